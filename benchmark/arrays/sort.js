@@ -0,0 +1,68 @@
+'use strict';
+var common = require('../common.js');
+var bench = common.createBenchmark(main, {
+  type: ['int', 'float', 'string', 'object'],
+  order: ['random', 'sorted', 'reversed', 'runs'],
+  compare: ['default', 'function'],
+  len: [1e3, 1e6],
+  n: [5e6]
+});
+
+// Arrays of ids, measurements, names and records sorted the way analytics and
+// reporting code sorts them, either in the default (string) order or with a
+// comparison function. Input that is partly ordered already, as appended logs
+// and merged result sets are, is sorted too.
+var makers = {
+  int: function(i, seed) { return seed % 1e6; },
+  float: function(i, seed) { return seed / 7; },
+  string: function(i, seed) { return 'user' + seed.toString(36); },
+  object: function(i, seed) { return { id: seed % 1e6, index: i }; }
+};
+
+var comparers = {
+  int: function(a, b) { return a - b; },
+  float: function(a, b) { return a - b; },
+  string: function(a, b) { return a < b ? -1 : a > b ? 1 : 0; },
+  object: function(a, b) { return a.id - b.id; }
+};
+
+function makeArray(type, order, len) {
+  var make = makers[type];
+  var arr = [];
+  var seed = 12345;
+  for (var i = 0; i < len; i++) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    switch (order) {
+      case 'random':
+        arr.push(make(i, seed));
+        break;
+      case 'sorted':
+        arr.push(make(i, i));
+        break;
+      case 'reversed':
+        arr.push(make(i, len - i));
+        break;
+      case 'runs':
+        // Sorted blocks of 100 with the odd out of place element
+        arr.push(make(i, seed % 100 === 0 ? seed : (i % 100) * len + i));
+        break;
+    }
+  }
+  return arr;
+}
+
+function main(conf) {
+  var len = +conf.len;
+  var passes = Math.max(1, Math.floor(+conf.n / len));
+  var source = makeArray(conf.type, conf.order, len);
+  var comparer = conf.compare === 'function' ? comparers[conf.type] : undefined;
+
+  var sorted;
+  bench.start();
+  for (var i = 0; i < passes; i++)
+    sorted = source.slice().sort(comparer);
+  bench.end(passes * len / 1e6);
+
+  if (sorted.length !== len)
+    throw new Error('unexpected result');
+}
@@ -0,0 +1,33 @@
+'use strict';
+var common = require('../common.js');
+var bench = common.createBenchmark(main, {
+  type: ['Uint8Array', 'Int32Array', 'Float64Array'],
+  len: [1024, 1024 * 1024],
+  n: [2e8]
+});
+
+// Element-wise map from one typed array into another of the same type, the
+// shape of the scale and offset passes run over decoded samples.
+function map(dst, src) {
+  for (var i = 0; i < src.length; i++)
+    dst[i] = src[i] * 3 + 1;
+}
+
+function main(conf) {
+  var clazz = global[conf.type];
+  var len = +conf.len;
+  var passes = Math.max(1, Math.floor(+conf.n / len));
+
+  var src = new clazz(len);
+  var dst = new clazz(len);
+  for (var i = 0; i < len; i++)
+    src[i] = i & 63;
+
+  bench.start();
+  for (var j = 0; j < passes; j++)
+    map(dst, src);
+  bench.end(passes * len / 1e6);
+
+  if (dst[len - 1] !== clazz.of(src[len - 1] * 3 + 1)[0])
+    throw new Error('unexpected result');
+}
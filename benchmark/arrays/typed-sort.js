@@ -0,0 +1,39 @@
+'use strict';
+var common = require('../common.js');
+var bench = common.createBenchmark(main, {
+  type: ['Uint8Array', 'Int32Array', 'Uint32Array', 'Float32Array',
+         'Float64Array'],
+  compare: ['default', 'function'],
+  len: [1e3, 1e6],
+  n: [5e6]
+});
+
+// Sorting sample buffers, in numeric order or with a comparison function, the
+// way medians and percentiles are computed.
+function main(conf) {
+  var clazz = global[conf.type];
+  var len = +conf.len;
+  var passes = Math.max(1, Math.floor(+conf.n / len));
+  var comparer = conf.compare === 'function' ?
+    function(a, b) { return a - b; } : undefined;
+
+  var source = new clazz(len);
+  var seed = 12345;
+  for (var i = 0; i < len; i++) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    source[i] = (seed - 0x40000000) / 4096;
+  }
+
+  var arr = new clazz(len);
+  bench.start();
+  for (var j = 0; j < passes; j++) {
+    arr.set(source);
+    arr.sort(comparer);
+  }
+  bench.end(passes * len / 1e6);
+
+  for (var k = 1; k < len; k++) {
+    if (arr[k - 1] > arr[k])
+      throw new Error('unexpected result');
+  }
+}
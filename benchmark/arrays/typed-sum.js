@@ -0,0 +1,35 @@
+'use strict';
+var common = require('../common.js');
+var bench = common.createBenchmark(main, {
+  type: ['Uint8Array', 'Int32Array', 'Float64Array'],
+  len: [1024, 1024 * 1024],
+  n: [2e8]
+});
+
+// Reduction over a typed array: every element is read once per pass, the
+// way checksums and statistics are computed over sample buffers.
+function sum(arr) {
+  var total = 0;
+  for (var i = 0; i < arr.length; i++)
+    total += arr[i];
+  return total;
+}
+
+function main(conf) {
+  var clazz = global[conf.type];
+  var len = +conf.len;
+  var passes = Math.max(1, Math.floor(+conf.n / len));
+
+  var arr = new clazz(len);
+  for (var i = 0; i < len; i++)
+    arr[i] = i & 127;
+
+  var total = 0;
+  bench.start();
+  for (var j = 0; j < passes; j++)
+    total += sum(arr);
+  bench.end(passes * len / 1e6);
+
+  if (total !== passes * sum(arr))
+    throw new Error('unexpected result');
+}
@@ -0,0 +1,47 @@
+'use strict';
+var common = require('../common.js');
+var bench = common.createBenchmark(main, {
+  inplace: ['true', 'false'],
+  len: [1024, 1024 * 1024],
+  n: [2e8]
+});
+
+// Byte-wise xor with a constant key over a Buffer, either in place or into a
+// second buffer, as done when scrambling or unscrambling payloads.
+function xorInPlace(buf, key) {
+  for (var i = 0; i < buf.length; i++)
+    buf[i] = buf[i] ^ key;
+}
+
+function xorInto(dst, src, key) {
+  for (var i = 0; i < src.length; i++)
+    dst[i] = src[i] ^ key;
+}
+
+function main(conf) {
+  var inplace = conf.inplace === 'true';
+  var len = +conf.len;
+  var passes = Math.max(1, Math.floor(+conf.n / len));
+
+  var src = Buffer.alloc(len);
+  var dst = Buffer.alloc(len);
+  for (var i = 0; i < len; i++)
+    src[i] = i & 255;
+
+  bench.start();
+  if (inplace) {
+    for (var j = 0; j < passes; j++)
+      xorInPlace(src, 0x5a);
+  } else {
+    for (var k = 0; k < passes; k++)
+      xorInto(dst, src, 0x5a);
+  }
+  bench.end(passes * len / 1e6);
+
+  var expected = (len - 1) & 255;
+  if (inplace && passes % 2 === 1)
+    expected ^= 0x5a;
+  var actual = inplace ? src[len - 1] : dst[len - 1] ^ 0x5a;
+  if (actual !== expected)
+    throw new Error('unexpected result');
+}
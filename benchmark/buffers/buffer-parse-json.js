@@ -0,0 +1,52 @@
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  method: ['toString', 'parseJSON'],
+  size: [1024, 64 * 1024, 1024 * 1024, 50 * 1024 * 1024],
+  n: [64 * 1024 * 1024]
+});
+
+// Builds an array of records the way API responses and config files look:
+// the same keys over and over, short strings, numbers and some non-ASCII text.
+function makePayload(size) {
+  const rows = [];
+  let length = 2;
+  for (let i = 0; length < size; i++) {
+    const row = JSON.stringify({
+      id: i,
+      name: 'user' + i,
+      email: 'user' + i + '@example.com',
+      active: i % 3 !== 0,
+      score: i * 1.5,
+      city: i % 2 ? 'Zürich' : 'São Paulo',
+      tags: ['alpha', 'beta']
+    });
+    rows.push(row);
+    length += row.length + 1;
+  }
+  return Buffer.from('[' + rows.join(',') + ']');
+}
+
+function main(conf) {
+  const buf = makePayload(+conf.size);
+  // Parse roughly the same number of bytes whatever the payload size is.
+  const n = Math.max(1, Math.floor(+conf.n / buf.length));
+  let result;
+
+  if (conf.method === 'parseJSON') {
+    bench.start();
+    for (var i = 0; i < n; i++)
+      result = Buffer.parseJSON(buf);
+    bench.end(n * buf.length / (1024 * 1024));
+  } else {
+    bench.start();
+    for (var j = 0; j < n; j++)
+      result = JSON.parse(buf.toString());
+    bench.end(n * buf.length / (1024 * 1024));
+  }
+
+  if (result.length === 0)
+    throw new Error('unexpected result');
+}
@@ -0,0 +1,56 @@
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  keys: ['literal', 'built', 'parsed'],
+  method: ['get', 'set'],
+  n: [1e6]
+});
+
+// Objects used as maps with string keys: a header map read with constant
+// keys, with keys built by concatenation and with keys taken apart from a
+// query string, the way querystring.parse produces them.
+const names = ['content-type', 'content-length', 'cache-control', 'etag',
+               'set-cookie', 'vary', 'x-response-time', 'date'];
+
+function makeKeys(kind) {
+  switch (kind) {
+    case 'literal':
+      return names.slice();
+    case 'built':
+      return names.map((name) => 'x-' + name.slice(2) + '-' + name.length);
+    case 'parsed':
+      return names.map((name, i) => `${name}=${i}`).join('&').split('&')
+                  .map((pair) => pair.slice(0, pair.indexOf('=')));
+  }
+}
+
+function main(conf) {
+  const n = +conf.n;
+  const keys = makeKeys(conf.keys);
+  const map = {};
+  for (var k = 0; k < keys.length; k++)
+    map[keys[k]] = k;
+  var result = 0;
+  var i;
+
+  bench.start();
+  switch (conf.method) {
+    case 'get':
+      for (i = 0; i < n; i++)
+        result += map[keys[i & 7]];
+      break;
+    case 'set':
+      for (i = 0; i < n; i++) {
+        const key = keys[i & 7];
+        map[key] = map[key] + 1;
+      }
+      result = map[keys[0]];
+      break;
+  }
+  bench.end(n);
+
+  if (!(result > 0))
+    throw new Error('unexpected result');
+}
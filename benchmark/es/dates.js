@@ -0,0 +1,74 @@
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  method: ['Date.parse', 'new Date', 'local fields', 'toString', 'Date.now'],
+  format: ['iso', 'utc', 'string'],
+  n: [1e5]
+});
+
+// Dates the way they travel as text: ISO strings from JSON, toUTCString's
+// format from HTTP headers and toString's format from logs. 'local fields'
+// and 'toString' convert the parsed dates to local time, and 'Date.now' reads
+// the clock, which does not depend on the format.
+function makeStrings(format) {
+  const strings = [];
+  for (var i = 0; i < 1000; i++) {
+    const date = new Date(1451606400000 + i * 3600013);
+    switch (format) {
+      case 'iso':
+        strings.push(date.toISOString());
+        break;
+      case 'utc':
+        strings.push(date.toUTCString());
+        break;
+      case 'string':
+        strings.push(date.toString());
+        break;
+    }
+  }
+  return strings;
+}
+
+function main(conf) {
+  const n = +conf.n;
+  const strings = makeStrings(conf.format);
+  const dates = strings.map((string) => new Date(string));
+  var sum = 0;
+  var i;
+
+  bench.start();
+  switch (conf.method) {
+    case 'Date.parse':
+      for (i = 0; i < n; i++)
+        sum += Date.parse(strings[i % 1000]);
+      break;
+    case 'new Date':
+      for (i = 0; i < n; i++)
+        sum += new Date(strings[i % 1000]).getTime();
+      break;
+    case 'local fields':
+      for (i = 0; i < n; i++)
+        sum += dates[i % 1000].getHours() + dates[i % 1000].getDate();
+      break;
+    case 'toString':
+      for (i = 0; i < n; i++)
+        sum += dates[i % 1000].toString().length;
+      break;
+    case 'Date.now':
+      for (i = 0; i < n; i++)
+        sum += Date.now() & 1;
+      break;
+  }
+  bench.end(n);
+
+  // The formats without milliseconds round to the second
+  for (i = 0; i < strings.length; i++) {
+    const expected = 1451606400000 + i * 3600013;
+    if (Math.abs(Date.parse(strings[i]) - expected) >= 1000)
+      throw new Error('unexpected result');
+  }
+  if (!isFinite(sum))
+    throw new Error('unexpected result');
+}
@@ -0,0 +1,81 @@
+'use strict';
+// Array destructuring goes through the iterator protocol, so every element
+// read allocates an iterator result unless the engine avoids it. Object
+// destructuring of a short-lived record is included for comparison.
+var common = require('../common.js');
+
+var bench = common.createBenchmark(main, {
+  method: ['swap', 'array', 'array-rest', 'object', 'return-pair'],
+  n: [2e7]
+});
+
+function pair(i) {
+  return [i, i + 1];
+}
+
+function runSwap(n) {
+  var a = 1;
+  var b = 2;
+  for (var i = 0; i < n; i++)
+    [a, b] = [b, a];
+  return a + b;
+}
+
+function runArray(n) {
+  var sum = 0;
+  var arr = [1, 2, 3];
+  for (var i = 0; i < n; i++) {
+    var [x, y, z] = arr;
+    sum += x + y + z;
+  }
+  return sum / n;
+}
+
+function runArrayRest(n) {
+  var sum = 0;
+  var arr = [1, 2, 3, 4];
+  for (var i = 0; i < n; i++) {
+    var [x, ...rest] = arr;
+    sum += x + rest.length;
+  }
+  return sum / n;
+}
+
+function runObject(n) {
+  var sum = 0;
+  for (var i = 0; i < n; i++) {
+    var { x, y } = { x: i, y: 1 };
+    sum += y;
+  }
+  return sum / n;
+}
+
+function runReturnPair(n) {
+  var sum = 0;
+  for (var i = 0; i < n; i++) {
+    var [lo, hi] = pair(i);
+    sum += hi - lo;
+  }
+  return sum / n;
+}
+
+function main(conf) {
+  var n = conf.n | 0;
+  var fn;
+  var expected;
+  switch (conf.method) {
+    case 'swap': fn = runSwap; expected = 3; break;
+    case 'array': fn = runArray; expected = 6; break;
+    case 'array-rest': fn = runArrayRest; expected = 4; break;
+    case 'object': fn = runObject; expected = 1; break;
+    case 'return-pair': fn = runReturnPair; expected = 1; break;
+    default: throw new Error('Unexpected method');
+  }
+
+  bench.start();
+  var result = fn(n);
+  bench.end(n);
+
+  if (result !== expected)
+    throw new Error('unexpected result');
+}
@@ -0,0 +1,81 @@
+'use strict';
+// for...of over arrays. Every step of the loop calls the array iterator's
+// next() and reads value and done off of a fresh result object.
+var common = require('../common.js');
+
+var bench = common.createBenchmark(main, {
+  method: ['for', 'for-of', 'for-of-keys', 'for-of-entries'],
+  type: ['int', 'double', 'object'],
+  len: [16, 1024],
+  n: [5e7]
+});
+
+function makeArray(type, len) {
+  var a = new Array(len);
+  for (var i = 0; i < len; i++) {
+    if (type === 'int')
+      a[i] = i;
+    else if (type === 'double')
+      a[i] = i + 0.5;
+    else
+      a[i] = { v: i };
+  }
+  return a;
+}
+
+function value(x) {
+  return typeof x === 'object' ? x.v : x;
+}
+
+function sumFor(a) {
+  var sum = 0;
+  for (var i = 0; i < a.length; i++)
+    sum += value(a[i]);
+  return sum;
+}
+
+function sumForOf(a) {
+  var sum = 0;
+  for (var x of a)
+    sum += value(x);
+  return sum;
+}
+
+function sumForOfKeys(a) {
+  var sum = 0;
+  for (var i of a.keys())
+    sum += value(a[i]);
+  return sum;
+}
+
+function sumForOfEntries(a) {
+  var sum = 0;
+  for (var e of a.entries())
+    sum += value(e[1]);
+  return sum;
+}
+
+function main(conf) {
+  var len = conf.len | 0;
+  var iterations = Math.max(1, Math.floor(conf.n / len));
+  var a = makeArray(conf.type, len);
+
+  var fn;
+  switch (conf.method) {
+    case 'for': fn = sumFor; break;
+    case 'for-of': fn = sumForOf; break;
+    case 'for-of-keys': fn = sumForOfKeys; break;
+    case 'for-of-entries': fn = sumForOfEntries; break;
+    default: throw new Error('Unexpected method');
+  }
+
+  var expected = sumFor(a);
+  var sum = 0;
+  bench.start();
+  for (var i = 0; i < iterations; i++)
+    sum = fn(a);
+  bench.end(iterations * len);
+
+  if (sum !== expected)
+    throw new Error('unexpected result');
+}
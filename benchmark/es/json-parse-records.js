@@ -0,0 +1,37 @@
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  keys: [4, 16, 48],
+  records: [10000],
+  n: [20]
+});
+
+// An array of records that all have the same keys in the same order, the way
+// REST responses usually look.
+function makePayload(keys, records) {
+  const rows = [];
+  for (let i = 0; i < records; i++) {
+    const row = {};
+    for (let k = 0; k < keys; k++)
+      row['field' + k] = k % 3 === 0 ? i + k : k % 3 === 1 ? 'v' + i : true;
+    rows.push(row);
+  }
+  return JSON.stringify(rows);
+}
+
+function main(conf) {
+  const records = +conf.records;
+  const json = makePayload(+conf.keys, records);
+  const n = +conf.n;
+  let result;
+
+  bench.start();
+  for (var i = 0; i < n; i++)
+    result = JSON.parse(json);
+  bench.end(n * records);
+
+  if (result.length !== records)
+    throw new Error('unexpected result');
+}
@@ -0,0 +1,94 @@
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  payload: ['twitter', 'canada'],
+  indent: [0, 2],
+  n: [64 * 1024 * 1024]
+});
+
+// Generated stand-ins for the usual JSON parser corpora, a few hundred KB each.
+// 'twitter' is a timeline: records with long free-text strings, URLs with
+// quoted HTML attributes, non-ASCII text and nested user objects.
+// 'canada' is GeoJSON: a few huge arrays of coordinate pairs.
+const payloads = {
+  twitter: function() {
+    const statuses = [];
+    for (let i = 0; statuses.length < 320; i++) {
+      statuses.push({
+        created_at: 'Sun Aug 31 00:29:' + (10 + i % 50) + ' +0000 2014',
+        id: 505874924095815700 + i,
+        id_str: String(505874924095815700 + i),
+        text: 'RT @user' + i + ': Lorem ipsum dolor sit amet, consectetur ' +
+              'adipiscing elit, sed do eiusmod tempor incididunt ut labore ' +
+              (i % 4 ? 'et dolore magna aliqua. #hashtag' : 'こんにちは世界 ✨') +
+              (i % 7 ? '' : ' "quoted"\n'),
+        source: '<a href="https://example.com/app/' + i + '" rel="nofollow">' +
+                'Example client</a>',
+        truncated: false,
+        user: {
+          id: 1186275104 + i,
+          name: 'Display name ' + i,
+          screen_name: 'user' + i,
+          location: i % 3 ? 'San Francisco, CA' : '',
+          description: 'Long profile description that goes on for a while ' +
+                       'and mentions a few interests, links and emoji 🎉',
+          url: 'http://t.co/' + i.toString(36) + 'abcdef',
+          followers_count: i * 37,
+          friends_count: i * 11,
+          verified: i % 10 === 0,
+          profile_image_url: 'http://pbs.twimg.com/profile_images/' + i +
+                             '/abcdefgh_normal.jpeg'
+        },
+        entities: {
+          hashtags: [{ text: 'hashtag', indices: [60, 68] }],
+          urls: [],
+          user_mentions: [{ screen_name: 'user' + i, indices: [3, 12] }]
+        },
+        retweet_count: i % 100,
+        favorite_count: i % 13,
+        lang: i % 4 ? 'en' : 'ja'
+      });
+    }
+    return { statuses: statuses };
+  },
+  canada: function() {
+    const rings = [];
+    let x = -65.613616999999977;
+    let y = 43.420273000000009;
+    for (let r = 0; r < 20; r++) {
+      const ring = [];
+      for (let p = 0; p < 600; p++) {
+        x += Math.sin(r * 600 + p) * 0.01;
+        y += Math.cos(r * 600 + p) * 0.01;
+        ring.push([x, y]);
+      }
+      rings.push(ring);
+    }
+    return {
+      type: 'FeatureCollection',
+      features: [{
+        type: 'Feature',
+        properties: { name: 'Canada' },
+        geometry: { type: 'Polygon', coordinates: rings }
+      }]
+    };
+  }
+};
+
+function main(conf) {
+  const indent = +conf.indent;
+  const json = JSON.stringify(payloads[conf.payload](), null, indent);
+  // Parse roughly the same number of characters for every payload.
+  const n = Math.max(1, Math.floor(+conf.n / json.length));
+  let result;
+
+  bench.start();
+  for (var i = 0; i < n; i++)
+    result = JSON.parse(json);
+  bench.end(n * json.length / (1024 * 1024));
+
+  if (typeof result !== 'object')
+    throw new Error('unexpected result');
+}
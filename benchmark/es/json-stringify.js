@@ -0,0 +1,84 @@
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  method: ['stringify', 'Buffer.from'],
+  payload: ['response', 'records'],
+  n: [2000]
+});
+
+// 'response' is what a typical API handler sends: an envelope with paging
+// data around a page of nested resources. 'records' is a flat list of
+// objects that all have the same keys.
+const payloads = {
+  response: function() {
+    const items = [];
+    for (let i = 0; i < 50; i++) {
+      items.push({
+        id: 1000 + i,
+        type: 'order',
+        status: i % 3 ? 'shipped' : 'pending',
+        total: Math.round(i * 1234.5) / 100,
+        currency: 'EUR',
+        createdAt: '2016-03-' + (10 + i % 20) + 'T12:34:56.000Z',
+        customer: {
+          id: 200 + i,
+          name: 'Customer ' + i,
+          email: 'c' + i + '@example.com'
+        },
+        lines: [
+          { sku: 'SKU-' + i, quantity: 1 + i % 4, price: 9.99 },
+          { sku: 'SKU-X', quantity: 2, price: 19.5 }
+        ],
+        notes: i % 5 ? null : 'Leave at the door, "please"'
+      });
+    }
+    return {
+      data: items,
+      page: 1,
+      pageSize: 50,
+      total: 1234,
+      links: { next: '/orders?page=2' }
+    };
+  },
+  records: function() {
+    const rows = [];
+    for (let i = 0; i < 500; i++) {
+      rows.push({
+        id: i,
+        name: 'user' + i,
+        active: i % 2 === 0,
+        score: i / 7,
+        city: 'Zürich'
+      });
+    }
+    return rows;
+  }
+};
+
+function main(conf) {
+  const n = +conf.n;
+  const value = payloads[conf.payload]();
+  let result;
+
+  switch (conf.method) {
+    case 'stringify':
+      bench.start();
+      for (var i = 0; i < n; i++)
+        result = JSON.stringify(value);
+      bench.end(n);
+      break;
+    case 'Buffer.from':
+      bench.start();
+      for (var j = 0; j < n; j++)
+        result = Buffer.from(JSON.stringify(value));
+      bench.end(n);
+      break;
+    default:
+      throw new Error('Unexpected method');
+  }
+
+  if (result.length === 0)
+    throw new Error('unexpected result');
+}
@@ -0,0 +1,83 @@
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  type: ['Map', 'Set'],
+  op: ['insert', 'lookup', 'iterate', 'delete'],
+  keys: ['int', 'string', 'object'],
+  size: [1e3, 1e6],
+  n: [2e6]
+});
+
+// Maps and sets used as in-memory caches and indexes: filled, probed,
+// walked in insertion order and emptied again.
+function makeKeys(kind, size) {
+  const keys = new Array(size);
+  for (var i = 0; i < size; i++) {
+    switch (kind) {
+      case 'int':
+        keys[i] = i * 7;
+        break;
+      case 'string':
+        keys[i] = 'key:' + i;
+        break;
+      case 'object':
+        keys[i] = { id: i };
+        break;
+    }
+  }
+  return keys;
+}
+
+function fill(type, keys) {
+  const collection = new global[type]();
+  if (type === 'Map') {
+    for (var i = 0; i < keys.length; i++)
+      collection.set(keys[i], i);
+  } else {
+    for (var j = 0; j < keys.length; j++)
+      collection.add(keys[j]);
+  }
+  return collection;
+}
+
+function main(conf) {
+  const size = +conf.size;
+  const passes = Math.max(1, Math.floor(+conf.n / size));
+  const keys = makeKeys(conf.keys, size);
+  var collection = fill(conf.type, keys);
+  var result = 0;
+  var i, j;
+
+  bench.start();
+  switch (conf.op) {
+    case 'insert':
+      for (i = 0; i < passes; i++)
+        result += fill(conf.type, keys).size;
+      break;
+    case 'lookup':
+      for (i = 0; i < passes; i++) {
+        for (j = 0; j < size; j++)
+          result += collection.has(keys[j]);
+      }
+      break;
+    case 'iterate':
+      for (i = 0; i < passes; i++) {
+        for (const entry of collection)
+          result += entry !== undefined;
+      }
+      break;
+    case 'delete':
+      for (i = 0; i < passes; i++) {
+        collection = fill(conf.type, keys);
+        for (j = 0; j < size; j++)
+          result += collection.delete(keys[j]);
+      }
+      break;
+  }
+  bench.end(passes * size / 1e6);
+
+  if (result !== passes * size)
+    throw new Error('unexpected result');
+}
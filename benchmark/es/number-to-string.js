@@ -0,0 +1,68 @@
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  values: ['coordinates', 'prices', 'ratios', 'large', 'repeated'],
+  method: ['String', 'concat', 'JSON.stringify'],
+  n: [1e5]
+});
+
+// Doubles of the kinds that end up in logs and JSON payloads: geographic
+// coordinates, prices with two decimals, quotients with 16 or 17 significant
+// digits, integers beyond the int32 range and a few values converted over
+// and over again.
+function makeValues(kind) {
+  const values = [];
+  for (var i = 0; i < 1000; i++) {
+    switch (kind) {
+      case 'coordinates':
+        values.push(Math.round((47.3769 + i * 0.000137) * 1e6) / 1e6);
+        break;
+      case 'prices':
+        values.push((i * 137 % 100000) / 100 + 0.01);
+        break;
+      case 'ratios':
+        values.push((i + 1) / 7 + Math.PI * i);
+        break;
+      case 'large':
+        values.push(1451606400000 + i * 86400013);
+        break;
+      case 'repeated':
+        values.push([0.5, 1.25, 99.99, 3.14159][i & 3]);
+        break;
+    }
+  }
+  return values;
+}
+
+function main(conf) {
+  const n = +conf.n;
+  const values = makeValues(conf.values);
+  var length = 0;
+  var i;
+
+  bench.start();
+  switch (conf.method) {
+    case 'String':
+      for (i = 0; i < n; i++)
+        length += String(values[i % 1000]).length;
+      break;
+    case 'concat':
+      for (i = 0; i < n; i++)
+        length += ('' + values[i % 1000] + ',').length;
+      break;
+    case 'JSON.stringify':
+      for (i = 0; i < n; i += 100)
+        length += JSON.stringify(values.slice(i % 1000, i % 1000 + 100)).length;
+      break;
+  }
+  bench.end(n);
+
+  for (i = 0; i < values.length; i++) {
+    if (+String(values[i]) !== values[i])
+      throw new Error('unexpected result');
+  }
+  if (!(length > 0))
+    throw new Error('unexpected result');
+}
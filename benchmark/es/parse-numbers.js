@@ -0,0 +1,88 @@
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  method: ['JSON.parse', 'parseFloat', 'Number', 'parseInt'],
+  values: ['prices', 'coordinates', 'ratios', 'ids'],
+  n: [100]
+});
+
+// Numbers the way they arrive in text: prices with two decimals, geographic
+// coordinates, quotients printed with all 17 significant digits, and 64-bit
+// identifiers and timestamps. 'JSON.parse' parses them as one JSON array,
+// the other methods convert the fields of CSV lines one by one.
+function makeValues(kind) {
+  const values = [];
+  for (var i = 0; i < 1000; i++) {
+    switch (kind) {
+      case 'prices':
+        values.push(((i * 7919) % 100000 / 100).toFixed(2));
+        break;
+      case 'coordinates':
+        values.push((-122.419416 + i * 0.001373).toFixed(6));
+        break;
+      case 'ratios':
+        values.push(String((i + 1) / 7 + Math.E * i));
+        break;
+      case 'ids':
+        values.push('1451606400' + String(1e8 + i * 7919).slice(1));
+        break;
+    }
+  }
+  return values;
+}
+
+function main(conf) {
+  const n = +conf.n;
+  const values = makeValues(conf.values);
+  const json = '[' + values.join(',') + ']';
+  const lines = [];
+  for (var l = 0; l < values.length; l += 4)
+    lines.push(values.slice(l, l + 4).join(','));
+  var sum = 0;
+  var i, j, k, fields;
+
+  bench.start();
+  switch (conf.method) {
+    case 'JSON.parse':
+      for (i = 0; i < n; i++)
+        sum += JSON.parse(json)[i % values.length];
+      break;
+    case 'parseFloat':
+      for (i = 0; i < n; i++) {
+        for (j = 0; j < lines.length; j++) {
+          fields = lines[j].split(',');
+          for (k = 0; k < fields.length; k++)
+            sum += parseFloat(fields[k]);
+        }
+      }
+      break;
+    case 'Number':
+      for (i = 0; i < n; i++) {
+        for (j = 0; j < lines.length; j++) {
+          fields = lines[j].split(',');
+          for (k = 0; k < fields.length; k++)
+            sum += Number(fields[k]);
+        }
+      }
+      break;
+    case 'parseInt':
+      for (i = 0; i < n; i++) {
+        for (j = 0; j < lines.length; j++) {
+          fields = lines[j].split(',');
+          for (k = 0; k < fields.length; k++)
+            sum += parseInt(fields[k], 10);
+        }
+      }
+      break;
+  }
+  bench.end(n * values.length);
+
+  for (i = 0; i < values.length; i++) {
+    if (parseFloat(values[i]) !== +values[i])
+      throw new Error('unexpected result');
+  }
+  if (!isFinite(sum))
+    throw new Error('unexpected result');
+}
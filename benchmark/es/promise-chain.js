@@ -0,0 +1,51 @@
+'use strict';
+// Throughput of promise reactions when many chains are in flight at once, so
+// that the microtask queue holds one job per chain. Every step of every chain
+// goes through the queue once.
+var common = require('../common.js');
+
+var bench = common.createBenchmark(main, {
+  type: ['then', 'step'],
+  chains: [1, 100, 10000],
+  n: [1e6]
+});
+
+function thenChain(steps) {
+  var p = Promise.resolve(0);
+  for (var i = 0; i < steps; i++)
+    p = p.then(function(v) { return v + 1; });
+  return p;
+}
+
+function stepChain(steps) {
+  // The shape of an async function awaiting in a loop: each step schedules
+  // the next one on an already resolved promise.
+  return new Promise(function(resolve) {
+    var count = 0;
+    function step(v) {
+      count = v;
+      if (count === steps)
+        return resolve(count);
+      Promise.resolve(count + 1).then(step);
+    }
+    step(0);
+  });
+}
+
+function main(conf) {
+  var chains = conf.chains | 0;
+  var steps = Math.max(1, Math.floor(conf.n / chains));
+  var fn = conf.type === 'then' ? thenChain : stepChain;
+
+  bench.start();
+  var results = new Array(chains);
+  for (var i = 0; i < chains; i++)
+    results[i] = fn(steps);
+  Promise.all(results).then(function(values) {
+    bench.end(chains * steps);
+    for (var j = 0; j < values.length; j++) {
+      if (values[j] !== steps)
+        throw new Error('unexpected result');
+    }
+  });
+}
@@ -0,0 +1,63 @@
+'use strict';
+// Chains of already resolved promises. Each step allocates the promise, its
+// reactions and the resolving functions, most of which die right away.
+var common = require('../common.js');
+
+var bench = common.createBenchmark(main, {
+  method: ['then-chain', 'resolve-then', 'all'],
+  n: [1e6]
+});
+
+function thenChain(n, done) {
+  var p = Promise.resolve(0);
+  for (var i = 0; i < n; i++)
+    p = p.then(function(v) { return v + 1; });
+  p.then(done);
+}
+
+function resolveThen(n, done) {
+  var count = 0;
+  function step(v) {
+    count += v;
+    if (count === n)
+      done(count);
+  }
+  for (var i = 0; i < n; i++)
+    Promise.resolve(1).then(step);
+}
+
+function all(n, done) {
+  var batch = 16;
+  var promises = new Array(batch);
+  var rounds = n / batch;
+  var count = 0;
+  function next() {
+    if (count === rounds)
+      return done(count * batch);
+    for (var i = 0; i < batch; i++)
+      promises[i] = Promise.resolve(i);
+    Promise.all(promises).then(function(values) {
+      count++;
+      next();
+    });
+  }
+  next();
+}
+
+function main(conf) {
+  var n = conf.n | 0;
+  var fn;
+  switch (conf.method) {
+    case 'then-chain': fn = thenChain; break;
+    case 'resolve-then': fn = resolveThen; break;
+    case 'all': fn = all; break;
+    default: throw new Error('Unexpected method');
+  }
+
+  bench.start();
+  fn(n, function(result) {
+    bench.end(n);
+    if (result !== n)
+      throw new Error('unexpected result');
+  });
+}
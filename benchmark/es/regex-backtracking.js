@@ -0,0 +1,47 @@
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  pattern: ['nested', 'alternation', 'log', 'route'],
+  n: [1e4]
+});
+
+// Patterns which make a backtracking matcher retry the same input over and
+// over when they fail, next to the kind of patterns servers run on every
+// request. 'nested' and 'alternation' fail on a long run of 'a's.
+const cases = {
+  nested: {
+    re: /(a+)+b/,
+    input: 'a'.repeat(16) + 'c'
+  },
+  alternation: {
+    re: /(?:a|aa)*c$/,
+    input: 'a'.repeat(24) + 'b'
+  },
+  log: {
+    re: /^(\S+) \S+ \S+ \[([^\]]+)\] "(?:GET|POST|PUT) ([^ "]*)[^"]*" (\d+)/,
+    input: '127.0.0.1 - frank [10/Oct/2000:13:55:36 -0700] ' +
+           '"GET /apache_pb.gif HTTP/1.0" 200 2326 "http://example.com/" ' +
+           '"Mozilla/4.08 [en] (Win98; I ;Nav)"'
+  },
+  route: {
+    re: /^\/(?:api\/)?users\/([^/]+?)(?:\/posts\/([^/]+?))?\/?$/i,
+    input: '/api/users/1234567890/posts/hello-world-of-regular-expressions/'
+  }
+};
+
+function main(conf) {
+  const n = +conf.n;
+  const re = cases[conf.pattern].re;
+  const input = cases[conf.pattern].input;
+  let result;
+
+  bench.start();
+  for (var i = 0; i < n; i++)
+    result = re.exec(input);
+  bench.end(n);
+
+  if (result === undefined)
+    throw new Error('unexpected result');
+}
@@ -0,0 +1,44 @@
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  pattern: ['token', 'header', 'date', 'search'],
+  n: [1e5]
+});
+
+// Patterns which never backtrack, of the kind servers run on every request.
+// Once they are hot they run as machine code instead of in the interpreter.
+const cases = {
+  token: {
+    re: /^[\^_`a-zA-Z\-0-9!#$%&'*+.|~]+$/,
+    input: 'X-Forwarded-For-Some-Long-Custom-Header-Name'
+  },
+  header: {
+    re: /^([^:]+):[ \t]*([^\r\n]*)$/,
+    input: 'Content-Type: application/json; charset=utf-8'
+  },
+  date: {
+    re: /^(\d{4})-(\d{2})-(\d{2})T(\d{2}):(\d{2}):(\d{2})Z$/,
+    input: '2016-02-29T13:55:36Z'
+  },
+  search: {
+    re: /charset=([\w-]+)/,
+    input: 'text/html; version=1; format=flowed; delsp=yes; charset=utf-8'
+  }
+};
+
+function main(conf) {
+  const n = +conf.n;
+  const re = cases[conf.pattern].re;
+  const input = cases[conf.pattern].input;
+  let result;
+
+  bench.start();
+  for (var i = 0; i < n; i++)
+    result = re.exec(input);
+  bench.end(n);
+
+  if (result === null)
+    throw new Error('unexpected result');
+}
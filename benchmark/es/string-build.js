@@ -0,0 +1,87 @@
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  build: ['append', 'template', 'prepend', 'wrap'],
+  method: ['build', 'write', 'Buffer.from'],
+  n: [1e4]
+});
+
+// Strings built piece by piece the way response headers and rendered
+// templates are, then either left alone, encoded into a Buffer that already
+// exists (what a socket write does) or into a new one.
+const headers = [
+  ['Content-Type', 'text/html; charset=utf-8'],
+  ['Content-Length', '5123'],
+  ['Cache-Control', 'private, max-age=0, must-revalidate'],
+  ['ETag', 'W/"1403-4f3a8b2c"'],
+  ['Set-Cookie', 'session=7f9a2c1d8e6b4a5f; Path=/; HttpOnly'],
+  ['Vary', 'Accept-Encoding'],
+  ['X-Response-Time', '12ms'],
+  ['Date', 'Mon, 01 Feb 2016 12:34:56 GMT']
+];
+
+const rows = [];
+for (var i = 0; i < 40; i++)
+  rows.push({ id: i, name: 'Item ' + i, price: (i * 3.75).toFixed(2) });
+
+const builders = {
+  append: function() {
+    var s = 'HTTP/1.1 200 OK\r\n';
+    for (var i = 0; i < headers.length; i++)
+      s += headers[i][0] + ': ' + headers[i][1] + '\r\n';
+    return s + '\r\n';
+  },
+  template: function() {
+    var s = '<table>';
+    for (var i = 0; i < rows.length; i++) {
+      const row = rows[i];
+      s += `<tr><td>${row.id}</td><td>${row.name}</td>` +
+           `<td>€${row.price}</td></tr>`;
+    }
+    return s + '</table>';
+  },
+  prepend: function() {
+    var s = '';
+    for (var i = rows.length - 1; i >= 0; i--)
+      s = '<li>' + rows[i].name + '</li>' + s;
+    return s;
+  },
+  wrap: function() {
+    var s = '';
+    for (var i = 0; i < rows.length; i++)
+      s = '<div>' + s + rows[i].name + '</div>';
+    return s;
+  }
+};
+
+function main(conf) {
+  const n = +conf.n;
+  const build = builders[conf.build];
+  const buffer = Buffer.allocUnsafe(3 * build().length);
+  var result;
+  var i;
+
+  bench.start();
+  switch (conf.method) {
+    case 'build':
+      for (i = 0; i < n; i++)
+        result = build().length;
+      break;
+    case 'write':
+      for (i = 0; i < n; i++)
+        result = buffer.write(build());
+      break;
+    case 'Buffer.from':
+      for (i = 0; i < n; i++)
+        result = Buffer.from(build()).length;
+      break;
+  }
+  bench.end(n);
+
+  const expected = conf.method === 'build' ? build().length :
+                                             Buffer.byteLength(build());
+  if (result !== expected)
+    throw new Error('unexpected result');
+}
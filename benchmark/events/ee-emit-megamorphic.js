@@ -0,0 +1,28 @@
+'use strict';
+var common = require('../common.js');
+var EventEmitter = require('events').EventEmitter;
+
+var bench = common.createBenchmark(main, {shapes: [1, 8, 64, 128], n: [2e6]});
+
+function main(conf) {
+  var n = conf.n | 0;
+  var shapes = conf.shapes | 0;
+
+  // Emitters with different sets of own properties, the way streams, sockets
+  // and user subclasses extend EventEmitter, so that the property accesses in
+  // emit() see many object shapes.
+  var emitters = [];
+  for (var i = 0; i < shapes; i += 1) {
+    var ee = new EventEmitter();
+    for (var j = 0; j < i; j += 1)
+      ee['field' + j] = j;
+    ee.on('dummy', function() {});
+    emitters.push(ee);
+  }
+
+  bench.start();
+  for (var k = 0; k < n; k += 1) {
+    emitters[k % shapes].emit('dummy');
+  }
+  bench.end(n);
+}
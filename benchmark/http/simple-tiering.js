@@ -0,0 +1,58 @@
+'use strict';
+// Runs the http/simple.js workload against a fresh server, either right after
+// it starts listening (phase=warmup, a proxy for time-to-peak) or after a
+// warm-up period (phase=steady), with and without adaptive execution-mode
+// tiering (node-chakracore only).
+var common = require('../common.js');
+var PORT = common.PORT;
+var spawn = require('child_process').spawn;
+
+var cluster = require('cluster');
+if (cluster.isMaster) {
+  var bench = common.createBenchmark(main, {
+    tiering: ['default', 'adaptive'],
+    phase: ['warmup', 'steady'],
+    // unicode confuses ab on os x.
+    type: ['bytes', 'buffer'],
+    length: [4, 1024],
+    c: [50]
+  });
+} else {
+  require('../http_simple.js');
+}
+
+function main(conf) {
+  process.env.PORT = PORT;
+  cluster.setupMaster({
+    execArgv: conf.tiering === 'adaptive' ? ['--adaptive-tiering'] : []
+  });
+  var worker = cluster.fork();
+
+  cluster.on('listening', function() {
+    var path = '/' + conf.type + '/' + conf.length + '/0';
+    var args = ['-d', '3s', '-t', 8, '-c', conf.c];
+
+    if (conf.phase === 'warmup') {
+      measure();
+      return;
+    }
+
+    // Load the server without measuring first, so that the measurement only
+    // sees the code that the tiering policy settles on.
+    var url = 'http://127.0.0.1:' + PORT + path;
+    var warmup = spawn('wrk', ['-d', '10s', '-t', 8, '-c', conf.c, url]);
+    warmup.on('close', function(code) {
+      if (code) {
+        console.error('wrk failed with ' + code);
+        process.exit(code);
+      }
+      measure();
+    });
+
+    function measure() {
+      bench.http(path, args, function() {
+        worker.destroy();
+      });
+    }
+  });
+}
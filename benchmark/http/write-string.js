@@ -0,0 +1,38 @@
+// Responses written as strings built by concatenation, the way rendered
+// templates are, next to the same text written as one flat string.
+'use strict';
+
+var common = require('../common.js');
+
+var bench = common.createBenchmark(main, {
+  type: ['flat', 'built'],
+  rows: [10, 100, 1000],
+  c: [100]
+});
+
+function render(rows) {
+  var s = '<!DOCTYPE html><html><body><ul>';
+  for (var i = 0; i < rows; i++)
+    s += '<li id="row-' + i + '">Row ' + i + ' – ' + (i * 7 % 13) + '</li>';
+  return s + '</ul></body></html>';
+}
+
+function main(conf) {
+  const http = require('http');
+  const rows = conf.rows | 0;
+  const flat = Buffer.from(render(rows)).toString();
+
+  var args = ['-d', '10s', '-t', 8, '-c', conf.c];
+
+  var server = http.createServer(function(req, res) {
+    res.setHeader('Content-Type', 'text/html; charset=utf-8');
+    res.write(conf.type === 'flat' ? flat : render(rows));
+    res.end();
+  });
+
+  server.listen(common.PORT, function() {
+    bench.http('/', args, function() {
+      server.close();
+    });
+  });
+}
@@ -0,0 +1,33 @@
+'use strict';
+// Nested loops run once. The inner loop becomes hot first and is compiled on
+// its own; the outer loop keeps calling into it until it is hot as well.
+var common = require('../common.js');
+
+var bench = common.createBenchmark(main, {
+  size: [300]
+});
+
+function main(conf) {
+  var size = conf.size | 0;
+  var a = new Float64Array(size * size);
+  var b = new Float64Array(size * size);
+  var c = new Float64Array(size * size);
+  for (var i = 0; i < a.length; i++) {
+    a[i] = i % 17;
+    b[i] = i % 23;
+  }
+
+  bench.start();
+  for (var row = 0; row < size; row++) {
+    for (var col = 0; col < size; col++) {
+      var sum = 0;
+      for (var k = 0; k < size; k++)
+        sum += a[row * size + k] * b[k * size + col];
+      c[row * size + col] = sum;
+    }
+  }
+  bench.end(size * size * size);
+
+  if (!(c[c.length - 1] > 0))
+    throw new Error('unexpected result');
+}
@@ -0,0 +1,42 @@
+'use strict';
+// One long loop in a function that is called only once, like a batch job that
+// transforms all of its records in a single pass. Only loop-body JIT can
+// optimize it.
+var common = require('../common.js');
+
+var bench = common.createBenchmark(main, {
+  records: [1e5],
+  passes: [50]
+});
+
+function makeRecords(count) {
+  var records = new Array(count);
+  for (var i = 0; i < count; i++) {
+    records[i] = {
+      id: i,
+      price: (i % 977) / 10,
+      quantity: i % 13,
+      region: 'r' + (i % 7)
+    };
+  }
+  return records;
+}
+
+function main(conf) {
+  var records = makeRecords(conf.records | 0);
+  var passes = conf.passes | 0;
+  var totals = {};
+
+  bench.start();
+  for (var p = 0; p < passes; p++) {
+    for (var i = 0; i < records.length; i++) {
+      var r = records[i];
+      var amount = r.price * r.quantity;
+      totals[r.region] = (totals[r.region] || 0) + amount;
+    }
+  }
+  bench.end(passes * records.length);
+
+  if (!(totals.r0 > 0))
+    throw new Error('unexpected result');
+}
@@ -0,0 +1,34 @@
+'use strict';
+// A function that is called often enough with short loops to be compiled by
+// the simple JIT, and then gets one long-running call. The long call should
+// move into an optimized loop body instead of finishing in the lower tier.
+var common = require('../common.js');
+
+var bench = common.createBenchmark(main, {
+  warmup: [0, 100, 1000],
+  n: [3e7]
+});
+
+function checksum(n, seed) {
+  var h = seed | 0;
+  for (var i = 0; i < n; i++) {
+    h = (h * 31 + (i ^ (h >>> 7))) | 0;
+  }
+  return h;
+}
+
+function main(conf) {
+  var warmup = conf.warmup | 0;
+  var n = conf.n | 0;
+  var h = 0;
+
+  for (var i = 0; i < warmup; i++)
+    h ^= checksum(100, i);
+
+  bench.start();
+  h ^= checksum(n, h);
+  bench.end(n);
+
+  if (h === 0x7fffffff)
+    console.log(h);
+}
@@ -0,0 +1,86 @@
+'use strict';
+// Measures how much of a short-lived process' warm-up is saved by reusing
+// the JIT type profiles of an earlier run (node-chakracore only).
+var path = require('path');
+var os = require('os');
+var spawn = require('child_process').spawn;
+
+if (process.argv[2] === 'child') {
+  workload();
+  return;
+}
+
+var common = require('../common.js');
+
+var bench = common.createBenchmark(main, {
+  cache: ['off', 'on'],
+  dur: [5]
+});
+
+function workload() {
+  function Point(x, y) {
+    this.x = x;
+    this.y = y;
+  }
+
+  function length(p) {
+    return Math.sqrt(p.x * p.x + p.y * p.y);
+  }
+
+  function sum(points) {
+    var total = 0;
+    for (var i = 0; i < points.length; i++)
+      total += length(points[i]);
+    return total;
+  }
+
+  var points = [];
+  for (var i = 0; i < 1000; i++)
+    points.push(new Point(i, i / 2));
+
+  var total = 0;
+  for (var j = 0; j < 200; j++)
+    total += sum(points);
+
+  if (!(total > 0))
+    throw new Error('unexpected result');
+}
+
+function main(conf) {
+  var dur = +conf.dur;
+  var args = [__filename, 'child'];
+  if (conf.cache === 'on') {
+    var dir = path.join(os.tmpdir(), 'node-jit-profile-cache-' + process.pid);
+    args.unshift('--jit-profile-cache=' + dir);
+  }
+
+  var go = true;
+  var runs = 0;
+
+  // The first run fills the cache, so it is not part of the measurement.
+  run(function() {
+    setTimeout(function() {
+      go = false;
+    }, dur * 1000);
+
+    bench.start();
+    run(next);
+  });
+
+  function next() {
+    runs++;
+    if (go)
+      run(next);
+    else
+      bench.end(runs);
+  }
+
+  function run(cb) {
+    var child = spawn(process.execPath, args);
+    child.on('exit', function(exitCode) {
+      if (exitCode !== 0)
+        throw new Error('child exited with code ' + exitCode);
+      cb();
+    });
+  }
+}
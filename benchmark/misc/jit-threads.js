@@ -0,0 +1,52 @@
+'use strict';
+// Measures how quickly a burst of hot functions gets through the background
+// JIT for a given number of JIT threads (node-chakracore only). The child
+// makes many distinct functions hot at once, much like a server right after
+// it starts, and keeps calling them until all have been compiled and run.
+var spawn = require('child_process').spawn;
+
+if (process.argv[2] === 'child') {
+  workload(+process.argv[3]);
+  return;
+}
+
+var common = require('../common.js');
+
+var bench = common.createBenchmark(main, {
+  threads: [1, 2, 4, 8],
+  functions: [500]
+});
+
+function workload(count) {
+  var fns = [];
+  for (var i = 0; i < count; i++) {
+    // Distinct source text, so that every function is compiled on its own.
+    fns.push(new Function('o', 'n',
+      'var s = ' + i + ';' +
+      'for (var j = 0; j < n; j++) s += o.x * j + o.y ^ ' + i + ';' +
+      'return s;'));
+  }
+
+  var o = { x: 3, y: 4 };
+  var total = 0;
+  for (var round = 0; round < 2000; round++) {
+    for (var k = 0; k < count; k++)
+      total += fns[k](o, 10);
+  }
+
+  if (total === 0)
+    throw new Error('unexpected result');
+}
+
+function main(conf) {
+  var functions = +conf.functions;
+  var args = ['--jit-threads=' + conf.threads, __filename, 'child', functions];
+
+  bench.start();
+  var child = spawn(process.execPath, args);
+  child.on('exit', function(exitCode) {
+    if (exitCode !== 0)
+      throw new Error('child exited with code ' + exitCode);
+    bench.end(functions);
+  });
+}
@@ -0,0 +1,26 @@
+'use strict';
+
+// Like promise-depth, but every step resolves its promise with another,
+// already settled promise, the way an async function awaits one.
+const common = require('../common.js');
+const bench = common.createBenchmark(main, {
+  millions: [1]
+});
+
+function main(conf) {
+  const N = +conf.millions * 1e6;
+  let n = N;
+
+  process.on('exit', function() {
+    bench.end(N / 1e6);
+  });
+
+  const settled = Promise.resolve(0);
+
+  bench.start();
+  new Promise((resolve) => resolve(settled)).then(onResolved);
+  function onResolved() {
+    if (--n)
+      new Promise((resolve) => resolve(settled)).then(onResolved);
+  }
+}
@@ -0,0 +1,22 @@
+'use strict';
+
+const common = require('../common.js');
+const bench = common.createBenchmark(main, {
+  millions: [1]
+});
+
+function main(conf) {
+  const N = +conf.millions * 1e6;
+  let n = N;
+
+  process.on('exit', function() {
+    bench.end(N / 1e6);
+  });
+
+  bench.start();
+  Promise.resolve().then(onResolved);
+  function onResolved() {
+    if (--n)
+      Promise.resolve().then(onResolved);
+  }
+}
@@ -82,6 +82,7 @@
         'src/v8booleanobject.cc',
         'src/v8chakra.h',
         'src/v8context.cc',
+        'src/v8cpuprofiler.cc',
         'src/v8date.cc',
         'src/v8debug.cc',
         'src/v8exception.cc',
@@ -93,6 +94,7 @@
         'src/v8int32.cc',
         'src/v8integer.cc',
         'src/v8isolate.cc',
+        'src/v8json.cc',
         'src/v8message.cc',
         'src/v8number.cc',
         'src/v8numberobject.cc',
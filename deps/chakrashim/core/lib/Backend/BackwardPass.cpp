@@ -3599,7 +3599,7 @@ BackwardPass::UpdateArrayBailOutKind(IR::Instr *const instr)
     Assert(instr->HasBailOutInfo());
 
     if (instr->m_opcode != Js::OpCode::StElemI_A && instr->m_opcode != Js::OpCode::StElemI_A_Strict &&
-        instr->m_opcode != Js::OpCode::Memcopy && instr->m_opcode != Js::OpCode::Memset ||
+        instr->m_opcode != Js::OpCode::Memcopy && instr->m_opcode != Js::OpCode::Memset && instr->m_opcode != Js::OpCode::Memxor ||
         !instr->GetDst()->IsIndirOpnd())
     {
         return;
@@ -1597,6 +1597,7 @@ void BailOutRecord::ScheduleFunctionCodeGen(Js::ScriptFunction * function, Js::S
     }
 
     Js::FunctionBody * executeFunction = function->GetFunctionBody();
+    executeFunction->RecordBailOut();
 
     if (PHASE_OFF(Js::ReJITPhase, executeFunction))
     {
@@ -2061,6 +2062,7 @@ void BailOutRecord::ScheduleFunctionCodeGen(Js::ScriptFunction * function, Js::S
             executeFunction->GetScriptContext()->LogRejit(executeFunction, rejitReason);
         }
 #endif
+        executeFunction->RecordRejit(rejitReason);
         executeFunction->ClearDontRethunkAfterBailout();
 
         GenerateFunction(executeFunction->GetScriptContext()->GetNativeCodeGenerator(), executeFunction, function);
@@ -2104,6 +2106,7 @@ void BailOutRecord::ScheduleLoopBodyCodeGen(Js::ScriptFunction * function, Js::S
 {
     Assert(bailOutKind != IR::LazyBailOut);
     Js::FunctionBody * executeFunction = function->GetFunctionBody();
+    executeFunction->RecordBailOut();
 
     if (PHASE_OFF(Js::ReJITPhase, executeFunction))
     {
@@ -2356,6 +2359,7 @@ void BailOutRecord::ScheduleLoopBodyCodeGen(Js::ScriptFunction * function, Js::S
             executeFunction->GetScriptContext()->LogRejit(executeFunction, rejitReason);
         }
 #endif
+        executeFunction->RecordRejit(rejitReason);
         // Single bailout triggers re-JIT of loop body. the actual codegen scheduling of the new
         // loop body happens in the interpreter
         loopHeader->interpretCount = executeFunction->GetLoopInterpretCount(loopHeader) - 2;
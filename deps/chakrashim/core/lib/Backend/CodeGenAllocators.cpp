@@ -17,6 +17,8 @@ CodeGenAllocators::CodeGenAllocators(AllocationPolicyManager * policyManager, Js
 #ifdef PERF_COUNTERS
 , staticNativeCodeData(0)
 #endif
+, threadPageAllocator(nullptr)
+, next(nullptr)
 {
 }
 
@@ -24,6 +24,11 @@ struct CodeGenAllocators
     size_t staticNativeCodeData;
 #endif
 
+    // Background allocators are created for each job processor thread and linked together, keyed by the page allocator of
+    // the thread they belong to
+    PageAllocator *threadPageAllocator;
+    CodeGenAllocators *next;
+
     CodeGenAllocators(AllocationPolicyManager * policyManager, Js::ScriptContext * scriptContext);
     PageAllocator *GetPageAllocator() { return &pageAllocator; };
     ~CodeGenAllocators();
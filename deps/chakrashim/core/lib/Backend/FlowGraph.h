@@ -629,7 +629,10 @@ public:
         SymID ldBase;
         StackSym* transferSym;
         byte ldCount;
-        MemCopyCandidate() : MemOpCandidate(MemOpCandidate::MEMCOPY) {}
+        // dst[i] = src[i] ^ xorConstant: transferSym is then the result of the xor
+        bool hasXor;
+        int32 xorConstant;
+        MemCopyCandidate() : MemOpCandidate(MemOpCandidate::MEMCOPY), hasXor(false), xorConstant(0) {}
     };
 
 #define FOREACH_MEMOP_CANDIDATES_EDITING(data, loop, iterator) FOREACH_SLISTCOUNTED_ENTRY_EDITING(Loop::MemOpCandidate*, data, loop->memOpInfo->candidates, iterator)
@@ -765,6 +768,7 @@ struct MemSetEmitData : public MemOpEmitData
 struct MemCopyEmitData : public MemOpEmitData
 {
     IR::Instr* ldElemInstr;
+    IR::Instr* xorInstr;
 };
 
 #define FOREACH_BLOCK_IN_FUNC(block, func)\
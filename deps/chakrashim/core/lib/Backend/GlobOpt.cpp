@@ -118,7 +118,8 @@
 #if DBG_DUMP
 #define DO_MEMOP_TRACE() (PHASE_TRACE(Js::MemOpPhase, this->func->GetJnFunction()) ||\
         PHASE_TRACE(Js::MemSetPhase, this->func->GetJnFunction()) ||\
-        PHASE_TRACE(Js::MemCopyPhase, this->func->GetJnFunction()))
+        PHASE_TRACE(Js::MemCopyPhase, this->func->GetJnFunction()) ||\
+        PHASE_TRACE(Js::MemXorPhase, this->func->GetJnFunction()))
 #define DO_MEMOP_TRACE_PHASE(phase) (PHASE_TRACE(Js::MemOpPhase, this->func->GetJnFunction()) || PHASE_TRACE(Js::phase ## Phase, this->func->GetJnFunction()))
 
 #define OUTPUT_MEMOP_TRACE(loop, instr, ...) {\
@@ -4356,6 +4357,23 @@ bool GlobOpt::CollectMemcopyStElementI(IR::Instr *instr, Loop *loop)
         return false;
     }
 
+    if (memcopyInfo->hasXor)
+    {
+        // The xor is applied to the destination range once it has been copied, which only gives the same values for typed
+        // int arrays. Stores to a Uint8ClampedArray also clamp, so only accept constants that can't take the result out of
+        // [0, 255].
+        const ValueType baseValueType(baseOp->GetValueType());
+        if (!baseValueType.IsTypedIntArray() ||
+            (
+                baseValueType.GetObjectType() == ObjectType::Uint8ClampedArray &&
+                (memcopyInfo->xorConstant < 0 || memcopyInfo->xorConstant > UINT8_MAX)
+            ))
+        {
+            TRACE_MEMOP_PHASE_VERBOSE(MemXor, loop, instr, L"Xor is not supported for the destination (s%d)", baseSymID);
+            return false;
+        }
+    }
+
     Assert(indexOp->GetStackSym());
     SymID inductionSymID = GetVarSymID(indexOp->GetStackSym());
     Assert(IsSymIDInductionVariable(inductionSymID, loop));
@@ -4374,6 +4392,66 @@ bool GlobOpt::CollectMemcopyStElementI(IR::Instr *instr, Loop *loop)
     return true;
 }
 
+bool
+GlobOpt::CollectMemcopyXor(IR::Instr *instr, Loop *loop)
+{
+    // Accepts `t2 = t1 ^ constant` between `t1 = src[i]` and `dst[i] = t2`. The candidate then becomes a copy of the range
+    // followed by an in-place xor of the destination range, or only the xor when src and dst are the same array.
+    Assert(!loop->memOpInfo->candidates->Empty());
+    Loop::MemCopyCandidate* memcopyInfo = loop->memOpInfo->candidates->Head()->AsMemCopy();
+    Assert(memcopyInfo->base == Js::Constants::InvalidSymID);
+
+    if (PHASE_OFF(Js::MemXorPhase, this->func) || instr->m_opcode != Js::OpCode::Xor_I4 || memcopyInfo->hasXor)
+    {
+        return false;
+    }
+
+    IR::Opnd *transferOpnd = instr->GetSrc1();
+    IR::Opnd *constantOpnd = instr->GetSrc2();
+    if (constantOpnd->IsRegOpnd() && constantOpnd->AsRegOpnd()->m_sym == memcopyInfo->transferSym)
+    {
+        transferOpnd = instr->GetSrc2();
+        constantOpnd = instr->GetSrc1();
+    }
+
+    if (!transferOpnd->IsRegOpnd() || transferOpnd->AsRegOpnd()->m_sym != memcopyInfo->transferSym)
+    {
+        return false;
+    }
+
+    if (!transferOpnd->AsRegOpnd()->GetIsDead())
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemXor, loop, instr, L"Source (s%d) is still alive after Xor", GetVarSymID(memcopyInfo->transferSym));
+        return false;
+    }
+
+    int32 constantValue;
+    if (constantOpnd->IsIntConstOpnd())
+    {
+        constantValue = constantOpnd->AsIntConstOpnd()->AsInt32();
+    }
+    else
+    {
+        Value *const constantVal = constantOpnd->IsRegOpnd() ? this->FindValue(constantOpnd->AsRegOpnd()->m_sym) : nullptr;
+        if (!constantVal || !constantVal->GetValueInfo()->TryGetIntConstantValue(&constantValue))
+        {
+            TRACE_MEMOP_PHASE_VERBOSE(MemXor, loop, instr, L"Xor operand is not a constant");
+            return false;
+        }
+    }
+
+    IR::Opnd *dst = instr->GetDst();
+    if (!dst->IsRegOpnd() || !dst->AsRegOpnd()->GetStackSym()->IsSingleDef())
+    {
+        return false;
+    }
+
+    memcopyInfo->hasXor = true;
+    memcopyInfo->xorConstant = constantValue;
+    memcopyInfo->transferSym = dst->AsRegOpnd()->GetStackSym();
+    return true;
+}
+
 bool
 GlobOpt::CollectMemOpLdElementI(IR::Instr *instr, Loop *loop)
 {
@@ -4547,7 +4625,7 @@ MemOpCheckInductionVariable:
                 Loop::MemCopyCandidate* memcopyCandidate = prevCandidate->AsMemCopy();
                 if (memcopyCandidate->base == Js::Constants::InvalidSymID)
                 {
-                    if (instr->FindRegUse(memcopyCandidate->transferSym))
+                    if (instr->FindRegUse(memcopyCandidate->transferSym) && !CollectMemcopyXor(instr, loop))
                     {
                         loop->memOpInfo->doMemOp = false;
                         TRACE_MEMOP_PHASE_VERBOSE(MemCopy, loop, instr, L"Found illegal use of LdElemI value(s%d)", GetVarSymID(memcopyCandidate->transferSym));
@@ -20636,9 +20714,10 @@ void
 GlobOpt::RemoveMemOpSrcInstr(IR::Instr* memopInstr, IR::Instr* srcInstr, BasicBlock* block)
 {
     Assert(srcInstr && (srcInstr->m_opcode == Js::OpCode::LdElemI_A || srcInstr->m_opcode == Js::OpCode::StElemI_A));
-    Assert(memopInstr && (memopInstr->m_opcode == Js::OpCode::Memcopy || memopInstr->m_opcode == Js::OpCode::Memset));
+    Assert(memopInstr && (memopInstr->m_opcode == Js::OpCode::Memcopy || memopInstr->m_opcode == Js::OpCode::Memset || memopInstr->m_opcode == Js::OpCode::Memxor));
     Assert(block);
-    const bool isDst = srcInstr->m_opcode == Js::OpCode::StElemI_A;
+    // An in-place memxor loads from and stores to its destination
+    const bool isDst = srcInstr->m_opcode == Js::OpCode::StElemI_A || memopInstr->m_opcode == Js::OpCode::Memxor;
     IR::RegOpnd* opnd = (isDst ? memopInstr->GetDst() : memopInstr->GetSrc1())->AsIndirOpnd()->GetBaseOpnd();
     IR::ArrayRegOpnd* arrayOpnd = opnd->IsArrayRegOpnd() ? opnd->AsArrayRegOpnd() : nullptr;
 
@@ -20760,8 +20839,12 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
     IR::RegOpnd *startIndexOpnd = GenerateStartIndexOpndForMemop(loop, indexOpnd, sizeOpnd, isInductionVariableChangeIncremental, bIndexAlreadyChanged, insertBeforeInstr);
     IR::IndirOpnd* dstOpnd = IR::IndirOpnd::New(baseOpnd, startIndexOpnd, dstType, localFunc);
 
-    IR::Opnd *src1;
+    IR::Opnd *src1 = nullptr;
     const bool isMemset = emitData->candidate->IsMemSet();
+    const bool hasXor = !isMemset && emitData->candidate->AsMemCopy()->hasXor;
+
+    // dst[i] = dst[i] ^ c doesn't need a copy
+    const bool needsCopy = !hasXor || emitData->candidate->AsMemCopy()->ldBase != emitData->candidate->base;
 
     // Get the source according to the memop type
     if (isMemset)
@@ -20780,7 +20863,7 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
             src1 = IR::AddrOpnd::New(candidate->constant.ToVar(localFunc, func->GetScriptContext()), IR::AddrOpndKindConstant, localFunc);
         }
     }
-    else
+    else if (needsCopy)
     {
         Assert(emitData->candidate->IsMemCopy());
 
@@ -20798,11 +20881,44 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
     }
 
     // Generate memcopy
-    IR::Instr* memopInstr = IR::BailOutInstr::New(isMemset ? Js::OpCode::Memset : Js::OpCode::Memcopy, bailOutKind, bailOutInfo, localFunc);
-    memopInstr->SetDst(dstOpnd);
-    memopInstr->SetSrc1(src1);
-    memopInstr->SetSrc2(sizeOpnd);
-    insertBeforeInstr->InsertBefore(memopInstr);
+    IR::Instr* memopInstr = nullptr;
+    if (isMemset || needsCopy)
+    {
+        memopInstr = IR::BailOutInstr::New(isMemset ? Js::OpCode::Memset : Js::OpCode::Memcopy, bailOutKind, bailOutInfo, localFunc);
+        memopInstr->SetDst(dstOpnd);
+        memopInstr->SetSrc1(src1);
+        memopInstr->SetSrc2(sizeOpnd);
+        insertBeforeInstr->InsertBefore(memopInstr);
+    }
+
+    // Generate memxor over the destination range. When it follows a memcopy, it gets a plain base operand so that the array
+    // syms of the memcopy destination are only cleaned up once.
+    if (hasXor)
+    {
+        IR::IndirOpnd *xorDstOpnd = dstOpnd;
+        if (memopInstr)
+        {
+            IR::RegOpnd *xorBaseOpnd = IR::RegOpnd::New(baseOpnd->m_sym, baseOpnd->GetType(), localFunc);
+            xorBaseOpnd->SetValueType(baseOpnd->GetValueType());
+            xorBaseOpnd->SetIsJITOptimizedReg(true);
+            xorDstOpnd = IR::IndirOpnd::New(xorBaseOpnd, startIndexOpnd, dstType, localFunc);
+        }
+
+        IR::Instr* memxorInstr = IR::BailOutInstr::New(Js::OpCode::Memxor, bailOutKind, bailOutInfo, localFunc);
+        memxorInstr->SetDst(xorDstOpnd);
+        memxorInstr->SetSrc1(IR::IntConstOpnd::New(emitData->candidate->AsMemCopy()->xorConstant, TyInt32, localFunc));
+        memxorInstr->SetSrc2(sizeOpnd);
+        insertBeforeInstr->InsertBefore(memxorInstr);
+        TESTTRACE_PHASE_INSTR(Js::MemXorPhase, memxorInstr, L"Xor with %d folded into a memxor%s\n",
+            emitData->candidate->AsMemCopy()->xorConstant, memopInstr ? L" after a memcopy" : L"");
+
+        // The xor itself is folded into the memxor
+        ConvertToByteCodeUses(((MemCopyEmitData*)emitData)->xorInstr);
+        if (!memopInstr)
+        {
+            memopInstr = memxorInstr;
+        }
+    }
 
 #if DBG_DUMP
     if (DO_MEMOP_TRACE())
@@ -20860,6 +20976,19 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
                               loopCountBuf,
                               bIndexAlreadyChanged);
         }
+        else if (hasXor)
+        {
+            const Loop::MemCopyCandidate* candidate = emitData->candidate->AsMemCopy();
+            TRACE_MEMOP_PHASE(MemXor, loop, emitData->stElemInstr,
+                              L"ValueType: %S, StBase: s%u, Index: s%u, LdBase: s%u, Constant: %d, LoopCount: %s, IsIndexChangedBeforeUse: %d",
+                              valueTypeStr,
+                              candidate->base,
+                              candidate->index,
+                              candidate->ldBase,
+                              candidate->xorConstant,
+                              loopCountBuf,
+                              bIndexAlreadyChanged);
+        }
         else
         {
             const Loop::MemCopyCandidate* candidate = emitData->candidate->AsMemCopy();
@@ -20944,6 +21073,12 @@ GlobOpt::InspectInstrForMemCopyCandidate(Loop* loop, IR::Instr* instr, MemCopyEm
         {
             Assert(instr->IsProfiledInstr());
             emitData->ldElemInstr = instr;
+            if (candidate->hasXor && !emitData->xorInstr)
+            {
+                TRACE_MEMOP_PHASE_VERBOSE(MemXor, loop, instr, L"Xor not found between LdElemI_A and StElemI_A");
+                errorInInstr = true;
+                return false;
+            }
             ValueType stValueType = emitData->stElemInstr->GetDst()->AsIndirOpnd()->GetBaseOpnd()->GetValueType();
             ValueType ldValueType = emitData->ldElemInstr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd()->GetValueType();
             if (stValueType != ldValueType)
@@ -20964,6 +21099,16 @@ GlobOpt::InspectInstrForMemCopyCandidate(Loop* loop, IR::Instr* instr, MemCopyEm
         TRACE_MEMOP_PHASE_VERBOSE(MemCopy, loop, instr, L"Orphan LdElemI_A detected");
         errorInInstr = true;
     }
+    else if (
+        candidate->hasXor &&
+        emitData->stElemInstr &&
+        instr->m_opcode == Js::OpCode::Xor_I4 &&
+        instr->GetDst()->IsRegOpnd() &&
+        instr->GetDst()->AsRegOpnd()->m_sym == candidate->transferSym
+        )
+    {
+        emitData->xorInstr = instr;
+    }
     return false;
 }
 
@@ -1429,6 +1429,7 @@ private:
     bool                    CollectMemcopyStElementI(IR::Instr *, Loop *);
     bool                    CollectMemOpLdElementI(IR::Instr *, Loop *);
     bool                    CollectMemcopyLdElementI(IR::Instr *, Loop *);
+    bool                    CollectMemcopyXor(IR::Instr *, Loop *);
     SymID                   GetVarSymID(StackSym *);
     const InductionVariable* GetInductionVariable(SymID, Loop *);
     bool                    IsSymIDInductionVariable(SymID, Loop *);
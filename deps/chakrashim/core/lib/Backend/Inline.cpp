@@ -3177,6 +3177,10 @@ Inline::SetupInlineInstrForCallDirect(Js::BuiltinFunction builtInId, IR::Instr*
         callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperRegExp_Exec, callInstr->m_func));
         break;
 
+    case Js::BuiltinFunction::ArrayIterator_Next:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperArrayIterator_Next, callInstr->m_func));
+        break;
+
     };
     callInstr->SetSrc2(argoutInstr->GetDst());
     return;
@@ -470,6 +470,10 @@ bool InliningDecider::GetBuiltInInfo(
                 .Merge(ValueType::Null);
         goto CallDirectCommon;
 
+    case Js::JavascriptBuiltInFunction::JavascriptArrayIterator_Next:
+        *returnType = ValueType::GetObject(ObjectType::Object);
+        goto CallDirectCommon;
+
     CallDirectCommon:
         *inlineCandidateOpCode = Js::OpCode::CallDirect;
         break;
@@ -203,6 +203,7 @@ HELPERCALL(Op_DeleteElementI_Int32, Js::JavascriptOperators::OP_DeleteElementI_I
 
 HELPERCALL(Op_Memset, Js::JavascriptOperators::OP_Memset, AttrCanThrow)
 HELPERCALL(Op_Memcopy, Js::JavascriptOperators::OP_Memcopy, AttrCanThrow)
+HELPERCALL(Op_Memxor, Js::JavascriptOperators::OP_Memxor, AttrCanThrow)
 
 HELPERCALL(Op_PatchGetValue, ((Js::Var (*)(Js::FunctionBody *const, Js::InlineCache *const, const Js::InlineCacheIndex, Js::Var, Js::PropertyId))Js::JavascriptOperators::PatchGetValue<true, Js::InlineCache>), AttrCanThrow)
 HELPERCALL(Op_PatchGetValueWithThisPtr, ((Js::Var(*)(Js::FunctionBody *const, Js::InlineCache *const, const Js::InlineCacheIndex, Js::Var, Js::PropertyId, Js::Var))Js::JavascriptOperators::PatchGetValueWithThisPtr<true, Js::InlineCache>), AttrCanThrow)
@@ -404,9 +405,11 @@ HELPERCALL(SimpleProfileParameters, Js::SimpleJitHelpers::ProfileParameters, 0)
 HELPERCALL(SimpleCleanImplicitCallFlags, Js::SimpleJitHelpers::CleanImplicitCallFlags, 0)
 HELPERCALL(SimpleGetScheduledEntryPoint, Js::SimpleJitHelpers::GetScheduledEntryPoint, 0)
 HELPERCALL(SimpleIsLoopCodeGenDone, Js::SimpleJitHelpers::IsLoopCodeGenDone, 0)
+HELPERCALL(SimpleScheduleLoopBodyCodeGen, Js::SimpleJitHelpers::ScheduleLoopBodyCodeGen, AttrCanThrow)
 HELPERCALL(SimpleRecordLoopImplicitCallFlags, Js::SimpleJitHelpers::RecordLoopImplicitCallFlags, 0)
 
 HELPERCALL(ScriptAbort, Js::JavascriptOperators::ScriptAbort, AttrCanThrow)
+HELPERCALL(ScriptInterruptProbe, Js::JavascriptOperators::ScriptInterruptProbe, AttrCanThrow)
 
 HELPERCALL(NoSaveRegistersBailOutForElidedYield, BailOutRecord::BailOutForElidedYield, 0)
 
@@ -463,6 +466,8 @@ HELPERCALL(String_TrimLeft, Js::JavascriptString::EntryTrimLeft, 0)
 HELPERCALL(String_TrimRight, Js::JavascriptString::EntryTrimRight, 0)
 HELPERCALL(String_GetSz, Js::JavascriptString::GetSzHelper, 0)
 HELPERCALL(GlobalObject_ParseInt, Js::GlobalObject::EntryParseInt, 0)
+HELPERCALL(ArrayIterator_Next, Js::JavascriptArrayIterator::EntryNext, 0)
+HELPERCALL(ArrayIterator_NextResultUsedAndMayBeTemp, Js::JavascriptArrayIterator::NextResultUsedAndMayBeTemp, 0)
 
 HELPERCALL(RegExp_SplitResultUsed, Js::RegexHelper::RegexSplitResultUsed, 0)
 HELPERCALL(RegExp_SplitResultUsedAndMayBeTemp, Js::RegexHelper::RegexSplitResultUsedAndMayBeTemp, 0)
@@ -676,6 +676,9 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
                 case IR::JnHelperMethod::HelperRegExp_Exec:
                     GenerateFastInlineRegExpExec(instr);
                     break;
+                case IR::JnHelperMethod::HelperArrayIterator_Next:
+                    GenerateFastInlineArrayIteratorNext(instr);
+                    break;
                 case IR::JnHelperMethod::HelperGlobalObject_ParseInt:
                     GenerateFastInlineGlobalObjectParseInt(instr);
                     break;
@@ -1505,6 +1508,7 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
 
         case Js::OpCode::Memset:
         case Js::OpCode::Memcopy:
+        case Js::OpCode::Memxor:
         {
             LowerMemOp(instr);
             break;
@@ -2354,7 +2358,20 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
                     const auto threshold = instr->m_func->GetJnFunction()->GetLoopInterpretCount(head);
 
                     this->InsertCompareBranch(countReg, IR::IntConstOpnd::New(threshold, type, m_func), Js::OpCode::BrLt_A, checkDoBailout, checkDoBailout);
-                    this->InsertMove(dobailout, IR::IntConstOpnd::New(1, dobailoutType, m_func, true), checkDoBailout);
+                    if (!m_func->HasTry() && !PHASE_OFF(Js::JITLoopBodyFromSimpleJitPhase, m_func->GetJnFunction()))
+                    {
+                        // Schedule the loop body from this frame and only bail out once it has been jitted:
+                        //   dobailout = ScheduleLoopBodyCodeGen(framePtr, loopNum)
+                        auto scheduleLoopBody = IR::Instr::New(Js::OpCode::Call, dobailout, IR::HelperCallOpnd::New(IR::HelperSimpleScheduleLoopBodyCodeGen, m_func), m_func);
+                        checkDoBailout->InsertBefore(scheduleLoopBody);
+                        m_lowererMD.LoadHelperArgument(scheduleLoopBody, IR::IntConstOpnd::New(loopNum, TyUint32, m_func));
+                        m_lowererMD.LoadHelperArgument(scheduleLoopBody, IR::Opnd::CreateFramePointerOpnd(m_func));
+                        m_lowererMD.LowerCall(scheduleLoopBody, 0);
+                    }
+                    else
+                    {
+                        this->InsertMove(dobailout, IR::IntConstOpnd::New(1, dobailoutType, m_func, true), checkDoBailout);
+                    }
                     // fallthrough
 
                     // Label checkDoBailout (inserted above)
@@ -5142,11 +5159,11 @@ Lowerer::DoInterruptProbes()
             {
                 // For every loop top label, insert the following:
 
-                //   cmp sp, ThreadContext::stackLimitForCurrentThread
+                //   cmp sp, ThreadContext::interruptProbeLimit
                 //   bgt $continue
                 // $helper:
-                //   call JavascriptOperators::ScriptAbort
-                //   b $exit
+                //   call JavascriptOperators::ScriptInterruptProbe
+                //   b $continue
                 // $continue:
 
                 IR::LabelInstr *newLabel = IR::LabelInstr::New(Js::OpCode::Label, this->m_func);
@@ -5182,11 +5199,11 @@ Lowerer::DoLoopProbeAndNumber(IR::BranchInstr *branchInstr)
     {
         // B $loop ==>
 
-        // cmp [], 0
-        // beq $loop
+        // cmp sp, [probeLimit]
+        // bgt $loop
         // $helper:
-        // call abort
-        // b $exit
+        // call probe
+        // b $loop
 
         this->InsertOneLoopProbe(branchInstr, labelInstr);
         branchInstr->Remove();
@@ -5196,11 +5213,11 @@ Lowerer::DoLoopProbeAndNumber(IR::BranchInstr *branchInstr)
         // Bcc $loop ==>
 
         // Binv $notloop
-        // cmp [], 0
-        // beq $loop
+        // cmp sp, [probeLimit]
+        // bgt $loop
         // $helper:
-        // call abort
-        // b $exit
+        // call probe
+        // b $loop
         // $notloop:
 
         IR::LabelInstr *loopExitLabel = IR::LabelInstr::New(Js::OpCode::Label, this->m_func);
@@ -5223,11 +5240,13 @@ Lowerer::DoLoopProbeAndNumber(IR::BranchInstr *branchInstr)
 void
 Lowerer::InsertOneLoopProbe(IR::Instr *insertInstr, IR::LabelInstr *loopLabel)
 {
-    // Insert one interrupt probe at the given instruction. Probe the stack and call the abort helper
-    // directly if the probe fails.
+    // Insert one interrupt probe at the given instruction. Compare the stack pointer against the interrupt
+    // probe limit and call the probe helper if it fails. The limit is hammered both when script execution
+    // is disabled (the helper throws) and when the host requests a sample (the helper returns), so continue
+    // the loop after the call.
 
     IR::Opnd *memRefOpnd = IR::MemRefOpnd::New(
-        this->m_func->GetScriptContext()->GetThreadContext()->GetAddressOfStackLimitForCurrentThread(),
+        this->m_func->GetScriptContext()->GetThreadContext()->GetAddressOfInterruptProbeLimit(),
         TyMachReg, this->m_func);
 
     IR::RegOpnd *regStackPointer = IR::RegOpnd::New(
@@ -5238,28 +5257,13 @@ Lowerer::InsertOneLoopProbe(IR::Instr *insertInstr, IR::LabelInstr *loopLabel)
     IR::LabelInstr *helperLabel = IR::LabelInstr::New(Js::OpCode::Label, this->m_func, true);
     insertInstr->InsertBefore(helperLabel);
 
-    IR::HelperCallOpnd *helperOpnd = IR::HelperCallOpnd::New(IR::HelperScriptAbort, this->m_func);
     IR::Instr *instr = IR::Instr::New(Js::OpCode::Call, this->m_func);
-    instr->SetSrc1(helperOpnd);
+    instr->SetSrc1(IR::HelperCallOpnd::New(IR::HelperScriptInterruptProbe, this->m_func));
     insertInstr->InsertBefore(instr);
+    this->LoadScriptContext(instr);
     this->m_lowererMD.LowerCall(instr, 0);
 
-    // Jump to the exit after the helper call. This instruction will never be reached, but the jump
-    // indicates that nothing is live after the call (to avoid useless spills in code that will
-    // be executed).
-    instr = this->m_func->m_exitInstr->GetPrevRealInstrOrLabel();
-    if (instr->IsLabelInstr())
-    {
-        helperLabel = instr->AsLabelInstr();
-    }
-    else
-    {
-        helperLabel = IR::LabelInstr::New(Js::OpCode::Label, this->m_func);
-        this->m_func->m_exitInstr->InsertBefore(helperLabel);
-    }
-
-    instr = IR::BranchInstr::New(LowererMD::MDUncondBranchOpcode, helperLabel, this->m_func);
-    insertInstr->InsertBefore(instr);
+    InsertBranch(Js::OpCode::Br, loopLabel, insertInstr);
 }
 
 ///----------------------------------------------------------------------------
@@ -8435,10 +8439,39 @@ Lowerer::LowerMemcopy(IR::Instr * instr, IR::RegOpnd * helperRet)
     src->Free(m_func);
 }
 
+void
+Lowerer::LowerMemxor(IR::Instr * instr, IR::RegOpnd * helperRet)
+{
+    IR::Opnd * dst = instr->UnlinkDst();
+    IR::Opnd * src1 = instr->UnlinkSrc1();
+
+    Assert(dst->IsIndirOpnd());
+    Assert(src1->IsIntConstOpnd());
+    IR::Opnd *baseOpnd = dst->AsIndirOpnd()->UnlinkBaseOpnd();
+    IR::Opnd *indexOpnd = dst->AsIndirOpnd()->UnlinkIndexOpnd();
+
+    IR::Opnd *sizeOpnd = instr->UnlinkSrc2();
+
+    Assert(baseOpnd);
+    Assert(sizeOpnd);
+    Assert(indexOpnd);
+
+    IR::JnHelperMethod helperMethod = IR::HelperOp_Memxor;
+
+    instr->SetDst(helperRet);
+    LoadScriptContext(instr);
+    m_lowererMD.LoadHelperArgument(instr, sizeOpnd);
+    m_lowererMD.LoadHelperArgument(instr, src1);
+    m_lowererMD.LoadHelperArgument(instr, indexOpnd);
+    m_lowererMD.LoadHelperArgument(instr, baseOpnd);
+    m_lowererMD.ChangeToHelperCall(instr, helperMethod);
+    dst->Free(m_func);
+}
+
 IR::Instr *
 Lowerer::LowerMemOp(IR::Instr * instr)
 {
-    Assert(instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy || instr->m_opcode == Js::OpCode::Memxor);
     IR::Instr *instrPrev = instr->m_prev;
 
     IR::RegOpnd* helperRet = IR::RegOpnd::New(TyInt8, instr->m_func);
@@ -8503,6 +8536,10 @@ Lowerer::LowerMemOp(IR::Instr * instr)
     {
         LowerMemcopy(instr, helperRet);
     }
+    else if (instr->m_opcode == Js::OpCode::Memxor)
+    {
+        LowerMemxor(instr, helperRet);
+    }
     return instrPrev;
 }
 
@@ -11276,7 +11313,7 @@ void Lowerer::LowerBailOnInvalidatedArrayHeadSegment(IR::Instr *const instr, con
     */
 
     Assert(instr);
-    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy || instr->m_opcode == Js::OpCode::Memxor);
     Assert(instr->GetDst());
     Assert(instr->GetDst()->IsIndirOpnd());
 
@@ -11403,7 +11440,7 @@ void Lowerer::LowerBailOnInvalidatedArrayLength(IR::Instr *const instr, const bo
     */
 
     Assert(instr);
-    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy || instr->m_opcode == Js::OpCode::Memxor);
     Assert(instr->GetDst());
     Assert(instr->GetDst()->IsIndirOpnd());
 
@@ -11490,7 +11527,7 @@ void Lowerer::LowerBailOnCreatedMissingValue(IR::Instr *const instr, const bool
     */
 
     Assert(instr);
-    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy || instr->m_opcode == Js::OpCode::Memxor);
     Assert(instr->GetDst());
     Assert(instr->GetDst()->IsIndirOpnd());
 
@@ -16984,6 +17021,76 @@ Lowerer::GenerateFastInlineRegExpExec(IR::Instr * instr)
     RelocateCallDirectToHelperPath(tmpInstr, labelHelper);
 }
 
+void
+Lowerer::GenerateFastInlineArrayIteratorNext(IR::Instr * instr)
+{
+    // it.next()
+    // When the result object doesn't escape (e.g. for...of and array destructuring only read its value and done
+    // properties), build it in stack space instead of allocating it. The helper returns null when it would have to run
+    // user code, in which case we fall back to the regular call.
+
+    Assert(instr->m_opcode == Js::OpCode::CallDirect);
+    IR::Opnd * callDst = instr->GetDst();
+    if (!callDst || !instr->dstIsTempObject)
+    {
+        return;
+    }
+
+    //ArgOut_A_InlineSpecialized
+    IR::Instr * tmpInstr = instr->GetSrc2()->AsSymOpnd()->m_sym->AsStackSym()->m_instrDef;
+
+    IR::Opnd * argsOpnd[1];
+    if (!instr->FetchOperands(argsOpnd, 1))
+    {
+        return;
+    }
+
+    IR::Opnd *opndIterator = argsOpnd[0];
+    if (opndIterator->IsTaggedInt() || opndIterator->GetValueType().IsNotObject())
+    {
+        return;
+    }
+
+    IR::LabelInstr *labelHelper = IR::LabelInstr::New(Js::OpCode::Label, this->m_func, true);
+    if (!opndIterator->IsRegOpnd())
+    {
+        IR::RegOpnd *opndReg = IR::RegOpnd::New(TyVar, m_func);
+        LowererMD::CreateAssign(opndReg, opndIterator, instr);
+        opndIterator = opndReg;
+    }
+    GenerateTypeIdCheck(Js::TypeIds_ArrayIterator, opndIterator->AsRegOpnd(), labelHelper, instr);
+
+    // stackAllocationPointer, scriptcontext, iterator (to be pushed in reverse order)
+
+    this->m_lowererMD.LoadHelperArgument(instr, opndIterator);
+    LoadScriptContext(instr);
+
+    // Allocate some space on the stack for the result object
+    IR::RegOpnd *const stackAllocationOpnd = IR::RegOpnd::New(TyVar, m_func);
+    const IR::AutoReuseOpnd autoReuseStackAllocationOpnd(stackAllocationOpnd, m_func);
+    stackAllocationOpnd->SetValueType(callDst->GetValueType());
+    GenerateMarkTempAlloc(stackAllocationOpnd, Js::JavascriptLibrary::IteratorResultObjectStackAllocationSize, instr);
+    m_lowererMD.LoadHelperArgument(instr, stackAllocationOpnd);
+
+    IR::RegOpnd *const resultOpnd = IR::RegOpnd::New(TyVar, m_func);
+    const IR::AutoReuseOpnd autoReuseResultOpnd(resultOpnd, m_func);
+    IR::Instr * helperCallInstr = IR::Instr::New(LowererMD::MDCallOpcode, resultOpnd, m_func);
+    instr->InsertBefore(helperCallInstr);
+    m_lowererMD.ChangeToHelperCall(helperCallInstr, IR::JnHelperMethod::HelperArrayIterator_NextResultUsedAndMayBeTemp);
+
+    // test result, result
+    // je   $labelHelper
+    InsertTestBranch(resultOpnd, resultOpnd, Js::OpCode::BrEq_A, labelHelper, instr);
+    LowererMD::CreateAssign(callDst, resultOpnd, instr);
+
+    IR::LabelInstr *doneLabel = IR::LabelInstr::New(Js::OpCode::Label, m_func);
+    instr->InsertAfter(doneLabel);
+    instr->InsertBefore(labelHelper);
+    InsertBranch(Js::OpCode::Br, true, doneLabel, labelHelper);
+
+    RelocateCallDirectToHelperPath(tmpInstr, labelHelper);
+}
+
 void
 Lowerer::RelocateCallDirectToHelperPath(IR::Instr* argoutInlineSpecialized, IR::LabelInstr* labelHelper)
 {
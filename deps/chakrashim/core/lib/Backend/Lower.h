@@ -160,6 +160,7 @@ private:
     IR::Instr *     LowerMemOp(IR::Instr * instr);
     void            LowerMemset(IR::Instr * instr, IR::RegOpnd * helperRet);
     void            LowerMemcopy(IR::Instr * instr, IR::RegOpnd * helperRet);
+    void            LowerMemxor(IR::Instr * instr, IR::RegOpnd * helperRet);
 
     IR::Instr *     LowerLdArrViewElem(IR::Instr * instr);
     IR::Instr *     LowerStArrViewElem(IR::Instr * instr);
@@ -357,6 +358,7 @@ private:
     void            GenerateFastInlineMathClz32(IR::Instr* instr);
     void            GenerateFastInlineMathFround(IR::Instr* instr);
     void            GenerateFastInlineRegExpExec(IR::Instr * instr);
+    void            GenerateFastInlineArrayIteratorNext(IR::Instr * instr);
     bool            GenerateFastPush(IR::Opnd *baseOpndParam, IR::Opnd *src, IR::Instr *callInstr, IR::Instr *insertInstr, IR::LabelInstr *labelHelper, IR::LabelInstr *doneLabel, IR::LabelInstr * bailOutLabelHelper, bool returnLength = false);
     bool            GenerateFastReplace(IR::Opnd* strOpnd, IR::Opnd* src1, IR::Opnd* src2, IR::Instr *callInstr, IR::Instr *insertInstr, IR::LabelInstr *labelHelper, IR::LabelInstr *doneLabel);
     bool            ShouldGenerateStringReplaceFastPath(IR::Instr * instr, IntConstType argCount);
@@ -102,20 +102,22 @@ NativeCodeGenerator::~NativeCodeGenerator()
     }
 
 
-    if (this->backgroundAllocators)
+    while (this->backgroundAllocators)
     {
+        CodeGenAllocators *const allocators = this->backgroundAllocators;
+        this->backgroundAllocators = allocators->next;
 #if DBG
         // PageAllocator is thread agile. This destructor can be called from background GC thread.
         // We have already removed this manager from the job queue and hence its fine to set the threadId to -1.
         // We can't DissociatePageAllocator here as its allocated ui thread.
         //this->Processor()->DissociatePageAllocator(allocator->GetPageAllocator());
-        this->backgroundAllocators->emitBufferManager.GetHeapPageAllocator()->ClearConcurrentThreadId();
-        this->backgroundAllocators->emitBufferManager.GetPreReservedHeapPageAllocator()->ClearConcurrentThreadId();
-        this->backgroundAllocators->GetPageAllocator()->ClearConcurrentThreadId();
+        allocators->emitBufferManager.GetHeapPageAllocator()->ClearConcurrentThreadId();
+        allocators->emitBufferManager.GetPreReservedHeapPageAllocator()->ClearConcurrentThreadId();
+        allocators->GetPageAllocator()->ClearConcurrentThreadId();
 #endif
         // The native code generator may be deleted after Close was called on the job processor. In that case, the
-        // background thread is no longer running, so clean things up in the foreground.
-        HeapDelete(this->backgroundAllocators);
+        // background threads are no longer running, so clean things up in the foreground.
+        HeapDelete(allocators);
     }
 
 #ifdef PROFILE_EXEC
@@ -164,9 +166,9 @@ void NativeCodeGenerator::Close()
 
     // Only decommit here instead of releasing the memory, so we retain control over these addresses
     // Mitigate against the case the entry point is called after the script site is closed
-    if (this->backgroundAllocators)
+    for (CodeGenAllocators *allocators = this->backgroundAllocators; allocators; allocators = allocators->next)
     {
-        this->backgroundAllocators->emitBufferManager.Decommit();
+        allocators->emitBufferManager.Decommit();
     }
 
     if (this->foregroundAllocators)
@@ -622,12 +624,8 @@ void NativeCodeGenerator::GenerateLoopBody(Js::FunctionBody * fn, Js::LoopHeader
     }
 #endif
 
-    // If the parent function is JITted, no need to JIT this loop
-    // CanReleaseLoopHeaders is a quick and dirty way of checking if the
-    // function is currently being interpreted. If it is being interpreted,
-    // We'd still like to jit the loop body.
     // We reset the interpretCount to 0 in case we switch back to the interpreter
-    if (fn->GetNativeEntryPointUsed() && fn->GetCanReleaseLoopHeaders() && (!fn->GetIsAsmJsFunction() || !(loopHeader->GetCurrentEntryPointInfo()->GetIsTJMode())))
+    if (!IsLoopBodyCodeGenNeeded(fn, loopHeader))
     {
         loopHeader->ResetInterpreterCount();
         return;
@@ -690,6 +688,28 @@ void NativeCodeGenerator::GenerateLoopBody(Js::FunctionBody * fn, Js::LoopHeader
     }
 }
 
+bool
+NativeCodeGenerator::IsLoopBodyCodeGenNeeded(Js::FunctionBody *const fn, Js::LoopHeader *const loopHeader)
+{
+    // If the parent function is JITted, no need to JIT this loop
+    // CanReleaseLoopHeaders is a quick and dirty way of checking if the
+    // function is currently being interpreted. If it is being interpreted,
+    // We'd still like to jit the loop body.
+    if (!fn->GetNativeEntryPointUsed() || !fn->GetCanReleaseLoopHeaders())
+    {
+        return true;
+    }
+
+    if (fn->GetIsAsmJsFunction())
+    {
+        return loopHeader->GetCurrentEntryPointInfo()->GetIsTJMode();
+    }
+
+    // Simple JIT code enters full JIT loop bodies through a bailout (see SimpleJitHelpers::ScheduleLoopBodyCodeGen), so
+    // the loop body is still needed until the function itself has been full jitted.
+    return fn->GetDefaultFunctionEntryPointInfo()->GetJitMode() == ExecutionMode::SimpleJit;
+}
+
 bool
 NativeCodeGenerator::IsValidVar(const Js::Var var, Recycler *const recycler)
 {
@@ -1310,6 +1330,17 @@ NativeCodeGenerator::PrioritizedButNotYetProcessed(JsUtil::Job *const job)
 #endif
 }
 
+uint
+NativeCodeGenerator::GetJobPriority(JsUtil::Job *const job) const
+{
+    // This function is called from inside the lock
+
+    ASSERT_THREAD();
+    Assert(job);
+
+    // Among the queued work items, the ones whose code keeps getting called while it waits to be jitted are picked up first
+    return static_cast<CodeGenWorkItem *>(job)->GetInterpretedCount();
+}
 
 void
 NativeCodeGenerator::BeforeWaitForJob(Js::EntryPointInfo *const entryPoint) const
@@ -1371,7 +1402,7 @@ NativeCodeGenerator::Process(JsUtil::Job *const job, JsUtil::ParallelThreadData
         JsLoopBodyCodeGen* loopBodyCodeGenWorkItem = (JsLoopBodyCodeGen*)codeGenWork;
         Js::FunctionBody* fn = loopBodyCodeGenWorkItem->GetFunctionBody();
 
-        if (fn->GetNativeEntryPointUsed() && fn->GetCanReleaseLoopHeaders() && (!fn->GetIsAsmJsFunction() || !(loopBodyCodeGenWorkItem->loopHeader->GetCurrentEntryPointInfo()->GetIsTJMode())))
+        if (!IsLoopBodyCodeGenNeeded(fn, loopBodyCodeGenWorkItem->loopHeader))
         {
             loopBodyCodeGenWorkItem->loopHeader->ResetInterpreterCount();
             return false;
@@ -1425,9 +1456,20 @@ NativeCodeGenerator::Prioritize(JsUtil::Job *const job, const bool forceAddJobTo
     }
     else
     {
-        if(!forceAddJobToProcessor && !functionBody->TryTransitionToJitExecutionMode())
+        if(!forceAddJobToProcessor)
         {
-            return;
+            // With adaptive tiering, hot functions tier up sooner while the background thread has no full JIT work to do
+            if(queuedFullJitWorkItemCount == 0 &&
+                scriptContext->GetThreadContext()->DoAdaptiveTiering() &&
+                !Js::Configuration::Global.flags.EnforceExecutionModeLimits)
+            {
+                functionBody->AdaptExecutionModeLimitsToIdleJitQueue();
+            }
+
+            if(!functionBody->TryTransitionToJitExecutionMode())
+            {
+                return;
+            }
         }
 
         jitMode = functionBody->GetExecutionMode();
@@ -2715,17 +2757,27 @@ bool NativeCodeGenerator::TryReleaseNonHiPriWorkItem(CodeGenWorkItem* workItem)
 bool
 NativeCodeGenerator::IsNativeFunctionAddr(void * address)
 {
-    return
-        (this->backgroundAllocators && this->backgroundAllocators->emitBufferManager.IsInRange(address)) ||
-        (this->foregroundAllocators && this->foregroundAllocators->emitBufferManager.IsInRange(address));
+    for (CodeGenAllocators *allocators = this->backgroundAllocators; allocators; allocators = allocators->next)
+    {
+        if (allocators->emitBufferManager.IsInRange(address))
+        {
+            return true;
+        }
+    }
+
+    return this->foregroundAllocators && this->foregroundAllocators->emitBufferManager.IsInRange(address);
 }
 
 void
 NativeCodeGenerator::FreeNativeCodeGenAllocation(void* address)
 {
-    if(this->backgroundAllocators)
+    // The code may have been jitted by any of the background threads
+    for (CodeGenAllocators *allocators = this->backgroundAllocators; allocators; allocators = allocators->next)
     {
-        this->backgroundAllocators->emitBufferManager.FreeAllocation(address);
+        if (allocators->emitBufferManager.FreeAllocation(address))
+        {
+            return;
+        }
     }
 }
 
@@ -35,6 +35,7 @@ public:
     bool GenerateFunction(Js::FunctionBody * fn, Js::ScriptFunction * function = nullptr);
     void GenerateLoopBody(Js::FunctionBody * functionBody, Js::LoopHeader * loopHeader, Js::EntryPointInfo* info = nullptr, uint localCount = 0, Js::Var localSlots[] = nullptr);
     static bool IsValidVar(const Js::Var var, Recycler *const recycler);
+    static bool IsLoopBodyCodeGenNeeded(Js::FunctionBody *const fn, Js::LoopHeader *const loopHeader);
 
 #ifdef ENABLE_PREJIT
     void GenerateAllFunctions(Js::FunctionBody * fn);
@@ -69,6 +70,7 @@ private:
     bool ShouldProcessInForeground(const bool willWaitForJob, const unsigned int numJobsInQueue) const;
     void Prioritize(JsUtil::Job *const job, const bool forceAddJobToProcessor = false, void* function = nullptr);
     void PrioritizedButNotYetProcessed(JsUtil::Job *const job);
+    uint GetJobPriority(JsUtil::Job *const job) const;
     void BeforeWaitForJob(Js::EntryPointInfo *const entryPoint) const;
     void AfterWaitForJob(Js::EntryPointInfo *const entryPoint) const;
     static bool WorkItemExceedsJITLimits(CodeGenWorkItem *const codeGenWork);
@@ -149,7 +151,12 @@ private:
 
     CodeGenAllocators * GetBackgroundAllocator(PageAllocator *pageAllocator)
     {
-        return this->backgroundAllocators;
+        CodeGenAllocators *allocators = this->backgroundAllocators;
+        while (allocators && allocators->threadPageAllocator != pageAllocator)
+        {
+            allocators = allocators->next;
+        }
+        return allocators;
     }
 
     Js::ScriptContextProfiler * GetBackgroundCodeGenProfiler(PageAllocator *allocator);
@@ -158,12 +165,16 @@ private:
 
     void AllocateBackgroundAllocators(PageAllocator * pageAllocator)
     {
-        if (!this->backgroundAllocators)
+        // Each background thread gets its own allocators so that work items can be jitted on several threads concurrently
+        if (!GetBackgroundAllocator(pageAllocator))
         {
-            this->backgroundAllocators = CreateAllocators(pageAllocator);
+            CodeGenAllocators *const allocators = CreateAllocators(pageAllocator);
 #if !_M_X64_OR_ARM64 && _CONTROL_FLOW_GUARD
-            this->backgroundAllocators->canCreatePreReservedSegment = true;
+            allocators->canCreatePreReservedSegment = true;
 #endif
+            allocators->threadPageAllocator = pageAllocator;
+            allocators->next = this->backgroundAllocators;
+            this->backgroundAllocators = allocators;
         }
 
         AllocateBackgroundCodeGenProfiler(pageAllocator);
@@ -3354,6 +3354,10 @@ Opnd::GetAddrDescription(__out_ecount(count) wchar_t *const description, const s
             {
                 WriteToBuffer(&buffer, &n, L" (&StackLimit)");
             }
+            else if (address == func->GetScriptContext()->GetThreadContext()->GetAddressOfInterruptProbeLimit())
+            {
+                WriteToBuffer(&buffer, &n, L" (&InterruptProbeLimit)");
+            }
             else if (func->CanAllocInPreReservedHeapPageSegment() &&
                 func->GetScriptContext()->GetThreadContext()->GetPreReservedVirtualAllocator()->IsPreReservedRegionPresent() &&
                 address == func->GetScriptContext()->GetThreadContext()->GetPreReservedVirtualAllocator()->GetPreReservedEndAddress())
@@ -239,6 +239,51 @@ namespace Js
         return info->IsCodeGenDone();
     }
 
+    bool SimpleJitHelpers::ScheduleLoopBodyCodeGen(void* framePtr, uint loopNum)
+    {
+        auto layout = JavascriptCallStackLayout::FromFramePointer(framePtr);
+        FunctionBody* functionBody = layout->functionObject->GetFunctionBody();
+        LoopHeader* loopHeader = functionBody->GetLoopHeader(loopNum);
+        LoopEntryPointInfo* entryPointInfo = loopHeader->GetCurrentEntryPointInfo();
+
+        // The loop is hot. Rather than bailing out now and interpreting the loop until the full JIT loop body is ready,
+        //   schedule the loop body from here and keep running the simple JIT code. The bailout happens once the code is
+        //   ready, and the interpreter then enters the loop body right away.
+        //
+        // No locals are passed. The interpreter passes its locals only so that the loop body's loads of live-in registers
+        //   get a likely value type (see IRBuilder::EnsureLoopBodyLoadSlot). This frame keeps the registers in stack slots
+        //   that only its bailout records can locate. Without the hint, the live-ins are typed from the profile data
+        //   collected so far, which simple JIT code keeps updating, and are checked at their uses like any other value.
+        if (entryPointInfo->IsNotScheduled())
+        {
+            if (loopHeader->isScheduledFromSimpleJit)
+            {
+                // This entry point was declined, dropped or failed to jit after an earlier call. Bail out rather than
+                //   scheduling it again on every iteration, and let the interpreter decide.
+                return true;
+            }
+            loopHeader->isScheduledFromSimpleJit = true;
+
+            // Only emitted for functions without try, so the loop cannot be in one
+            loopHeader->isInTry = false;
+            GenerateLoopBody(functionBody->GetScriptContext()->GetNativeCodeGenerator(), functionBody, loopHeader, entryPointInfo, 0, nullptr);
+            if (entryPointInfo->IsNotScheduled())
+            {
+                // Declined, because the function has been full jitted in the meantime. Bail out, so that the interpreter,
+                //   which keeps the loop headers alive, schedules the loop body instead.
+                return true;
+            }
+        }
+
+        // Keep running this code while the job is in flight. Otherwise the loop body is either ready or will not be, and
+        //   the interpreter takes over in both cases.
+        const bool isCodeGenInFlight =
+            entryPointInfo->IsCodeGenPending() ||
+            entryPointInfo->IsCodeGenQueued() ||
+            (entryPointInfo->IsNativeCode() && !entryPointInfo->IsCodeGenDone());
+        return !isCodeGenInFlight;
+    }
+
     void SimpleJitHelpers::RecordLoopImplicitCallFlags(void* framePtr, uint loopNum, int restoreCallFlags)
     {
         auto layout = JavascriptCallStackLayout::FromFramePointer(framePtr);
@@ -28,6 +28,7 @@ namespace Js
 
         LoopEntryPointInfo* GetScheduledEntryPoint(void* framePtr, uint loopnum);
         bool IsLoopCodeGenDone(LoopEntryPointInfo* info);
+        bool ScheduleLoopBodyCodeGen(void* framePtr, uint loopNum);
         void RecordLoopImplicitCallFlags(void* framePtr, uint loopNum, int restoreCallFlags);
     }
 }
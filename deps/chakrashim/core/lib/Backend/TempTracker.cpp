@@ -1032,6 +1032,8 @@ ObjectTemp::IsTempUseOpCodeSym(IR::Instr * instr, Js::OpCode opcode, Sym * sym)
         return instr->GetDst()->AsIndirOpnd()->GetBaseOpnd()->m_sym == sym || instr->GetSrc1()->IsRegOpnd() && instr->GetSrc1()->AsRegOpnd()->m_sym == sym;
     case Js::OpCode::Memcopy:
         return instr->GetDst()->AsIndirOpnd()->GetBaseOpnd()->m_sym == sym || instr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd()->m_sym == sym;
+    case Js::OpCode::Memxor:
+        return instr->GetDst()->AsIndirOpnd()->GetBaseOpnd()->m_sym == sym;
 
     // Special case FromVar for now until we can allow CallsValueOf opcode to be accept temp use
     case Js::OpCode::FromVar:
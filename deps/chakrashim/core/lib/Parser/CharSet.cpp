@@ -1830,6 +1830,15 @@ namespace UnifiedRegex
         return leaf->vec.Get(CharSetNode::leafIdx(k));
     }
 
+    bool RuntimeCharSet<wchar_t>::GetNextNonDirectRange(Char searchCharStart, _Out_ Char *outLowerChar, _Out_ Char *outHigherChar) const
+    {
+        if (root == nullptr)
+            return false;
+        if (CTU(searchCharStart) < CharSetNode::directSize)
+            searchCharStart = UTC(CharSetNode::directSize);
+        return root->GetNextRange(CharSetNode::levels - 1, searchCharStart, outLowerChar, outHigherChar);
+    }
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
     // CAUTION: This method is very slow.
     void RuntimeCharSet<wchar_t>::Print(DebugWriter* w) const
@@ -744,6 +744,9 @@ namespace UnifiedRegex
                 return Get_helper(CTU(kc));
         }
 
+        // Ranges of the set at or above searchCharStart, not counting the first directSize characters
+        _Success_(return) bool GetNextNonDirectRange(Char searchCharStart, _Out_ Char *outLowerChar, _Out_ Char *outHigherChar) const;
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
         void Print(DebugWriter* w) const;
 #endif
@@ -0,0 +1,956 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "ParserPch.h"
+
+namespace UnifiedRegex
+{
+    // ----------------------------------------------------------------------
+    // CharClassMap
+    // ----------------------------------------------------------------------
+
+    uint CharClassMap::GetNonAscii(const Char c) const
+    {
+        Assert(numRanges > 0 && CTU(rangeStarts[0]) == AsciiTableSize);
+        Assert(CTU(c) >= AsciiTableSize);
+
+        uint lower = 0;
+        uint upper = numRanges;
+        while (upper - lower > 1)
+        {
+            const uint middle = lower + (upper - lower) / 2;
+            if (CTU(rangeStarts[middle]) <= CTU(c))
+                lower = middle;
+            else
+                upper = middle;
+        }
+        return rangeClasses[lower];
+    }
+
+    // ----------------------------------------------------------------------
+    // LazyDfa
+    // ----------------------------------------------------------------------
+
+    LazyDfa::LazyDfa(Recycler* recycler, const Inst* insts, const uint numInsts, const uint numClasses, const bool isLeftmostFirst)
+        : insts(insts)
+        , numInsts(numInsts)
+        , numClasses(numClasses)
+        , isLeftmostFirst(isLeftmostFirst)
+        , isRestartEmpty(false)
+        , visited(nullptr)
+        , generation(0)
+        , stack(nullptr)
+        , threads(nullptr)
+        , states(nullptr)
+        , numStates(0)
+        , stateCapacity(0)
+        , transitions(nullptr)
+        , stateInsts(nullptr)
+        , numStateInsts(0)
+        , stateInstsCapacity(0)
+        , stateTable(nullptr)
+        , numFlushes(0)
+    {
+        Assert(numInsts > 0 && numInsts <= MaxInsts);
+        Assert(numClasses > 0 && numClasses <= MaxClasses);
+
+        visited = RecyclerNewArrayLeafZ(recycler, uint32, numInsts);
+        stack = RecyclerNewArrayLeaf(recycler, uint16, numInsts);
+        threads = RecyclerNewArrayLeaf(recycler, uint16, numInsts);
+
+        for (int i = 0; i < 2; i++)
+        {
+            startStates[i][0] = UnknownState;
+            startStates[i][1] = UnknownState;
+        }
+
+        // A match attempt begun anywhere but at the boundary of the input starts with the same instructions, so if there
+        // are none there is no point in restarting
+        NextGeneration();
+        uint numRestartThreads = 0;
+        uint8 restartFlags = 0;
+        AddThreads(0, false, false, numRestartThreads, restartFlags);
+        isRestartEmpty = numRestartThreads == 0;
+    }
+
+    void LazyDfa::EnsureCache(Recycler* recycler)
+    {
+        if (states != nullptr)
+            return;
+
+        const uint initialStateCapacity = 16;
+        const uint initialStateInstsCapacity = 256;
+
+        stateTable = RecyclerNewArrayLeaf(recycler, StateId, StateTableSize);
+        stateInsts = RecyclerNewArrayLeaf(recycler, uint16, initialStateInstsCapacity);
+        stateInstsCapacity = initialStateInstsCapacity;
+        transitions = RecyclerNewArrayLeaf(recycler, StateId, initialStateCapacity * numClasses);
+        State* const newStates = RecyclerNewArrayLeaf(recycler, State, initialStateCapacity);
+        stateCapacity = initialStateCapacity;
+
+        // The dead state has no instructions and only ever goes to itself
+        newStates[DeadState].instsOffset = 0;
+        newStates[DeadState].numInsts = 0;
+        newStates[DeadState].flags = 0;
+        for (uint i = 0; i < numClasses; i++)
+            transitions[DeadState * numClasses + i] = DeadState;
+        states = newStates;
+
+        Flush();
+        numFlushes = 0;
+    }
+
+    void LazyDfa::Flush()
+    {
+        numStates = 1;
+        numStateInsts = 0;
+        memset(stateTable, 0xff, StateTableSize * sizeof(StateId));
+        for (int i = 0; i < 2; i++)
+        {
+            startStates[i][0] = UnknownState;
+            startStates[i][1] = UnknownState;
+        }
+        numFlushes++;
+    }
+
+    void LazyDfa::NextGeneration()
+    {
+        if (++generation == 0)
+        {
+            memset(visited, 0, numInsts * sizeof(uint32));
+            generation = 1;
+        }
+    }
+
+    bool LazyDfa::AddThreads(uint16 pc, const bool atBoundary, const bool atEnd, uint& numThreads, uint8& flags)
+    {
+        uint stackDepth = 0;
+        while (true)
+        {
+            Assert(pc < numInsts);
+            if (visited[pc] != generation)
+            {
+                visited[pc] = generation;
+                const Inst& inst = insts[pc];
+                switch (inst.tag)
+                {
+                case SplitInst:
+                    // Each split is visited once per generation, so the stack can't hold more than one entry per instruction
+                    Assert(stackDepth < numInsts);
+                    stack[stackDepth++] = inst.alt;
+                    pc = inst.next;
+                    continue;
+
+                case JumpInst:
+                    pc = inst.next;
+                    continue;
+
+                case AssertBeginInst:
+                    if (atBoundary)
+                    {
+                        pc = inst.next;
+                        continue;
+                    }
+                    break;
+
+                case AssertEndInst:
+                    if (atEnd)
+                    {
+                        pc = inst.next;
+                        continue;
+                    }
+                    threads[numThreads++] = pc;
+                    flags |= PendingEndFlag;
+                    break;
+
+                case MatchInst:
+                    threads[numThreads++] = pc;
+                    flags |= MatchFlag;
+                    if (isLeftmostFirst)
+                        return true;
+                    break;
+
+                default:
+                    Assert(inst.tag == CharInst);
+                    threads[numThreads++] = pc;
+                    break;
+                }
+            }
+
+            if (stackDepth == 0)
+                return false;
+            pc = stack[--stackDepth];
+        }
+    }
+
+    LazyDfa::StateId LazyDfa::Intern(Recycler* recycler, const uint numThreads, const uint8 flags)
+    {
+        if (numThreads == 0 && (flags & RestartFlag) == 0)
+            return DeadState;
+
+        uint hash = flags;
+        for (uint i = 0; i < numThreads; i++)
+            hash = (hash ^ threads[i]) * 16777619;
+
+        uint slot = hash & (StateTableSize - 1);
+        for (StateId stateId; (stateId = stateTable[slot]) != UnknownState; slot = (slot + 1) & (StateTableSize - 1))
+        {
+            const State& state = states[stateId];
+            if (state.flags == flags &&
+                state.numInsts == numThreads &&
+                memcmp(stateInsts + state.instsOffset, threads, numThreads * sizeof(uint16)) == 0)
+            {
+                return stateId;
+            }
+        }
+
+        if (numStates == MaxStates || numStateInsts + numThreads > MaxStateInsts)
+        {
+            // Start over rather than let the cache grow without bound. The search goes on from the new state.
+            Flush();
+            slot = hash & (StateTableSize - 1);
+        }
+
+        if (numStates == stateCapacity)
+        {
+            const uint newCapacity = stateCapacity * 2;
+            StateId* const newTransitions = RecyclerNewArrayLeaf(recycler, StateId, newCapacity * numClasses);
+            js_memcpy_s(newTransitions, newCapacity * numClasses * sizeof(StateId), transitions, numStates * numClasses * sizeof(StateId));
+            State* const newStates = RecyclerNewArrayLeaf(recycler, State, newCapacity);
+            js_memcpy_s(newStates, newCapacity * sizeof(State), states, numStates * sizeof(State));
+            transitions = newTransitions;
+            states = newStates;
+            stateCapacity = newCapacity;
+        }
+
+        if (numStateInsts + numThreads > stateInstsCapacity)
+        {
+            uint newCapacity = stateInstsCapacity * 2;
+            while (numStateInsts + numThreads > newCapacity)
+                newCapacity *= 2;
+            uint16* const newStateInsts = RecyclerNewArrayLeaf(recycler, uint16, newCapacity);
+            js_memcpy_s(newStateInsts, newCapacity * sizeof(uint16), stateInsts, numStateInsts * sizeof(uint16));
+            stateInsts = newStateInsts;
+            stateInstsCapacity = newCapacity;
+        }
+
+        const StateId stateId = numStates++;
+        State& state = states[stateId];
+        state.instsOffset = numStateInsts;
+        state.numInsts = (uint16)numThreads;
+        state.flags = flags;
+        js_memcpy_s(stateInsts + numStateInsts, (stateInstsCapacity - numStateInsts) * sizeof(uint16), threads, numThreads * sizeof(uint16));
+        numStateInsts += numThreads;
+        for (uint i = 0; i < numClasses; i++)
+            transitions[stateId * numClasses + i] = UnknownState;
+        stateTable[slot] = stateId;
+        return stateId;
+    }
+
+    LazyDfa::StateId LazyDfa::StartState(Recycler* recycler, const bool atBoundary, const bool restart)
+    {
+        if (startStates[atBoundary][restart] == UnknownState)
+        {
+            NextGeneration();
+            uint numThreads = 0;
+            uint8 flags = 0;
+            if (!AddThreads(0, atBoundary, false, numThreads, flags) && restart && !isRestartEmpty)
+                flags |= RestartFlag;
+            const StateId stateId = Intern(recycler, numThreads, flags);
+            startStates[atBoundary][restart] = stateId;
+        }
+        return startStates[atBoundary][restart];
+    }
+
+    LazyDfa::StateId LazyDfa::Step(Recycler* recycler, const StateId stateId, const uint charClass)
+    {
+        // Interning may move the cache, so take copies
+        const uint32 instsOffset = states[stateId].instsOffset;
+        const uint numStateThreads = states[stateId].numInsts;
+        const uint8 stateFlags = states[stateId].flags;
+
+        NextGeneration();
+        uint numThreads = 0;
+        uint8 flags = 0;
+        bool isCut = false;
+        for (uint i = 0; i < numStateThreads && !isCut; i++)
+        {
+            const Inst& inst = insts[stateInsts[instsOffset + i]];
+            if (inst.tag == CharInst && (inst.classes >> charClass & 1) != 0)
+                isCut = AddThreads(inst.next, false, false, numThreads, flags);
+        }
+
+        // A match attempt begun here has the lowest priority of all
+        if (!isCut && (stateFlags & RestartFlag) != 0 && !AddThreads(0, false, false, numThreads, flags))
+            flags |= RestartFlag;
+
+        const uint numFlushesBefore = numFlushes;
+        const StateId nextStateId = Intern(recycler, numThreads, flags);
+        if (numFlushes == numFlushesBefore)
+            transitions[stateId * numClasses + charClass] = nextStateId;
+        return nextStateId;
+    }
+
+    bool LazyDfa::MatchesAtEnd(const StateId stateId, const bool atBoundary)
+    {
+        const State& state = states[stateId];
+        if ((state.flags & (MatchFlag | PendingEndFlag)) == 0)
+            return false;
+
+        NextGeneration();
+        uint numThreads = 0;
+        uint8 flags = 0;
+        for (uint i = 0; i < state.numInsts; i++)
+        {
+            const Inst& inst = insts[stateInsts[state.instsOffset + i]];
+            if (inst.tag == MatchInst)
+                return true;
+            if (inst.tag == AssertEndInst)
+            {
+                AddThreads(inst.next, atBoundary, true, numThreads, flags);
+                if ((flags & MatchFlag) != 0)
+                    return true;
+            }
+        }
+        return false;
+    }
+
+    bool LazyDfa::SearchForward
+        ( Recycler* recycler
+        , const CharClassMap& classMap
+        , const Char* const input
+        , const CharCount inputLength
+        , const CharCount offset
+        , const bool isAnchored
+        , CharCount& matchEnd)
+    {
+        Assert(isLeftmostFirst);
+        Assert(offset <= inputLength);
+        EnsureCache(recycler);
+
+        const bool atBoundary = offset == 0;
+        StateId stateId = StartState(recycler, atBoundary, !isAnchored);
+        bool isMatch = false;
+        if ((states[stateId].flags & MatchFlag) != 0)
+        {
+            isMatch = true;
+            matchEnd = offset;
+        }
+
+        CharCount inputOffset = offset;
+        while (stateId != DeadState && inputOffset < inputLength)
+        {
+            const uint charClass = classMap.Get(input[inputOffset]);
+            StateId nextStateId = transitions[stateId * numClasses + charClass];
+            if (nextStateId == UnknownState)
+                nextStateId = Step(recycler, stateId, charClass);
+            stateId = nextStateId;
+            inputOffset++;
+
+            if ((states[stateId].flags & MatchFlag) != 0)
+            {
+                isMatch = true;
+                matchEnd = inputOffset;
+            }
+        }
+
+        if (inputOffset == inputLength &&
+            (states[stateId].flags & PendingEndFlag) != 0 &&
+            MatchesAtEnd(stateId, atBoundary && inputOffset == offset))
+        {
+            isMatch = true;
+            matchEnd = inputLength;
+        }
+
+        return isMatch;
+    }
+
+    bool LazyDfa::SearchBackward
+        ( Recycler* recycler
+        , const CharClassMap& classMap
+        , const Char* const input
+        , const CharCount inputLength
+        , const CharCount offset
+        , const CharCount end
+        , CharCount& matchStart)
+    {
+        Assert(!isLeftmostFirst);
+        Assert(offset <= end && end <= inputLength);
+        EnsureCache(recycler);
+
+        const bool atBoundary = end == inputLength;
+        StateId stateId = StartState(recycler, atBoundary, false);
+        bool isMatch = false;
+        if ((states[stateId].flags & MatchFlag) != 0)
+        {
+            isMatch = true;
+            matchStart = end;
+        }
+
+        CharCount inputOffset = end;
+        while (stateId != DeadState && inputOffset > offset)
+        {
+            const uint charClass = classMap.Get(input[inputOffset - 1]);
+            StateId nextStateId = transitions[stateId * numClasses + charClass];
+            if (nextStateId == UnknownState)
+                nextStateId = Step(recycler, stateId, charClass);
+            stateId = nextStateId;
+            inputOffset--;
+
+            if ((states[stateId].flags & MatchFlag) != 0)
+            {
+                isMatch = true;
+                matchStart = inputOffset;
+            }
+        }
+
+        if (inputOffset == 0 &&
+            (states[stateId].flags & PendingEndFlag) != 0 &&
+            MatchesAtEnd(stateId, atBoundary && inputOffset == end))
+        {
+            isMatch = true;
+            matchStart = 0;
+        }
+
+        return isMatch;
+    }
+
+    // ----------------------------------------------------------------------
+    // LazyDfaMatcher
+    // ----------------------------------------------------------------------
+
+    LazyDfaMatcher::LazyDfaMatcher
+        ( Recycler* recycler
+        , const CharClassMap& classMap
+        , const LazyDfa::Inst* forwardInsts
+        , const LazyDfa::Inst* reverseInsts
+        , const uint numInsts)
+        : classMap(classMap)
+        , forward(recycler, forwardInsts, numInsts, classMap.numClasses, true)
+        , reverse(recycler, reverseInsts, numInsts, classMap.numClasses, false)
+    {
+    }
+
+    bool LazyDfaMatcher::Match
+        ( Recycler* recycler
+        , const Char* const input
+        , const CharCount inputLength
+        , const CharCount offset
+        , const bool isSticky
+        , CharCount& matchStart
+        , CharCount& matchEnd)
+    {
+        if (!forward.SearchForward(recycler, classMap, input, inputLength, offset, isSticky, matchEnd))
+            return false;
+
+        if (isSticky)
+        {
+            matchStart = offset;
+            return true;
+        }
+
+        // The earliest start of any match ending at matchEnd is the earliest start of any match at all, which is where the
+        // leftmost-first match begins
+        const bool hasStart = reverse.SearchBackward(recycler, classMap, input, inputLength, offset, matchEnd, matchStart);
+        Assert(hasStart);
+        return hasStart;
+    }
+
+#if ENABLE_REGEX_CONFIG_OPTIONS
+    void LazyDfaMatcher::Print(DebugWriter* w) const
+    {
+        w->Print(L"%u instructions, %u character classes, %u+%u cached states",
+            forward.numInsts, classMap.numClasses, forward.numStates, reverse.numStates);
+    }
+#endif
+
+    // ----------------------------------------------------------------------
+    // LazyDfaBuilder
+    // ----------------------------------------------------------------------
+
+    bool LazyDfaBuilder::CharPredicate::Matches(const Char c) const
+    {
+        if (set != nullptr)
+            return set->Get(c) != isNegation;
+
+        for (uint i = 0; i < numChars; i++)
+        {
+            if (chars[i] == c)
+                return true;
+        }
+        return false;
+    }
+
+    LazyDfaBuilder::LazyDfaBuilder(Js::ScriptContext* scriptContext, ArenaAllocator* ctAllocator, const Char* litbuf, const RegexFlags flags)
+        : scriptContext(scriptContext)
+        , ctAllocator(ctAllocator)
+        , litbuf(litbuf)
+        , flags(flags)
+        , intervalStarts(nullptr)
+        , intervalClasses(nullptr)
+        , numIntervals(0)
+        , numClasses(0)
+        , insts(nullptr)
+        , numInsts(0)
+        , isReverse(false)
+    {
+    }
+
+    bool LazyDfaBuilder::Qualifies(Node* node) const
+    {
+        PROBE_STACK(scriptContext, Js::Constants::MinStackRegex);
+
+        switch (node->tag)
+        {
+        case Node::Empty:
+        case Node::MatchLiteral:
+        case Node::MatchChar:
+        case Node::MatchSet:
+            return true;
+
+        case Node::BOL:
+        case Node::EOL:
+            // In multiline mode these depend on the neighbouring characters
+            return (flags & MultilineRegexFlag) == 0;
+
+        case Node::Concat:
+            for (ConcatNode* curr = (ConcatNode*)node; curr != 0; curr = curr->tail)
+            {
+                if (!Qualifies(curr->head))
+                    return false;
+            }
+            return true;
+
+        case Node::Alt:
+            for (AltNode* curr = (AltNode*)node; curr != 0; curr = curr->tail)
+            {
+                if (!Qualifies(curr->head))
+                    return false;
+            }
+            return true;
+
+        case Node::DefineGroup:
+            return Qualifies(((DefineGroupNode*)node)->body);
+
+        case Node::Loop:
+        {
+            LoopNode* loop = (LoopNode*)node;
+            // An optional iteration which matches empty fails, which the NFA has no way to express
+            if (!loop->repeats.IsFixed() && loop->body->thisConsumes.CouldMatchEmpty())
+                return false;
+            if (loop->repeats.lower > LazyDfa::MaxInsts ||
+                (!loop->repeats.IsUnbounded() && loop->repeats.upper - loop->repeats.lower > LazyDfa::MaxInsts))
+            {
+                return false;
+            }
+            return Qualifies(loop->body);
+        }
+
+        default:
+            // Word boundaries, backreferences and assertions look at more than the next character
+            return false;
+        }
+    }
+
+    template <typename Fn>
+    void LazyDfaBuilder::ForEachPredicate(Node* node, Fn fn) const
+    {
+        PROBE_STACK(scriptContext, Js::Constants::MinStackRegex);
+
+        switch (node->tag)
+        {
+        case Node::MatchLiteral:
+        {
+            MatchLiteralNode* literal = (MatchLiteralNode*)node;
+            const uint charSize = literal->isEquivClass ? CaseInsensitive::EquivClassSize : 1;
+            for (CharCount i = 0; i < literal->length; i++)
+            {
+                const CharPredicate predicate = { litbuf + literal->offset + i * charSize, charSize, nullptr, false };
+                fn(i, predicate);
+            }
+            break;
+        }
+
+        case Node::MatchChar:
+        {
+            MatchCharNode* matchChar = (MatchCharNode*)node;
+            const CharPredicate predicate = { matchChar->cs, matchChar->isEquivClass ? CaseInsensitive::EquivClassSize : 1, nullptr, false };
+            fn(0, predicate);
+            break;
+        }
+
+        case Node::MatchSet:
+        {
+            MatchSetNode* matchSet = (MatchSetNode*)node;
+            const CharPredicate predicate = { nullptr, 0, &matchSet->set, matchSet->isNegation };
+            fn(0, predicate);
+            break;
+        }
+
+        case Node::Concat:
+            for (ConcatNode* curr = (ConcatNode*)node; curr != 0; curr = curr->tail)
+                ForEachPredicate(curr->head, fn);
+            break;
+
+        case Node::Alt:
+            for (AltNode* curr = (AltNode*)node; curr != 0; curr = curr->tail)
+                ForEachPredicate(curr->head, fn);
+            break;
+
+        case Node::DefineGroup:
+            ForEachPredicate(((DefineGroupNode*)node)->body, fn);
+            break;
+
+        case Node::Loop:
+            ForEachPredicate(((LoopNode*)node)->body, fn);
+            break;
+        }
+    }
+
+    bool LazyDfaBuilder::ComputeClasses(Node* root)
+    {
+        // Mark where each run of characters which every predicate treats alike begins
+        uint32* const boundaries = AnewArrayZ(ctAllocator, uint32, NumChars / 32);
+        const auto setBoundary = [&](const uint c)
+        {
+            if (c < NumChars)
+                boundaries[c / 32] |= 1u << (c % 32);
+        };
+
+        setBoundary(0);
+        setBoundary(CharClassMap::AsciiTableSize);
+        ForEachPredicate(root, [&](const CharCount, const CharPredicate& predicate)
+        {
+            if (predicate.set == nullptr)
+            {
+                for (uint i = 0; i < predicate.numChars; i++)
+                {
+                    setBoundary(CTU(predicate.chars[i]));
+                    setBoundary(CTU(predicate.chars[i]) + 1);
+                }
+                return;
+            }
+
+            Char lower, upper;
+            for (uint searchStart = 0;
+                searchStart < NumChars && predicate.set->GetNextRange(UTC(searchStart), &lower, &upper);
+                searchStart = CTU(upper) + 1)
+            {
+                setBoundary(CTU(lower));
+                setBoundary(CTU(upper) + 1);
+            }
+        });
+
+        numIntervals = 0;
+        for (uint i = 0; i < NumChars / 32; i++)
+        {
+            for (uint32 bits = boundaries[i]; bits != 0; bits &= bits - 1)
+                numIntervals++;
+        }
+        if (numIntervals > MaxIntervals)
+            return false;
+
+        intervalStarts = AnewArray(ctAllocator, uint, numIntervals);
+        intervalClasses = AnewArrayZ(ctAllocator, uint8, numIntervals);
+        uint nextInterval = 0;
+        for (uint i = 0; i < NumChars / 32; i++)
+        {
+            for (uint32 bits = boundaries[i]; bits != 0; bits &= bits - 1)
+            {
+                DWORD bit;
+                _BitScanForward(&bit, bits);
+                intervalStarts[nextInterval++] = i * 32 + bit;
+            }
+        }
+        Assert(nextInterval == numIntervals);
+
+        // Refine the partition of the intervals into classes by each predicate in turn
+        numClasses = 1;
+        bool fits = true;
+        ForEachPredicate(root, [&](const CharCount, const CharPredicate& predicate)
+        {
+            if (!fits)
+                return;
+
+            uint8 refinedClasses[LazyDfa::MaxClasses][2];
+            memset(refinedClasses, 0xff, sizeof(refinedClasses));
+            uint numRefinedClasses = 0;
+            for (uint i = 0; i < numIntervals; i++)
+            {
+                uint8& refinedClass = refinedClasses[intervalClasses[i]][predicate.Matches(UTC(intervalStarts[i]))];
+                if (refinedClass == 0xff)
+                {
+                    if (numRefinedClasses == LazyDfa::MaxClasses)
+                    {
+                        fits = false;
+                        return;
+                    }
+                    refinedClass = (uint8)numRefinedClasses++;
+                }
+                intervalClasses[i] = refinedClass;
+            }
+            numClasses = numRefinedClasses;
+        });
+        return fits;
+    }
+
+    uint64 LazyDfaBuilder::ClassesOf(const CharPredicate& predicate) const
+    {
+        uint64 classes = 0;
+        for (uint i = 0; i < numIntervals; i++)
+        {
+            if (predicate.Matches(UTC(intervalStarts[i])))
+                classes |= (uint64)1 << intervalClasses[i];
+        }
+        return classes;
+    }
+
+    void LazyDfaBuilder::FillClassMap(Recycler* recycler, CharClassMap& classMap) const
+    {
+        classMap.numClasses = numClasses;
+
+        uint interval = 0;
+        for (uint c = 0; c < CharClassMap::AsciiTableSize; c++)
+        {
+            while (interval + 1 < numIntervals && intervalStarts[interval + 1] <= c)
+                interval++;
+            classMap.asciiClasses[c] = intervalClasses[interval];
+        }
+
+        // An interval always starts right after the ASCII characters. Merge neighbouring intervals in the same class.
+        const uint firstInterval = interval + 1;
+        Assert(firstInterval < numIntervals && intervalStarts[firstInterval] == CharClassMap::AsciiTableSize);
+        classMap.numRanges = 0;
+        for (uint i = firstInterval; i < numIntervals; i++)
+        {
+            if (i == firstInterval || intervalClasses[i] != intervalClasses[i - 1])
+                classMap.numRanges++;
+        }
+
+        classMap.rangeStarts = RecyclerNewArrayLeaf(recycler, Char, classMap.numRanges);
+        classMap.rangeClasses = RecyclerNewArrayLeaf(recycler, uint8, classMap.numRanges);
+        uint range = 0;
+        for (uint i = firstInterval; i < numIntervals; i++)
+        {
+            if (i == firstInterval || intervalClasses[i] != intervalClasses[i - 1])
+            {
+                classMap.rangeStarts[range] = UTC(intervalStarts[i]);
+                classMap.rangeClasses[range] = intervalClasses[i];
+                range++;
+            }
+        }
+        Assert(range == classMap.numRanges);
+    }
+
+    bool LazyDfaBuilder::EmitInst(const LazyDfa::InstTag tag, const uint64 classes)
+    {
+        if (numInsts == LazyDfa::MaxInsts)
+            return false;
+
+        LazyDfa::Inst& inst = insts[numInsts++];
+        inst.classes = classes;
+        inst.next = (uint16)numInsts;
+        inst.alt = LazyDfa::NoInst;
+        inst.tag = tag;
+        return true;
+    }
+
+    bool LazyDfaBuilder::Emit(Node* node)
+    {
+        PROBE_STACK(scriptContext, Js::Constants::MinStackRegex);
+
+        switch (node->tag)
+        {
+        case Node::Empty:
+            return true;
+
+        // Scanning backwards, the start of the input is reached last
+        case Node::BOL:
+            return EmitInst(isReverse ? LazyDfa::AssertEndInst : LazyDfa::AssertBeginInst);
+
+        case Node::EOL:
+            return EmitInst(isReverse ? LazyDfa::AssertBeginInst : LazyDfa::AssertEndInst);
+
+        case Node::MatchLiteral:
+        {
+            MatchLiteralNode* literal = (MatchLiteralNode*)node;
+            const uint firstInst = numInsts;
+            if (literal->length > LazyDfa::MaxInsts - numInsts)
+                return false;
+            numInsts += literal->length;
+            ForEachPredicate(node, [&](const CharCount i, const CharPredicate& predicate)
+            {
+                LazyDfa::Inst& inst = insts[firstInst + (isReverse ? literal->length - 1 - i : i)];
+                inst.classes = ClassesOf(predicate);
+                inst.alt = LazyDfa::NoInst;
+                inst.tag = LazyDfa::CharInst;
+            });
+            for (uint i = firstInst; i < numInsts; i++)
+                insts[i].next = (uint16)(i + 1);
+            return true;
+        }
+
+        case Node::MatchChar:
+        case Node::MatchSet:
+        {
+            bool emitted = false;
+            ForEachPredicate(node, [&](const CharCount, const CharPredicate& predicate)
+            {
+                emitted = EmitInst(LazyDfa::CharInst, ClassesOf(predicate));
+            });
+            return emitted;
+        }
+
+        case Node::Concat:
+        {
+            if (!isReverse)
+            {
+                for (ConcatNode* curr = (ConcatNode*)node; curr != 0; curr = curr->tail)
+                {
+                    if (!Emit(curr->head))
+                        return false;
+                }
+                return true;
+            }
+
+            // Scanning backwards, the items are matched last to first
+            CharCount numItems = 0;
+            for (ConcatNode* curr = (ConcatNode*)node; curr != 0; curr = curr->tail)
+                numItems++;
+            Node** items = AnewArray(ctAllocator, Node*, numItems);
+            CharCount item = 0;
+            for (ConcatNode* curr = (ConcatNode*)node; curr != 0; curr = curr->tail)
+                items[item++] = curr->head;
+            while (item > 0)
+            {
+                if (!Emit(items[--item]))
+                    return false;
+            }
+            return true;
+        }
+
+        case Node::Alt:
+        {
+            // Split to each item in turn and jump from the end of each item to the end of the alt. Jumps to be fixed up are
+            // chained through their next fields.
+            uint16 jumpFixups = LazyDfa::NoInst;
+            for (AltNode* curr = (AltNode*)node; curr != 0; curr = curr->tail)
+            {
+                if (curr->tail == 0)
+                {
+                    if (!Emit(curr->head))
+                        return false;
+                    break;
+                }
+
+                const uint split = numInsts;
+                if (!EmitInst(LazyDfa::SplitInst) || !Emit(curr->head) || !EmitInst(LazyDfa::JumpInst))
+                    return false;
+                insts[numInsts - 1].next = jumpFixups;
+                jumpFixups = (uint16)(numInsts - 1);
+                insts[split].alt = (uint16)numInsts;
+            }
+            while (jumpFixups != LazyDfa::NoInst)
+            {
+                const uint16 nextFixup = insts[jumpFixups].next;
+                insts[jumpFixups].next = (uint16)numInsts;
+                jumpFixups = nextFixup;
+            }
+            return true;
+        }
+
+        case Node::DefineGroup:
+            return Emit(((DefineGroupNode*)node)->body);
+
+        case Node::Loop:
+        {
+            LoopNode* loop = (LoopNode*)node;
+            for (CharCount i = 0; i < loop->repeats.lower; i++)
+            {
+                if (!Emit(loop->body))
+                    return false;
+            }
+
+            if (loop->repeats.IsUnbounded())
+            {
+                // Split to the body or past the loop, and jump from the end of the body back to the split
+                const uint split = numInsts;
+                if (!EmitInst(LazyDfa::SplitInst) || !Emit(loop->body) || !EmitInst(LazyDfa::JumpInst))
+                    return false;
+                insts[numInsts - 1].next = (uint16)split;
+                insts[split].next = (uint16)(loop->isGreedy ? split + 1 : numInsts);
+                insts[split].alt = (uint16)(loop->isGreedy ? numInsts : split + 1);
+                return true;
+            }
+
+            // Skipping an optional iteration skips all the following ones too. Splits to be fixed up are chained through
+            // their alt fields.
+            uint16 splitFixups = LazyDfa::NoInst;
+            for (CharCount i = loop->repeats.lower; i < loop->repeats.upper; i++)
+            {
+                const uint split = numInsts;
+                if (!EmitInst(LazyDfa::SplitInst) || !Emit(loop->body))
+                    return false;
+                insts[split].alt = splitFixups;
+                splitFixups = (uint16)split;
+            }
+            while (splitFixups != LazyDfa::NoInst)
+            {
+                const uint16 split = splitFixups;
+                splitFixups = insts[split].alt;
+                insts[split].next = (uint16)(loop->isGreedy ? split + 1 : numInsts);
+                insts[split].alt = (uint16)(loop->isGreedy ? numInsts : split + 1);
+            }
+            return true;
+        }
+
+        default:
+            Assert(false);
+            return false;
+        }
+    }
+
+    LazyDfa::Inst* LazyDfaBuilder::EmitProgram(Recycler* recycler, Node* root, const bool isReverse)
+    {
+        this->isReverse = isReverse;
+        numInsts = 0;
+        if (!Emit(root) || !EmitInst(LazyDfa::MatchInst))
+            return nullptr;
+
+        LazyDfa::Inst* const result = RecyclerNewArrayLeaf(recycler, LazyDfa::Inst, numInsts);
+        js_memcpy_s(result, numInsts * sizeof(LazyDfa::Inst), insts, numInsts * sizeof(LazyDfa::Inst));
+        return result;
+    }
+
+    LazyDfaMatcher* LazyDfaBuilder::Build
+        ( Js::ScriptContext* scriptContext
+        , ArenaAllocator* ctAllocator
+        , Node* root
+        , const Char* litbuf
+        , const RegexFlags flags)
+    {
+        // Surrogate pairs would have to be matched as single characters
+        if ((flags & UnicodeRegexFlag) != 0)
+            return nullptr;
+
+        LazyDfaBuilder builder(scriptContext, ctAllocator, litbuf, flags);
+        if (!builder.Qualifies(root) || !builder.ComputeClasses(root))
+            return nullptr;
+
+        Recycler* const recycler = scriptContext->GetRecycler();
+        builder.insts = AnewArray(ctAllocator, LazyDfa::Inst, LazyDfa::MaxInsts);
+        const LazyDfa::Inst* const forwardInsts = builder.EmitProgram(recycler, root, false);
+        if (forwardInsts == nullptr)
+            return nullptr;
+        const uint numInsts = builder.numInsts;
+
+        // The reverse program has the same instructions in a different order
+        const LazyDfa::Inst* const reverseInsts = builder.EmitProgram(recycler, root, true);
+        Assert(reverseInsts != nullptr && builder.numInsts == numInsts);
+
+        CharClassMap classMap;
+        builder.FillClassMap(recycler, classMap);
+        return RecyclerNew(recycler, LazyDfaMatcher, recycler, classMap, forwardInsts, reverseInsts, numInsts);
+    }
+}
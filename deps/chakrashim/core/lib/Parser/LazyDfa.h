@@ -0,0 +1,275 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// Backtracking-free matcher for patterns of form:
+//    pattern ::= char | set | literal | ^ | $ | pattern pattern | pattern '|' pattern | (pattern) | (?:pattern)
+//              | pattern{n,m} | pattern{n,m}?
+// where:
+//   - ^ and $ only appear when the pattern is not multiline
+//   - a loop body which could match empty is always repeated a fixed number of times
+//   - the pattern is not unicode
+//
+// The pattern is compiled to a Thompson NFA whose sets of active instructions are cached as DFA states, together with
+// the transitions between them, as the input is scanned. Matching is linear in the length of the input whatever the
+// pattern, and since the cache lives as long as the program it is shared by every execution of the pattern.
+//
+// The leftmost-first (backtracking) semantics are kept by ordering the active instructions of a state by priority and
+// dropping those behind an accepting one. A forward scan then finds the end of the match the backtracking matcher would
+// find, and a scan of the reversed pattern backwards from that end finds the earliest start, which is where that match
+// begins. Groups other than the overall match are not tracked: the caller recovers them by running the backtracking
+// program from the start of the match.
+//
+#pragma once
+
+namespace UnifiedRegex
+{
+    // ----------------------------------------------------------------------
+    // CharClassMap
+    // ----------------------------------------------------------------------
+
+    // Maps characters to classes of characters which no instruction of a lazy DFA tells apart
+    struct CharClassMap : private Chars<wchar_t>
+    {
+        static const uint AsciiTableSize = 128;
+
+        uint8 asciiClasses[AsciiTableSize];
+
+        // Sorted starts of the runs of non-ASCII characters in the same class, the first being AsciiTableSize
+        // In recycler, owned by matcher
+        Char* rangeStarts;
+        uint8* rangeClasses;
+        uint numRanges;
+        uint numClasses;
+
+        __inline uint Get(const Char c) const
+        {
+            if (CTU(c) < AsciiTableSize)
+                return asciiClasses[CTU(c)];
+            return GetNonAscii(c);
+        }
+
+    private:
+        uint GetNonAscii(const Char c) const;
+    };
+
+    // ----------------------------------------------------------------------
+    // LazyDfa
+    // ----------------------------------------------------------------------
+
+    // The NFA for a pattern, or for its reverse, together with its cache of DFA states
+    class LazyDfa : private Chars<wchar_t>
+    {
+        friend class LazyDfaBuilder;
+        friend class LazyDfaMatcher;
+
+    public:
+        static const uint MaxInsts = 4096;
+        static const uint MaxClasses = 64;
+
+        // Once the cache is this large it is flushed and filled again from the current state
+        static const uint MaxStates = 1024;
+        static const uint MaxStateInsts = 64 * 1024;
+
+    private:
+        enum InstTag : uint8
+        {
+            CharInst,           // Consume a character in classes, continue at next
+            SplitInst,          // Continue at next, else at alt
+            JumpInst,           // Continue at next
+            AssertBeginInst,    // Continue at next if the scan started at the boundary of the input
+            AssertEndInst,      // Continue at next if the scan reached the boundary of the input
+            MatchInst           // Accept
+        };
+
+        static const uint16 NoInst = (uint16)-1;
+
+        struct Inst
+        {
+            uint64 classes;
+            uint16 next;
+            uint16 alt;
+            InstTag tag;
+        };
+
+        typedef uint32 StateId;
+        static const StateId DeadState = 0;
+        static const StateId UnknownState = (StateId)-1;
+
+        enum StateFlags : uint8
+        {
+            RestartFlag = 1 << 0,       // A new match attempt begins at each following character
+            MatchFlag = 1 << 1,         // A match ends where the state is entered
+            PendingEndFlag = 1 << 2     // Some instructions are waiting for the boundary of the input
+        };
+
+        struct State
+        {
+            uint32 instsOffset; // into stateInsts
+            uint16 numInsts;
+            uint8 flags;
+        };
+
+        static const uint StateTableSize = MaxStates * 2;
+
+        // NFA, in recycler, owned by the matcher. Instruction 0 is the entry point.
+        const Inst* insts;
+        uint numInsts;
+        uint numClasses;
+        // True if instructions behind an accepting one are dropped (forward scan), false if the longest match is wanted
+        // (reverse scan)
+        bool isLeftmostFirst;
+        // True if a match attempt begun anywhere but at the boundary of the input fails without consuming a character
+        bool isRestartEmpty;
+
+        // Scratch for computing states, in recycler
+        uint32* visited;    // generation in which each instruction was last added
+        uint32 generation;
+        uint16* stack;
+        uint16* threads;
+
+        // Cache, in recycler, allocated on first use
+        State* states;
+        uint numStates;
+        uint stateCapacity;
+        StateId* transitions;   // numClasses per state
+        uint16* stateInsts;     // instructions of each state, in priority order
+        uint numStateInsts;
+        uint stateInstsCapacity;
+        StateId* stateTable;    // open addressed hash table of states
+        StateId startStates[2][2]; // indexed by whether at boundary, whether restarting
+        uint numFlushes;
+
+        LazyDfa(Recycler* recycler, const Inst* insts, const uint numInsts, const uint numClasses, const bool isLeftmostFirst);
+
+        void EnsureCache(Recycler* recycler);
+        void Flush();
+        void NextGeneration();
+
+        // Add the instructions reachable from pc without consuming a character, in priority order. Return true if an
+        // accepting instruction was reached and lower priority instructions are to be dropped.
+        bool AddThreads(uint16 pc, const bool atBoundary, const bool atEnd, uint& numThreads, uint8& flags);
+        StateId Intern(Recycler* recycler, const uint numThreads, const uint8 flags);
+        StateId StartState(Recycler* recycler, const bool atBoundary, const bool restart);
+        StateId Step(Recycler* recycler, const StateId stateId, const uint charClass);
+        bool MatchesAtEnd(const StateId stateId, const bool atBoundary);
+
+    public:
+        // Find the end of the leftmost-first match at or after offset, or at offset only if anchored
+        bool SearchForward
+            ( Recycler* recycler
+            , const CharClassMap& classMap
+            , const Char* const input
+            , const CharCount inputLength
+            , const CharCount offset
+            , const bool isAnchored
+            , CharCount& matchEnd);
+
+        // Find the earliest start at or after offset of a match of the reversed pattern ending at end
+        bool SearchBackward
+            ( Recycler* recycler
+            , const CharClassMap& classMap
+            , const Char* const input
+            , const CharCount inputLength
+            , const CharCount offset
+            , const CharCount end
+            , CharCount& matchStart);
+    };
+
+    // ----------------------------------------------------------------------
+    // LazyDfaMatcher
+    // ----------------------------------------------------------------------
+
+    class LazyDfaMatcher : private Chars<wchar_t>
+    {
+        friend class LazyDfaBuilder;
+
+    private:
+        CharClassMap classMap;
+        LazyDfa forward;
+        LazyDfa reverse;
+
+        LazyDfaMatcher
+            ( Recycler* recycler
+            , const CharClassMap& classMap
+            , const LazyDfa::Inst* forwardInsts
+            , const LazyDfa::Inst* reverseInsts
+            , const uint numInsts);
+
+    public:
+        // Find the overall match the backtracking matcher would find at or after offset, or at offset only if sticky
+        bool Match
+            ( Recycler* recycler
+            , const Char* const input
+            , const CharCount inputLength
+            , const CharCount offset
+            , const bool isSticky
+            , CharCount& matchStart
+            , CharCount& matchEnd);
+
+#if ENABLE_REGEX_CONFIG_OPTIONS
+        void Print(DebugWriter* w) const;
+#endif
+    };
+
+    // ----------------------------------------------------------------------
+    // LazyDfaBuilder
+    // ----------------------------------------------------------------------
+
+    class LazyDfaBuilder : private Chars<wchar_t>
+    {
+    private:
+        static const uint MaxIntervals = 4096;
+
+        // Characters accepted by a char, set or literal character node
+        struct CharPredicate
+        {
+            const Char* chars;  // significant only if set is null
+            uint numChars;
+            CharSet<Char>* set;
+            bool isNegation;
+
+            bool Matches(const Char c) const;
+        };
+
+        Js::ScriptContext* scriptContext;
+        ArenaAllocator* ctAllocator;
+        const Char* litbuf;
+        RegexFlags flags;
+
+        // Runs of characters in the same class, in compile-time allocator
+        uint* intervalStarts;
+        uint8* intervalClasses;
+        uint numIntervals;
+        uint numClasses;
+
+        // Instruction buffer, in compile-time allocator
+        LazyDfa::Inst* insts;
+        uint numInsts;
+        bool isReverse;
+
+        LazyDfaBuilder(Js::ScriptContext* scriptContext, ArenaAllocator* ctAllocator, const Char* litbuf, const RegexFlags flags);
+
+        bool Qualifies(Node* node) const;
+
+        template <typename Fn>
+        void ForEachPredicate(Node* node, Fn fn) const;
+        bool ComputeClasses(Node* root);
+        uint64 ClassesOf(const CharPredicate& predicate) const;
+        void FillClassMap(Recycler* recycler, CharClassMap& classMap) const;
+
+        bool EmitInst(const LazyDfa::InstTag tag, const uint64 classes = 0);
+        bool Emit(Node* node);
+        LazyDfa::Inst* EmitProgram(Recycler* recycler, Node* root, const bool isReverse);
+
+    public:
+        // Return a matcher for the pattern, or null if the pattern does not qualify
+        static LazyDfaMatcher* Build
+            ( Js::ScriptContext* scriptContext
+            , ArenaAllocator* ctAllocator
+            , Node* root
+            , const Char* litbuf
+            , const RegexFlags flags);
+    };
+}
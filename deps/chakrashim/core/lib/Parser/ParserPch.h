@@ -17,6 +17,9 @@
 #include "StandardChars.h"
 #include "OctoquadIdentifier.h"
 #include "RegexCompileTime.h"
+#include "LazyDfa.h"
+#include "RegexEncoder.h"
+#include "RegexCodeGenerator.h"
 #include "RegexParser.h"
 #include "RegexPattern.h"
 
@@ -0,0 +1,65 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "ParserPch.h"
+
+#if ENABLE_REGEX_NATIVE_CODEGEN
+#include "..\Backend\CodeGenAllocators.h"
+
+namespace UnifiedRegex
+{
+    RegexCodeGenerator::RegexCodeGenerator(Js::ScriptContext* scriptContext)
+        : scriptContext(scriptContext)
+        , foregroundAllocators(GetForegroundAllocator(scriptContext->GetNativeCodeGenerator(), scriptContext->GetThreadContext()->GetPageAllocator()))
+        , codeBytes(0)
+    {
+    }
+
+    void RegexCodeGenerator::CodeGen(Program* program)
+    {
+        Assert(program->nativeCode == nullptr);
+
+        if (codeBytes >= MaxCodeBytes)
+            return;
+
+        BEGIN_TEMP_ALLOCATOR(tempAllocator, scriptContext, L"RegexEncoder");
+
+        uint8* code;
+        uint codeSize;
+        if (RegexEncoder::Encode(tempAllocator, program, code, codeSize))
+        {
+            BYTE* buffer = nullptr;
+            EmitBufferAllocation* allocation = foregroundAllocators->emitBufferManager.AllocateBuffer(codeSize, &buffer, 0, 0);
+            if (allocation != nullptr && buffer != nullptr)
+            {
+                if (foregroundAllocators->emitBufferManager.CommitBuffer(allocation, buffer, codeSize, code))
+                {
+                    scriptContext->GetThreadContext()->SetValidCallTargetForCFG(buffer);
+                    PERF_MAP(PerfMap::LogRegexNativeLoadEvent(program->source, program->sourceLen, buffer, codeSize));
+
+                    program->nativeCode = (RegexNativeCode)buffer;
+                    program->nativeCodeSize = codeSize;
+                    codeBytes += codeSize;
+                }
+                else
+                    foregroundAllocators->emitBufferManager.FreeAllocation(buffer);
+            }
+        }
+
+        END_TEMP_ALLOCATOR(tempAllocator, scriptContext);
+    }
+
+    void RegexCodeGenerator::FreeCode(Program* program)
+    {
+        Assert(program->nativeCode != nullptr);
+        Assert(codeBytes >= program->nativeCodeSize);
+
+        codeBytes -= program->nativeCodeSize;
+        FreeNativeCodeGenAllocation(scriptContext, (void*)program->nativeCode);
+        program->nativeCode = nullptr;
+        program->nativeCodeSize = 0;
+    }
+}
+
+#endif
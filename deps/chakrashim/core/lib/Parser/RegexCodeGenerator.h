@@ -0,0 +1,34 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#if ENABLE_REGEX_NATIVE_CODEGEN
+
+struct CodeGenAllocators;
+
+namespace UnifiedRegex
+{
+    // Places the machine code for the regex programs of a script context in the same executable memory as the code of its
+    // functions. Owned by the script context.
+    class RegexCodeGenerator
+    {
+    private:
+        // Limit on the executable memory taken up by the code of all the programs
+        static const size_t MaxCodeBytes = 512 * 1024;
+
+        Js::ScriptContext* const scriptContext;
+        CodeGenAllocators* const foregroundAllocators;
+        size_t codeBytes;
+
+    public:
+        RegexCodeGenerator(Js::ScriptContext* scriptContext);
+
+        // Compile the instructions of the program. Leaves them to the interpreter if they cannot be compiled.
+        void CodeGen(Program* program);
+        void FreeCode(Program* program);
+    };
+}
+
+#endif
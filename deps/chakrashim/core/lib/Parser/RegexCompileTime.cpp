@@ -4548,6 +4548,13 @@ namespace UnifiedRegex
                     }
 #endif
 
+                    if (REGEX_CONFIG_FLAG(RegexLazyDfa) && !root->isDeterministic)
+                    {
+                        // SPECIAL CASE: pattern may backtrack, but finding where it matches needs no backtracking
+                        // (the instructions below are still needed to bind groups)
+                        program->lazyDfaMatcher = LazyDfaBuilder::Build(scriptContext, ctAllocator, root, program->rep.insts.litbuf, program->flags);
+                    }
+
                     CharCount skipped = 0;
 
                     // If the root Node has a hard fail BOI, we should not emit any synchronize Nodes
@@ -0,0 +1,1354 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "ParserPch.h"
+
+#if ENABLE_REGEX_NATIVE_CODEGEN
+
+namespace UnifiedRegex
+{
+    // Counts and offsets which are encoded as signed 32-bit immediates or displacements
+    static const CharCount MaxImmediate = 0x7fffffff;
+
+    RegexEncoder::RegexEncoder(ArenaAllocator* allocator, const Program* program)
+        : program(program)
+        , litbuf(program->rep.insts.litbuf)
+        , pc(0)
+        , isTooLarge(false)
+        , numTables(0)
+        , numTableRefs(0)
+    {
+        buffer = AnewArray(allocator, uint8, MaxCodeSize);
+
+        const CharCount instsLen = program->rep.insts.instsLen;
+        labelOffsets = AnewArray(allocator, int, instsLen);
+        for (CharCount i = 0; i < instsLen; i++)
+            labelOffsets[i] = -1;
+        labelChains = AnewArray(allocator, JumpChain, instsLen);
+
+        tables = AnewArray(allocator, uint8, MaxTables * TableSize);
+        tableRefs = AnewArray(allocator, TableRef, MaxTableRefs);
+
+        memset(wordTest.direct, 0, sizeof(wordTest.direct));
+        memset(newlineTest.direct, 0, sizeof(newlineTest.direct));
+        for (uint c = 0; c < Chars<char>::NumChars; c++)
+        {
+            if (ASCIIChars::IsWord(ASCIIChars::UTC(c)))
+                wordTest.direct[c / 8] |= (uint8)(1 << (c % 8));
+            if (ASCIIChars::IsNewline(ASCIIChars::UTC(c)))
+                newlineTest.direct[c / 8] |= (uint8)(1 << (c % 8));
+        }
+        wordTest.numRanges = 0;
+        newlineTest.numRanges = 1;
+        newlineTest.lowers[0] = 0x2028;
+        newlineTest.uppers[0] = 0x2029;
+    }
+
+    bool RegexEncoder::Encode(ArenaAllocator* allocator, const Program* program, uint8*& code, uint& codeSize)
+    {
+        switch (program->tag)
+        {
+        case Program::InstructionsTag:
+        case Program::BOIInstructionsTag:
+        case Program::BOIInstructionsForStickyFlagTag:
+            break;
+        default:
+            return false;
+        }
+
+        RegexEncoder encoder(allocator, program);
+        if (!encoder.EncodeProgram())
+            return false;
+
+        code = encoder.buffer;
+        codeSize = encoder.pc;
+        return true;
+    }
+
+    bool RegexEncoder::EncodeProgram()
+    {
+        // The arguments are 32 bits, but the registers take part in 64-bit address computations
+        EmitMovRegReg(InputLengthReg, InputLengthReg);
+        EmitMovRegReg(MatchStartReg, MatchStartReg);
+        EmitMovdXmmReg(NextSyncInputOffsetXmmReg, MatchStartReg);
+
+        // Each match attempt starts here, with every group undefined. Group 0 is only written on success.
+        const uint attempt = pc;
+        EmitMovRegReg(InputOffsetReg, MatchStartReg);
+        for (int groupId = 1; groupId < program->numGroups; groupId++)
+            EmitMovGroupMemImm(GroupLengthDisplacement(groupId), CharCountFlag);
+
+        const uint8* const insts = program->rep.insts.insts;
+        const CharCount instsLen = program->rep.insts.instsLen;
+        Label label = 0;
+        while (label < instsLen)
+        {
+            labelOffsets[label] = pc;
+            Bind(labelChains[label]);
+
+            uint instSize;
+            if (!EncodeInst((const Inst*)(insts + label), instSize) || isTooLarge)
+                return false;
+            label += instSize;
+        }
+        Assert(label == instsLen);
+
+        // The attempt failed. Unless the program is anchored, try again from the next offset, as Matcher::Match does.
+        Bind(failChain);
+        if (program->tag == Program::InstructionsTag)
+        {
+            EmitIncReg(MatchStartReg);
+            EmitCmpRegReg(MatchStartReg, InputLengthReg);
+            EmitJccBack(CcBE, attempt);
+        }
+        Bind(hardFailChain);
+        EmitXorRegReg(RegEAX, RegEAX);
+        EmitRet();
+
+        const uint tablesOffset = pc;
+        for (uint i = 0; i < numTables * TableSize; i++)
+            Emit(tables[i]);
+        if (isTooLarge)
+            return false;
+
+        for (uint i = 0; i < numTableRefs; i++)
+        {
+            const TableRef& ref = tableRefs[i];
+            const int displacement = (int)(tablesOffset + ref.table * TableSize) - (int)(ref.displacementOffset + 4);
+            memcpy(buffer + ref.displacementOffset, &displacement, sizeof(displacement));
+        }
+        return true;
+    }
+
+    RegexEncoder::JumpChain* RegexEncoder::ForwardTarget(const Label label)
+    {
+        Assert(label < program->rep.insts.instsLen);
+
+        // Programs without choicepoints only jump forward
+        if (labelOffsets[label] >= 0)
+            return nullptr;
+        return &labelChains[label];
+    }
+
+    bool RegexEncoder::EncodeInst(const Inst* inst, uint& instSize)
+    {
+        switch (inst->tag)
+        {
+        case Inst::Fail:
+            instSize = sizeof(FailInst);
+            EmitJmp(failChain);
+            return true;
+
+        case Inst::Succ:
+            instSize = sizeof(SuccInst);
+            EncodeSucc();
+            return true;
+
+        case Inst::Jump:
+            {
+                const JumpInst* const jumpInst = (const JumpInst*)inst;
+                instSize = sizeof(*jumpInst);
+                JumpChain* const target = ForwardTarget(jumpInst->targetLabel);
+                if (target == nullptr)
+                    return false;
+                EmitJmp(*target);
+                return true;
+            }
+
+        case Inst::JumpIfNotChar:
+        case Inst::MatchCharOrJump:
+            {
+                CompileAssert(sizeof(JumpIfNotCharInst) == sizeof(MatchCharOrJumpInst));
+                const JumpIfNotCharInst* const charInst = (const JumpIfNotCharInst*)inst;
+                instSize = sizeof(*charInst);
+                JumpChain* const target = ForwardTarget(charInst->targetLabel);
+                if (target == nullptr)
+                    return false;
+                EmitCmpRegReg(InputOffsetReg, InputLengthReg);
+                EmitJcc(CcAE, *target);
+                EmitCmpCharImm(0, charInst->c);
+                EmitJcc(CcNE, *target);
+                if (inst->tag == Inst::MatchCharOrJump)
+                    EmitIncReg(InputOffsetReg);
+                return true;
+            }
+
+        case Inst::JumpIfNotSet:
+        case Inst::MatchSetOrJump:
+            {
+                CompileAssert(sizeof(JumpIfNotSetInst) == sizeof(MatchSetOrJumpInst));
+                const JumpIfNotSetInst* const setInst = (const JumpIfNotSetInst*)inst;
+                instSize = sizeof(*setInst);
+                JumpChain* const target = ForwardTarget(setInst->targetLabel);
+                CharTest test;
+                if (target == nullptr || !BuildSetTest(setInst->set, test))
+                    return false;
+                EncodeLoadCharOrJump(*target);
+                EncodeCharTest(test, false, *target);
+                if (inst->tag == Inst::MatchSetOrJump)
+                    EmitIncReg(InputOffsetReg);
+                return true;
+            }
+
+        case Inst::Switch10:
+            instSize = sizeof(Switch10Inst);
+            return EncodeSwitch(((const Switch10Inst*)inst)->cases, ((const Switch10Inst*)inst)->numCases, false);
+
+        case Inst::Switch20:
+            instSize = sizeof(Switch20Inst);
+            return EncodeSwitch(((const Switch20Inst*)inst)->cases, ((const Switch20Inst*)inst)->numCases, false);
+
+        case Inst::SwitchAndConsume10:
+            instSize = sizeof(SwitchAndConsume10Inst);
+            return EncodeSwitch(((const SwitchAndConsume10Inst*)inst)->cases, ((const SwitchAndConsume10Inst*)inst)->numCases, true);
+
+        case Inst::SwitchAndConsume20:
+            instSize = sizeof(SwitchAndConsume20Inst);
+            return EncodeSwitch(((const SwitchAndConsume20Inst*)inst)->cases, ((const SwitchAndConsume20Inst*)inst)->numCases, true);
+
+        case Inst::BOITest:
+            {
+                const BOITestInst* const boiInst = (const BOITestInst*)inst;
+                instSize = sizeof(*boiInst);
+                EmitTestRegReg(InputOffsetReg, InputOffsetReg);
+                EmitJcc(CcNE, boiInst->canHardFail ? hardFailChain : failChain);
+                return true;
+            }
+
+        case Inst::EOITest:
+            // A hard fail here only stops backtracking, and there is none
+            instSize = sizeof(EOITestInst);
+            EmitCmpRegReg(InputOffsetReg, InputLengthReg);
+            EmitJcc(CcB, failChain);
+            return true;
+
+        case Inst::BOLTest:
+            {
+                instSize = sizeof(BOLTestInst);
+                JumpChain atBeginChain;
+                EmitTestRegReg(InputOffsetReg, InputOffsetReg);
+                EmitJcc(CcE, atBeginChain);
+                EncodeLoadChar(-1);
+                EncodeCharTest(newlineTest, false, failChain);
+                Bind(atBeginChain);
+                return true;
+            }
+
+        case Inst::EOLTest:
+            {
+                instSize = sizeof(EOLTestInst);
+                JumpChain atEndChain;
+                EncodeLoadCharOrJump(atEndChain);
+                EncodeCharTest(newlineTest, false, failChain);
+                Bind(atEndChain);
+                return true;
+            }
+
+        case Inst::WordBoundaryTest:
+            instSize = sizeof(WordBoundaryTestInst);
+            EncodeWordBoundaryTest(((const WordBoundaryTestInst*)inst)->isNegation);
+            return true;
+
+        case Inst::MatchChar:
+            instSize = sizeof(MatchCharInst);
+            EmitCmpRegReg(InputOffsetReg, InputLengthReg);
+            EmitJcc(CcAE, failChain);
+            EmitCmpCharImm(0, ((const MatchCharInst*)inst)->c);
+            EmitJcc(CcNE, failChain);
+            EmitIncReg(InputOffsetReg);
+            return true;
+
+        case Inst::MatchChar2:
+            instSize = sizeof(MatchChar2Inst);
+            EncodeLoadCharOrJump(failChain);
+            EncodeCharsTest(((const MatchChar2Inst*)inst)->cs, 2, failChain);
+            EmitIncReg(InputOffsetReg);
+            return true;
+
+        case Inst::MatchChar3:
+            instSize = sizeof(MatchChar3Inst);
+            EncodeLoadCharOrJump(failChain);
+            EncodeCharsTest(((const MatchChar3Inst*)inst)->cs, 3, failChain);
+            EmitIncReg(InputOffsetReg);
+            return true;
+
+        case Inst::MatchChar4:
+            instSize = sizeof(MatchChar4Inst);
+            EncodeLoadCharOrJump(failChain);
+            EncodeCharsTest(((const MatchChar4Inst*)inst)->cs, 4, failChain);
+            EmitIncReg(InputOffsetReg);
+            return true;
+
+        case Inst::MatchSet:
+        case Inst::MatchNegatedSet:
+            {
+                CompileAssert(sizeof(MatchSetInst<false>) == sizeof(MatchSetInst<true>));
+                const MatchSetInst<false>* const setInst = (const MatchSetInst<false>*)inst;
+                instSize = sizeof(*setInst);
+                CharTest test;
+                if (!BuildSetTest(setInst->set, test))
+                    return false;
+                EncodeLoadCharOrJump(failChain);
+                EncodeCharTest(test, inst->tag == Inst::MatchNegatedSet, failChain);
+                EmitIncReg(InputOffsetReg);
+                return true;
+            }
+
+        case Inst::MatchLiteral:
+            {
+                const MatchLiteralInst* const literalInst = (const MatchLiteralInst*)inst;
+                instSize = sizeof(*literalInst);
+                if (literalInst->length > MaxCodeSize)
+                    return false;
+                EncodeRemainingLengthTest(literalInst->length);
+                for (CharCount i = 0; i < literalInst->length; i++)
+                {
+                    EmitCmpCharImm(i, litbuf[literalInst->offset + i]);
+                    EmitJcc(CcNE, failChain);
+                }
+                EmitAddRegImm(InputOffsetReg, literalInst->length);
+                return true;
+            }
+
+        case Inst::MatchLiteralEquiv:
+            {
+                const MatchLiteralEquivInst* const literalInst = (const MatchLiteralEquivInst*)inst;
+                instSize = sizeof(*literalInst);
+                if (literalInst->length > MaxCodeSize)
+                    return false;
+                EncodeRemainingLengthTest(literalInst->length);
+                for (CharCount i = 0; i < literalInst->length; i++)
+                {
+                    EncodeLoadChar(i);
+                    EncodeCharsTest(litbuf + literalInst->offset + i * CaseInsensitive::EquivClassSize, CaseInsensitive::EquivClassSize, failChain);
+                }
+                EmitAddRegImm(InputOffsetReg, literalInst->length);
+                return true;
+            }
+
+        case Inst::OptMatchChar:
+            {
+                instSize = sizeof(OptMatchCharInst);
+                JumpChain skipChain;
+                EmitCmpRegReg(InputOffsetReg, InputLengthReg);
+                EmitJcc(CcAE, skipChain);
+                EmitCmpCharImm(0, ((const OptMatchCharInst*)inst)->c);
+                EmitJcc(CcNE, skipChain);
+                EmitIncReg(InputOffsetReg);
+                Bind(skipChain);
+                return true;
+            }
+
+        case Inst::OptMatchSet:
+            {
+                const OptMatchSetInst* const setInst = (const OptMatchSetInst*)inst;
+                instSize = sizeof(*setInst);
+                CharTest test;
+                if (!BuildSetTest(setInst->set, test))
+                    return false;
+                JumpChain skipChain;
+                EncodeLoadCharOrJump(skipChain);
+                EncodeCharTest(test, false, skipChain);
+                EmitIncReg(InputOffsetReg);
+                Bind(skipChain);
+                return true;
+            }
+
+        case Inst::SyncToCharAndContinue:
+            instSize = sizeof(SyncToCharAndContinueInst);
+            return EncodeCharSync(SyncMode::Continue, nullptr, CharMatcher(((const SyncToCharAndContinueInst*)inst)->c));
+
+        case Inst::SyncToCharAndConsume:
+            instSize = sizeof(SyncToCharAndConsumeInst);
+            return EncodeCharSync(SyncMode::Consume, nullptr, CharMatcher(((const SyncToCharAndConsumeInst*)inst)->c));
+
+        case Inst::SyncToCharAndBackup:
+            {
+                const SyncToCharAndBackupInst* const syncInst = (const SyncToCharAndBackupInst*)inst;
+                instSize = sizeof(*syncInst);
+                return EncodeCharSync(SyncMode::Backup, &syncInst->backup, CharMatcher(syncInst->c));
+            }
+
+        case Inst::SyncToChar2SetAndContinue:
+            instSize = sizeof(SyncToChar2SetAndContinueInst);
+            return EncodeCharSync(SyncMode::Continue, nullptr, CharsMatcher(((const SyncToChar2SetAndContinueInst*)inst)->cs, 2));
+
+        case Inst::SyncToChar2SetAndConsume:
+            instSize = sizeof(SyncToChar2SetAndConsumeInst);
+            return EncodeCharSync(SyncMode::Consume, nullptr, CharsMatcher(((const SyncToChar2SetAndConsumeInst*)inst)->cs, 2));
+
+        case Inst::SyncToSetAndContinue:
+        case Inst::SyncToNegatedSetAndContinue:
+            {
+                CompileAssert(sizeof(SyncToSetAndContinueInst<false>) == sizeof(SyncToSetAndContinueInst<true>));
+                const SyncToSetAndContinueInst<false>* const syncInst = (const SyncToSetAndContinueInst<false>*)inst;
+                instSize = sizeof(*syncInst);
+                CharTest test;
+                return BuildSetTest(syncInst->set, test) &&
+                    EncodeCharSync(SyncMode::Continue, nullptr, SetMatcher(test, inst->tag == Inst::SyncToNegatedSetAndContinue));
+            }
+
+        case Inst::SyncToSetAndConsume:
+        case Inst::SyncToNegatedSetAndConsume:
+            {
+                CompileAssert(sizeof(SyncToSetAndConsumeInst<false>) == sizeof(SyncToSetAndConsumeInst<true>));
+                const SyncToSetAndConsumeInst<false>* const syncInst = (const SyncToSetAndConsumeInst<false>*)inst;
+                instSize = sizeof(*syncInst);
+                CharTest test;
+                return BuildSetTest(syncInst->set, test) &&
+                    EncodeCharSync(SyncMode::Consume, nullptr, SetMatcher(test, inst->tag == Inst::SyncToNegatedSetAndConsume));
+            }
+
+        case Inst::SyncToSetAndBackup:
+        case Inst::SyncToNegatedSetAndBackup:
+            {
+                CompileAssert(sizeof(SyncToSetAndBackupInst<false>) == sizeof(SyncToSetAndBackupInst<true>));
+                const SyncToSetAndBackupInst<false>* const syncInst = (const SyncToSetAndBackupInst<false>*)inst;
+                instSize = sizeof(*syncInst);
+                CharTest test;
+                return BuildSetTest(syncInst->set, test) &&
+                    EncodeCharSync(SyncMode::Backup, &syncInst->backup, SetMatcher(test, inst->tag == Inst::SyncToNegatedSetAndBackup));
+            }
+
+        case Inst::SyncToChar2LiteralAndContinue:
+            instSize = sizeof(SyncToChar2LiteralAndContinueInst);
+            return EncodeLiteralSync(SyncMode::Continue, nullptr, ((const SyncToChar2LiteralAndContinueInst*)inst)->cs, 2);
+
+        case Inst::SyncToChar2LiteralAndConsume:
+            instSize = sizeof(SyncToChar2LiteralAndConsumeInst);
+            return EncodeLiteralSync(SyncMode::Consume, nullptr, ((const SyncToChar2LiteralAndConsumeInst*)inst)->cs, 2);
+
+        case Inst::SyncToChar2LiteralAndBackup:
+            {
+                const SyncToChar2LiteralAndBackupInst* const syncInst = (const SyncToChar2LiteralAndBackupInst*)inst;
+                instSize = sizeof(*syncInst);
+                return EncodeLiteralSync(SyncMode::Backup, &syncInst->backup, syncInst->cs, 2);
+            }
+
+        case Inst::SyncToLiteralAndContinue:
+            {
+                const SyncToLiteralAndContinueInst* const syncInst = (const SyncToLiteralAndContinueInst*)inst;
+                instSize = sizeof(*syncInst);
+                return EncodeLiteralSync(SyncMode::Continue, nullptr, litbuf + syncInst->offset, syncInst->length);
+            }
+
+        case Inst::SyncToLiteralAndConsume:
+            {
+                const SyncToLiteralAndConsumeInst* const syncInst = (const SyncToLiteralAndConsumeInst*)inst;
+                instSize = sizeof(*syncInst);
+                return EncodeLiteralSync(SyncMode::Consume, nullptr, litbuf + syncInst->offset, syncInst->length);
+            }
+
+        case Inst::SyncToLiteralAndBackup:
+            {
+                const SyncToLiteralAndBackupInst* const syncInst = (const SyncToLiteralAndBackupInst*)inst;
+                instSize = sizeof(*syncInst);
+                return EncodeLiteralSync(SyncMode::Backup, &syncInst->backup, litbuf + syncInst->offset, syncInst->length);
+            }
+
+        case Inst::SyncToLinearLiteralAndContinue:
+            {
+                const SyncToLinearLiteralAndContinueInst* const syncInst = (const SyncToLinearLiteralAndContinueInst*)inst;
+                instSize = sizeof(*syncInst);
+                return EncodeLiteralSync(SyncMode::Continue, nullptr, litbuf + syncInst->offset, syncInst->length);
+            }
+
+        case Inst::SyncToLinearLiteralAndConsume:
+            {
+                const SyncToLinearLiteralAndConsumeInst* const syncInst = (const SyncToLinearLiteralAndConsumeInst*)inst;
+                instSize = sizeof(*syncInst);
+                return EncodeLiteralSync(SyncMode::Consume, nullptr, litbuf + syncInst->offset, syncInst->length);
+            }
+
+        case Inst::SyncToLinearLiteralAndBackup:
+            {
+                const SyncToLinearLiteralAndBackupInst* const syncInst = (const SyncToLinearLiteralAndBackupInst*)inst;
+                instSize = sizeof(*syncInst);
+                return EncodeLiteralSync(SyncMode::Backup, &syncInst->backup, litbuf + syncInst->offset, syncInst->length);
+            }
+
+        case Inst::BeginDefineGroup:
+            {
+                const BeginDefineGroupInst* const groupInst = (const BeginDefineGroupInst*)inst;
+                instSize = sizeof(*groupInst);
+                EmitMovGroupMemReg(GroupOffsetDisplacement(groupInst->groupId), InputOffsetReg);
+                return true;
+            }
+
+        case Inst::EndDefineGroup:
+            {
+                // The undo action pushed by the interpreter is only needed by backtracking
+                const EndDefineGroupInst* const groupInst = (const EndDefineGroupInst*)inst;
+                instSize = sizeof(*groupInst);
+                EncodeEndGroup(groupInst->groupId);
+                return true;
+            }
+
+        case Inst::DefineGroupFixed:
+            {
+                const DefineGroupFixedInst* const groupInst = (const DefineGroupFixedInst*)inst;
+                instSize = sizeof(*groupInst);
+                if (groupInst->length > MaxImmediate)
+                    return false;
+                EmitLea(CharReg, InputOffsetReg, -(int)groupInst->length);
+                EmitMovGroupMemReg(GroupOffsetDisplacement(groupInst->groupId), CharReg);
+                EmitMovGroupMemImm(GroupLengthDisplacement(groupInst->groupId), groupInst->length);
+                return true;
+            }
+
+        case Inst::ChompCharStar:
+        case Inst::ChompCharPlus:
+            {
+                CompileAssert(sizeof(ChompCharInst<ChompMode::Star>) == sizeof(ChompCharInst<ChompMode::Plus>));
+                const ChompCharInst<ChompMode::Star>* const chompInst = (const ChompCharInst<ChompMode::Star>*)inst;
+                instSize = sizeof(*chompInst);
+                EncodeChomp(inst->tag == Inst::ChompCharStar ? ChompMode::Star : ChompMode::Plus, CharMatcher(chompInst->c));
+                return true;
+            }
+
+        case Inst::ChompSetStar:
+        case Inst::ChompSetPlus:
+            {
+                CompileAssert(sizeof(ChompSetInst<ChompMode::Star>) == sizeof(ChompSetInst<ChompMode::Plus>));
+                const ChompSetInst<ChompMode::Star>* const chompInst = (const ChompSetInst<ChompMode::Star>*)inst;
+                instSize = sizeof(*chompInst);
+                CharTest test;
+                if (!BuildSetTest(chompInst->set, test))
+                    return false;
+                EncodeChomp(inst->tag == Inst::ChompSetStar ? ChompMode::Star : ChompMode::Plus, SetMatcher(test));
+                return true;
+            }
+
+        case Inst::ChompCharGroupStar:
+        case Inst::ChompCharGroupPlus:
+            {
+                CompileAssert(sizeof(ChompCharGroupInst<ChompMode::Star>) == sizeof(ChompCharGroupInst<ChompMode::Plus>));
+                const ChompCharGroupInst<ChompMode::Star>* const chompInst = (const ChompCharGroupInst<ChompMode::Star>*)inst;
+                instSize = sizeof(*chompInst);
+                // The group's offset is written up front; the group stays undefined until its length is written
+                EmitMovGroupMemReg(GroupOffsetDisplacement(chompInst->groupId), InputOffsetReg);
+                EncodeChomp(inst->tag == Inst::ChompCharGroupStar ? ChompMode::Star : ChompMode::Plus, CharMatcher(chompInst->c));
+                EncodeEndGroup(chompInst->groupId);
+                return true;
+            }
+
+        case Inst::ChompSetGroupStar:
+        case Inst::ChompSetGroupPlus:
+            {
+                CompileAssert(sizeof(ChompSetGroupInst<ChompMode::Star>) == sizeof(ChompSetGroupInst<ChompMode::Plus>));
+                const ChompSetGroupInst<ChompMode::Star>* const chompInst = (const ChompSetGroupInst<ChompMode::Star>*)inst;
+                instSize = sizeof(*chompInst);
+                CharTest test;
+                if (!BuildSetTest(chompInst->set, test))
+                    return false;
+                EmitMovGroupMemReg(GroupOffsetDisplacement(chompInst->groupId), InputOffsetReg);
+                EncodeChomp(inst->tag == Inst::ChompSetGroupStar ? ChompMode::Star : ChompMode::Plus, SetMatcher(test));
+                EncodeEndGroup(chompInst->groupId);
+                return true;
+            }
+
+        case Inst::ChompCharBounded:
+            {
+                const ChompCharBoundedInst* const chompInst = (const ChompCharBoundedInst*)inst;
+                instSize = sizeof(*chompInst);
+                return EncodeChompBounded(chompInst->repeats, false, CharMatcher(chompInst->c));
+            }
+
+        case Inst::ChompSetBounded:
+            {
+                const ChompSetBoundedInst* const chompInst = (const ChompSetBoundedInst*)inst;
+                instSize = sizeof(*chompInst);
+                CharTest test;
+                return BuildSetTest(chompInst->set, test) && EncodeChompBounded(chompInst->repeats, false, SetMatcher(test));
+            }
+
+        case Inst::ChompSetBoundedGroupLastChar:
+            {
+                const ChompSetBoundedGroupLastCharInst* const chompInst = (const ChompSetBoundedGroupLastCharInst*)inst;
+                instSize = sizeof(*chompInst);
+                CharTest test;
+                if (!BuildSetTest(chompInst->set, test) || !EncodeChompBounded(chompInst->repeats, true, SetMatcher(test)))
+                    return false;
+
+                // If any character was consumed, the group is the last one
+                JumpChain emptyChain;
+                EmitMovdRegXmm(CharReg, LoopStartXmmReg);
+                EmitCmpRegReg(InputOffsetReg, CharReg);
+                EmitJcc(CcBE, emptyChain);
+                EmitLea(CharReg, InputOffsetReg, -1);
+                EmitMovGroupMemReg(GroupOffsetDisplacement(chompInst->groupId), CharReg);
+                EmitMovGroupMemImm(GroupLengthDisplacement(chompInst->groupId), 1);
+                Bind(emptyChain);
+                return true;
+            }
+
+        default:
+            // Everything else either needs the continuation stack, loop infos or assertion stack, or (for the
+            // equivalence class scanners and SyncToLiteralsAndBackup) is not worth a template
+            instSize = 0;
+            return false;
+        }
+    }
+
+    // ----------------------------------------------------------------------
+    // Instruction templates
+    // ----------------------------------------------------------------------
+
+    void RegexEncoder::EncodeLoadChar(const int offset)
+    {
+        EmitMovzxCharReg(CharReg, offset);
+    }
+
+    void RegexEncoder::EncodeLoadCharOrJump(JumpChain& atEndTarget)
+    {
+        EmitCmpRegReg(InputOffsetReg, InputLengthReg);
+        EmitJcc(CcAE, atEndTarget);
+        EncodeLoadChar(0);
+    }
+
+    void RegexEncoder::EncodeRemainingLengthTest(const CharCount length)
+    {
+        EmitMovRegReg(CharReg, InputLengthReg);
+        EmitSubRegReg(CharReg, InputOffsetReg);
+        EmitCmpRegImm(CharReg, length);
+        EmitJcc(CcB, failChain);
+    }
+
+    void RegexEncoder::EncodeCharTest(const CharTest& test, const bool isNegation, JumpChain& failTarget)
+    {
+        // Characters in the set go to memberTarget and the others to nonMemberTarget, one of which is the fall through
+        JumpChain passChain;
+        JumpChain& memberTarget = isNegation ? failTarget : passChain;
+        JumpChain& nonMemberTarget = isNegation ? passChain : failTarget;
+
+        EmitCmpRegImm(CharReg, Chars<char>::NumChars);
+        if (test.numRanges == 0)
+            EmitJcc(CcAE, nonMemberTarget);
+        else
+        {
+            JumpChain directChain;
+            EmitJcc(CcB, directChain);
+            for (uint i = 0; i < test.numRanges; i++)
+            {
+                // The ranges are sorted, so a character below this range is below all the remaining ones
+                EmitCmpRegImm(CharReg, CTU(test.lowers[i]));
+                EmitJcc(CcB, nonMemberTarget);
+                EmitCmpRegImm(CharReg, CTU(test.uppers[i]));
+                EmitJcc(CcBE, memberTarget);
+            }
+            EmitJmp(nonMemberTarget);
+            Bind(directChain);
+        }
+
+        bool isEmpty = true;
+        bool isFull = true;
+        for (uint i = 0; i < TableSize; i++)
+        {
+            isEmpty = isEmpty && test.direct[i] == 0;
+            isFull = isFull && test.direct[i] == 0xff;
+        }
+
+        if (isEmpty)
+        {
+            if (!isNegation)
+                EmitJmp(failTarget);
+        }
+        else if (isFull)
+        {
+            if (isNegation)
+                EmitJmp(failTarget);
+        }
+        else
+        {
+            // Carry is set for members
+            EmitBtTable(CharReg, AddTable(test.direct));
+            EmitJcc(isNegation ? CcB : CcAE, failTarget);
+        }
+        Bind(passChain);
+    }
+
+    void RegexEncoder::EncodeCharsTest(const Char* const cs, const int numChars, JumpChain& failTarget)
+    {
+        Char distinct[CaseInsensitive::EquivClassSize];
+        int numDistinct = 0;
+        for (int i = 0; i < numChars; i++)
+        {
+            bool isDuplicate = false;
+            for (int j = 0; j < numDistinct; j++)
+                isDuplicate = isDuplicate || distinct[j] == cs[i];
+            if (!isDuplicate)
+                distinct[numDistinct++] = cs[i];
+        }
+
+        JumpChain matchChain;
+        for (int i = 0; i < numDistinct - 1; i++)
+        {
+            EmitCmpRegImm(CharReg, CTU(distinct[i]));
+            EmitJcc(CcE, matchChain);
+        }
+        EmitCmpRegImm(CharReg, CTU(distinct[numDistinct - 1]));
+        EmitJcc(CcNE, failTarget);
+        Bind(matchChain);
+    }
+
+    bool RegexEncoder::EncodeSwitch(const SwitchCase* const cases, const int numCases, const bool isConsume)
+    {
+        for (int i = 0; i < numCases; i++)
+        {
+            if (ForwardTarget(cases[i].targetLabel) == nullptr)
+                return false;
+        }
+
+        EncodeLoadCharOrJump(failChain);
+        for (int i = 0; i < numCases; i++)
+        {
+            JumpChain& target = *ForwardTarget(cases[i].targetLabel);
+            EmitCmpRegImm(CharReg, CTU(cases[i].c));
+            if (isConsume)
+            {
+                JumpChain nextCaseChain;
+                EmitJcc(CcNE, nextCaseChain);
+                EmitIncReg(InputOffsetReg);
+                EmitJmp(target);
+                Bind(nextCaseChain);
+            }
+            else
+                EmitJcc(CcE, target);
+        }
+        return true;
+    }
+
+    void RegexEncoder::EncodeSucc()
+    {
+        EmitMovGroupMemReg(GroupOffsetDisplacement(0), MatchStartReg);
+        EmitMovRegReg(CharReg, InputOffsetReg);
+        EmitSubRegReg(CharReg, MatchStartReg);
+        EmitMovGroupMemReg(GroupLengthDisplacement(0), CharReg);
+        EmitMovRegImm(RegEAX, 1);
+        EmitRet();
+    }
+
+    void RegexEncoder::EncodeEndGroup(const int groupId)
+    {
+        EmitMovRegReg(CharReg, InputOffsetReg);
+        EmitSubRegGroupMem(CharReg, GroupOffsetDisplacement(groupId));
+        EmitMovGroupMemReg(GroupLengthDisplacement(groupId), CharReg);
+    }
+
+    void RegexEncoder::EncodeWordBoundaryTest(const bool isNegation)
+    {
+        // ScratchReg = inputOffset > 0 && IsWord(input[inputOffset - 1])
+        JumpChain prevDoneChain;
+        EmitXorRegReg(ScratchReg, ScratchReg);
+        EmitTestRegReg(InputOffsetReg, InputOffsetReg);
+        EmitJcc(CcE, prevDoneChain);
+        EncodeLoadChar(-1);
+        EncodeCharTest(wordTest, false, prevDoneChain);
+        EmitMovRegImm(ScratchReg, 1);
+        Bind(prevDoneChain);
+
+        // CharReg = inputOffset < inputLength && IsWord(input[inputOffset])
+        JumpChain currFalseChain;
+        JumpChain currDoneChain;
+        EncodeLoadCharOrJump(currFalseChain);
+        EncodeCharTest(wordTest, false, currFalseChain);
+        EmitMovRegImm(CharReg, 1);
+        EmitJmp(currDoneChain);
+        Bind(currFalseChain);
+        EmitXorRegReg(CharReg, CharReg);
+        Bind(currDoneChain);
+
+        // Fail if isNegation == (prev != curr)
+        EmitCmpRegReg(CharReg, ScratchReg);
+        EmitJcc(isNegation ? CcNE : CcE, failChain);
+    }
+
+    template <typename MatchT>
+    bool RegexEncoder::EncodeCharSync(const SyncMode mode, const CountDomain* const backup, const MatchT& matcher)
+    {
+        switch (mode)
+        {
+        case SyncMode::Continue:
+            {
+                // Reaching the end of the input is not a failure: the rest of the program may match the empty string there
+                JumpChain doneChain;
+                EncodeCharScan(doneChain, matcher);
+                Bind(doneChain);
+                EmitMovRegReg(MatchStartReg, InputOffsetReg);
+                return true;
+            }
+
+        case SyncMode::Consume:
+            EncodeCharScan(hardFailChain, matcher);
+            EmitMovRegReg(MatchStartReg, InputOffsetReg);
+            EmitIncReg(InputOffsetReg);
+            return true;
+
+        default:
+            Assert(mode == SyncMode::Backup);
+            return EncodeBackupSync(*backup, [&]()
+            {
+                EncodeCharScan(hardFailChain, matcher);
+            });
+        }
+    }
+
+    bool RegexEncoder::EncodeLiteralSync(const SyncMode mode, const CountDomain* const backup, const Char* const literal, const CharCount length)
+    {
+        // The scan compares the whole literal at each offset, which only beats the interpreter's Boyer-Moore scanners on
+        // short literals
+        if (length > MaxSyncLiteralLength)
+            return false;
+
+        switch (mode)
+        {
+        case SyncMode::Continue:
+            EncodeLiteralScan(literal, length);
+            EmitMovRegReg(MatchStartReg, InputOffsetReg);
+            return true;
+
+        case SyncMode::Consume:
+            EncodeLiteralScan(literal, length);
+            EmitMovRegReg(MatchStartReg, InputOffsetReg);
+            EmitAddRegImm(InputOffsetReg, length);
+            return true;
+
+        default:
+            Assert(mode == SyncMode::Backup);
+            return EncodeBackupSync(*backup, [&]()
+            {
+                EncodeLiteralScan(literal, length);
+            });
+        }
+    }
+
+    template <typename MatchT>
+    void RegexEncoder::EncodeCharScan(JumpChain& notFoundTarget, const MatchT& matcher)
+    {
+        // Advance inputOffset to the first character accepted by the matcher
+        JumpChain advanceChain;
+        JumpChain foundChain;
+        const uint loop = pc;
+        EmitCmpRegReg(InputOffsetReg, InputLengthReg);
+        EmitJcc(CcAE, notFoundTarget);
+        matcher.Encode(*this, advanceChain);
+        EmitJmp(foundChain);
+        Bind(advanceChain);
+        EmitIncReg(InputOffsetReg);
+        EmitJmpBack(loop);
+        Bind(foundChain);
+    }
+
+    void RegexEncoder::EncodeLiteralScan(const Char* const literal, const CharCount length)
+    {
+        // Advance inputOffset to the first occurrence of the literal, or hard fail. ScratchReg is the last offset at which
+        // the literal fits.
+        EmitMovRegReg(ScratchReg, InputLengthReg);
+        EmitSubRegImm(ScratchReg, length);
+        EmitJcc(CcB, hardFailChain);
+
+        JumpChain testChain;
+        EmitJmp(testChain);
+        const uint advance = pc;
+        EmitIncReg(InputOffsetReg);
+        Bind(testChain);
+        EmitCmpRegReg(InputOffsetReg, ScratchReg);
+        EmitJcc(CcA, hardFailChain);
+        for (CharCount i = 0; i < length; i++)
+        {
+            EmitCmpCharImm(i, literal[i]);
+            EmitJccBack(CcNE, advance);
+        }
+    }
+
+    template <typename ScanFn>
+    bool RegexEncoder::EncodeBackupSync(const CountDomain& backup, const ScanFn& scanFn)
+    {
+        if (backup.lower > MaxImmediate || (backup.upper != CharCountFlag && backup.upper > MaxImmediate))
+            return false;
+
+        if (backup.lower > 0)
+        {
+            // Even a match at the very end of the input would not allow for the minimum backup
+            EmitMovRegReg(CharReg, InputLengthReg);
+            EmitSubRegReg(CharReg, MatchStartReg);
+            EmitCmpRegImm(CharReg, backup.lower);
+            EmitJcc(CcB, hardFailChain);
+        }
+
+        // Until the input offset we last synced to is reached again, syncing would find the same place
+        JumpChain skipChain;
+        EmitMovdRegXmm(CharReg, NextSyncInputOffsetXmmReg);
+        EmitCmpRegReg(InputOffsetReg, CharReg);
+        EmitJcc(CcB, skipChain);
+
+        if (backup.lower > 0)
+        {
+            // No use looking for a match until the minimum backup is possible
+            JumpChain canBackupChain;
+            EmitMovRegReg(CharReg, InputOffsetReg);
+            EmitSubRegReg(CharReg, MatchStartReg);
+            EmitCmpRegImm(CharReg, backup.lower);
+            EmitJcc(CcAE, canBackupChain);
+            EmitLea(InputOffsetReg, MatchStartReg, backup.lower);
+            Bind(canBackupChain);
+        }
+
+        scanFn();
+
+        EmitLea(CharReg, InputOffsetReg, 1);
+        EmitMovdXmmReg(NextSyncInputOffsetXmmReg, CharReg);
+
+        if (backup.upper != CharCountFlag)
+        {
+            // Back up at most backup.upper for the new start
+            JumpChain withinBackupChain;
+            EmitMovRegReg(CharReg, InputOffsetReg);
+            EmitSubRegReg(CharReg, MatchStartReg);
+            EmitCmpRegImm(CharReg, backup.upper);
+            EmitJcc(CcBE, withinBackupChain);
+            EmitLea(MatchStartReg, InputOffsetReg, -(int)backup.upper);
+            Bind(withinBackupChain);
+        }
+
+        EmitMovRegReg(InputOffsetReg, MatchStartReg);
+        Bind(skipChain);
+        return true;
+    }
+
+    template <typename MatchT>
+    void RegexEncoder::EncodeChomp(const ChompMode mode, const MatchT& matcher)
+    {
+        if (mode == ChompMode::Plus)
+        {
+            EmitCmpRegReg(InputOffsetReg, InputLengthReg);
+            EmitJcc(CcAE, failChain);
+            matcher.Encode(*this, failChain);
+            EmitIncReg(InputOffsetReg);
+        }
+
+        JumpChain doneChain;
+        const uint loop = pc;
+        EmitCmpRegReg(InputOffsetReg, InputLengthReg);
+        EmitJcc(CcAE, doneChain);
+        matcher.Encode(*this, doneChain);
+        EmitIncReg(InputOffsetReg);
+        EmitJmpBack(loop);
+        Bind(doneChain);
+    }
+
+    template <typename MatchT>
+    bool RegexEncoder::EncodeChompBounded(const CountDomain& repeats, const bool saveStart, const MatchT& matcher)
+    {
+        if (repeats.lower > MaxImmediate || (repeats.upper != CharCountFlag && repeats.upper > MaxImmediate))
+            return false;
+
+        if (saveStart || repeats.lower > 0)
+            EmitMovdXmmReg(LoopStartXmmReg, InputOffsetReg);
+
+        // ScratchReg = upper >= inputLength - inputOffset ? inputLength : inputOffset + upper
+        EmitMovRegReg(ScratchReg, InputLengthReg);
+        if (repeats.upper != CharCountFlag)
+        {
+            JumpChain limitChain;
+            EmitSubRegReg(ScratchReg, InputOffsetReg);
+            EmitCmpRegImm(ScratchReg, repeats.upper);
+            EmitMovRegReg(ScratchReg, InputLengthReg);
+            EmitJcc(CcBE, limitChain);
+            EmitLea(ScratchReg, InputOffsetReg, repeats.upper);
+            Bind(limitChain);
+        }
+
+        JumpChain doneChain;
+        const uint loop = pc;
+        EmitCmpRegReg(InputOffsetReg, ScratchReg);
+        EmitJcc(CcAE, doneChain);
+        matcher.Encode(*this, doneChain);
+        EmitIncReg(InputOffsetReg);
+        EmitJmpBack(loop);
+        Bind(doneChain);
+
+        if (repeats.lower > 0)
+        {
+            EmitMovdRegXmm(CharReg, LoopStartXmmReg);
+            EmitAddRegImm(CharReg, repeats.lower);
+            EmitCmpRegReg(InputOffsetReg, CharReg);
+            EmitJcc(CcB, failChain);
+        }
+        return true;
+    }
+
+    RegexEncoder::CharMatcher::CharMatcher(const Char c) : c(c)
+    {
+    }
+
+    void RegexEncoder::CharMatcher::Encode(RegexEncoder& encoder, JumpChain& failTarget) const
+    {
+        encoder.EmitCmpCharImm(0, c);
+        encoder.EmitJcc(CcNE, failTarget);
+    }
+
+    RegexEncoder::CharsMatcher::CharsMatcher(const Char* const cs, const int numChars) : cs(cs), numChars(numChars)
+    {
+    }
+
+    void RegexEncoder::CharsMatcher::Encode(RegexEncoder& encoder, JumpChain& failTarget) const
+    {
+        encoder.EncodeLoadChar(0);
+        encoder.EncodeCharsTest(cs, numChars, failTarget);
+    }
+
+    RegexEncoder::SetMatcher::SetMatcher(const CharTest& test, const bool isNegation) : test(test), isNegation(isNegation)
+    {
+    }
+
+    void RegexEncoder::SetMatcher::Encode(RegexEncoder& encoder, JumpChain& failTarget) const
+    {
+        encoder.EncodeLoadChar(0);
+        encoder.EncodeCharTest(test, isNegation, failTarget);
+    }
+
+    bool RegexEncoder::BuildSetTest(const RuntimeCharSet<Char>& set, CharTest& test) const
+    {
+        memset(test.direct, 0, sizeof(test.direct));
+        for (uint c = 0; c < Chars<char>::NumChars; c++)
+        {
+            if (set.Get(UTC(c)))
+                test.direct[c / 8] |= (uint8)(1 << (c % 8));
+        }
+
+        test.numRanges = 0;
+        Char lower;
+        Char upper;
+        uint next = Chars<char>::NumChars;
+        while (next <= MaxUChar && set.GetNextNonDirectRange(UTC(next), &lower, &upper))
+        {
+            if (test.numRanges == MaxSetRanges)
+                return false;
+            if (CTU(lower) < next)
+                lower = UTC(next);
+            test.lowers[test.numRanges] = lower;
+            test.uppers[test.numRanges] = upper;
+            test.numRanges++;
+            next = CTU(upper) + 1;
+        }
+        return true;
+    }
+
+    uint RegexEncoder::AddTable(const uint8 (&table)[TableSize])
+    {
+        for (uint i = 0; i < numTables; i++)
+        {
+            if (memcmp(tables + i * TableSize, table, TableSize) == 0)
+                return i;
+        }
+
+        if (numTables == MaxTables)
+        {
+            isTooLarge = true;
+            return 0;
+        }
+        memcpy(tables + numTables * TableSize, table, TableSize);
+        return numTables++;
+    }
+
+    int RegexEncoder::GroupOffsetDisplacement(const int groupId)
+    {
+        return groupId * (int)sizeof(GroupInfo) + (int)offsetof(GroupInfo, offset);
+    }
+
+    int RegexEncoder::GroupLengthDisplacement(const int groupId)
+    {
+        return groupId * (int)sizeof(GroupInfo) + (int)offsetof(GroupInfo, length);
+    }
+
+    // ----------------------------------------------------------------------
+    // Instruction encodings
+    // ----------------------------------------------------------------------
+
+    void RegexEncoder::Emit(const uint8 b)
+    {
+        if (pc >= MaxCodeSize)
+        {
+            isTooLarge = true;
+            return;
+        }
+        buffer[pc++] = b;
+    }
+
+    void RegexEncoder::Emit16(const uint16 v)
+    {
+        Emit((uint8)v);
+        Emit((uint8)(v >> 8));
+    }
+
+    void RegexEncoder::Emit32(const uint32 v)
+    {
+        Emit((uint8)v);
+        Emit((uint8)(v >> 8));
+        Emit((uint8)(v >> 16));
+        Emit((uint8)(v >> 24));
+    }
+
+    void RegexEncoder::EmitRex(const uint reg, const uint index, const uint base)
+    {
+        const uint8 rex = (uint8)(0x40 | ((reg & 8) >> 1) | ((index & 8) >> 2) | ((base & 8) >> 3));
+        if (rex != 0x40)
+            Emit(rex);
+    }
+
+    void RegexEncoder::EmitModRmReg(const uint reg, const uint rm)
+    {
+        Emit((uint8)(0xc0 | ((reg & 7) << 3) | (rm & 7)));
+    }
+
+    void RegexEncoder::EmitModRmMem(const uint reg, const RegNum base, const int displacement)
+    {
+        // No base used here needs a SIB byte, or has no displacement-free form
+        Assert((base & 7) != 4 && (base & 7) != 5);
+
+        if (displacement == 0)
+            Emit((uint8)(((reg & 7) << 3) | (base & 7)));
+        else if (displacement == (int8)displacement)
+        {
+            Emit((uint8)(0x40 | ((reg & 7) << 3) | (base & 7)));
+            Emit((uint8)displacement);
+        }
+        else
+        {
+            Emit((uint8)(0x80 | ((reg & 7) << 3) | (base & 7)));
+            Emit32((uint32)displacement);
+        }
+    }
+
+    void RegexEncoder::EmitModRmInput(const uint reg, const int offset)
+    {
+        // [InputReg + InputOffsetReg * sizeof(Char) + offset * sizeof(Char)]
+        CompileAssert(sizeof(Char) == 2);
+        const int displacement = offset * (int)sizeof(Char);
+        const uint8 sib = (uint8)((1 << 6) | ((InputOffsetReg & 7) << 3) | (InputReg & 7));
+        if (displacement == 0)
+        {
+            Emit((uint8)(((reg & 7) << 3) | 4));
+            Emit(sib);
+        }
+        else if (displacement == (int8)displacement)
+        {
+            Emit((uint8)(0x40 | ((reg & 7) << 3) | 4));
+            Emit(sib);
+            Emit((uint8)displacement);
+        }
+        else
+        {
+            Emit((uint8)(0x80 | ((reg & 7) << 3) | 4));
+            Emit(sib);
+            Emit32((uint32)displacement);
+        }
+    }
+
+    void RegexEncoder::EmitMovRegReg(const RegNum dst, const RegNum src)
+    {
+        // mov r32, r/m32
+        EmitRex(dst, 0, src);
+        Emit(0x8b);
+        EmitModRmReg(dst, src);
+    }
+
+    void RegexEncoder::EmitMovRegImm(const RegNum dst, const uint32 imm)
+    {
+        // mov r32, imm32
+        EmitRex(0, 0, dst);
+        Emit((uint8)(0xb8 | (dst & 7)));
+        Emit32(imm);
+    }
+
+    void RegexEncoder::EmitAluRegReg(const uint8 opcode, const RegNum dst, const RegNum src)
+    {
+        // op r32, r/m32
+        EmitRex(dst, 0, src);
+        Emit(opcode);
+        EmitModRmReg(dst, src);
+    }
+
+    void RegexEncoder::EmitAluRegImm(const uint extension, const RegNum dst, const int32 imm)
+    {
+        // op r/m32, imm8 (sign extended) or op r/m32, imm32
+        EmitRex(0, 0, dst);
+        if (imm == (int8)imm)
+        {
+            Emit(0x83);
+            EmitModRmReg(extension, dst);
+            Emit((uint8)imm);
+        }
+        else
+        {
+            Emit(0x81);
+            EmitModRmReg(extension, dst);
+            Emit32((uint32)imm);
+        }
+    }
+
+    void RegexEncoder::EmitIncReg(const RegNum reg)
+    {
+        // inc r/m32
+        EmitRex(0, 0, reg);
+        Emit(0xff);
+        EmitModRmReg(0, reg);
+    }
+
+    void RegexEncoder::EmitLea(const RegNum dst, const RegNum base, const int displacement)
+    {
+        // lea r32, [base + displacement]; the 64-bit address is truncated to 32 bits
+        EmitRex(dst, 0, base);
+        Emit(0x8d);
+        EmitModRmMem(dst, base, displacement);
+    }
+
+    void RegexEncoder::EmitSubRegGroupMem(const RegNum dst, const int displacement)
+    {
+        // sub r32, [GroupInfosReg + displacement]
+        EmitRex(dst, 0, GroupInfosReg);
+        Emit(0x2b);
+        EmitModRmMem(dst, GroupInfosReg, displacement);
+    }
+
+    void RegexEncoder::EmitMovGroupMemReg(const int displacement, const RegNum src)
+    {
+        // mov [GroupInfosReg + displacement], r32
+        EmitRex(src, 0, GroupInfosReg);
+        Emit(0x89);
+        EmitModRmMem(src, GroupInfosReg, displacement);
+    }
+
+    void RegexEncoder::EmitMovGroupMemImm(const int displacement, const uint32 imm)
+    {
+        // mov dword [GroupInfosReg + displacement], imm32
+        EmitRex(0, 0, GroupInfosReg);
+        Emit(0xc7);
+        EmitModRmMem(0, GroupInfosReg, displacement);
+        Emit32(imm);
+    }
+
+    void RegexEncoder::EmitMovzxCharReg(const RegNum dst, const int offset)
+    {
+        // movzx r32, word [input + (inputOffset + offset) * 2]
+        EmitRex(dst, InputOffsetReg, InputReg);
+        Emit(0x0f);
+        Emit(0xb7);
+        EmitModRmInput(dst, offset);
+    }
+
+    void RegexEncoder::EmitCmpCharImm(const int offset, const Char c)
+    {
+        // cmp word [input + (inputOffset + offset) * 2], imm16
+        Emit(0x66);
+        EmitRex(0, InputOffsetReg, InputReg);
+        Emit(0x81);
+        EmitModRmInput(7, offset);
+        Emit16((uint16)CTU(c));
+    }
+
+    void RegexEncoder::EmitBtTable(const RegNum bitIndex, const uint table)
+    {
+        // bt dword [rip + table], r32
+        EmitRex(bitIndex, 0, 0);
+        Emit(0x0f);
+        Emit(0xa3);
+        Emit((uint8)(((bitIndex & 7) << 3) | 5));
+        if (numTableRefs == MaxTableRefs || pc + 4 > MaxCodeSize)
+        {
+            isTooLarge = true;
+            return;
+        }
+        tableRefs[numTableRefs].displacementOffset = pc;
+        tableRefs[numTableRefs].table = table;
+        numTableRefs++;
+        Emit32(0);
+    }
+
+    void RegexEncoder::EmitMovdXmmReg(const XmmRegNum dst, const RegNum src)
+    {
+        // movd xmm, r32
+        Emit(0x66);
+        EmitRex(dst, 0, src);
+        Emit(0x0f);
+        Emit(0x6e);
+        EmitModRmReg(dst, src);
+    }
+
+    void RegexEncoder::EmitMovdRegXmm(const RegNum dst, const XmmRegNum src)
+    {
+        // movd r32, xmm
+        Emit(0x66);
+        EmitRex(src, 0, dst);
+        Emit(0x0f);
+        Emit(0x7e);
+        EmitModRmReg(src, dst);
+    }
+
+    void RegexEncoder::EmitRet()
+    {
+        Emit(0xc3);
+    }
+
+    void RegexEncoder::EmitJcc(const ConditionCode cc, JumpChain& target)
+    {
+        // jcc rel32
+        Emit(0x0f);
+        Emit((uint8)(0x80 | cc));
+        EmitLink(target);
+    }
+
+    void RegexEncoder::EmitJccBack(const ConditionCode cc, const uint target)
+    {
+        Emit(0x0f);
+        Emit((uint8)(0x80 | cc));
+        Emit32((uint32)((int)target - (int)(pc + 4)));
+    }
+
+    void RegexEncoder::EmitJmp(JumpChain& target)
+    {
+        // jmp rel32
+        Emit(0xe9);
+        EmitLink(target);
+    }
+
+    void RegexEncoder::EmitJmpBack(const uint target)
+    {
+        Emit(0xe9);
+        Emit32((uint32)((int)target - (int)(pc + 4)));
+    }
+
+    void RegexEncoder::EmitLink(JumpChain& target)
+    {
+        // The displacement field holds the previous link until the target is bound
+        if (pc + 4 > MaxCodeSize)
+        {
+            isTooLarge = true;
+            return;
+        }
+        const int link = pc;
+        Emit32((uint32)target.last);
+        target.last = link;
+    }
+
+    void RegexEncoder::Bind(JumpChain& chain)
+    {
+        if (isTooLarge)
+            return;
+
+        int link = chain.last;
+        while (link != -1)
+        {
+            int next;
+            memcpy(&next, buffer + link, sizeof(next));
+            const int displacement = (int)pc - (link + 4);
+            memcpy(buffer + link, &displacement, sizeof(displacement));
+            link = next;
+        }
+        chain.last = -1;
+    }
+}
+
+#endif
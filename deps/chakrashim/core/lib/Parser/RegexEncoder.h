@@ -0,0 +1,237 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// Translation of regex programs to x64 machine code
+//
+// Only programs which never push a choicepoint are translated: every instruction either moves forward through the
+// program or fails the current match attempt, so a match attempt is a single straight pass and the only state is a
+// handful of offsets into the input, which live in registers. The code for an instruction is a template specialized
+// on its operands (characters, sets, literals, group ids) with the same semantics as its Exec method, and the loop
+// over start offsets in Matcher::Match is part of the generated code.
+//
+// The generated function is a leaf which touches only volatile registers and never the stack, so it needs no unwind
+// data. It is position independent: jumps are relative and the tables for set tests follow the code and are addressed
+// relative to the instruction pointer.
+//
+#pragma once
+
+#if ENABLE_REGEX_NATIVE_CODEGEN
+
+namespace UnifiedRegex
+{
+    class RegexEncoder : private Chars<wchar_t>
+    {
+    public:
+        static const uint MaxCodeSize = 16 * 1024;
+
+    private:
+        static const uint MaxSetRanges = 8;
+        static const uint MaxSyncLiteralLength = 8;
+        static const uint MaxTables = 64;
+        static const uint MaxTableRefs = 256;
+        static const uint TableSize = Chars<char>::NumChars / 8;
+
+        enum RegNum : uint8
+        {
+            RegEAX = 0,
+            RegECX = 1,
+            RegEDX = 2,
+            RegR8 = 8,
+            RegR9 = 9,
+            RegR10 = 10,
+            RegR11 = 11
+        };
+
+        enum XmmRegNum : uint8
+        {
+            RegXMM0 = 0,
+            RegXMM1 = 1
+        };
+
+        // Register assignment. The first four are where the calling convention passes the arguments of RegexNativeCode.
+        static const RegNum InputReg = RegECX;          // const Char* input
+        static const RegNum InputLengthReg = RegEDX;    // inputLength
+        static const RegNum MatchStartReg = RegR8;      // matchStart, updated by sync instructions
+        static const RegNum GroupInfosReg = RegR9;      // GroupInfo* groupInfos
+        static const RegNum InputOffsetReg = RegR10;    // inputOffset
+        static const RegNum CharReg = RegEAX;           // character under test
+        static const RegNum ScratchReg = RegR11;
+        static const XmmRegNum LoopStartXmmReg = RegXMM0;      // inputOffset when a bounded chomp began
+        static const XmmRegNum NextSyncInputOffsetXmmReg = RegXMM1;
+
+        enum ConditionCode : uint8
+        {
+            CcB = 0x2,
+            CcAE = 0x3,
+            CcE = 0x4,
+            CcNE = 0x5,
+            CcBE = 0x6,
+            CcA = 0x7
+        };
+
+        enum class SyncMode : uint8
+        {
+            Continue,
+            Consume,
+            Backup
+        };
+
+        // Forward jumps to the same not yet emitted location are chained through their displacement fields
+        struct JumpChain
+        {
+            int last;
+
+            JumpChain() : last(-1) {}
+        };
+
+        // Characters accepted by a test: a bitmap for the first 256 characters and sorted ranges for the rest
+        struct CharTest
+        {
+            uint8 direct[TableSize];
+            uint numRanges;
+            Char lowers[MaxSetRanges];
+            Char uppers[MaxSetRanges];
+        };
+
+        struct TableRef
+        {
+            uint displacementOffset;
+            uint table;
+        };
+
+        // Tests of the character at inputOffset, which is known to be in the input, for scans and chomps
+        struct CharMatcher
+        {
+            const Char c;
+
+            CharMatcher(const Char c);
+            void Encode(RegexEncoder& encoder, JumpChain& failTarget) const;
+        };
+
+        struct CharsMatcher
+        {
+            const Char* const cs;
+            const int numChars;
+
+            CharsMatcher(const Char* const cs, const int numChars);
+            void Encode(RegexEncoder& encoder, JumpChain& failTarget) const;
+        };
+
+        struct SetMatcher
+        {
+            const CharTest& test;
+            const bool isNegation;
+
+            SetMatcher(const CharTest& test, const bool isNegation = false);
+            void Encode(RegexEncoder& encoder, JumpChain& failTarget) const;
+        };
+
+        const Program* program;
+        const Char* litbuf;
+
+        // Code buffer, in the allocator
+        uint8* buffer;
+        uint pc;
+        bool isTooLarge;
+
+        // Offset of the code for each instruction label, and the jumps waiting for labels not yet reached
+        int* labelOffsets;
+        JumpChain* labelChains;
+
+        JumpChain failChain;
+        JumpChain hardFailChain;
+
+        // Bitmaps of set tests, emitted after the code
+        uint8* tables;
+        uint numTables;
+        TableRef* tableRefs;
+        uint numTableRefs;
+
+        CharTest wordTest;
+        CharTest newlineTest;
+
+        RegexEncoder(ArenaAllocator* allocator, const Program* program);
+
+        bool EncodeProgram();
+        JumpChain* ForwardTarget(const Label label);
+        bool EncodeInst(const Inst* inst, uint& instSize);
+
+        // Instruction templates. Those which may not apply to every instance of an instruction return false if the
+        // instance cannot be translated.
+        void EncodeLoadChar(const int offset);
+        void EncodeLoadCharOrJump(JumpChain& atEndTarget);
+        void EncodeRemainingLengthTest(const CharCount length);
+        void EncodeCharTest(const CharTest& test, const bool isNegation, JumpChain& failTarget);
+        void EncodeCharsTest(const Char* const cs, const int numChars, JumpChain& failTarget);
+        bool EncodeSwitch(const SwitchCase* const cases, const int numCases, const bool isConsume);
+        void EncodeSucc();
+        void EncodeEndGroup(const int groupId);
+        void EncodeWordBoundaryTest(const bool isNegation);
+        template <typename MatchT>
+        bool EncodeCharSync(const SyncMode mode, const CountDomain* const backup, const MatchT& matcher);
+        bool EncodeLiteralSync(const SyncMode mode, const CountDomain* const backup, const Char* const literal, const CharCount length);
+        template <typename MatchT>
+        void EncodeCharScan(JumpChain& notFoundTarget, const MatchT& matcher);
+        void EncodeLiteralScan(const Char* const literal, const CharCount length);
+        template <typename ScanFn>
+        bool EncodeBackupSync(const CountDomain& backup, const ScanFn& scanFn);
+        template <typename MatchT>
+        void EncodeChomp(const ChompMode mode, const MatchT& matcher);
+        template <typename MatchT>
+        bool EncodeChompBounded(const CountDomain& repeats, const bool saveStart, const MatchT& matcher);
+
+        bool BuildSetTest(const RuntimeCharSet<Char>& set, CharTest& test) const;
+        uint AddTable(const uint8 (&table)[TableSize]);
+        static int GroupOffsetDisplacement(const int groupId);
+        static int GroupLengthDisplacement(const int groupId);
+
+        // Instruction encodings. Operations on general purpose registers are 32 bits wide.
+        void Emit(const uint8 b);
+        void Emit16(const uint16 v);
+        void Emit32(const uint32 v);
+        void EmitRex(const uint reg, const uint index, const uint base);
+        void EmitModRmReg(const uint reg, const uint rm);
+        void EmitModRmMem(const uint reg, const RegNum base, const int displacement);
+        void EmitModRmInput(const uint reg, const int offset);
+
+        void EmitMovRegReg(const RegNum dst, const RegNum src);
+        void EmitMovRegImm(const RegNum dst, const uint32 imm);
+        void EmitAluRegReg(const uint8 opcode, const RegNum dst, const RegNum src);
+        void EmitAluRegImm(const uint extension, const RegNum dst, const int32 imm);
+        void EmitAddRegImm(const RegNum dst, const int32 imm) { EmitAluRegImm(0, dst, imm); }
+        void EmitSubRegImm(const RegNum dst, const int32 imm) { EmitAluRegImm(5, dst, imm); }
+        void EmitCmpRegImm(const RegNum dst, const int32 imm) { EmitAluRegImm(7, dst, imm); }
+        void EmitSubRegReg(const RegNum dst, const RegNum src) { EmitAluRegReg(0x2B, dst, src); }
+        void EmitCmpRegReg(const RegNum dst, const RegNum src) { EmitAluRegReg(0x3B, dst, src); }
+        void EmitXorRegReg(const RegNum dst, const RegNum src) { EmitAluRegReg(0x33, dst, src); }
+        void EmitTestRegReg(const RegNum dst, const RegNum src) { EmitAluRegReg(0x85, dst, src); }
+        void EmitIncReg(const RegNum reg);
+        void EmitLea(const RegNum dst, const RegNum base, const int displacement);
+        void EmitSubRegGroupMem(const RegNum dst, const int displacement);
+        void EmitMovGroupMemReg(const int displacement, const RegNum src);
+        void EmitMovGroupMemImm(const int displacement, const uint32 imm);
+        void EmitMovzxCharReg(const RegNum dst, const int offset);
+        void EmitCmpCharImm(const int offset, const Char c);
+        void EmitBtTable(const RegNum bitIndex, const uint table);
+        void EmitMovdXmmReg(const XmmRegNum dst, const RegNum src);
+        void EmitMovdRegXmm(const RegNum dst, const XmmRegNum src);
+        void EmitRet();
+
+        void EmitJcc(const ConditionCode cc, JumpChain& target);
+        void EmitJccBack(const ConditionCode cc, const uint target);
+        void EmitJmp(JumpChain& target);
+        void EmitJmpBack(const uint target);
+        void EmitLink(JumpChain& target);
+        void Bind(JumpChain& chain);
+
+    public:
+        // Translate the instructions of the program. Returns false, leaving the program to the interpreter, if it uses an
+        // instruction which is not translated or the code would be too large. On success, code points to the code in the
+        // allocator.
+        static bool Encode(ArenaAllocator* allocator, const Program* program, uint8*& code, uint& codeSize);
+    };
+}
+
+#endif
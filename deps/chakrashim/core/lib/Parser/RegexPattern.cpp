@@ -49,6 +49,9 @@ namespace UnifiedRegex
         if(isShallowClone)
             return;
 
+#if ENABLE_REGEX_NATIVE_CODEGEN
+        rep.unified.program->FreeNativeCode(scriptContext);
+#endif
         rep.unified.program->FreeBody(scriptContext->RegexAllocator());
     }
 
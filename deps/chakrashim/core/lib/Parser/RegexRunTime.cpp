@@ -4697,6 +4697,24 @@ namespace UnifiedRegex
         }
     }
 
+#if ENABLE_REGEX_NATIVE_CODEGEN
+    void Matcher::CountTowardsNativeCode()
+    {
+        // A shallow clone shares the program with a pattern of another script context, which owns its code
+        if (pattern->isShallowClone)
+            return;
+
+        Program* const mutableProgram = pattern->rep.unified.program;
+        Assert(mutableProgram == program);
+        if (--mutableProgram->nativeCodeCountdown != 0)
+            return;
+
+        RegexCodeGenerator* const codeGenerator = pattern->GetScriptContext()->InitRegexCodeGenerator();
+        if (codeGenerator != nullptr)
+            codeGenerator->CodeGen(mutableProgram);
+    }
+#endif
+
     __inline bool Matcher::MatchBOILiteral2(const Char* const input, const CharCount inputLength, CharCount offset, DWORD literal2)
     {
         if (offset == 0 && inputLength >= 2)
@@ -4757,6 +4775,43 @@ namespace UnifiedRegex
 
         case Program::InstructionsTag:
             {
+#if ENABLE_REGEX_NATIVE_CODEGEN
+                if (prog->nativeCode == nullptr && prog->nativeCodeCountdown != 0)
+                    CountTowardsNativeCode();
+
+                if (prog->nativeCode != nullptr)
+                {
+                    res = prog->nativeCode(input, inputLength, offset, groupInfos);
+                    if (!res)
+                        ResetInnerGroups(0, prog->numGroups - 1);
+                    break;
+                }
+#endif
+
+                if (prog->lazyDfaMatcher != 0)
+                {
+                    CharCount matchStart;
+                    CharCount matchEnd;
+                    if (!prog->lazyDfaMatcher->Match(scriptContext->GetRecycler(), input, inputLength, offset, isStickyPresent, matchStart, matchEnd))
+                    {
+                        ResetInnerGroups(0, prog->numGroups - 1);
+                        res = false;
+                        break;
+                    }
+
+                    if (prog->numGroups == 1)
+                    {
+                        GroupInfo* const info = GroupIdToGroupInfo(0);
+                        info->offset = matchStart;
+                        info->length = matchEnd - matchStart;
+                        res = true;
+                        break;
+                    }
+
+                    // Bind the groups by backtracking from where the match is known to begin
+                    offset = matchStart;
+                }
+
                 previousQcTime = 0;
                 uint qcTicks = 0;
 
@@ -4897,6 +4952,12 @@ namespace UnifiedRegex
         , numLoops(0)
     {
         tag = InstructionsTag;
+        lazyDfaMatcher = 0;
+#if ENABLE_REGEX_NATIVE_CODEGEN
+        nativeCode = nullptr;
+        nativeCodeSize = 0;
+        nativeCodeCountdown = REGEX_CONFIG_FLAG(RegexJit) ? (uint)REGEX_CONFIG_FLAG(RegexJitThreshold) + 1 : 0;
+#endif
         rep.insts.insts = 0;
         rep.insts.instsLen = 0;
         rep.insts.litbuf = 0;
@@ -4939,6 +5000,19 @@ namespace UnifiedRegex
                 RecyclerNewLeaf(recycler, ScannerInfo, offset, length, isEquivClass);
     }
 
+#if ENABLE_REGEX_NATIVE_CODEGEN
+    void Program::FreeNativeCode(Js::ScriptContext* scriptContext)
+    {
+        if (nativeCode == nullptr)
+            return;
+
+        // The code could only have been generated through the script context's code generator
+        RegexCodeGenerator* const codeGenerator = scriptContext->GetRegexCodeGenerator();
+        Assert(codeGenerator != nullptr);
+        codeGenerator->FreeCode(this);
+    }
+#endif
+
     void Program::FreeBody(ArenaAllocator* rtAllocator)
     {
         if(tag != InstructionsTag || !rep.insts.insts)
@@ -5030,6 +5104,16 @@ namespace UnifiedRegex
             w->PrintEOL(L">");
             break;
         }
+        if (lazyDfaMatcher != 0)
+        {
+            w->Print(L"lazy DFA:     ");
+            lazyDfaMatcher->Print(w);
+            w->EOL();
+        }
+#if ENABLE_REGEX_NATIVE_CODEGEN
+        if (nativeCode != nullptr)
+            w->PrintEOL(L"native code:  %u bytes", nativeCodeSize);
+#endif
         w->Unindent();
         w->PrintEOL(L"}");
     }
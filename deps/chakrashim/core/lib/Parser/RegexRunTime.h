@@ -17,6 +17,14 @@ namespace UnifiedRegex
     class ContStack;
     class AssertionStack;
     class OctoquadMatcher;
+    class LazyDfaMatcher;
+    struct GroupInfo;
+
+#if ENABLE_REGEX_NATIVE_CODEGEN
+    // Machine code for the instructions of a program, see RegexEncoder.h. Tries every start offset from matchStart on and
+    // returns true on a match, with all the groups defined by it set.
+    typedef bool (*RegexNativeCode)(const wchar_t* input, CharCount inputLength, CharCount matchStart, GroupInfo* groupInfos);
+#endif
 
     enum class ChompMode : uint8
     {
@@ -35,6 +43,8 @@ namespace UnifiedRegex
         friend struct AltNode;
         friend class Matcher;
         friend struct LoopInfo;
+        friend class RegexEncoder;
+        friend class RegexCodeGenerator;
 
         template <typename ScannerT>
         friend struct SyncToLiteralAndConsumeInstT;
@@ -78,6 +88,18 @@ namespace UnifiedRegex
 
         ProgramTag tag;
 
+        // Backtracking-free matcher for the instructions, or null if the pattern does not qualify. In recycler, owned by
+        // program.
+        LazyDfaMatcher* lazyDfaMatcher;
+
+#if ENABLE_REGEX_NATIVE_CODEGEN
+        // Machine code for the instructions, or null. In the script context's native code allocators, owned by program.
+        RegexNativeCode nativeCode;
+        uint nativeCodeSize;
+        // Matches left in the interpreter before the instructions are compiled, or 0 if they have been tried already
+        uint nativeCodeCountdown;
+#endif
+
         struct Instructions
         {
             // Instruction array, in run-time allocator, owned by program, never null
@@ -152,6 +174,9 @@ namespace UnifiedRegex
             const bool isEquivClass);
 
         void FreeBody(ArenaAllocator* rtAllocator);
+#if ENABLE_REGEX_NATIVE_CODEGEN
+        void FreeNativeCode(Js::ScriptContext* scriptContext);
+#endif
 
         inline CaseInsensitive::MappingSource GetCaseMappingSource() const
         {
@@ -1830,6 +1855,11 @@ namespace UnifiedRegex
         // Specialized matcher for regex ^literal
         __inline bool MatchBOILiteral2(const Char * const input, const CharCount inputLength, CharCount offset, DWORD literal2);
 
+#if ENABLE_REGEX_NATIVE_CODEGEN
+        // Counts a match of the instructions in the interpreter, compiling them once the program is hot
+        void CountTowardsNativeCode();
+#endif
+
         void SaveInnerGroups(const int fromGroupId, const int toGroupId, const bool reset, const Char *const input, ContStack &contStack);
         void DoSaveInnerGroups(const int fromGroupId, const int toGroupId, const bool reset, const Char *const input, ContStack &contStack);
         void SaveInnerGroups_AllUndefined(const int fromGroupId, const int toGroupId, const Char *const input, ContStack &contStack);
@@ -17,6 +17,9 @@
 #include "Language\DynamicProfileMutator.h"
 #endif
 #include "Language\SourceDynamicProfileManager.h"
+#ifdef DYNAMIC_PROFILE_STORAGE
+#include "Language\DynamicProfileStorage.h"
+#endif
 
 #include "Debug\ProbeContainer.h"
 #include "Debug\DebugContext.h"
@@ -448,6 +451,10 @@ namespace Js
         debuggerScopeIndex(0),
         bailOnMisingProfileCount(0),
         bailOnMisingProfileRejitCount(0),
+        totalBailOutCount(0),
+        totalRejitCount(0),
+        totalInterpretedCount(0),
+        lastRejitReason(RejitReason::None),
         auxBlock(nullptr),
         auxContextBlock(nullptr),
         byteCodeBlock(nullptr),
@@ -478,6 +485,7 @@ namespace Js
         committedProfiledIterations(0),
         simpleJitEntryPointInfo(nullptr),
         wasCalledFromLoop(false),
+        hasAdaptedExecutionModeLimits(false),
         hasScopeObject(false),
         hasNestedLoop(false),
         recentlyBailedOutOfJittedLoopBody(false),
@@ -2863,6 +2871,24 @@ namespace Js
                 }
             }
 #endif
+
+            if (this->dynamicProfileInfo &&
+                this->dynamicProfileInfo->WasFullJitted() &&
+                !Configuration::Global.flags.EnforceExecutionModeLimits &&
+                fullJitThreshold > 1)
+            {
+                // The function reached full JIT in the run the profile was recorded in, and the profile already has the
+                // type information the lower tiers would collect. Skip them like we do for functions with a hot loop.
+                TraceExecutionMode("LoadedFullJitProfile (before)");
+                SetFullJitThreshold(1, true);
+                TraceExecutionMode("LoadedFullJitProfile");
+#ifdef DYNAMIC_PROFILE_STORAGE
+                if (DynamicProfileStorage::DoReport())
+                {
+                    DynamicProfileStorage::Report(L"DynamicProfileStorage: Full JIT on the first call of '%s' from its loaded profile\n", GetDisplayName());
+                }
+#endif
+            }
         }
 
 #ifdef DYNAMIC_PROFILE_MUTATOR
@@ -3081,6 +3107,7 @@ namespace Js
                 this->originalEntryPoint = this->m_scriptContext->GetNextDynamicInterpreterThunk(&this->m_dynamicInterpreterThunk);
             }
             JS_ETW(EtwTrace::LogMethodInterpreterThunkLoadEvent(this));
+            PERF_MAP(PerfMap::LogMethodInterpreterThunkLoadEvent(this));
         }
         else
         {
@@ -3216,6 +3243,7 @@ namespace Js
         }
 
         JS_ETW(EtwTrace::LogMethodNativeLoadEvent(this, entryPointInfo));
+        PERF_MAP(PerfMap::LogMethodNativeLoadEvent(this, entryPointInfo));
 
 #ifdef _M_ARM
         // For ARM we need to make sure that pipeline is synchronized with memory/cache for newly jitted code.
@@ -3266,6 +3294,7 @@ namespace Js
             loopHeader->interpretCount = entryPointInfo->GetFunctionBody()->GetLoopInterpretCount(loopHeader) - 1;
         }
         JS_ETW(EtwTrace::LogLoopBodyLoadEvent(this, loopHeader, ((LoopEntryPointInfo*) entryPointInfo)));
+        PERF_MAP(PerfMap::LogLoopBodyLoadEvent(this, loopHeader, ((LoopEntryPointInfo*) entryPointInfo)));
     }
 #endif
 
@@ -5836,6 +5865,13 @@ namespace Js
         Assert(polymorphicInlineCache && polymorphicInlineCache->CanAllocateBigger());
         uint16 polymorphicInlineCacheSize = polymorphicInlineCache->GetSize();
         uint16 newPolymorphicInlineCacheSize = PolymorphicInlineCache::GetNextSize(polymorphicInlineCacheSize);
+        // Leave room for the types seen so far and the incoming one at no more than half occupancy, so that a site that
+        // keeps seeing new types skips the intermediate sizes instead of copying its caches at each of them.
+        const uint expectedEntryCount = polymorphicInlineCache->GetEntryCount() + 1;
+        while (newPolymorphicInlineCacheSize < MaxPolymorphicInlineCacheSize && expectedEntryCount * 2 > newPolymorphicInlineCacheSize)
+        {
+            newPolymorphicInlineCacheSize = PolymorphicInlineCache::GetNextSize(newPolymorphicInlineCacheSize);
+        }
         Assert(newPolymorphicInlineCacheSize > polymorphicInlineCacheSize);
         PolymorphicInlineCache * newPolymorphicInlineCache = CreatePolymorphicInlineCache(index, newPolymorphicInlineCacheSize);
         polymorphicInlineCache->CopyTo(propertyId, m_scriptContext, newPolymorphicInlineCache);
@@ -5855,6 +5891,29 @@ namespace Js
         return newPolymorphicInlineCache;
     }
 
+    void FunctionBody::GetPolymorphicInlineCacheSiteCounts(uint *const polymorphicSiteCount, uint *const megamorphicSiteCount) const
+    {
+        Assert(polymorphicSiteCount);
+        Assert(megamorphicSiteCount);
+
+        uint polymorphic = 0;
+        uint megamorphic = 0;
+
+        // Polymorphic inline caches are only created for the non-root field access sites. A site whose cache can no
+        // longer grow is reported as megamorphic.
+        this->polymorphicInlineCaches.Map([&](PolymorphicInlineCache *const polymorphicInlineCache)
+        {
+            ++polymorphic;
+            if (!polymorphicInlineCache->CanAllocateBigger())
+            {
+                ++megamorphic;
+            }
+        }, GetInlineCacheCount() == 0 ? 0 : GetRootObjectLoadInlineCacheStart());
+
+        *polymorphicSiteCount = polymorphic;
+        *megamorphicSiteCount = megamorphic;
+    }
+
     void FunctionBody::ResetInlineCaches()
     {
         isInstInlineCacheCount = inlineCacheCount = rootObjectLoadInlineCacheStart = rootObjectStoreInlineCacheStart = 0;
@@ -6550,6 +6609,40 @@ namespace Js
         SetExecutionMode(ExecutionMode::FullJit);
     }
 
+#if ENABLE_NATIVE_CODEGEN
+    void FunctionBody::AdaptExecutionModeLimitsToIdleJitQueue()
+    {
+        // Called before the function is queued for JIT, while adaptive tiering is on and the full JIT queue is empty
+        Assert(!Configuration::Global.flags.EnforceExecutionModeLimits);
+
+        if(hasAdaptedExecutionModeLimits ||
+            !IsInterpreterExecutionMode() ||
+            !DoFullJit() ||
+            GetProfiledIterations() < static_cast<uint>(Configuration::Global.flags.AdaptiveTieringProfileIterations))
+        {
+            return;
+        }
+        hasAdaptedExecutionModeLimits = true;
+
+        // The function is hot enough to have been profiled and the background thread has no full JIT work, so the default
+        // limits would only delay peak performance. If the profile has not seen polymorphic field accesses or implicit calls,
+        // it is unlikely to change with more profiling, so skip simple JIT and go to full JIT on the next call. Otherwise,
+        // keep the remaining tiers but halve the full JIT threshold.
+        const bool hasStableProfile =
+            HasDynamicProfileInfo() &&
+            !GetAnyDynamicProfileInfo()->HasPolymorphicFldAccess() &&
+            GetAnyDynamicProfileInfo()->GetImplicitCallFlags() == ImplicitCall_None;
+
+        CommitExecutedIterations();
+        TraceExecutionMode("AdaptiveTiering (before)");
+        if(fullJitThreshold > 1)
+        {
+            SetFullJitThreshold(hasStableProfile ? 1 : fullJitThreshold / 2, hasStableProfile);
+        }
+        TraceExecutionMode("AdaptiveTiering");
+    }
+#endif
+
     void FunctionBody::VerifyExecutionModeLimits()
     {
         Assert(initializedExecutionModeAndLimits);
@@ -6675,6 +6768,7 @@ namespace Js
     void FunctionBody::ReinitializeExecutionModeAndLimits()
     {
         wasCalledFromLoop = false;
+        hasAdaptedExecutionModeLimits = false;
         fullJitRequeueThreshold = 0;
         committedProfiledIterations = 0;
         InitializeExecutionModeAndLimits();
@@ -9262,6 +9356,7 @@ namespace Js
         ScriptContext* scriptContext = this->functionBody->GetScriptContext();
         Recycler* recycler = scriptContext->GetRecycler();
         LoopEntryPointInfo* entryPoint = RecyclerNew(recycler, LoopEntryPointInfo, this, scriptContext->GetLibrary(), scriptContext->GetNativeCodeGenerator());
+        this->isScheduledFromSimpleJit = false;
         return this->entryPoints->Add(entryPoint);
     }
 
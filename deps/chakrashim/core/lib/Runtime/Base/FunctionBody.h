@@ -1043,6 +1043,7 @@ namespace Js
         uint profiledLoopCounter;
         bool isNested;
         bool isInTry;
+        bool isScheduledFromSimpleJit; // Simple JIT code already tried to schedule the current entry point
         FunctionBody * functionBody;
 
 #if DBG_DUMP
@@ -1852,6 +1853,7 @@ namespace Js
         bool disableInlineSpread : 1;
         bool hasHotLoop: 1;
         bool wasCalledFromLoop : 1;
+        bool hasAdaptedExecutionModeLimits : 1;
         bool hasNestedLoop : 1;
         bool recentlyBailedOutOfJittedLoopBody : 1;
         bool m_firstFunctionObject: 1;
@@ -1897,6 +1899,12 @@ namespace Js
         NoWriteBarrierField<uint8> bailOnMisingProfileCount;
         NoWriteBarrierField<uint8> bailOnMisingProfileRejitCount;
 
+        // Lifetime counters reported by JsGetRuntimeFunctionTelemetry. Unlike the counters above, these are never reset.
+        NoWriteBarrierField<uint> totalBailOutCount;
+        NoWriteBarrierField<uint> totalRejitCount;
+        NoWriteBarrierField<uint> totalInterpretedCount;
+        NoWriteBarrierField<RejitReason> lastRejitReason;
+
         NoWriteBarrierField<byte> inlineDepth; // Used by inlining to avoid recursively inlining functions excessively
 
         NoWriteBarrierField<ExecutionMode> executionMode;
@@ -2113,6 +2121,9 @@ namespace Js
         bool TryTransitionToJitExecutionMode();
         void TransitionToSimpleJitExecutionMode();
         void TransitionToFullJitExecutionMode();
+#if ENABLE_NATIVE_CODEGEN
+        void AdaptExecutionModeLimitsToIdleJitQueue();
+#endif
 
     private:
         void VerifyExecutionModeLimits();
@@ -2553,6 +2564,13 @@ namespace Js
         uint8 IncrementBailOnMisingProfileCount() { return ++bailOnMisingProfileCount; }
         void ResetBailOnMisingProfileCount() { bailOnMisingProfileCount = 0; }
         uint8 IncrementBailOnMisingProfileRejitCount() { return ++bailOnMisingProfileRejitCount; }
+        void RecordBailOut() { ++totalBailOutCount; }
+        void RecordRejit(const RejitReason reason) { ++totalRejitCount; lastRejitReason = reason; }
+        void RecordInterpretedCall() { ++totalInterpretedCount; }
+        uint GetTotalBailOutCount() const { return totalBailOutCount; }
+        uint GetTotalRejitCount() const { return totalRejitCount; }
+        uint GetTotalInterpretedCount() const { return totalInterpretedCount; }
+        RejitReason GetLastRejitReason() const { return lastRejitReason; }
         uint32 GetFrameHeight(EntryPointInfo* entryPointInfo) const;
         void SetFrameHeight(EntryPointInfo* entryPointInfo, uint32 frameHeight);
 
@@ -2643,6 +2661,7 @@ namespace Js
         PolymorphicInlineCache * GetPolymorphicInlineCache(uint index);
         PolymorphicInlineCache * CreateNewPolymorphicInlineCache(uint index, PropertyId propertyId, InlineCache * inlineCache);
         PolymorphicInlineCache * CreateBiggerPolymorphicInlineCache(uint index, PropertyId propertyId);
+        void GetPolymorphicInlineCacheSiteCounts(uint *const polymorphicSiteCount, uint *const megamorphicSiteCount) const;
 
     private:
         void ResetInlineCaches();
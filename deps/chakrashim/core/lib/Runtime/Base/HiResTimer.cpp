@@ -8,9 +8,12 @@ namespace Js
 {
     double HiResTimer::GetSystemTime()
     {
-        SYSTEMTIME stTime;
-        ::GetSystemTime(&stTime);
-        return DateUtilities::TimeFromSt(&stTime);
+        // The file time counts 100ns ticks since 1601, which takes a subtraction and a division to turn into a time
+        // value; breaking the time into a SYSTEMTIME and putting it back together takes calendar arithmetic.
+        FILETIME ftTime;
+        ::GetSystemTimeAsFileTime(&ftTime);
+        const INT64 ticks = ((INT64)ftTime.dwHighDateTime << 32) | ftTime.dwLowDateTime;
+        return (double)((ticks - DateUtilities::jsEpochTicks) / DateUtilities::ticksPerMillisecond);
     }
 
     // determine if the system time is being adjusted every tick to gradually
@@ -0,0 +1,158 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeBasePch.h"
+#include <share.h>
+
+#ifdef ENABLE_PERF_MAP
+#include "Base\PerfMap.h"
+
+using namespace Js;
+
+bool PerfMap::isEnabled = false;
+FILE* PerfMap::file = nullptr;
+CriticalSection PerfMap::cs;
+
+void PerfMap::Enable()
+{
+    AutoCriticalSection autoCs(&cs);
+    if (isEnabled)
+    {
+        return;
+    }
+
+    wchar_t defaultPath[MAX_PATH];
+    const wchar_t* path = CONFIG_FLAG(PerfMapFile);
+    if (path == nullptr)
+    {
+        wchar_t tempPath[MAX_PATH];
+        DWORD tempPathLength = ::GetTempPathW(_countof(tempPath), tempPath);
+        if (tempPathLength == 0 || tempPathLength >= _countof(tempPath))
+        {
+            return;
+        }
+
+        if (_snwprintf_s(defaultPath, _TRUNCATE, L"%sperf-%u.map", tempPath, ::GetCurrentProcessId()) == -1)
+        {
+            return;
+        }
+        path = defaultPath;
+    }
+
+    // Other processes (the profiler) may open the map while we are still appending to it. Entries are buffered rather
+    // than flushed one by one, so the map is only complete once it is closed.
+    file = _wfsopen(path, L"wb", _SH_DENYWR);
+    if (file == nullptr)
+    {
+        return;
+    }
+    setvbuf(file, nullptr, _IOFBF, FileBufferSize);
+    isEnabled = true;
+}
+
+void PerfMap::Close()
+{
+    AutoCriticalSection autoCs(&cs);
+    if (file == nullptr)
+    {
+        return;
+    }
+
+    isEnabled = false;
+    fclose(file);
+    file = nullptr;
+}
+
+void PerfMap::WriteEntry(FunctionBody* body, void* address, size_t size, const wchar_t* tierMarker, const wchar_t* name)
+{
+    Assert(body);
+    Assert(address);
+
+    const wchar_t* sourceName = body->GetSourceName();
+    wchar_t entry[NameBufferLength];
+    int length = _snwprintf_s(entry, _TRUNCATE, L"JS:%s%s %s:%u:%u",
+        tierMarker,
+        name,
+        sourceName != nullptr ? sourceName : L"",
+        body->GetLineNumber(),
+        body->GetColumnNumber());
+    if (length == -1)
+    {
+        // Names that do not fit are rare; keep the address range symbolized with just the function name.
+        length = _snwprintf_s(entry, _TRUNCATE, L"JS:%s%.256s", tierMarker, name);
+        if (length == -1)
+        {
+            return;
+        }
+    }
+
+    WriteLine(address, size, entry, (charcount_t)length);
+}
+
+void PerfMap::WriteLine(void* address, size_t size, const wchar_t* entry, charcount_t length)
+{
+    utf8char_t utf8Entry[NameBufferLength * 3 + 1];
+    size_t utf8Length = utf8::EncodeIntoAndNullTerminate(utf8Entry, entry, length);
+
+    AutoCriticalSection autoCs(&cs);
+    if (file == nullptr)
+    {
+        return;
+    }
+
+    fprintf(file, "%Ix %Ix ", (size_t)address, size);
+    fwrite(utf8Entry, sizeof(utf8char_t), utf8Length, file);
+    fputc('\n', file);
+}
+
+void PerfMap::LogMethodNativeLoadEvent(FunctionBody* body, FunctionEntryPointInfo* entryPoint)
+{
+    Assert(entryPoint->GetNativeAddress() != NULL);
+    Assert(entryPoint->GetCodeSize() > 0);
+
+    const wchar_t* tierMarker = entryPoint->GetJitMode() == ExecutionMode::SimpleJit ? L"~" : L"*";
+    WriteEntry(body, (void*)entryPoint->GetNativeAddress(), entryPoint->GetCodeSize(), tierMarker, body->GetExternalDisplayName());
+}
+
+void PerfMap::LogLoopBodyLoadEvent(FunctionBody* body, LoopHeader* loopHeader, LoopEntryPointInfo* entryPoint)
+{
+    Assert(entryPoint->GetNativeAddress() != NULL);
+    Assert(entryPoint->GetCodeSize() > 0);
+
+    wchar_t loopBodyName[NameBufferLength];
+    size_t requiredLength = body->GetLoopBodyName(body->GetLoopNumber(loopHeader), loopBodyName, _countof(loopBodyName));
+    if (requiredLength > _countof(loopBodyName))
+    {
+        // GetLoopBodyName leaves the buffer untouched if it is too small.
+        wcscpy_s(loopBodyName, L"Loop");
+    }
+
+    WriteEntry(body, (void*)entryPoint->GetNativeAddress(), entryPoint->GetCodeSize(), L"*", loopBodyName);
+}
+
+#if DYNAMIC_INTERPRETER_THUNK
+void PerfMap::LogMethodInterpreterThunkLoadEvent(FunctionBody* body)
+{
+    Assert(body->GetDynamicInterpreterEntryPoint() != nullptr);
+
+    WriteEntry(body, body->GetDynamicInterpreterEntryPoint(), body->GetDynamicInterpreterThunkSize(), L"", body->GetExternalDisplayName());
+}
+#endif
+
+void PerfMap::LogRegexNativeLoadEvent(const wchar_t* source, charcount_t sourceLength, void* address, size_t size)
+{
+    Assert(address);
+
+    // Long patterns are cut short; the prefix is enough to tell them apart in a profile.
+    wchar_t entry[NameBufferLength];
+    int length = _snwprintf_s(entry, _TRUNCATE, L"RegExp:/%.*s/", (int)min(sourceLength, (charcount_t)256), source);
+    if (length == -1)
+    {
+        return;
+    }
+
+    WriteLine(address, size, entry, (charcount_t)length);
+}
+
+#endif
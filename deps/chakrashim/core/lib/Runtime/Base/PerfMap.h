@@ -0,0 +1,57 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#ifdef ENABLE_PERF_MAP
+
+//
+// Writes a perf map file (the format of Linux perf's /tmp/perf-<pid>.map, which other sampling
+// profilers read as well) describing every range of generated code. ChakraCore only builds for
+// Windows, so the file goes to the temp directory there and is for profilers on Windows or for
+// copying next to a trace; Linux perf never sees it. Each line is
+//
+//      <start address in hex> <size in hex> <symbol name>
+//
+// The map is append-only: when a code range is freed and later reused, the newer entry for the
+// address supersedes the older one in the consumer, so no unload records are written.
+//
+// Symbol names follow the V8 convention so existing tooling groups them the same way:
+//      JS:*name url:line:column    full JIT
+//      JS:~name url:line:column    simple JIT
+//      JS:name url:line:column     interpreter thunk
+//      RegExp:/source/             compiled regular expression
+//
+class PerfMap
+{
+public:
+    static void Enable();
+    // Writes out the buffered entries and closes the map; called when the engine is unloaded
+    static void Close();
+    static bool IsEnabled() { return isEnabled; }
+
+    static void LogMethodNativeLoadEvent(Js::FunctionBody* body, Js::FunctionEntryPointInfo* entryPoint);
+    static void LogLoopBodyLoadEvent(Js::FunctionBody* body, Js::LoopHeader* loopHeader, Js::LoopEntryPointInfo* entryPoint);
+#if DYNAMIC_INTERPRETER_THUNK
+    static void LogMethodInterpreterThunkLoadEvent(Js::FunctionBody* body);
+#endif
+    static void LogRegexNativeLoadEvent(const wchar_t* source, charcount_t sourceLength, void* address, size_t size);
+
+private:
+    static const size_t NameBufferLength = 512;
+    static const size_t FileBufferSize = 64 * 1024;
+
+    static void WriteEntry(Js::FunctionBody* body, void* address, size_t size, const wchar_t* tierMarker, const wchar_t* name);
+    static void WriteLine(void* address, size_t size, const wchar_t* entry, charcount_t length);
+
+    static bool isEnabled;
+    static FILE* file;
+    static CriticalSection cs;
+};
+
+#define PERF_MAP(x) if (PerfMap::IsEnabled()) { x; }
+
+#else
+#define PERF_MAP(x)
+#endif
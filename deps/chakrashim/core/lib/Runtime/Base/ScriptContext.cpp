@@ -8,6 +8,7 @@
 #include "RegexCommon.h"
 #include "DebugWriter.h"
 #include "RegexStats.h"
+#include "RegexCodeGenerator.h"
 
 #include "ByteCode\ByteCodeAPI.h"
 #include "Library\ProfileString.h"
@@ -60,6 +61,9 @@ namespace Js
 #endif
         trigramAlphabet(nullptr),
         regexStacks(nullptr),
+#if ENABLE_REGEX_NATIVE_CODEGEN
+        regexCodeGenerator(nullptr),
+#endif
         arrayMatchInit(false),
         config(threadContext->GetConfig(), threadContext->IsOptimizedForManyInstances()),
 #if ENABLE_BACKGROUND_PARSING
@@ -392,6 +396,14 @@ namespace Js
             regexStacks = nullptr;
         }
 
+#if ENABLE_REGEX_NATIVE_CODEGEN
+        if (regexCodeGenerator != nullptr)
+        {
+            HeapDelete(regexCodeGenerator);
+            regexCodeGenerator = nullptr;
+        }
+#endif
+
         if (javascriptLibrary != nullptr)
         {
             javascriptLibrary->scriptContext = nullptr;
@@ -1072,6 +1084,17 @@ namespace Js
         regexStacks = stacks;
     }
 
+#if ENABLE_REGEX_NATIVE_CODEGEN
+    UnifiedRegex::RegexCodeGenerator *ScriptContext::InitRegexCodeGenerator()
+    {
+        if (regexCodeGenerator == nullptr && !IsInterpreted() && nativeCodeGen != nullptr)
+        {
+            regexCodeGenerator = HeapNew(UnifiedRegex::RegexCodeGenerator, this);
+        }
+        return regexCodeGenerator;
+    }
+#endif
+
     Js::TempArenaAllocatorObject* ScriptContext::GetTemporaryAllocator(LPCWSTR name)
     {
         return this->threadContext->GetTemporaryAllocator(name);
@@ -1474,6 +1497,50 @@ namespace Js
         return string;
     }
 
+    static uint PropertyKeyCacheIndex(JavascriptString* key)
+    {
+        // Recycler objects are 16 byte aligned
+        const size_t bits = reinterpret_cast<size_t>(key) >> 4;
+        return static_cast<uint>(bits ^ (bits >> 7)) & (PropertyKeyCacheEntry::CacheSize - 1);
+    }
+
+    PropertyString* ScriptContext::GetPropertyStringForKey(JavascriptString* key)
+    {
+        Assert(!VirtualTableInfo<PropertyString>::HasVirtualTable(key));
+
+        PropertyKeyCacheEntry& entry = cache->propertyKeyCache[PropertyKeyCacheIndex(key)];
+        if (entry.key == key)
+        {
+            return entry.propertyString;
+        }
+
+        const wchar_t* propertyName = key->GetString();
+        const charcount_t propertyLength = key->GetLength();
+        PropertyString* propertyString = nullptr;
+        uint32 index;
+        if (!JavascriptOperators::TryConvertToUInt32(propertyName, propertyLength, &index) || index == JavascriptArray::InvalidIndex)
+        {
+            PropertyRecord const * propertyRecord;
+            GetOrAddPropertyRecord(propertyName, propertyLength, &propertyRecord);
+            propertyString = GetPropertyString(propertyRecord->GetPropertyId());
+        }
+
+        entry.key = key;
+        entry.propertyString = propertyString;
+        return propertyString;
+    }
+
+    PropertyString* ScriptContext::TryGetCachedPropertyStringForKey(JavascriptString* key)
+    {
+        const PropertyKeyCacheEntry& entry = cache->propertyKeyCache[PropertyKeyCacheIndex(key)];
+        return entry.key == key ? entry.propertyString : nullptr;
+    }
+
+    void ScriptContext::ClearPropertyKeyCache()
+    {
+        memset(cache->propertyKeyCache, 0, sizeof(cache->propertyKeyCache));
+    }
+
     void ScriptContext::InvalidatePropertyStringCache(PropertyId propertyId, Type* type)
     {
         PropertyStringCacheMap* propertyStringMap = this->javascriptLibrary->GetPropertyStringMap();
@@ -2262,7 +2329,7 @@ namespace Js
     // Makes a copy of the URL to be stored in the map.
     //
     SourceContextInfo * ScriptContext::CreateSourceContextInfo(DWORD_PTR sourceContext, wchar_t const * url, size_t len,
-        IActiveScriptDataCache* profileDataCache, wchar_t const * sourceMapUrl /*= NULL*/, size_t sourceMapUrlLen /*= 0*/)
+        IActiveScriptDataCache* profileDataCache, wchar_t const * sourceMapUrl /*= NULL*/, size_t sourceMapUrlLen /*= 0*/, uint sourceHash /*= 0*/)
     {
         // Take etw rundown lock on this thread context. We are going to init/add to sourceContextInfoMap.
         AutoCriticalSection autocs(GetThreadContext()->GetEtwRundownCriticalSection());
@@ -2275,6 +2342,7 @@ namespace Js
         sourceContextInfo->isHostDynamicDocument = false;
 #if ENABLE_PROFILE_INFO
         sourceContextInfo->sourceDynamicProfileManager = nullptr;
+        sourceContextInfo->sourceHash = sourceHash;
 #endif
 
         if (url != nullptr)
@@ -4188,6 +4256,9 @@ namespace Js
         Assert(this->guestArena);
         Assert(this->cache);
 
+        // Let the strings used as keys since the last collection die
+        ClearPropertyKeyCache();
+
         if (EnableEvalMapCleanup())
         {
             // The eval map is not re-entrant, so make sure it's not in the middle of adding an entry
@@ -4292,20 +4363,31 @@ void ScriptContext::RegisterPrototypeChainEnsuredToHaveOnlyWritableDataPropertie
         registeredPrototypeChainEnsuredToHaveOnlyWritableDataPropertiesScriptContext = nullptr;
     }
 
-    JavascriptString * ScriptContext::GetLastNumberToStringRadix10(double value)
+    static uint NumberToStringCacheIndex(uint64 value)
     {
-        if (value == lastNumberToStringRadix10)
-        {
-            return cache->lastNumberToStringRadix10String;
-        }
-        return nullptr;
+        CompileAssert(NumberToStringCacheEntry::CacheSize == 1 << 4);
+
+        // Integers have their low bits clear and fractions have their high bits alike, so mix all of them
+        const uint bits = static_cast<uint>(value) ^ static_cast<uint>(value >> 32);
+        return (bits * 2654435769u) >> (32 - 4);
     }
 
-    void
-        ScriptContext::SetLastNumberToStringRadix10(double value, JavascriptString * str)
+    JavascriptString * ScriptContext::GetCachedNumberToStringRadix10(double value)
     {
-            lastNumberToStringRadix10 = value;
-            cache->lastNumberToStringRadix10String = str;
+        // Zero is never cached, so an empty entry does not match
+        const uint64 bits = NumberUtilities::ToSpecial(value);
+        const NumberToStringCacheEntry& entry = cache->numberToStringCache[NumberToStringCacheIndex(bits)];
+        return entry.value == bits ? entry.string : nullptr;
+    }
+
+    void ScriptContext::CacheNumberToStringRadix10(double value, JavascriptString * str)
+    {
+        Assert(!JavascriptNumber::IsZero(value));
+
+        const uint64 bits = NumberUtilities::ToSpecial(value);
+        NumberToStringCacheEntry& entry = cache->numberToStringCache[NumberToStringCacheIndex(bits)];
+        entry.value = bits;
+        entry.string = str;
     }
 
     bool ScriptContext::GetLastUtcTimeFromStr(JavascriptString * str, double& dbl)
@@ -314,11 +314,29 @@ namespace Js
         int validPropStrings;
     };
 
+    // A string used as a computed property key, and the property string of its property record, or null if the string is an
+    // array index
+    struct PropertyKeyCacheEntry
+    {
+        static const uint CacheSize = 128;
+
+        JavascriptString* key;
+        PropertyString* propertyString;
+    };
+
+    // A number converted to a string in radix 10, and the string
+    struct NumberToStringCacheEntry
+    {
+        static const uint CacheSize = 16;
+
+        uint64 value;
+        JavascriptString* string;
+    };
+
     // Holder for all cached pointers. These are allocated on a guest arena
     // ensuring they cause the related objects to be pinned.
     struct Cache
     {
-        JavascriptString * lastNumberToStringRadix10String;
         EnumeratedObjectCache enumObjCache;
         JavascriptString * lastUtcTimeFromStrString;
         TypePath* rootPath;
@@ -331,6 +349,8 @@ namespace Js
         SourceContextInfo* noContextSourceContextInfo;
         SRCINFO* noContextGlobalSourceInfo;
         SRCINFO const ** moduleSrcInfo;
+        PropertyKeyCacheEntry propertyKeyCache[PropertyKeyCacheEntry::CacheSize];
+        NumberToStringCacheEntry numberToStringCache[NumberToStringCacheEntry::CacheSize];
     };
 
     class ScriptContext : public ScriptContextBase
@@ -686,6 +706,9 @@ private:
 #endif
         UnifiedRegex::TrigramAlphabet* trigramAlphabet;
         UnifiedRegex::RegexStacks *regexStacks;
+#if ENABLE_REGEX_NATIVE_CODEGEN
+        UnifiedRegex::RegexCodeGenerator *regexCodeGenerator;
+#endif
 
         FunctionReferenceList* dynamicFunctionReference;
         uint dynamicFunctionReferenceDepth;
@@ -726,7 +749,6 @@ private:
 
         JsUtil::BaseDictionary<uint, JavascriptString *, ArenaAllocator> integerStringMap;
 
-        double lastNumberToStringRadix10;
         double lastUtcTimeFromStr;
 
 #if ENABLE_PROFILE_INFO
@@ -911,6 +933,10 @@ private:
         UnifiedRegex::RegexStacks *AllocRegexStacks();
         UnifiedRegex::RegexStacks *SaveRegexStacks();
         void RestoreRegexStacks(UnifiedRegex::RegexStacks *const contStack);
+#if ENABLE_REGEX_NATIVE_CODEGEN
+        UnifiedRegex::RegexCodeGenerator *GetRegexCodeGenerator() const { return regexCodeGenerator; }
+        UnifiedRegex::RegexCodeGenerator *InitRegexCodeGenerator();
+#endif
 
         void InitializeGlobalObject();
         bool IsIntlEnabled();
@@ -973,7 +999,7 @@ private:
         SourceContextInfo * GetSourceContextInfo(uint hash);
         SourceContextInfo * CreateSourceContextInfo(uint hash, DWORD_PTR hostSourceContext);
         SourceContextInfo * CreateSourceContextInfo(DWORD_PTR hostSourceContext, wchar_t const * url, size_t len,
-            IActiveScriptDataCache* profileDataCache, wchar_t const * sourceMapUrl = nullptr, size_t sourceMapUrlLen = 0);
+            IActiveScriptDataCache* profileDataCache, wchar_t const * sourceMapUrl = nullptr, size_t sourceMapUrlLen = 0, uint sourceHash = 0);
 
 #if defined(LEAK_REPORT) || defined(CHECK_MEMORY_LEAK)
         void ClearSourceContextInfoMaps()
@@ -1149,6 +1175,13 @@ private:
         EnumeratedObjectCache* GetEnumeratedObjectCache() { return &(cache->enumObjCache); }
         PropertyString* GetPropertyString(PropertyId propertyId);
         void InvalidatePropertyStringCache(PropertyId propertyId, Type* type);
+
+        // Strings used as computed property keys are looked up by identity in a small cache until the next collection, so
+        // using the same string again neither hashes it nor misses the inline cache of its property string. Get adds the
+        // string, creating its property record if necessary; TryGetCached only looks.
+        PropertyString* GetPropertyStringForKey(JavascriptString* key);
+        PropertyString* TryGetCachedPropertyStringForKey(JavascriptString* key);
+        void ClearPropertyKeyCache();
         JavascriptString* GetIntegerString(Var aValue);
         JavascriptString* GetIntegerString(int value);
         JavascriptString* GetIntegerString(uint value);
@@ -1296,8 +1329,8 @@ private:
         void ClearPrototypeChainEnsuredToHaveOnlyWritableDataPropertiesCaches();
 
     public:
-        JavascriptString * GetLastNumberToStringRadix10(double value);
-        void SetLastNumberToStringRadix10(double value, JavascriptString * str);
+        JavascriptString * GetCachedNumberToStringRadix10(double value);
+        void CacheNumberToStringRadix10(double value, JavascriptString * str);
         bool GetLastUtcTimeFromStr(JavascriptString * str, double& dbl);
         void SetLastUtcTimeFromStr(JavascriptString * str, double value);
         bool IsNoContextSourceContextInfo(SourceContextInfo *sourceContextInfo) const
@@ -6,6 +6,7 @@
 #include "BackEndAPI.h"
 #include "ThreadServiceWrapper.h"
 #include "Types\TypePropertyCache.h"
+#include "Types\MegamorphicPropertyCache.h"
 #include "Debug\DebuggingFlags.h"
 #include "Debug\DiagProbe.h"
 #include "Debug\DebugManager.h"
@@ -98,6 +99,10 @@ ThreadContext::RecyclableData::RecyclableData(Recycler *const recycler) :
 ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager, JsUtil::ThreadService::ThreadServiceCallback threadServiceCallback, bool enableExperimentalFeatures) :
     currentThreadId(::GetCurrentThreadId()),
     stackLimitForCurrentThread(0),
+    interruptProbeLimit(0),
+    isSampleRequested(false),
+    sampleHandler(nullptr),
+    sampleHandlerState(nullptr),
     stackProber(nullptr),
     isThreadBound(false),
     hasThrownPendingException(false),
@@ -166,6 +171,7 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     codeGenNumberThreadAllocator(nullptr),
 #endif
     dynamicObjectEnumeratorCacheMap(&HeapAllocator::Instance, 16),
+    megamorphicPropertyCache(nullptr),
     //threadContextFlags(ThreadContextFlagNoFlag),
     telemetryBlock(&localTelemetryBlock),
     configuration(enableExperimentalFeatures),
@@ -279,6 +285,7 @@ void ThreadContext::SetStackProber(StackProber * stackProber)
     if (stackProber != NULL && this->stackLimitForCurrentThread != Js::Constants::StackLimitForScriptInterrupt)
     {
         this->stackLimitForCurrentThread = stackProber->GetScriptStackLimit();
+        this->RestoreInterruptProbeLimit();
     }
 }
 
@@ -473,6 +480,12 @@ ThreadContext::~ThreadContext()
     this->equivalentTypeCacheEntryPoints.Reset();
     this->prototypeChainEnsuredToHaveOnlyWritableDataPropertiesScriptContext.Reset();
 
+    if (this->megamorphicPropertyCache != nullptr)
+    {
+        HeapDelete(this->megamorphicPropertyCache);
+        this->megamorphicPropertyCache = nullptr;
+    }
+
     this->registeredInlineCacheCount = 0;
     this->unregisteredInlineCacheCount = 0;
 
@@ -1438,6 +1451,80 @@ void
 ThreadContext::SetStackLimitForCurrentThread(PBYTE limit)
 {
     this->stackLimitForCurrentThread = limit;
+    this->RestoreInterruptProbeLimit();
+}
+
+void
+ThreadContext::RestoreInterruptProbeLimit()
+{
+    this->interruptProbeLimit = this->stackLimitForCurrentThread;
+
+    // A sample may have been requested on another thread between the caller clearing (or never seeing) the request
+    // and the store above; re-arm the probe so the request isn't lost until the next interpreter entry.
+    MemoryBarrier();
+    if (this->isSampleRequested)
+    {
+        this->interruptProbeLimit = Js::Constants::StackLimitForScriptInterrupt;
+    }
+}
+
+void
+ThreadContext::SetSampleHandler(SampleHandler handler, void * state)
+{
+    Assert(handler != nullptr || state == nullptr);
+    this->sampleHandler = handler;
+    this->sampleHandlerState = state;
+}
+
+// May be called from any thread.
+void
+ThreadContext::RequestSample()
+{
+    this->isSampleRequested = true;
+    MemoryBarrier();
+
+    // Hammer only the loop probe limit; the real stack limit is left alone so stack probes in function prologs,
+    // which never return to their caller, keep working.
+    this->interruptProbeLimit = Js::Constants::StackLimitForScriptInterrupt;
+}
+
+void
+ThreadContext::TakeSample()
+{
+    Assert(this->isSampleRequested);
+    this->isSampleRequested = false;
+    MemoryBarrier();
+    this->RestoreInterruptProbeLimit();
+
+    Js::ScriptEntryExitRecord * entryExitRecord = this->GetScriptEntryExit();
+    if (this->sampleHandler == nullptr || entryExitRecord == nullptr || this->IsExecutionDisabled())
+    {
+        return;
+    }
+
+    // The handler only walks the stack; it must not run script or allocate on the recycler.
+    AUTO_NO_EXCEPTION_REGION;
+    this->sampleHandler(entryExitRecord->scriptContext, this->sampleHandlerState);
+}
+
+// Called from jitted loop probes once the interrupt probe limit has been hit.
+void
+ThreadContext::HandleInterruptProbe()
+{
+    if (this->IsExecutionDisabled())
+    {
+        throw Js::ScriptAbortException();
+    }
+
+    if (this->isSampleRequested)
+    {
+        this->TakeSample();
+    }
+    else
+    {
+        // Fault injection, or a race with a request that was already serviced elsewhere.
+        this->RestoreInterruptProbeLimit();
+    }
 }
 
 bool
@@ -2243,6 +2330,12 @@ ThreadContext::PreSweepCallback()
     ClearEquivalentTypeCaches();
 
     this->dynamicObjectEnumeratorCacheMap.Clear();
+
+    // The cache refers to types that may be about to be swept
+    if (this->megamorphicPropertyCache != nullptr)
+    {
+        this->megamorphicPropertyCache->Clear();
+    }
 }
 
 void
@@ -3792,6 +3885,17 @@ ThreadContext::AddDynamicObjectEnumeratorCache(Js::DynamicType const * dynamicTy
     this->dynamicObjectEnumeratorCacheMap.Item(dynamicType, cache);
 }
 
+Js::MegamorphicPropertyCache *
+ThreadContext::EnsureMegamorphicPropertyCache()
+{
+    if (this->megamorphicPropertyCache == nullptr && CONFIG_FLAG(MegamorphicPropertyCache))
+    {
+        // Failing to allocate the cache only costs the lookups it would have saved
+        this->megamorphicPropertyCache = HeapNewNoThrow(Js::MegamorphicPropertyCache);
+    }
+    return this->megamorphicPropertyCache;
+}
+
 InterruptPoller::InterruptPoller(ThreadContext *tc) :
     threadContext(tc),
     lastPollTick(0),
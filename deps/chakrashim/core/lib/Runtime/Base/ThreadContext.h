@@ -10,6 +10,7 @@ namespace Js
     struct InlineCache;
     class DebugManager;
     class CodeGenRecyclableData;
+    class MegamorphicPropertyCache;
     struct ReturnedValue;
     typedef JsUtil::List<ReturnedValue*> ReturnedValueList;
 }
@@ -37,6 +38,7 @@ enum ThreadContextFlags
     ThreadContextFlagCanDisableExecution           = 0x00000001,
     ThreadContextFlagEvalDisabled                  = 0x00000002,
     ThreadContextFlagNoJIT                         = 0x00000004,
+    ThreadContextFlagAdaptiveTiering               = 0x00000008,
 };
 
 const int LS_MAX_STACK_SIZE_KB = 300;
@@ -395,6 +397,16 @@ public:
 
         return &this->stackLimitForCurrentThread;
     }
+    typedef void (*SampleHandler)(Js::ScriptContext *scriptContext, void *state);
+
+    // Loop interrupt probes in jitted code compare against this limit instead of the stack limit so that
+    // a sample request can stop them without also failing the stack probes in function prologs.
+    void * GetAddressOfInterruptProbeLimit()
+    {
+        FAULTINJECT_SCRIPT_TERMINATION
+
+        return &this->interruptProbeLimit;
+    }
     void InitAvailableCommit();
 
     // This is always on for JSRT APIs.
@@ -581,6 +593,10 @@ private:
     ThreadContextFlags threadContextFlags;
     DWORD currentThreadId;
     mutable PBYTE stackLimitForCurrentThread;
+    PBYTE interruptProbeLimit;
+    volatile bool isSampleRequested;
+    SampleHandler sampleHandler;
+    void * sampleHandlerState;
     StackProber * stackProber;
     bool isThreadBound;
     bool hasThrownPendingException;
@@ -753,6 +769,9 @@ private:
     typedef JsUtil::BaseDictionary<Js::DynamicType const *, void *, HeapAllocator, PowerOf2SizePolicy> DynamicObjectEnumeratorCacheMap;
     DynamicObjectEnumeratorCacheMap dynamicObjectEnumeratorCacheMap;
 
+    // Created the first time a property access site overflows its polymorphic inline cache
+    Js::MegamorphicPropertyCache *megamorphicPropertyCache;
+
     ThreadContextWatsonTelemetryBlock localTelemetryBlock;
     ThreadContextWatsonTelemetryBlock * telemetryBlock;
 
@@ -890,6 +909,11 @@ public:
         return this->TestThreadContextFlag(ThreadContextFlagNoJIT);
     }
 
+    bool DoAdaptiveTiering() const
+    {
+        return this->TestThreadContextFlag(ThreadContextFlagAdaptiveTiering);
+    }
+
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     Js::Var GetMemoryStat(Js::ScriptContext* scriptContext);
     void SetAutoProxyName(LPCWSTR objectName);
@@ -1465,6 +1489,9 @@ public:
 
     void * GetDynamicObjectEnumeratorCache(Js::DynamicType const * dynamicType);
     void AddDynamicObjectEnumeratorCache(Js::DynamicType const * dynamicType, void * cache);
+
+    Js::MegamorphicPropertyCache * GetMegamorphicPropertyCache() const { return megamorphicPropertyCache; }
+    Js::MegamorphicPropertyCache * EnsureMegamorphicPropertyCache();
 public:
     bool IsScriptActive() const { return isScriptActive; }
     void SetIsScriptActive(bool isActive) { isScriptActive = isActive; }
@@ -1474,6 +1501,23 @@ public:
     }
     void DisableExecution();
     void EnableExecution();
+
+    // Sampling: a host (typically on another thread) requests a sample, and the sample handler is invoked
+    // on the script thread at the next interrupt probe, interpreter entry or host call.
+    void SetSampleHandler(SampleHandler handler, void *state);
+    void RequestSample();
+    void CheckSampleRequest()
+    {
+        if (this->isSampleRequested)
+        {
+            this->TakeSample();
+        }
+    }
+    void HandleInterruptProbe();
+private:
+    void TakeSample();
+    void RestoreInterruptProbeLimit();
+public:
     bool TestThreadContextFlag(ThreadContextFlags threadContextFlag) const;
     void SetThreadContextFlag(ThreadContextFlags threadContextFlag);
     void ClearThreadContextFlag(ThreadContextFlags threadContextFlag);
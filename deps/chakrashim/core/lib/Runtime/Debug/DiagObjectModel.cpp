@@ -15,7 +15,7 @@
 #include "Library\BoundFunction.h"
 #include "Library\JavascriptRegExpConstructor.h"
 #include "Library\SameValueComparer.h"
-#include "Library\MapOrSetDataList.h"
+#include "Library\MapOrSetDataTable.h"
 #include "Library\JavascriptProxy.h"
 #include "Library\JavascriptMap.h"
 #include "Library\JavascriptSet.h"
@@ -42,12 +42,14 @@ bool SourceContextInfo::IsSourceProfileLoaded() const
 SourceContextInfo* SourceContextInfo::Clone(Js::ScriptContext* scriptContext) const
 {
     IActiveScriptDataCache* profileCache = NULL;
+    uint sourceHash = 0;
     
 #if ENABLE_PROFILE_INFO
     if (this->sourceDynamicProfileManager != NULL)
     {
         profileCache = this->sourceDynamicProfileManager->GetProfileCache();
     }
+    sourceHash = this->sourceHash;
 #endif
 
     SourceContextInfo * newSourceContextInfo = scriptContext->GetSourceContextInfo(dwHostSourceContext, profileCache);
@@ -61,7 +63,8 @@ SourceContextInfo* SourceContextInfo::Clone(Js::ScriptContext* scriptContext) co
             oldUrl? wcslen(oldUrl) : 0,
             NULL,
             oldSourceMapUrl,
-            oldSourceMapUrl ? wcslen(oldSourceMapUrl) : 0);
+            oldSourceMapUrl ? wcslen(oldSourceMapUrl) : 0,
+            sourceHash);
         newSourceContextInfo->nextLocalFunctionId = this->nextLocalFunctionId;
         newSourceContextInfo->sourceContextId = this->sourceContextId;
         newSourceContextInfo->EnsureInitialized();
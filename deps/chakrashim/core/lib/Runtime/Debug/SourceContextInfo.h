@@ -37,6 +37,7 @@ public:
     };
 #if ENABLE_PROFILE_INFO
     Js::SourceDynamicProfileManager * sourceDynamicProfileManager;
+    uint sourceHash;                    // hash of the source text if provided by the host, 0 otherwise
 #endif
 
     void EnsureInitialized();
@@ -105,7 +105,18 @@ namespace Js
                     ReturnOperationInfo ? operationInfo : nullptr,
                     propertyValueInfo))
         {
-            return false;
+            MegamorphicPropertyCache *const megamorphicPropertyCache =
+                requestContext->GetThreadContext()->GetMegamorphicPropertyCache();
+            if(!megamorphicPropertyCache ||
+                !megamorphicPropertyCache->TryGetProperty(
+                    object,
+                    propertyId,
+                    propertyValue,
+                    requestContext,
+                    propertyValueInfo))
+            {
+                return false;
+            }
         }
 
         if(!ReturnOperationInfo || operationInfo->cacheType == CacheType_TypeProperty)
@@ -217,7 +228,18 @@ namespace Js
                 ReturnOperationInfo ? operationInfo : nullptr,
                 propertyValueInfo))
         {
-            return false;
+            MegamorphicPropertyCache *const megamorphicPropertyCache =
+                requestContext->GetThreadContext()->GetMegamorphicPropertyCache();
+            if(!megamorphicPropertyCache ||
+                !megamorphicPropertyCache->TrySetProperty(
+                    object,
+                    propertyId,
+                    propertyValue,
+                    requestContext,
+                    propertyValueInfo))
+            {
+                return false;
+            }
         }
 
         if(!ReturnOperationInfo || operationInfo->cacheType == CacheType_TypeProperty)
@@ -364,6 +386,7 @@ namespace Js
 
         const bool includeTypePropertyCache = IncludeTypePropertyCache && !isRoot;
         bool createTypePropertyCache = false;
+        bool isMegamorphic = false;
         PolymorphicInlineCache *polymorphicInlineCache = info->GetPolymorphicInlineCache();
         if(!polymorphicInlineCache && info->GetFunctionBody())
         {
@@ -445,6 +468,12 @@ namespace Js
                             info->GetInlineCacheIndex(),
                             propertyId);
                 }
+                else
+                {
+                    // The polymorphic inline cache can't hold any more types, so from here on this site relies on the
+                    // megamorphic property cache
+                    isMegamorphic = true;
+                }
                 if(includeTypePropertyCache)
                 {
                     createTypePropertyCache = true;
@@ -496,6 +525,21 @@ namespace Js
         }
         Assert(!IsAccessor);
 
+        if(isMegamorphic && !isProto)
+        {
+            MegamorphicPropertyCache *const megamorphicPropertyCache =
+                requestContext->GetThreadContext()->EnsureMegamorphicPropertyCache();
+            if(megamorphicPropertyCache)
+            {
+                megamorphicPropertyCache->Cache(
+                    type,
+                    propertyId,
+                    propertyIndex,
+                    isInlineSlot,
+                    info->IsWritable() && info->IsStoreFieldCacheEnabled());
+            }
+        }
+
         TypePropertyCache *typePropertyCache = type->GetPropertyCache();
         if(!typePropertyCache)
         {
@@ -1078,7 +1078,7 @@ namespace Js
             if (sourceContextInfo->sourceDynamicProfileManager != nullptr && sourceContextInfo->url != nullptr
                 && !sourceContextInfo->IsDynamic())
             {
-                sourceContextInfo->sourceDynamicProfileManager->SaveToDynamicProfileStorage(sourceContextInfo->url);
+                sourceContextInfo->sourceDynamicProfileManager->SaveToDynamicProfileStorage(sourceContextInfo);
             }
         });
 #endif
@@ -1730,6 +1730,11 @@ namespace Js
 
         FunctionBody * functionBody = this->GetFunctionBody();
         Js::ArgSlot paramInfoCount = functionBody->GetProfiledInParamsCount();
+
+        // Remember functions that got hot enough for full JIT so that the next run can skip the lower tiers for them
+        Bits bits = this->bits;
+        bits.wasFullJitted = bits.wasFullJitted || functionBody->GetExecutionMode() == ExecutionMode::FullJit;
+
         if (!writer->Write(functionBody->GetLocalFunctionId())
             || !writer->Write(paramInfoCount)
             || !writer->WriteArray(this->parameterInfo, paramInfoCount)
@@ -1755,7 +1760,7 @@ namespace Js
             || !writer->WriteArray(this->loopImplicitCallFlags, functionBody->GetLoopCount())
             || !writer->Write(this->implicitCallFlags)
             || !writer->Write(this->thisInfo)
-            || !writer->Write(this->bits)
+            || !writer->Write(bits)
             || !writer->Write(this->m_recursiveInlineInfo)
             || (this->loopFlags && !writer->WriteArray(this->loopFlags->GetData(), this->loopFlags->WordCount())))
         {
@@ -498,6 +498,7 @@ namespace Js
             bool disableSwitchOpt : 1;
             bool disableEquivalentObjTypeSpec : 1;
             bool disableObjTypeSpec_jitLoopBody : 1;
+            bool wasFullJitted : 1; // The function reached full JIT, possibly in a previous run whose profile was loaded
         } bits;
 
         uint32 m_recursiveInlineInfo; // Bit is set for each callsites where the function is called recursively
@@ -778,6 +779,7 @@ namespace Js
         void DisableEquivalentObjTypeSpec() { this->bits.disableEquivalentObjTypeSpec = true; }
         bool IsObjTypeSpecDisabledInJitLoopBody() const { return this->bits.disableObjTypeSpec_jitLoopBody; }
         void DisableObjTypeSpecInJitLoopBody() { this->bits.disableObjTypeSpec_jitLoopBody = true; }
+        bool WasFullJitted() const { return this->bits.wasFullJitted; }
 
         static bool IsCallSiteNoInfo(Js::LocalFunctionId functionId) { return functionId == CallSiteNoInfo; }
 #if DBG_DUMP
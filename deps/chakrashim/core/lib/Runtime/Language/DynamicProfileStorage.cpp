@@ -11,6 +11,7 @@ bool DynamicProfileStorage::uninitialized = false;
 bool DynamicProfileStorage::enabled = false;
 bool DynamicProfileStorage::useCacheDir = false;
 bool DynamicProfileStorage::collectInfo = false;
+bool DynamicProfileStorage::reportToStderr = false;
 HANDLE DynamicProfileStorage::mutex = nullptr;
 wchar_t DynamicProfileStorage::cacheDrive[_MAX_DRIVE];
 wchar_t DynamicProfileStorage::cacheDir[_MAX_DIR];
@@ -20,7 +21,7 @@ DynamicProfileStorage::InfoMap DynamicProfileStorage::infoMap(&NoCheckHeapAlloca
 DWORD DynamicProfileStorage::creationTime = 0;
 long DynamicProfileStorage::lastOffset = 0;
 DWORD const DynamicProfileStorage::MagicNumber = 20100526;
-DWORD const DynamicProfileStorage::FileFormatVersion = 2;
+DWORD const DynamicProfileStorage::FileFormatVersion = 3;
 DWORD DynamicProfileStorage::nextFileId = 0;
 #if DBG
 bool DynamicProfileStorage::locked = false;
@@ -95,8 +96,7 @@ bool DynamicProfileStorageReaderWriter::ReadArray(T * t, size_t len)
     long pos = ftell(file);
     if (fread(t, sizeof(T), len, file) != len)
     {
-        Output::Print(L"ERROR: DynamicProfileStorage: '%s': File corrupted at %d\n", filename, pos);
-        Output::Flush();
+        DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: '%s': File corrupted at %d\n", filename, pos);
         return false;
     }
     return true;
@@ -113,8 +113,7 @@ _Success_(return) bool DynamicProfileStorageReaderWriter::ReadUtf8String(__deref
     utf8char_t * tempBuffer = NoCheckHeapNewArray(utf8char_t, urllen);
     if (tempBuffer == nullptr)
     {
-        Output::Print(L"ERROR: DynamicProfileStorage: Out of memory reading '%s'\n", filename);
-        Output::Flush();
+        DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Out of memory reading '%s'\n", filename);
         return false;
     }
 
@@ -128,8 +127,7 @@ _Success_(return) bool DynamicProfileStorageReaderWriter::ReadUtf8String(__deref
     wchar_t * name = NoCheckHeapNewArray(wchar_t, length + 1);
     if (name == nullptr)
     {
-        Output::Print(L"ERROR: DynamicProfileStorage: Out of memory reading '%s'\n", filename);
-        Output::Flush();
+        DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Out of memory reading '%s'\n", filename);
         HeapDeleteArray(urllen, tempBuffer);
         return false;
     }
@@ -152,8 +150,7 @@ bool DynamicProfileStorageReaderWriter::WriteArray(T * t, size_t len)
     Assert(file);
     if (fwrite(t, sizeof(T), len, file) != len)
     {
-        Output::Print(L"ERROR: DynamicProfileStorage: Unable to write to file '%s'\n", filename);
-        Output::Flush();
+        DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Unable to write to file '%s'\n", filename);
         return false;
     }
     return true;
@@ -165,8 +162,7 @@ bool DynamicProfileStorageReaderWriter::WriteUtf8String(wchar_t const * str)
     utf8char_t * tempBuffer = NoCheckHeapNewArray(utf8char_t, len * 3);
     if (tempBuffer == nullptr)
     {
-        Output::Print(L"ERROR: DynamicProfileStorage: Out of memory writing to file '%s'\n", filename);
-        Output::Flush();
+        DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Out of memory writing to file '%s'\n", filename);
         return false;
     }
     DWORD cbNeeded = (DWORD)utf8::EncodeInto(tempBuffer, str, len);
@@ -239,8 +235,7 @@ char const * DynamicProfileStorage::StorageInfo::ReadRecord() const
     char * record = AllocRecord(size);
     if (record == nullptr)
     {
-        Output::Print(L"ERROR: DynamicProfileStorage: Out of memory reading '%s'", cacheFilename);
-        Output::Flush();
+        DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Out of memory reading '%s'\n", cacheFilename);
         return nullptr;
     }
 
@@ -259,8 +254,7 @@ bool DynamicProfileStorage::StorageInfo::WriteRecord(__in_ecount(sizeof(DWORD) +
     DynamicProfileStorageReaderWriter writer;
     if (!writer.Init(cacheFilename, L"wcb", true))
     {
-        Output::Print(L"ERROR: DynamicProfileStorage: Unable open record file '%s'", cacheFilename);
-        Output::Flush();
+        DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Unable open record file '%s'\n", cacheFilename);
         return false;
     }
     if (!writer.WriteArray(GetRecordBuffer(record), GetRecordSize(record)))
@@ -279,6 +273,24 @@ bool DynamicProfileStorage::DoTrace()
 }
 #endif
 
+void __cdecl DynamicProfileStorage::Report(wchar_t const * format, ...)
+{
+    va_list argptr;
+    va_start(argptr, format);
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    Output::VPrint(format, argptr);
+    Output::Flush();
+#else
+    // The host owns stdout in release builds
+    if (reportToStderr)
+    {
+        vfwprintf(stderr, format, argptr);
+        fflush(stderr);
+    }
+#endif
+    va_end(argptr);
+}
+
 wchar_t const * DynamicProfileStorage::GetMessageType()
 {
     if (!DynamicProfileStorage::DoCollectInfo())
@@ -304,6 +316,7 @@ bool DynamicProfileStorage::Initialize()
 
     bool success = true;
     initialized = true;
+    reportToStderr = Js::Configuration::Global.flags.DynamicProfileStorageReport;
 
 #ifdef FORCE_DYNAMIC_PROFILE_STORAGE
     enabled = true;
@@ -359,12 +372,14 @@ bool DynamicProfileStorage::Initialize()
                 }
 
                 Sleep(DELAY_INTERVAL);
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
                 if (Js::Configuration::Global.flags.Verbose)
                 {
                     Output::Print(L"  Retrying load of dynamic profile from '%s' (attempt %d)...\n",
                         Js::Configuration::Global.flags.DynamicProfileInput, i + 1);
                     Output::Flush();
                 }
+#endif
             }
 
             if (!readSuccessful)
@@ -395,6 +410,22 @@ bool DynamicProfileStorage::Initialize()
     return success;
 }
 
+bool DynamicProfileStorage::EnableCacheDir(__in_z_opt wchar_t const * dirname, bool report)
+{
+    Assert(!uninitialized);
+    AutoCriticalSection autocs(&cs);
+    reportToStderr = reportToStderr || report;
+    if (enabled)
+    {
+        // Already configured, either by an earlier call or from the command line.
+        return useCacheDir;
+    }
+
+    enabled = true;
+    collectInfo = true;
+    return SetupCacheDir(dirname);
+}
+
 // We used to have problem with dynamic profile being corrupt and this is to verify it.
 // We don't see this any more so we will just disable it to speed up unittest
 #if 0
@@ -504,6 +535,7 @@ bool DynamicProfileStorage::ImportFile(__in_z wchar_t const * filename, bool all
         }
         else
         {
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
             if (Js::Configuration::Global.flags.Verbose)
             {
                 Output::Print(L"ERROR: DynamicProfileStorage: Unable to open file '%s' to import (%d)\n", filename, e);
@@ -513,6 +545,7 @@ bool DynamicProfileStorage::ImportFile(__in_z wchar_t const * filename, bool all
                 Output::Print(L"ERROR:   For file '%s': %s (%d)\n", filename, error_string, e);
                 Output::Flush();
             }
+#endif
             return false;
         }
     }
@@ -529,8 +562,7 @@ bool DynamicProfileStorage::ImportFile(__in_z wchar_t const * filename, bool all
 
     if (magic != MagicNumber)
     {
-        Output::Print(L"ERROR: DynamicProfileStorage: '%s' is not a dynamic profile data file", filename);
-        Output::Flush();
+        DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: '%s' is not a dynamic profile data file\n", filename);
         return false;
     }
     if (version != FileFormatVersion)
@@ -540,9 +572,8 @@ bool DynamicProfileStorage::ImportFile(__in_z wchar_t const * filename, bool all
             // Treat version mismatch as non-existent file
             return true;
         }
-        Output::Print(L"ERROR: DynamicProfileStorage: '%s' has format version %d; version %d expected", filename,
+        DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: '%s' has format version %d; version %d expected\n", filename,
             version, FileFormatVersion);
-        Output::Flush();
         return false;
     }
 
@@ -566,8 +597,7 @@ bool DynamicProfileStorage::ImportFile(__in_z wchar_t const * filename, bool all
         char * record = AllocRecord(recordLen);
         if (record == nullptr)
         {
-            Output::Print(L"ERROR: DynamicProfileStorage: Out of memory importing '%s'\n", filename);
-            Output::Flush();
+            DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Out of memory importing '%s'\n", filename);
             NoCheckHeapDeleteArray(len + 1, name);
             return false;
         }
@@ -614,8 +644,7 @@ bool DynamicProfileStorage::ExportFile(__in_z wchar_t const * filename)
 
     if (!writer.Init(filename, L"wcb", true))
     {
-        Output::Print(L"ERROR: DynamicProfileStorage: Unable to open file '%s' to export\n", filename);
-        Output::Flush();
+        DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Unable to open file '%s' to export\n", filename);
         return false;
     }
     DWORD recordCount = infoMap.Count();
@@ -711,8 +740,7 @@ bool DynamicProfileStorage::AcquireLock()
 #endif
         return true;
     }
-    Output::Print(L"ERROR: DynamicProfileStorage: Unable to acquire mutex %d\n", ret);
-    Output::Flush();
+    DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Unable to acquire mutex %d\n", ret);
     DisableCacheDir();
 
     return false;
@@ -730,8 +758,7 @@ bool DynamicProfileStorage::ReleaseLock()
         return true;
     }
     DisableCacheDir();
-    Output::Print(L"ERROR: DynamicProfileStorage: Unable to release mutex");
-    Output::Flush();
+    DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Unable to release mutex\n");
     return false;
 }
 
@@ -742,8 +769,7 @@ bool DynamicProfileStorage::SetupCacheDir(__in_z wchar_t const * dirname)
     mutex = CreateMutex(NULL, FALSE, L"JSDPCACHE");
     if (mutex == nullptr)
     {
-        Output::Print(L"ERROR: DynamicProfileStorage: Unable to create mutex");
-        Output::Flush();
+        DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Unable to create mutex\n");
         return false;
     }
 
@@ -760,8 +786,7 @@ bool DynamicProfileStorage::SetupCacheDir(__in_z wchar_t const * dirname)
         if (len >= _MAX_PATH || wcscat_s(tempPath, L"jsdpcache") != 0)
         {
             DisableCacheDir();
-            Output::Print(L"ERROR: DynamicProfileStorage: Can't setup cache directory: Unable to create directory\n");
-            Output::Flush();
+            DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Can't setup cache directory: Unable to create directory\n");
             ReleaseLock();
             return false;
         }
@@ -769,8 +794,7 @@ bool DynamicProfileStorage::SetupCacheDir(__in_z wchar_t const * dirname)
         if (!CreateDirectory(tempPath, NULL) && GetLastError() != ERROR_ALREADY_EXISTS)
         {
             DisableCacheDir();
-            Output::Print(L"ERROR: DynamicProfileStorage: Can't setup cache directory: Unable to create directory\n");
-            Output::Flush();
+            DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Can't setup cache directory: Unable to create directory\n");
             ReleaseLock();
             return false;
         }
@@ -805,8 +829,7 @@ bool DynamicProfileStorage::CreateCacheCatalog()
         || !catalogFile.Write(0)) // count
     {
         DisableCacheDir();
-        Output::Print(L"ERROR: DynamicProfileStorage: Unable to create cache catalog\n");
-        Output::Flush();
+        DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Unable to create cache catalog\n");
         return false;
     }
     lastOffset = catalogFile.Size();
@@ -860,8 +883,7 @@ bool DynamicProfileStorage::AppendCacheCatalog(__in_z wchar_t const * url)
     if (version > FileFormatVersion)
     {
         DisableCacheDir();
-        Output::Print(L"ERROR: DynamicProfileStorage: Existing cache catalog has a newer format\n");
-        Output::Flush();
+        DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Existing cache catalog has a newer format\n");
         return false;
     }
 
@@ -869,8 +891,7 @@ bool DynamicProfileStorage::AppendCacheCatalog(__in_z wchar_t const * url)
     {
         // This should not happen, as we are under lock from the LoadCacheCatalog
         DisableCacheDir();
-        Output::Print(L"ERROR: DynamicProfileStorage: Internal error, file modified under lock\n");
-        Output::Flush();
+        DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Internal error, file modified under lock\n");
         return false;
     }
 
@@ -929,8 +950,7 @@ bool DynamicProfileStorage::LoadCacheCatalog()
     if (version > FileFormatVersion)
     {
         DisableCacheDir();
-        Output::Print(L"ERROR: DynamicProfileStorage: Existing cache catalog has a newer format.\n");
-        Output::Flush();
+        DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Existing cache catalog has a newer format.\n");
         return false;
     }
 
@@ -952,15 +972,13 @@ bool DynamicProfileStorage::LoadCacheCatalog()
         if (!catalogFile.Seek(lastOffset))
         {
             catalogFile.Close();
-            Output::Print(L"ERROR: DynamicProfileStorage: Unable to seek to last known offset\n");
-            Output::Flush();
+            DynamicProfileStorage::Report(L"ERROR: DynamicProfileStorage: Unable to seek to last known offset\n");
             return CreateCacheCatalog();
         }
     }
     else if (creationTime != 0)
     {
-        Output::Print(L"WARNING: DynamicProfileStorage: Reloading full catalog\n");
-        Output::Flush();
+        DynamicProfileStorage::Report(L"WARNING: DynamicProfileStorage: Reloading full catalog\n");
     }
 
     for (DWORD i = start; i < count; i++)
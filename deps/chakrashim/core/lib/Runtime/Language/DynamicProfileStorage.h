@@ -10,10 +10,17 @@ class DynamicProfileStorage
 public:
     static bool Initialize();
     static bool Uninitialize();
+    static bool EnableCacheDir(__in_z_opt wchar_t const * dirname, bool report);
 
     static bool IsEnabled() { return enabled; }
     static bool DoCollectInfo() { return collectInfo; }
 
+    // Problems with the storage are printed with the rest of the engine's output in builds with debug config options,
+    // and to stderr in release builds, only if -DynamicProfileStorageReport or the host asked for it. Which profiles
+    // are loaded and used is only reported then.
+    static bool DoReport() { return reportToStderr; }
+    static void __cdecl Report(wchar_t const * format, ...);
+
     template <typename Fn>
     static Js::SourceDynamicProfileManager * Load(__in_z wchar_t const * filename, Fn loadFn);
     static void SaveRecord(__in_z wchar_t const * filename, __in_ecount(sizeof(DWORD) + *record) char const * record);
@@ -45,6 +52,7 @@ private:
     static bool enabled;
     static bool collectInfo;
     static bool useCacheDir;
+    static bool reportToStderr;
     static wchar_t cacheDrive[_MAX_DRIVE];
     static wchar_t cacheDir[_MAX_DIR];
     static wchar_t catalogFilename[_MAX_PATH];
@@ -99,8 +107,7 @@ DynamicProfileStorage::Load(wchar_t const * filename, Fn loadFn)
         wchar_t const * messageType = GetMessageType();
         if (messageType)
         {
-            Output::Print(L"%s: DynamicProfileStorage: Dynamic Profile Data not found for '%s'\n", messageType, filename);
-            Output::Flush();
+            Report(L"%s: DynamicProfileStorage: Dynamic Profile Data not found for '%s'\n", messageType, filename);
         }
 #endif
         return nullptr;
@@ -141,14 +148,17 @@ DynamicProfileStorage::Load(wchar_t const * filename, Fn loadFn)
         Output::Print(L"TRACE: DynamicProfileStorage: Dynamic Profile Data Loaded: '%s'\n", filename);
     }
 #endif
+    if (DoReport() && sourceDynamicProfileManager)
+    {
+        Report(L"DynamicProfileStorage: Loaded profile for '%s'\n", filename);
+    }
 
     if (sourceDynamicProfileManager == nullptr)
     {
         wchar_t const * messageType = GetMessageType();
         if (messageType)
         {
-            Output::Print(L"%s: DynamicProfileStorage: Dynamic Profile Data corrupted: '%s'\n", messageType, filename);
-            Output::Flush();
+            Report(L"%s: DynamicProfileStorage: Dynamic Profile Data corrupted: '%s'\n", messageType, filename);
         }
     }
     return sourceDynamicProfileManager;
@@ -639,21 +639,22 @@ namespace Js
 
     void PolymorphicInlineCache::UpdateInlineCachesFillInfo(uint index, bool set)
     {
-        Assert(index < 0x20);
+        Assert(index < MaxPolymorphicInlineCacheSize);
+        CompileAssert(MaxPolymorphicInlineCacheSize <= sizeof(inlineCachesFillInfo) * 8);
         if (set)
         {
-            this->inlineCachesFillInfo |= 1 << index;
+            this->inlineCachesFillInfo |= 1ull << index;
         }
         else
         {
-            this->inlineCachesFillInfo &= ~(1 << index);
+            this->inlineCachesFillInfo &= ~(1ull << index);
         }
     }
 
     bool PolymorphicInlineCache::IsFull()
     {
-        Assert(this->size <= 0x20);
-        return this->inlineCachesFillInfo == ((1 << (this->size - 1)) << 1) - 1;
+        Assert(this->size <= MaxPolymorphicInlineCacheSize);
+        return this->inlineCachesFillInfo == ((1ull << (this->size - 1)) << 1) - 1;
     }
 
     void PolymorphicInlineCache::CacheLocal(
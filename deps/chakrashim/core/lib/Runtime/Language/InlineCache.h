@@ -362,7 +362,7 @@ namespace Js
         bool ignoreForEquivalentObjTypeSpec;
         bool cloneForJitTimeUse;
 
-        int32 inlineCachesFillInfo;
+        uint64 inlineCachesFillInfo;
 
         // DList chaining all polymorphic inline caches of a FunctionBody together.
         // Since PolymorphicInlineCache is a leaf object, these references do not keep
@@ -407,10 +407,23 @@ namespace Js
         void SetIgnoreForEquivalentObjTypeSpec(bool value) { this->ignoreForEquivalentObjTypeSpec = value; }
         bool GetCloneForJitTimeUse() const { return this->cloneForJitTimeUse; }
         void SetCloneForJitTimeUse(bool value) { this->cloneForJitTimeUse = value; }
-        uint32 GetInlineCachesFillInfo() { return this->inlineCachesFillInfo; }
+        uint64 GetInlineCachesFillInfo() { return this->inlineCachesFillInfo; }
         void UpdateInlineCachesFillInfo(uint32 index, bool set);
         bool IsFull();
 
+        uint GetEntryCount()
+        {
+            uint count = 0;
+            for (uint i = 0; i < size; ++i)
+            {
+                if (!inlineCaches[i].IsEmpty())
+                {
+                    count++;
+                }
+            }
+            return count;
+        }
+
         virtual void Finalize(bool isShutdown) override;
         virtual void Dispose(bool isShutdown) override { };
         virtual void Mark(Recycler *recycler) override { AssertMsg(false, "Mark called on object that isn't TrackableObject"); }
@@ -504,20 +517,6 @@ namespace Js
 #ifdef CLONE_INLINECACHE_TO_EMPTYSLOT
         template <typename TDelegate>
         bool CheckClonedInlineCache(uint inlineCacheIndex, TDelegate mapper);
-#endif
-#if INTRUSIVE_TESTTRACE_PolymorphicInlineCache
-        uint GetEntryCount()
-        {
-            uint count = 0;
-            for (uint i = 0; i < size; ++i)
-            {
-                if (!inlineCaches[i].IsEmpty())
-                {
-                    count++;
-                }
-            }
-            return count;
-        }
 #endif
     };
 
@@ -464,7 +464,7 @@ namespace Js
             // so it may not pass VerifyRegistrationForInvalidation. Besides, it will be repopulated with the incoming data,
             // and registered for invalidation, if necessary.
             inlineCaches[inlineCacheIndex].Clear();
-            Assert((this->inlineCachesFillInfo & (1 << inlineCacheIndex)) != 0);
+            Assert((this->inlineCachesFillInfo & (1ull << inlineCacheIndex)) != 0);
             UpdateInlineCachesFillInfo(inlineCacheIndex, false /*set*/);
         }
     }
@@ -1747,6 +1747,7 @@ namespace Js
 #endif
 
         executeFunction->interpretedCount++;
+        executeFunction->RecordInterpretedCall();
 #ifdef BGJIT_STATS
         functionScriptContext->interpretedCount++;
         functionScriptContext->maxFuncInterpret = max(functionScriptContext->maxFuncInterpret, executeFunction->interpretedCount);
@@ -3056,6 +3057,10 @@ namespace Js
                 this->ehBailoutData = nullptr;
             }
         }
+
+        // Function entry is a safepoint for samples requested by the host; this frame is already on the frame list.
+        scriptContext->GetThreadContext()->CheckSampleRequest();
+
 #ifndef TEMP_DISABLE_ASMJS
         FunctionBody *const functionBody = GetFunctionBody();
         if( functionBody->GetIsAsmjsMode() )
@@ -7096,6 +7101,7 @@ const byte * InterpreterStackFrame::OP_ProfiledLoopBodyStart(const byte * ip)
     void InterpreterStackFrame::DoInterruptProbe()
     {
         PROBE_STACK(scriptContext, 0);
+        scriptContext->GetThreadContext()->CheckSampleRequest();
     }
 
     void InterpreterStackFrame::InitializeStackFunctions(StackScriptFunction * scriptFunctions)
@@ -3504,12 +3504,23 @@ CommonNumber:
             temp = JavascriptString::FromVar(index);
             Assert(temp->GetScriptContext() == scriptContext);
 
+            PropertyString * propertyString = nullptr;
+            RecyclableObject* object = nullptr;
             if (VirtualTableInfo<Js::PropertyString>::HasVirtualTable(temp))
             {
-                PropertyString * propertyString = (PropertyString*)temp;
+                propertyString = (PropertyString*)temp;
+            }
+            else if (JavascriptOperators::GetPropertyObject(instance, scriptContext, &object) && !IsJsNativeObject(object))
+            {
+                // Other strings, such as keys built by concatenation, use the property string of their property record, so
+                // the cache below applies from the second use of the same string on
+                propertyString = scriptContext->GetPropertyStringForKey(temp);
+            }
+
+            if (propertyString != nullptr)
+            {
                 PropertyCache const *cache = propertyString->GetPropertyCache();
-                RecyclableObject* object = nullptr;
-                if (FALSE == JavascriptOperators::GetPropertyObject(instance, scriptContext, &object))
+                if (object == nullptr && FALSE == JavascriptOperators::GetPropertyObject(instance, scriptContext, &object))
                 {
                     JavascriptError::ThrowTypeError(scriptContext, JSERR_Property_CannotGet_NullOrUndefined,
                         JavascriptString::FromVar(index)->GetSz());
@@ -4171,12 +4182,17 @@ CommonNumber:
             }
         }
 
-        // fastpath for PropertyStrings only if receiver == object
-        if (!TaggedInt::Is(index) && JavascriptString::Is(index) &&
-            VirtualTableInfo<Js::PropertyString>::HasVirtualTable(JavascriptString::FromVar(index)))
+        // fastpath for PropertyStrings only if receiver == object. Other strings use the property string of their property
+        // record if they were recently used as a key to get a property.
+        if (!TaggedInt::Is(index) && JavascriptString::Is(index))
         {
-            propertyString = (PropertyString *)JavascriptString::FromVar(index);
+            JavascriptString * indexString = JavascriptString::FromVar(index);
+            propertyString = VirtualTableInfo<Js::PropertyString>::HasVirtualTable(indexString) ?
+                (PropertyString *)indexString : scriptContext->TryGetCachedPropertyStringForKey(indexString);
+        }
 
+        if (propertyString != nullptr)
+        {
             Assert(propertyString->GetScriptContext() == scriptContext);
 
             PropertyCache const * cache = propertyString->GetPropertyCache();
@@ -4399,6 +4415,18 @@ CommonNumber:
             return false;
         }
 
+        if (TypedArrayBase::Is(instanceType))
+        {
+            // An element-by-element copy between two views that overlap at different offsets is not a memcpy
+            TypedArrayBase *const dstTypedArray = TypedArrayBase::FromVar(dstInstance);
+            TypedArrayBase *const srcTypedArray = TypedArrayBase::FromVar(srcInstance);
+            if (dstTypedArray->GetArrayBuffer() == srcTypedArray->GetArrayBuffer() &&
+                dstTypedArray->GetByteOffset() != srcTypedArray->GetByteOffset())
+            {
+                return false;
+            }
+        }
+
         BOOL  returnValue = false;
         switch (instanceType)
         {
@@ -4583,6 +4611,67 @@ CommonNumber:
         return returnValue;
     }
 
+    BOOL JavascriptOperators::OP_Memxor(Var instance, int32 start, int32 value, int32 length, ScriptContext* scriptContext)
+    {
+        if (length <= 0)
+        {
+            return true;
+        }
+        TypeId instanceType = JavascriptOperators::GetTypeId(instance);
+        BOOL  returnValue = false;
+
+        // The typed array will deal with all possible values for the index
+#define MEMXOR_TYPED_ARRAY(type) type ## ::FromVar(instance)->DirectXorItemAtRange(start, length, value)
+        switch (instanceType)
+        {
+        case TypeIds_Int8Array:
+        {
+            returnValue = MEMXOR_TYPED_ARRAY(Int8Array);
+            break;
+        }
+        case TypeIds_Uint8Array:
+        {
+            returnValue = MEMXOR_TYPED_ARRAY(Uint8Array);
+            break;
+        }
+        case TypeIds_Uint8ClampedArray:
+        {
+            // The JIT only xors clamped arrays with values that are already in [0, 255]
+            Assert(value >= 0 && value <= UINT8_MAX);
+            returnValue = MEMXOR_TYPED_ARRAY(Uint8ClampedArray);
+            break;
+        }
+        case TypeIds_Int16Array:
+        {
+            returnValue = MEMXOR_TYPED_ARRAY(Int16Array);
+            break;
+        }
+        case TypeIds_Uint16Array:
+        {
+            returnValue = MEMXOR_TYPED_ARRAY(Uint16Array);
+            break;
+        }
+        case TypeIds_Int32Array:
+        {
+            returnValue = MEMXOR_TYPED_ARRAY(Int32Array);
+            break;
+        }
+        case TypeIds_Uint32Array:
+        {
+            returnValue = MEMXOR_TYPED_ARRAY(Uint32Array);
+            break;
+        }
+        default:
+        {
+            // Only typed int arrays are candidates for memxor, but the type is not checked before the call. Bail out.
+            break;
+        }
+        }
+
+#undef MEMXOR_TYPED_ARRAY
+        return returnValue;
+    }
+
     Var JavascriptOperators::OP_DeleteElementI_UInt32(Var instance, uint32 index, ScriptContext* scriptContext, PropertyOperationFlags propertyOperationFlags)
     {
 #if FLOATVAR
@@ -9046,6 +9135,12 @@ CommonNumber:
         throw ScriptAbortException();
     }
 
+    void JavascriptOperators::ScriptInterruptProbe(ScriptContext* scriptContext)
+    {
+        // Either script execution was disabled (throws) or the host asked for a sample.
+        scriptContext->GetThreadContext()->HandleInterruptProbe();
+    }
+
     void PolymorphicInlineCache::Finalize(bool isShutdown)
     {
         if (size == 0)
@@ -35,6 +35,7 @@
 #include "Library\ArgumentsObject.h"
 
 #include "Types\TypePropertyCache.h"
+#include "Types\MegamorphicPropertyCache.h"
 #include "Library\JavascriptVariantDate.h"
 #include "Library\JavascriptProxy.h"
 #include "Library\JavascriptSymbol.h"
@@ -305,9 +305,10 @@ namespace Js
         Recycler* recycler = scriptContext->GetRecycler();
 
 #ifdef DYNAMIC_PROFILE_STORAGE
-        if(DynamicProfileStorage::IsEnabled() && info->url != nullptr)
+        wchar_t key[MaxDynamicProfileStorageKeyLength];
+        if(DynamicProfileStorage::IsEnabled() && info->url != nullptr && GetDynamicProfileStorageKey(info, key, _countof(key)))
         {
-            manager = DynamicProfileStorage::Load(info->url, [recycler](char const * buffer, uint length) -> SourceDynamicProfileManager *
+            manager = DynamicProfileStorage::Load(key, [recycler](char const * buffer, uint length) -> SourceDynamicProfileManager *
             {
                 BufferReader reader(buffer, length);
                 return SourceDynamicProfileManager::Deserialize(&reader, recycler);
@@ -438,10 +439,28 @@ namespace Js
         return true;
     }
 
+    // Profiles are keyed by url. When the host provided a hash of the source text it is appended to the key, so that a
+    // profile recorded for an older version of a script is never applied to the current one.
+    bool
+    SourceDynamicProfileManager::GetDynamicProfileStorageKey(SourceContextInfo const * info, __out_ecount(keyLength) wchar_t * key, size_t keyLength)
+    {
+        Assert(info->url != nullptr);
+        int length = info->sourceHash != 0 ?
+            _snwprintf_s(key, keyLength, _TRUNCATE, L"%s#%08x", info->url, info->sourceHash) :
+            _snwprintf_s(key, keyLength, _TRUNCATE, L"%s", info->url);
+        return length != -1;
+    }
+
     void
-    SourceDynamicProfileManager::SaveToDynamicProfileStorage(wchar_t const * url)
+    SourceDynamicProfileManager::SaveToDynamicProfileStorage(SourceContextInfo const * info)
     {
         Assert(DynamicProfileStorage::IsEnabled());
+        wchar_t key[MaxDynamicProfileStorageKeyLength];
+        if (!GetDynamicProfileStorageKey(info, key, _countof(key)))
+        {
+            return;
+        }
+
         BufferSizeCounter counter;
         if (!this->Serialize(&counter))
         {
@@ -458,7 +477,7 @@ namespace Js
 #if DBG_DUMP
         if (PHASE_STATS1(DynamicProfilePhase))
         {
-            Output::Print(L"%-180s : %d bytes\n", url, counter.GetByteCount());
+            Output::Print(L"%-180s : %d bytes\n", key, counter.GetByteCount());
         }
 #endif
 
@@ -469,7 +488,7 @@ namespace Js
             DynamicProfileStorage::DeleteRecord(record);
         }
 
-        DynamicProfileStorage::SaveRecord(url, record);
+        DynamicProfileStorage::SaveRecord(key, record);
     }
 
 #endif
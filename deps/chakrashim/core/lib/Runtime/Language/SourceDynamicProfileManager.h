@@ -44,7 +44,8 @@ namespace Js
 
 #ifdef DYNAMIC_PROFILE_STORAGE
         void SaveDynamicProfileInfo(LocalFunctionId functionId, DynamicProfileInfo * dynamicProfileInfo);
-        void SaveToDynamicProfileStorage(wchar_t const * url);
+        void SaveToDynamicProfileStorage(SourceContextInfo const * info);
+        static bool GetDynamicProfileStorageKey(SourceContextInfo const * info, __out_ecount(keyLength) wchar_t * key, size_t keyLength);
         template <typename T>
         static SourceDynamicProfileManager * Deserialize(T * reader, Recycler* allocator);
         template <typename T>
@@ -64,6 +65,9 @@ namespace Js
         JsUtil::BaseDictionary<LocalFunctionId, DynamicProfileInfo *, Recycler, PowerOf2SizePolicy> dynamicProfileInfoMap;
 
         static const uint MAX_FUNCTION_COUNT = 10000;  // Consider data corrupt if there are more functions than this
+#ifdef DYNAMIC_PROFILE_STORAGE
+        static const size_t MaxDynamicProfileStorageKeyLength = 1024;
+#endif
 
         //
         // Simple read-only wrapper around IStream - templatized and returns boolean result to indicate errors
@@ -1004,6 +1004,198 @@ Error:
         return true;
     }
 
+    bool DateImplementation::TryParseShortName(
+        const wchar_t *const str,
+        const size_t length,
+        const size_t startIndex,
+        const wchar_t (*const names)[4],
+        const int numNames,
+        int &value)
+    {
+        Assert(str);
+        Assert(startIndex <= length);
+
+        if(length - startIndex < 3)
+            return false;
+
+        wchar_t name[3];
+        for(size_t i = 0; i < 3; ++i)
+        {
+            const wchar_t ch = str[startIndex + i];
+            if(!(ch >= L'a' && ch <= L'z') && !(ch >= L'A' && ch <= L'Z'))
+                return false;
+            name[i] = ch | 0x20;
+        }
+
+        for(int n = 0; n < numNames; ++n)
+        {
+            if(name[0] == (names[n][0] | 0x20) && name[1] == names[n][1] && name[2] == names[n][2])
+            {
+                value = n;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Accepts
+    //     [Www[,] ]DD Mmm YYYY hh:mm[:ss][ zone][ (comment)]
+    //     [Www ]Mmm DD YYYY hh:mm[:ss][ zone][ (comment)]
+    // where the zone is GMT, UTC, UT or Z, optionally followed by +hhmm or -hhmm, or the offset alone. Fields are separated
+    // by single spaces. A string without a zone is in local time. Anything the generic parser could read differently,
+    // such as a day of the month of 70 or more or a year below 100, is rejected.
+    bool DateImplementation::TryParseRfcString(const wchar_t *const str, const size_t length, double &timeValue, ScriptContext *scriptContext)
+    {
+        Assert(str);
+
+        if(length == 0)
+            return false;
+
+        size_t i = 0;
+        int t;
+
+        // The day of the week is ignored, as by the generic parser
+        if(TryParseShortName(str, length, i, g_rgpszDay, (int)_countof(g_rgpszDay), t))
+        {
+            i += 3;
+            if(i < length && str[i] == L',')
+                ++i;
+            if(i >= length || str[i] != L' ')
+                return false;
+            ++i;
+        }
+
+        int month;
+        int day;
+        if(TryParseShortName(str, length, i, g_rgpszMonth, (int)_countof(g_rgpszMonth), month))
+        {
+            i += 3;
+            if(i >= length || str[i] != L' ')
+                return false;
+            ++i;
+            if(TryParseDecimalDigits(str, length, i, 2, day))
+                i += 2;
+            else if(TryParseDecimalDigits(str, length, i, 1, day))
+                ++i;
+            else
+                return false;
+        }
+        else
+        {
+            if(TryParseDecimalDigits(str, length, i, 2, day))
+                i += 2;
+            else if(TryParseDecimalDigits(str, length, i, 1, day))
+                ++i;
+            else
+                return false;
+            if(i >= length || str[i] != L' ')
+                return false;
+            ++i;
+            if(!TryParseShortName(str, length, i, g_rgpszMonth, (int)_countof(g_rgpszMonth), month))
+                return false;
+            i += 3;
+        }
+
+        // The generic parser takes numbers from 70 on as years, and adds 1900 to years below 100
+        if(day >= 70)
+            return false;
+
+        int year;
+        if(i >= length || str[i] != L' ' || !TryParseDecimalDigits(str, length, ++i, 4, year) || year < 100)
+            return false;
+        i += 4;
+
+        int hour;
+        int minute;
+        int second = 0;
+        if(i >= length || str[i] != L' ' || !TryParseTwoDecimalDigits(str, length, ++i, hour) || hour > 23)
+            return false;
+        i += 2;
+        if(i >= length || str[i] != L':' || !TryParseTwoDecimalDigits(str, length, ++i, minute) || minute > 59)
+            return false;
+        i += 2;
+        if(i < length && str[i] == L':')
+        {
+            if(!TryParseTwoDecimalDigits(str, length, ++i, second) || second > 59)
+                return false;
+            i += 2;
+        }
+
+        bool isLocalTime = true;
+        long offsetMinutes = 0;
+        if(i < length && str[i] == L' ')
+        {
+            ++i;
+
+            size_t zoneLength = 0;
+            while(i + zoneLength < length && zoneLength < 4 &&
+                ((str[i + zoneLength] >= L'a' && str[i + zoneLength] <= L'z') || (str[i + zoneLength] >= L'A' && str[i + zoneLength] <= L'Z')))
+            {
+                ++zoneLength;
+            }
+            if(zoneLength != 0)
+            {
+                wchar_t zone[3];
+                if(zoneLength > 3)
+                    return false;
+                for(size_t j = 0; j < zoneLength; ++j)
+                    zone[j] = str[i + j] | 0x20;
+                if(zoneLength == 3 ?
+                        !(zone[0] == L'g' && zone[1] == L'm' && zone[2] == L't') && !(zone[0] == L'u' && zone[1] == L't' && zone[2] == L'c') :
+                    zoneLength == 2 ?
+                        !(zone[0] == L'u' && zone[1] == L't') :
+                        zone[0] != L'z')
+                {
+                    return false;
+                }
+                isLocalTime = false;
+                i += zoneLength;
+            }
+
+            if(i < length && (str[i] == L'+' || str[i] == L'-'))
+            {
+                const bool isNegative = str[i] == L'-';
+                if(!TryParseDecimalDigits(str, length, ++i, 4, t))
+                    return false;
+                i += 4;
+
+                // As computed by the generic parser, which takes offsets below 24 as hours
+                offsetMinutes = t < 24 ? t * 60 : (t % 100) + (t / 100) * 60;
+                if(isNegative)
+                    offsetMinutes = -offsetMinutes;
+                isLocalTime = false;
+            }
+
+            if(i < length && str[i] == L' ')
+                ++i;
+
+            // A comment such as the time zone name at the end of toString's format, without nested parentheses
+            if(i < length && str[i] == L'(')
+            {
+                while(++i < length && str[i] != L')')
+                {
+                    if(str[i] == L'(')
+                        return false;
+                }
+                if(i >= length)
+                    return false;
+                ++i;
+            }
+        }
+
+        if(i < length)
+            return false;
+        Assert(i == length);
+
+        const long timeSeconds = hour * 3600L + minute * 60L + second - offsetMinutes * 60;
+        timeValue = TvFromDate(year, month, day - 1, (double)timeSeconds * 1000);
+        if(isLocalTime)
+        {
+            timeValue = GetTvUtc(timeValue, scriptContext);
+        }
+        return true;
+    }
+
     boolean DateImplementation::UtcTimeFromStrCore(
         __in_ecount_z(ulength) const wchar_t *psz,
         unsigned int ulength,
@@ -1030,6 +1222,12 @@ Error:
             return true;
         }
 
+        // Then the formats of toUTCString and toString, which the generic parser below would read the same, only slower
+        if(TryParseRfcString(psz, ulength, retVal, scriptContext))
+        {
+            return true;
+        }
+
         enum
         {
             ssNil,
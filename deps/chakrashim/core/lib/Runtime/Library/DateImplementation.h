@@ -139,6 +139,20 @@ namespace Js {
         // ISO format.
         static bool TryParseIsoString(const wchar_t *const str, const size_t length, double &timeValue, ScriptContext *scriptContext);
 
+        // Matches three letters against names such as those in g_rgpszMonth, ignoring case
+        static bool TryParseShortName(
+            const wchar_t *const str,
+            const size_t length,
+            const size_t startIndex,
+            const wchar_t (*const names)[4],
+            const int numNames,
+            int &value);
+
+        // Tries to parse the string in the formats of toUTCString and toString, which are those of RFC 1123 and RFC 2822
+        // and the non-ISO formats most often parsed back. Returns false if the string is in any other format, which is
+        // left to the generic parser in UtcTimeFromStrCore; the strings accepted give the same time value as there.
+        static bool TryParseRfcString(const wchar_t *const str, const size_t length, double &timeValue, ScriptContext *scriptContext);
+
         static JavascriptString* ConvertVariantDateToString(double variantDateDouble, ScriptContext* scriptContext);
         static JavascriptString* GetDateDefaultString(Js::YMD *pymd, TZD *ptzd,DateTimeFlag noDateTime,ScriptContext* scriptContext);
         static JavascriptString* GetDateGmtString(Js::YMD *pymd,ScriptContext* scriptContext);
@@ -57,6 +57,23 @@ namespace JSON
         return Parse(input, reviver, scriptContext);
     }
 
+    Js::Var ParseUtf8(LPCUTF8 input, size_t length, Js::ScriptContext* scriptContext)
+    {
+        // A UTF-8 sequence never decodes to more UTF-16 code units than it has bytes, so the byte length bounds the text.
+        if (!Js::IsValidCharCount(length))
+        {
+            Js::JavascriptError::ThrowOutOfMemoryError(scriptContext);
+        }
+
+        // Decode straight into the buffer of the string the parser works on, instead of building a string in the host and
+        // copying it into the engine.
+        wchar_t* buffer = RecyclerNewArrayLeaf(scriptContext->GetRecycler(), wchar_t, length + 1);
+        LPCUTF8 current = input;
+        charcount_t decodedLength = static_cast<charcount_t>(utf8::DecodeUnitsIntoAndNullTerminate(buffer, current, input + length));
+
+        return Parse(Js::JavascriptString::NewWithBuffer(buffer, decodedLength, scriptContext), nullptr, scriptContext);
+    }
+
     Js::Var Parse(Js::JavascriptString* input, Js::RecyclableObject* reviver, Js::ScriptContext* scriptContext)
     {
         // alignment required because of the union in JSONParser::m_token
@@ -318,15 +335,22 @@ namespace JSON
 
         BEGIN_TEMP_ALLOCATOR(tempAlloc, scriptContext, L"JSON")
         {
-            stringifySession.CompleteInit(space, tempAlloc);
+            __try
+            {
+                stringifySession.CompleteInit(space, tempAlloc);
 
-            Js::DynamicObject* wrapper = scriptContext->GetLibrary()->CreateObject();
-            JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(wrapper));
-            Js::PropertyRecord const * propertyRecord;
-            scriptContext->GetOrAddPropertyRecord(L"", 0, &propertyRecord);
-            Js::PropertyId propertyId = propertyRecord->GetPropertyId();
-            Js::JavascriptOperators::InitProperty(wrapper, propertyId, value);
-            result = stringifySession.Str(scriptContext->GetLibrary()->GetEmptyString(), propertyId, wrapper);
+                Js::DynamicObject* wrapper = scriptContext->GetLibrary()->CreateObject();
+                JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(wrapper));
+                Js::PropertyRecord const * propertyRecord;
+                scriptContext->GetOrAddPropertyRecord(L"", 0, &propertyRecord);
+                Js::PropertyId propertyId = propertyRecord->GetPropertyId();
+                Js::JavascriptOperators::InitProperty(wrapper, propertyId, value);
+                result = stringifySession.Str(scriptContext->GetLibrary()->GetEmptyString(), propertyId, wrapper);
+            }
+            __finally
+            {
+                stringifySession.Finalizer();
+            }
         }
         END_TEMP_ALLOCATOR(tempAlloc, scriptContext);
 
@@ -388,6 +412,16 @@ namespace JSON
         objectStack = Anew(tempAlloc, JSONStack, tempAlloc, scriptContext);
     }
 
+    void StringifySession::Finalizer()
+    {
+        if (typeInfoAllocatorObject)
+        {
+            scriptContext->ReleaseTemporaryGuestAllocator(typeInfoAllocatorObject);
+            typeInfoAllocatorObject = nullptr;
+            typeInfoCache = nullptr;
+        }
+    }
+
     Js::Var StringifySession::Str(uint32 index, Js::Var holder)
     {
         Js::Var value;
@@ -585,6 +619,7 @@ namespace JSON
         Js::JavascriptString* indentString = NULL;          // gap*indent
         Js::RecyclableObject* object = Js::RecyclableObject::FromVar(value);
         Js::JavascriptString* result = NULL;
+        ObjectTypeInfo* typeInfo = nullptr;
 
         if(ReplacerArray == this->replacerType)
         {
@@ -638,6 +673,10 @@ namespace JSON
                     }
                 }
             }
+            else if (ReplacerNone == replacerType && (typeInfo = GetObjectTypeInfo(object)) != nullptr)
+            {
+                result = StringifyMembers(Js::DynamicObject::FromVar(object), typeInfo, indentString, memberSeparator, isEmpty);
+            }
             else
             {
                 uint32 precisePropertyCount = 0;
@@ -767,6 +806,118 @@ namespace JSON
         return result;
     }
 
+    StringifySession::ObjectTypeInfo* StringifySession::GetObjectTypeInfo(Js::RecyclableObject* object)
+    {
+        if (Js::JavascriptOperators::GetTypeId(object) != Js::TypeIds_Object || !Js::DynamicObject::Is(object))
+        {
+            return nullptr;
+        }
+
+        Js::DynamicObject* dynamicObject = Js::DynamicObject::FromVar(object);
+        Js::DynamicType* type = dynamicObject->GetDynamicType();
+        Js::DynamicTypeHandler* typeHandler = type->GetTypeHandler();
+
+        // Shared types never change their handler, so what is learned here holds for every object of the type
+        if (!type->GetIsShared() || !typeHandler->IsPathTypeHandler() || dynamicObject->HasObjectArray())
+        {
+            return nullptr;
+        }
+
+        if (!typeInfoCache)
+        {
+            typeInfoAllocatorObject = scriptContext->GetTemporaryGuestAllocator(L"JSONStringify");
+            typeInfoCache = Anew(typeInfoAllocatorObject->GetAllocator(), ObjectTypeInfoCache, typeInfoAllocatorObject->GetAllocator(), 8);
+        }
+
+        ObjectTypeInfo* typeInfo;
+        if (typeInfoCache->TryGetValue(type, &typeInfo))
+        {
+            return typeInfo;
+        }
+        if (typeInfoCache->Count() >= MAX_CACHED_OBJECT_TYPES)
+        {
+            return nullptr;
+        }
+
+        ArenaAllocator* allocator = typeInfoAllocatorObject->GetAllocator();
+        int propertyCount = typeHandler->GetPropertyCount();
+        typeInfo = Anew(allocator, ObjectTypeInfo);
+        typeInfo->memberCount = 0;
+        typeInfo->memberSlots = AnewArray(allocator, Js::PropertyIndex, propertyCount);
+        typeInfo->memberIds = AnewArray(allocator, Js::PropertyId, propertyCount);
+        typeInfo->memberNames = AnewArray(allocator, Js::JavascriptString*, propertyCount);
+        typeInfo->memberPrefixes = AnewArray(allocator, Js::JavascriptString*, propertyCount);
+
+        // Same order and filtering as PathTypeHandlerBase::FindNextProperty
+        for (Js::PropertyIndex index = 0; index < propertyCount; index++)
+        {
+            Js::PropertyId id = typeHandler->GetPropertyId(scriptContext, index);
+            if (scriptContext->GetPropertyName(id)->IsSymbol())
+            {
+                continue;
+            }
+
+            Js::JavascriptString* name = scriptContext->GetPropertyString(id);
+            Js::JavascriptString* prefix = Js::JavascriptString::Concat(Quote(name), GetPropertySeparator());
+            prefix->GetSz(); // flatten it once, rather than in every string it becomes part of
+
+            uint member = typeInfo->memberCount++;
+            typeInfo->memberSlots[member] = index;
+            typeInfo->memberIds[member] = id;
+            typeInfo->memberNames[member] = name;
+            typeInfo->memberPrefixes[member] = prefix;
+        }
+
+        typeInfoCache->Add(type, typeInfo);
+        return typeInfo;
+    }
+
+    Js::ConcatStringBuilder* StringifySession::StringifyMembers(Js::DynamicObject* object, ObjectTypeInfo* typeInfo,
+        Js::JavascriptString* &indentString, Js::JavascriptString* &memberSeparator, bool &isEmpty)
+    {
+        Js::Type* type = object->GetType();
+        bool isFirstMember = true;
+
+        // Separator, prefix and value for each member
+        Js::ConcatStringBuilder* result = Js::ConcatStringBuilder::New(this->scriptContext, typeInfo->memberCount * 3);
+
+        for (uint member = 0; member < typeInfo->memberCount; member++)
+        {
+            Js::Var memberString;
+            if (object->GetType() == type)
+            {
+                memberString = StrHelper(typeInfo->memberNames[member], object->GetSlot(typeInfo->memberSlots[member]), object);
+            }
+            else
+            {
+                // A toJSON function changed the object, so its slots can no longer be trusted. The remaining members are
+                // looked up by name, which is what the spec asks for anyway.
+                memberString = Str(typeInfo->memberNames[member], typeInfo->memberIds[member], object);
+            }
+
+            if (Js::JavascriptOperators::IsUndefinedObject(memberString, scriptContext))
+            {
+                continue;
+            }
+
+            if (!isFirstMember)
+            {
+                if (!indentString)
+                {
+                    indentString = GetIndentString(this->indent);
+                    memberSeparator = GetMemberSeparator(indentString);
+                }
+                result->Append(memberSeparator);
+            }
+            result->Append(typeInfo->memberPrefixes[member]);
+            result->Append(Js::JavascriptString::FromVar(memberString));
+            isFirstMember = false;
+            isEmpty = false;
+        }
+
+        return result;
+    }
+
     Js::JavascriptString* StringifySession::GetArrayElementString(uint32 index, Js::Var arrayVar)
     {
         Js::RecyclableObject *undefined = scriptContext->GetLibrary()->GetUndefined();
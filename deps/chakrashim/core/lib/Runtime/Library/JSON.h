@@ -20,6 +20,10 @@ namespace JSON
     Js::Var Stringify(Js::RecyclableObject* function, Js::CallInfo callInfo, ...);
     Js::Var Parse(Js::RecyclableObject* function, Js::CallInfo callInfo, ...);
 
+    // Parses UTF-8 encoded JSON text from a host buffer. The text is decoded once, straight into the string the parser reads,
+    // instead of being decoded by the host and then copied.
+    Js::Var ParseUtf8(LPCUTF8 input, size_t length, Js::ScriptContext* scriptContext);
+
     class StringifySession
     {
     public:
@@ -40,7 +44,9 @@ namespace JSON
                 replacerType(ReplacerNone),
                 gap(NULL),
                 indent(0),
-                propertySeparator(NULL)
+                propertySeparator(NULL),
+                typeInfoAllocatorObject(nullptr),
+                typeInfoCache(nullptr)
         {
             replacer.propertyList.propertyNames = NULL;
             replacer.propertyList.length = 0;
@@ -61,14 +67,32 @@ namespace JSON
             replacer.propertyList.length = len;
         }
         void CompleteInit(Js::Var space, ArenaAllocator* alloc);
+        void Finalizer();
 
         Js::Var Str(Js::JavascriptString* key, Js::PropertyId keyId, Js::Var holder);
         Js::Var Str(uint32 index, Js::Var holder);
 
     private:
+        // Members of objects whose type is a shared path type, in enumeration order. Such members are all enumerable data
+        // properties, so objects of the type can be stringified by reading their slots instead of enumerating them.
+        struct ObjectTypeInfo
+        {
+            uint memberCount;
+            Js::PropertyIndex* memberSlots;
+            Js::PropertyId* memberIds;
+            Js::JavascriptString** memberNames;
+            Js::JavascriptString** memberPrefixes;      // quoted name and property separator
+        };
+
+        typedef JsUtil::BaseDictionary<Js::Type*, ObjectTypeInfo*, ArenaAllocator> ObjectTypeInfoCache;
+        static const int MAX_CACHED_OBJECT_TYPES = 256;
+
         Js::JavascriptString* Quote(Js::JavascriptString* value);
 
         Js::Var StringifyObject(Js::Var value);
+        ObjectTypeInfo* GetObjectTypeInfo(Js::RecyclableObject* object);
+        Js::ConcatStringBuilder* StringifyMembers(Js::DynamicObject* object, ObjectTypeInfo* typeInfo,
+            Js::JavascriptString* &indentString, Js::JavascriptString* &memberSeparator, bool &isEmpty);
 
         Js::Var StringifyArray(Js::Var value);
         Js::JavascriptString* GetArrayElementString(uint32 index, Js::Var arrayVar);
@@ -100,6 +124,8 @@ namespace JSON
         Js::JavascriptString* gap;
         uint indent;
         Js::JavascriptString* propertySeparator;     // colon or colon+space
+        Js::TempGuestArenaAllocatorObject* typeInfoAllocatorObject;  // guest arena, so that the cached strings stay alive
+        ObjectTypeInfoCache* typeInfoCache;
         Js::Var StringifySession::StrHelper(Js::JavascriptString* key, Js::Var value, Js::Var holder);
     };
 } // namespace JSON
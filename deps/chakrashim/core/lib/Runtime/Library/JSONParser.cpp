@@ -42,7 +42,36 @@ namespace JSON
 
     Js::Var JSONParser::Parse(Js::JavascriptString* input)
     {
-        return Parse(input->GetSz(), input->GetLength());
+        LPCWSTR str = input->GetSz();
+
+        // Strings sliced out of the input belong to the input's script context
+        if (input->GetScriptContext() == scriptContext)
+        {
+            this->inputString = input;
+        }
+        return Parse(str, input->GetLength());
+    }
+
+    Js::JavascriptString* JSONParser::NewStringValue()
+    {
+        wchar_t* str = m_scanner.GetCurrentString();
+        uint len = m_scanner.GetCurrentStringLen();
+
+        // A string value without escapes is already sitting in the input, so it can share the input's buffer instead of being
+        // copied. A SubString keeps the whole input alive for as long as it lives, though, so that is only done for strings that
+        // make up a large part of the input, where the memory kept alive is at most a small multiple of the copy's. Short
+        // strings are always copied, since a SubString is no smaller than the copy.
+        if (inputString != nullptr &&
+            len >= MIN_SUBSTRING_LENGTH &&
+            len >= inputString->GetLength() / MAX_SUBSTRING_INPUT_RATIO &&
+            m_scanner.IsCurrentStringInInputText())
+        {
+            Assert(inputString->GetString() == m_scanner.inputText);
+            return Js::SubString::New(inputString, (charcount_t)(str - m_scanner.inputText), len);
+        }
+
+        // will auto-null-terminate the string (as length=len+1)
+        return Js::JavascriptString::NewCopyBuffer(str, len, scriptContext);
     }
 
     Js::Var JSONParser::Walk(Js::JavascriptString* name, Js::PropertyId id, Js::Var holder, uint32 index)
@@ -200,9 +229,7 @@ namespace JSON
 
         case tkStrCon:
             {
-                // will auto-null-terminate the string (as length=len+1)
-                uint len = m_scanner.GetCurrentStringLen();
-                retVal = Js::JavascriptString::NewCopyBuffer(m_scanner.GetCurrentString(), len, scriptContext);
+                retVal = NewStringValue();
                 Scan();
                 return retVal;
             }
@@ -302,6 +329,15 @@ namespace JSON
                 }
                 JsonTypeCache* previousCache = nullptr;
                 JsonTypeCache* currentCache = nullptr;
+                JsonTypeCache* firstCache = nullptr;
+
+                // The type the object would have with the members parsed so far. When an earlier object with the same
+                // first member tells us the type this one is likely to end up with, the object is given that type (and
+                // all of its slots) up front, and each cached member after that only has to fill in its slot. The object
+                // goes back to currentType as soon as its members stop following that type.
+                DynamicType* currentType = object->GetDynamicType();
+                DynamicType* expectedType = nullptr;
+
                 //parse the list of members
                 while(true)
                 {
@@ -318,7 +354,7 @@ namespace JSON
                     WCHAR* currentStr = m_scanner.GetCurrentString();
                     uint currentStrLength = m_scanner.GetCurrentStringLen();
 
-                    DynamicType* typeWithoutProperty = object->GetDynamicType();
+                    DynamicType* typeWithoutProperty = currentType;
                     if(IsCaching())
                     {
                         if(!previousCache)
@@ -329,6 +365,19 @@ namespace JSON
                         if(currentCache && currentCache->typeWithoutProperty == typeWithoutProperty &&
                             currentCache->propertyRecord->Equals(JsUtil::CharacterBuffer<WCHAR>(currentStr, currentStrLength)))
                         {
+                            if(!previousCache)
+                            {
+                                firstCache = currentCache;
+                                DynamicType* objectType = currentCache->objectType;
+                                if(objectType && objectType->GetTypeHandler()->GetInlineSlotCapacity() == typeWithoutProperty->GetTypeHandler()->GetInlineSlotCapacity())
+                                {
+                                    object->EnsureSlots(typeWithoutProperty->GetTypeHandler()->GetSlotCapacity(),
+                                        objectType->GetTypeHandler()->GetSlotCapacity(), scriptContext, objectType->GetTypeHandler());
+                                    object->ReplaceType(objectType);
+                                    expectedType = objectType;
+                                }
+                            }
+
                             //check and consume ":"
                             if(Scan() != tkColon )
                             {
@@ -343,10 +392,20 @@ namespace JSON
                             previousCache = currentCache;
                             currentCache = currentCache->next;
 
-                            // fast path for type transition and property set
-                            object->EnsureSlots(typeWithoutProperty->GetTypeHandler()->GetSlotCapacity(),
-                                typeWithProperty->GetTypeHandler()->GetSlotCapacity(), scriptContext, typeWithProperty->GetTypeHandler());
-                            object->ReplaceType(typeWithProperty);
+                            if(expectedType && expectedType->GetTypeHandler()->GetPropertyId(scriptContext, propertyIndex) != propertyId)
+                            {
+                                Assert(typeWithoutProperty->GetTypeHandler()->GetInlineSlotCapacity() == expectedType->GetTypeHandler()->GetInlineSlotCapacity());
+                                object->ReplaceType(typeWithoutProperty);
+                                expectedType = nullptr;
+                            }
+                            if(!expectedType)
+                            {
+                                // fast path for type transition and property set
+                                object->EnsureSlots(typeWithoutProperty->GetTypeHandler()->GetSlotCapacity(),
+                                    typeWithProperty->GetTypeHandler()->GetSlotCapacity(), scriptContext, typeWithProperty->GetTypeHandler());
+                                object->ReplaceType(typeWithProperty);
+                            }
+                            currentType = typeWithProperty;
                             Js::Var value = ParseObject();
                             object->SetSlot(SetSlotArguments(propertyId, propertyIndex, value));
 
@@ -359,6 +418,13 @@ namespace JSON
                     }
 
                     // slow path
+                    if(expectedType)
+                    {
+                        Assert(typeWithoutProperty->GetTypeHandler()->GetInlineSlotCapacity() == expectedType->GetTypeHandler()->GetInlineSlotCapacity());
+                        object->ReplaceType(typeWithoutProperty);
+                        expectedType = nullptr;
+                    }
+
                     Js::PropertyRecord const * propertyRecord;
                     scriptContext->GetOrAddPropertyRecord(currentStr, currentStrLength, &propertyRecord);
 
@@ -373,6 +439,7 @@ namespace JSON
                     object->SetProperty(propertyRecord->GetPropertyId(), value, PropertyOperation_None, &info);
 
                     DynamicType* typeWithProperty = object->GetDynamicType();
+                    currentType = typeWithProperty;
                     if(IsCaching() && !propertyRecord->IsNumeric() && !info.IsNoCache() && typeWithProperty->GetIsShared() && typeWithProperty->GetTypeHandler()->IsPathTypeHandler())
                     {
                         PropertyIndex propertyIndex = info.GetPropertyIndex();
@@ -393,6 +460,10 @@ namespace JSON
                             // cache miss!!
                             currentCache->Update(propertyRecord, typeWithoutProperty, typeWithProperty, propertyIndex);
                         }
+                        if(!previousCache)
+                        {
+                            firstCache = currentCache;
+                        }
                         previousCache = currentCache;
                         currentCache = currentCache->next;
                     }
@@ -403,6 +474,20 @@ namespace JSON
                     Scan();
                 }
 
+                if(expectedType && expectedType != currentType)
+                {
+                    // The object had fewer members than the type it was given up front
+                    Assert(currentType->GetTypeHandler()->GetInlineSlotCapacity() == expectedType->GetTypeHandler()->GetInlineSlotCapacity());
+                    object->ReplaceType(currentType);
+                }
+                Assert(object->GetDynamicType() == currentType);
+
+                if(firstCache)
+                {
+                    firstCache->objectType =
+                        currentType->GetIsShared() && currentType->GetTypeHandler()->IsPathTypeHandler() ? currentType : nullptr;
+                }
+
                 // check  and consume the ending '}"
                 CheckCurrentToken(tkRCurly, ERRnoRcurly);
                 return object;
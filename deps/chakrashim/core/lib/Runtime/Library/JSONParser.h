@@ -15,6 +15,8 @@ namespace JSON
         Js::DynamicType* typeWithoutProperty;
         Js::DynamicType* typeWithProperty;
         JsonTypeCache* next;
+        // Only set on the first entry of a chain: the type the last object that started with this property ended up with
+        Js::DynamicType* objectType;
         Js::PropertyIndex propertyIndex;
 
         JsonTypeCache(const Js::PropertyRecord* propertyRecord, Js::DynamicType* typeWithoutProperty, Js::DynamicType* typeWithProperty, Js::PropertyIndex propertyIndex) :
@@ -22,7 +24,8 @@ namespace JSON
             typeWithoutProperty(typeWithoutProperty),
             typeWithProperty(typeWithProperty),
             propertyIndex(propertyIndex),
-            next(nullptr) {}
+            next(nullptr),
+            objectType(nullptr) {}
 
         static JsonTypeCache* JsonTypeCache::New(ArenaAllocator* allocator,
             const Js::PropertyRecord* propertyRecord,
@@ -42,6 +45,7 @@ namespace JSON
             this->typeWithoutProperty = typeWithoutProperty;
             this->typeWithProperty = typeWithProperty;
             this->propertyIndex = propertyIndex;
+            this->objectType = nullptr;
         }
     };
 
@@ -50,7 +54,7 @@ namespace JSON
     {
     public:
         JSONParser(Js::ScriptContext* sc, Js::RecyclableObject* rv) : scriptContext(sc),
-            reviver(rv),  arenaAllocatorObject(nullptr), arenaAllocator(nullptr), typeCacheList(nullptr)
+            reviver(rv),  arenaAllocatorObject(nullptr), arenaAllocator(nullptr), typeCacheList(nullptr), inputString(nullptr)
         {
         };
 
@@ -66,6 +70,7 @@ namespace JSON
         }
 
         Js::Var ParseObject();
+        Js::JavascriptString* NewStringValue();
 
         void CheckCurrentToken(int tk, int wErr)
         {
@@ -87,6 +92,9 @@ namespace JSON
         ArenaAllocator* arenaAllocator;
         typedef JsUtil::BaseDictionary<const Js::PropertyRecord *, JsonTypeCache*, ArenaAllocator, PowerOf2SizePolicy, Js::PropertyRecordStringHashComparer>  JsonTypeCacheList;
         JsonTypeCacheList* typeCacheList;
+        Js::JavascriptString* inputString;
         static const int MIN_CACHE_LENGTH = 50; // Use Json type cache only if the JSON string is larger than this constant.
+        static const uint MIN_SUBSTRING_LENGTH = 32; // Escape-free string values at least this long can be sliced out of the input instead of copied,
+        static const uint MAX_SUBSTRING_INPUT_RATIO = 4; // as long as the input is at most this many times longer than the value.
     };
 } // namespace JSON
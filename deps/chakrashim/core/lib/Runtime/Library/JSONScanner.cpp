@@ -9,6 +9,89 @@ using namespace Js;
 
 namespace JSON
 {
+    // Returns the first character in [current, end) that needs a closer look inside a string: the closing quote, the
+    // start of an escape sequence, or a control character (which includes the terminating null). Returns end if there
+    // is none.
+    static const wchar_t* SkipPlainStringChars(const wchar_t* current, const wchar_t* const end)
+    {
+#if defined(_M_IX86) || defined(_M_X64)
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            const __m128i quotes = _mm_set1_epi16(L'"');
+            const __m128i backslashes = _mm_set1_epi16(L'\\');
+            // SSE2 only compares signed words, so flip the sign bit to get an unsigned ch < 0x20
+            const __m128i signBit = _mm_set1_epi16((short)0x8000);
+            const __m128i controlLimit = _mm_set1_epi16((short)(0x8000 | 0x20));
+            const size_t charsPerChunk = sizeof(__m128i) / sizeof(wchar_t);
+
+            for (; (size_t)(end - current) >= charsPerChunk; current += charsPerChunk)
+            {
+                const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(current));
+                const __m128i special =
+                    _mm_or_si128(
+                        _mm_or_si128(_mm_cmpeq_epi16(chars, quotes), _mm_cmpeq_epi16(chars, backslashes)),
+                        _mm_cmplt_epi16(_mm_xor_si128(chars, signBit), controlLimit));
+                const int mask = _mm_movemask_epi8(special);
+                if (mask != 0)
+                {
+                    DWORD byteIndex;
+                    _BitScanForward(&byteIndex, mask);
+                    return current + byteIndex / sizeof(wchar_t);
+                }
+            }
+        }
+#endif
+        for (; current < end; ++current)
+        {
+            const wchar_t ch = *current;
+            if (ch == L'"' || ch == L'\\' || ch <= 0x1F)
+            {
+                break;
+            }
+        }
+        return current;
+    }
+
+    // Returns the first character in [current, end) that is not JSON whitespace, or end if there is none
+    static const wchar_t* SkipWhiteSpace(const wchar_t* current, const wchar_t* const end)
+    {
+#if defined(_M_IX86) || defined(_M_X64)
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            const __m128i spaces = _mm_set1_epi16(L' ');
+            const __m128i tabs = _mm_set1_epi16(L'\t');
+            const __m128i carriageReturns = _mm_set1_epi16(L'\r');
+            const __m128i lineFeeds = _mm_set1_epi16(L'\n');
+            const size_t charsPerChunk = sizeof(__m128i) / sizeof(wchar_t);
+
+            for (; (size_t)(end - current) >= charsPerChunk; current += charsPerChunk)
+            {
+                const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(current));
+                const __m128i whiteSpace =
+                    _mm_or_si128(
+                        _mm_or_si128(_mm_cmpeq_epi16(chars, spaces), _mm_cmpeq_epi16(chars, tabs)),
+                        _mm_or_si128(_mm_cmpeq_epi16(chars, carriageReturns), _mm_cmpeq_epi16(chars, lineFeeds)));
+                const int mask = _mm_movemask_epi8(whiteSpace) ^ 0xFFFF;
+                if (mask != 0)
+                {
+                    DWORD byteIndex;
+                    _BitScanForward(&byteIndex, mask);
+                    return current + byteIndex / sizeof(wchar_t);
+                }
+            }
+        }
+#endif
+        for (; current < end; ++current)
+        {
+            const wchar_t ch = *current;
+            if (ch != L' ' && ch != L'\t' && ch != L'\r' && ch != L'\n')
+            {
+                break;
+            }
+        }
+        return current;
+    }
+
     // -------- Scanner implementation ------------//
     JSONScanner::JSONScanner()
         : inputText(0), inputLen(0), pToken(0), stringBuffer(0), allocator(0), allocatorObject(0),
@@ -56,7 +139,8 @@ namespace JSON
             case '\r':
             case '\n':
             case ' ':
-                //WS - keep looping
+                //WS - keep looping; indented JSON has long runs of it, so skip the rest of the run in bulk
+                currentChar = SkipWhiteSpace(currentChar, inputText + inputLen);
                 break;
 
             case '"':
@@ -233,6 +317,16 @@ namespace JSON
 
         while (currentChar < inputText + inputLen)
         {
+            // Most characters in a string need no attention beyond being counted, so take them in bulk and only look
+            // at the ones that end the string, start an escape or are illegal one by one
+            const wchar_t* plainEnd = SkipPlainStringChars(currentChar, inputText + inputLen);
+            bulkLength += (uint)(plainEnd - currentChar);
+            currentChar = plainEnd;
+            if (currentChar >= inputText + inputLen)
+            {
+                break;
+            }
+
             ch = ReadNextChar();
             int tempHex;
 
@@ -359,7 +453,7 @@ namespace JSON
             }
             else
             {
-                // continue
+                AssertMsg(false, "SkipPlainStringChars should only stop at a quote, a backslash or a control character");
                 bulkLength++;
             }
         }
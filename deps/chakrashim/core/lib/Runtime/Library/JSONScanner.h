@@ -23,6 +23,8 @@ namespace JSON
         void Finalizer();
         wchar_t* GetCurrentString(){return currentString;}
         uint GetCurrentStringLen(){return currentIndex;}
+        // True if the current string had no escapes and so points straight into the input text
+        bool IsCurrentStringInInputText(){return currentString >= inputText && currentString < inputText + inputLen;}
 
 
     private:
@@ -5994,6 +5994,8 @@ Case0:
     {
         ScriptContext* scriptContext;
         RecyclableObject* compFn;
+
+        int Compare(const Var& a, const Var& b);
     };
 
     int __cdecl compareVars(void* cvInfoV, const void* aRef, const void* bRef)
@@ -6051,41 +6053,18 @@ Case0:
         }
     }
 
-    static void hybridSort(__inout_ecount(length) Var *elements, uint32 length, CompareVarsInfo* compareInfo)
+    inline int CompareVarsInfo::Compare(const Var& a, const Var& b)
     {
-        // The cost of memory moves starts to be more expensive than additional comparer calls (given a simple comparer)
-        // for arrays of more than 512 elements.
-        if (length > 512)
-        {
-            qsort_s(elements, length, sizeof(Var), compareVars, compareInfo);
-            return;
-        }
-
-        for (int i = 1; i < (int)length; i++)
-        {
-            if (compareVars(compareInfo, elements + i, elements + i - 1) < 0) {
-                // binary search for the left-most element greater than value:
-                int first = 0;
-                int last = i - 1;
-                while (first <= last)
-                {
-                    int middle = (first + last) / 2;
-                    if (compareVars(compareInfo, elements + i, elements + middle) < 0)
-                    {
-                        last = middle - 1;
-                    }
-                    else
-                    {
-                        first = middle + 1;
-                    }
-                }
+        return compareVars(this, &a, &b);
+    }
 
-                // insert value right before first:
-                Var value = elements[i];
-                memmove(elements + first + 1, elements + first, (i - first) * sizeof(Var));
-                elements[first] = value;
-            }
-        }
+    static void stableSort(__inout_ecount(length) Var *elements, uint32 length, CompareVarsInfo* compareInfo)
+    {
+        // Elements taken out of the array during a merge may be referenced from nowhere else while the comparer runs, so the
+        // scratch buffer is allocated on the recycler to keep them alive.
+        const uint32 scratchLength = JsUtil::MergeSort<Var, CompareVarsInfo>::GetScratchLength(length);
+        Var* scratch = scratchLength == 0 ? nullptr : RecyclerNewArrayZ(compareInfo->scriptContext->GetRecycler(), Var, scratchLength);
+        JsUtil::MergeSort<Var, CompareVarsInfo>::Sort(elements, length, scratch, *compareInfo);
     }
 
     void JavascriptArray::Sort(RecyclableObject* compFn)
@@ -6131,7 +6110,7 @@ Case0:
 #ifdef VALIDATE_ARRAY
                     ValidateSegment(startSeg);
 #endif
-                    hybridSort(startSeg->elements, startSeg->length, &cvInfo);
+                    stableSort(startSeg->elements, startSeg->length, &cvInfo);
                 }
                 else
                 {
@@ -6163,7 +6142,7 @@ Case0:
 
                 if (compFn != nullptr)
                 {
-                    hybridSort(allElements->elements, allElements->length, &cvInfo);
+                    stableSort(allElements->elements, allElements->length, &cvInfo);
                 }
                 else
                 {
@@ -6273,20 +6252,91 @@ Case0:
         return countUndefined;
     }
 
-    int __cdecl JavascriptArray::CompareElements(void* context, const void* elem1, const void* elem2)
+    int JavascriptArray::ElementComparer::Compare(const Element& element1, const Element& element2)
+    {
+        return JavascriptString::strcmp(element1.StringValue, element2.StringValue);
+    }
+
+    void JavascriptArray::SortElements(Element* elements, uint32 left, uint32 right)
     {
-        const Element* element1 = static_cast<const Element*>(elem1);
-        const Element* element2 = static_cast<const Element*>(elem2);
+        const uint32 count = right - left + 1;
+        const uint32 scratchLength = JsUtil::MergeSort<Element, ElementComparer>::GetScratchLength(count);
+        Element* scratch = scratchLength == 0 ? nullptr : RecyclerNewArrayZ(GetScriptContext()->GetRecycler(), Element, scratchLength);
+        ElementComparer comparer;
+        JsUtil::MergeSort<Element, ElementComparer>::Sort(elements + left, count, scratch, comparer);
+    }
 
-        Assert(element1 != NULL);
-        Assert(element2 != NULL);
+    int JavascriptArray::CompareInt32AsStrings(const int32 value1, const int32 value2)
+    {
+        static const uint64 powersOf10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+
+        if (value1 == value2)
+        {
+            return 0;
+        }
+
+        // '-' sorts before the digits
+        if ((value1 < 0) != (value2 < 0))
+        {
+            return value1 < 0 ? -1 : 1;
+        }
 
-        return JavascriptString::strcmp(element1->StringValue, element2->StringValue);
+        // Compare the digits of the magnitudes, lined up on the left by scaling the shorter one
+        uint64 digits1 = value1 < 0 ? (uint64)(-(int64)value1) : (uint64)value1;
+        uint64 digits2 = value2 < 0 ? (uint64)(-(int64)value2) : (uint64)value2;
+        uint32 digitCount1 = 1;
+        while (digitCount1 < _countof(powersOf10) && digits1 >= powersOf10[digitCount1])
+        {
+            digitCount1++;
+        }
+        uint32 digitCount2 = 1;
+        while (digitCount2 < _countof(powersOf10) && digits2 >= powersOf10[digitCount2])
+        {
+            digitCount2++;
+        }
+
+        if (digitCount1 < digitCount2)
+        {
+            digits1 *= powersOf10[digitCount2 - digitCount1];
+        }
+        else
+        {
+            digits2 *= powersOf10[digitCount1 - digitCount2];
+        }
+
+        if (digits1 != digits2)
+        {
+            return digits1 < digits2 ? -1 : 1;
+        }
+
+        // One is a prefix of the other
+        return digitCount1 < digitCount2 ? -1 : 1;
     }
 
-    void JavascriptArray::SortElements(Element* elements, uint32 left, uint32 right)
+    bool JavascriptArray::TrySortNativeIntArrayAsStrings(JavascriptNativeIntArray* intArray)
     {
-        qsort_s(elements, right - left + 1, sizeof(Element), CompareElements, this);
+        SparseArraySegment<int32>* head = (SparseArraySegment<int32>*)intArray->head;
+        if (head->next != nullptr || head->left != 0 || !intArray->HasNoMissingValues())
+        {
+            return false;
+        }
+
+        // Values are equal as strings only if they are equal, so the elements can be sorted where they are without
+        // creating the strings.
+        ScriptContext* scriptContext = intArray->GetScriptContext();
+        const uint32 scratchLength = JsUtil::MergeSort<int32, Int32AsStringComparer>::GetScratchLength(head->length);
+        BEGIN_TEMP_ALLOCATOR(tempAlloc, scriptContext, L"Runtime")
+        {
+            int32* scratch = scratchLength == 0 ? nullptr : AnewArray(tempAlloc, int32, scratchLength);
+            Int32AsStringComparer comparer;
+            JsUtil::MergeSort<int32, Int32AsStringComparer>::Sort(head->elements, head->length, scratch, comparer);
+        }
+        END_TEMP_ALLOCATOR(tempAlloc, scriptContext);
+
+#ifdef VALIDATE_ARRAY
+        intArray->ValidateArray();
+#endif
+        return true;
     }
 
     Var JavascriptArray::EntrySort(RecyclableObject* function, CallInfo callInfo, ...)
@@ -6340,6 +6390,12 @@ Case0:
                 arr->FillFromPrototypes(0, arr->length); // We need find all missing value from [[proto]] object
             }
 
+            // The default order of int32 values needs no conversions to strings or to a var array
+            if (compFn == nullptr && JavascriptNativeIntArray::Is(arr) && TrySortNativeIntArrayAsStrings(JavascriptNativeIntArray::FromVar(arr)))
+            {
+                return args[0];
+            }
+
             // Maintain nativity of the array only for the following cases (To favor inplace conversions - keeps the conversion cost less):
             // -    int cases for X86 and
             // -    FloatArray for AMD64
@@ -551,8 +551,19 @@ namespace Js
             JavascriptString* StringValue;
         };
 
-        static int __cdecl CompareElements(void* context, const void* elem1, const void* elem2);
+        struct ElementComparer
+        {
+            static int Compare(const Element& element1, const Element& element2);
+        };
+
+        struct Int32AsStringComparer
+        {
+            static int Compare(const int32& value1, const int32& value2) { return CompareInt32AsStrings(value1, value2); }
+        };
+
         void SortElements(Element* elements, uint32 left, uint32 right);
+        static int CompareInt32AsStrings(const int32 value1, const int32 value2);
+        static bool TrySortNativeIntArrayAsStrings(JavascriptNativeIntArray* intArray);
 
         template <typename Fn>
         static void ForEachOwnArrayIndexOfObject(RecyclableObject* obj, uint32 startIndex, uint32 limitIndex, Fn fn);
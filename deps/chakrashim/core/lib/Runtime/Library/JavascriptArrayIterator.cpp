@@ -133,4 +133,53 @@ namespace Js
 
         return library->CreateIteratorResultObjectValueFalse(keyValueTuple);
     }
+
+    Var JavascriptArrayIterator::NextResultUsedAndMayBeTemp(void *const stackAllocationPointer, ScriptContext* scriptContext, JavascriptArrayIterator* iterator)
+    {
+        Assert(stackAllocationPointer);
+        Assert(JavascriptArrayIterator::Is(iterator));
+
+        JavascriptLibrary* library = scriptContext->GetLibrary();
+        Var iterable = iterator->m_iterableObject;
+
+        if (iterable == nullptr)
+        {
+            return library->CreateIteratorResultObjectUndefinedTrue(stackAllocationPointer);
+        }
+
+        // Only arrays can be read without invoking user code. Everything else, and [key, value] pairs that need a heap
+        // allocated tuple anyway, takes the regular path.
+        if (!JavascriptArray::Is(iterable) ||
+            JavascriptArray::FromVar(iterable)->IsCrossSiteObject() ||
+            iterator->m_kind == JavascriptArrayIteratorKind::KeyAndValue)
+        {
+            return nullptr;
+        }
+
+#if ENABLE_COPYONACCESS_ARRAY
+        JavascriptLibrary::CheckAndConvertCopyOnAccessNativeIntArray<Var>(iterable);
+#endif
+        JavascriptArray* pArr = JavascriptArray::FromVar(iterable);
+        int64 index = iterator->m_nextIndex;
+
+        if (index >= pArr->GetLength())
+        {
+            iterator->m_iterableObject = nullptr;
+            return library->CreateIteratorResultObjectUndefinedTrue(stackAllocationPointer);
+        }
+
+        Var value;
+        if (iterator->m_kind == JavascriptArrayIteratorKind::Key)
+        {
+            value = JavascriptNumber::ToVar(index, scriptContext);
+        }
+        else if (!pArr->DirectGetVarItemAt((uint32)index, &value, scriptContext))
+        {
+            // A missing value is looked up on the prototype chain, which may run a getter
+            return nullptr;
+        }
+
+        iterator->m_nextIndex += 1;
+        return library->CreateIteratorResultObjectValueFalse(value, stackAllocationPointer);
+    }
 } //namespace Js
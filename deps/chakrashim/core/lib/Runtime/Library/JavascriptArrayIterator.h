@@ -38,6 +38,10 @@ namespace Js
 
         static Var EntryNext(RecyclableObject* function, CallInfo callInfo, ...);
 
+        // JIT helper for an inlined next() whose result does not escape. Returns nullptr, without advancing the iterator,
+        // whenever producing the next value could have side effects; the caller then falls back to EntryNext.
+        static Var NextResultUsedAndMayBeTemp(void *const stackAllocationPointer, ScriptContext* scriptContext, JavascriptArrayIterator* iterator);
+
     public:
         Var GetIteratorObjectForHeapEnum() { return m_iterableObject; }
     };
@@ -268,6 +268,9 @@ namespace Js
 
         externalFunction->PrepareExternalCall(&args);
 
+        // Calls into the host are a safepoint for samples; long-running host work is attributed to the calling script.
+        scriptContext->GetThreadContext()->CheckSampleRequest();
+
         Var result = nullptr;
         BEGIN_LEAVE_SCRIPT_WITH_EXCEPTION(scriptContext)
         {
@@ -307,6 +310,8 @@ namespace Js
         AnalysisAssert(scriptContext);
         Var result = NULL;
 
+        scriptContext->GetThreadContext()->CheckSampleRequest();
+
         BEGIN_LEAVE_SCRIPT(scriptContext)
         {
             result = externalFunction->stdCallNativeMethod(function, ((callInfo.Flags & CallFlags_New) != 0), args.Values, args.Info.Count, externalFunction->callbackState);
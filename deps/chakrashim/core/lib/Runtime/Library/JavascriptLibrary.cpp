@@ -3986,8 +3986,9 @@ namespace Js
 
         JavascriptLibrary* library = arrayIteratorPrototype->GetLibrary();
         ScriptContext* scriptContext = library->GetScriptContext();
+        JavascriptFunction ** builtinFuncs = library->GetBuiltinFunctions();
 
-        library->AddFunctionToLibraryObject(arrayIteratorPrototype, PropertyIds::next, &JavascriptArrayIterator::EntryInfo::Next, 0);
+        builtinFuncs[BuiltinFunction::ArrayIterator_Next] = library->AddFunctionToLibraryObject(arrayIteratorPrototype, PropertyIds::next, &JavascriptArrayIterator::EntryInfo::Next, 0);
 
         if (scriptContext->GetConfig()->IsES6ToStringTagEnabled())
         {
@@ -5713,9 +5714,23 @@ namespace Js
         return RecyclerNew(this->GetRecycler(), JavascriptStringIterator, stringIteratorType, string);
     }
 
-    DynamicObject* JavascriptLibrary::CreateIteratorResultObject(Var value, Var done)
+    const size_t JavascriptLibrary::IteratorResultObjectStackAllocationSize = sizeof(DynamicObject) + 2 * sizeof(Var);
+
+    DynamicObject* JavascriptLibrary::CreateIteratorResultObject(Var value, Var done, void *const stackAllocationPointer)
     {
-        DynamicObject* iteratorResult = DynamicObject::New(this->GetRecycler(), iteratorResultType);
+        DynamicObject* iteratorResult;
+        if (stackAllocationPointer)
+        {
+            // Both properties live in inline slots, so the object fits in the space the JIT reserved for it. If it turns out
+            // to escape after all (e.g. on bailout), JavascriptOperators::BoxStackInstance copies it to the heap.
+            Assert(iteratorResultType->GetTypeHandler()->GetOffsetOfInlineSlots() + iteratorResultType->GetTypeHandler()->GetInlineSlotsSize()
+                <= IteratorResultObjectStackAllocationSize);
+            iteratorResult = new(stackAllocationPointer) DynamicObject(iteratorResultType);
+        }
+        else
+        {
+            iteratorResult = DynamicObject::New(this->GetRecycler(), iteratorResultType);
+        }
 
         iteratorResult->SetSlot(SetSlotArguments(Js::PropertyIds::value, 0, value));
         iteratorResult->SetSlot(SetSlotArguments(Js::PropertyIds::done, 1, done));
@@ -5723,14 +5738,14 @@ namespace Js
         return iteratorResult;
     }
 
-    DynamicObject* JavascriptLibrary::CreateIteratorResultObjectValueFalse(Var value)
+    DynamicObject* JavascriptLibrary::CreateIteratorResultObjectValueFalse(Var value, void *const stackAllocationPointer)
     {
-        return CreateIteratorResultObject(value, GetFalse());
+        return CreateIteratorResultObject(value, GetFalse(), stackAllocationPointer);
     }
 
-    DynamicObject* JavascriptLibrary::CreateIteratorResultObjectUndefinedTrue()
+    DynamicObject* JavascriptLibrary::CreateIteratorResultObjectUndefinedTrue(void *const stackAllocationPointer)
     {
-        return CreateIteratorResultObject(GetUndefined(), GetTrue());
+        return CreateIteratorResultObject(GetUndefined(), GetTrue(), stackAllocationPointer);
     }
 
     RecyclableObject* JavascriptLibrary::CreateThrowErrorObject(JavascriptError* error)
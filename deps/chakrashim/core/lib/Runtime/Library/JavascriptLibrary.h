@@ -832,9 +832,12 @@ namespace Js
         JavascriptStringIterator* CreateStringIterator(JavascriptString* string);
         JavascriptRegExp* CreateRegExp(UnifiedRegex::RegexPattern* pattern);
 
-        DynamicObject* CreateIteratorResultObject(Var value, Var done);
-        DynamicObject* CreateIteratorResultObjectValueFalse(Var value);
-        DynamicObject* CreateIteratorResultObjectUndefinedTrue();
+        // Stack space the JIT reserves for an iterator result object that does not escape ({value, done} in inline slots)
+        static const size_t IteratorResultObjectStackAllocationSize;
+
+        DynamicObject* CreateIteratorResultObject(Var value, Var done, void *const stackAllocationPointer = nullptr);
+        DynamicObject* CreateIteratorResultObjectValueFalse(Var value, void *const stackAllocationPointer = nullptr);
+        DynamicObject* CreateIteratorResultObjectUndefinedTrue(void *const stackAllocationPointer = nullptr);
 
         RecyclableObject* CreateThrowErrorObject(JavascriptError* error);
 
@@ -31,9 +31,9 @@ namespace Js
         return static_cast<JavascriptMap *>(RecyclableObject::FromVar(aValue));
     }
 
-    JavascriptMap::MapDataList::Iterator JavascriptMap::GetIterator()
+    JavascriptMap::MapDataMap::Iterator JavascriptMap::GetIterator()
     {
-        return list.GetIterator();
+        return MapDataMap::Iterator(map);
     }
 
     Var JavascriptMap::NewInstance(RecyclableObject* function, CallInfo callInfo, ...)
@@ -341,27 +341,20 @@ namespace Js
 
     void JavascriptMap::Clear()
     {
-        list.Clear();
         map->Clear();
     }
 
     bool JavascriptMap::Delete(Var key)
     {
-        if (map->ContainsKey(key))
-        {
-            MapDataNode* node = map->Item(key);
-            list.Remove(node);
-            return map->Remove(key);
-        }
-        return false;
+        return map->Remove(key);
     }
 
     bool JavascriptMap::Get(Var key, Var* value)
     {
-        if (map->ContainsKey(key))
+        MapDataKeyValuePair* data = map->Find(key);
+        if (data != nullptr)
         {
-            MapDataNode* node = map->Item(key);
-            *value = node->data.Value();
+            *value = data->Value();
             return true;
         }
         return false;
@@ -369,21 +362,16 @@ namespace Js
 
     bool JavascriptMap::Has(Var key)
     {
-        return map->ContainsKey(key);
+        return map->Find(key) != nullptr;
     }
 
     void JavascriptMap::Set(Var key, Var value)
     {
-        if (map->ContainsKey(key))
-        {
-            MapDataNode* node = map->Item(key);
-            node->data = MapDataKeyValuePair(key, value);
-        }
-        else
+        MapDataKeyValuePair* existing = map->Add(MapDataKeyValuePair(key, value));
+        if (existing != nullptr)
         {
-            MapDataKeyValuePair pair(key, value);
-            MapDataNode* node = list.Append(pair, GetScriptContext()->GetRecycler());
-            map->Add(key, node);
+            // The entry keeps its key
+            *existing = MapDataKeyValuePair(existing->Key(), value);
         }
     }
 
@@ -840,7 +840,7 @@ namespace Js
             return string;
         }
 
-        string = scriptContext->GetLastNumberToStringRadix10(value);
+        string = scriptContext->GetCachedNumberToStringRadix10(value);
         if (string == nullptr)
         {
             wchar_t szBuffer[bufSize];
@@ -850,7 +850,7 @@ namespace Js
                 Js::JavascriptError::ThrowOutOfMemoryError(scriptContext);
             }
             string = JavascriptString::NewCopySz(szBuffer, scriptContext);
-            scriptContext->SetLastNumberToStringRadix10(value, string);
+            scriptContext->CacheNumberToStringRadix10(value, string);
         }
         return string;
     }
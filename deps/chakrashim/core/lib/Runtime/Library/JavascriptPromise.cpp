@@ -13,6 +13,8 @@ namespace Js
 
         this->status = PromiseStatusCode_Undefined;
         this->result = nullptr;
+        this->firstResolveReaction = nullptr;
+        this->firstRejectReaction = nullptr;
         this->resolveReactions = nullptr;
         this->rejectReactions = nullptr;
     }
@@ -97,14 +99,10 @@ namespace Js
         Assert(resolve);
         Assert(reject);
 
-        Recycler* recycler = scriptContext->GetRecycler();
         JavascriptLibrary* library = scriptContext->GetLibrary();
 
         promise->status = PromiseStatusCode_Unresolved;
 
-        promise->resolveReactions = RecyclerNew(recycler, JavascriptPromiseReactionList, recycler);
-        promise->rejectReactions = RecyclerNew(recycler, JavascriptPromiseReactionList, recycler);
-
         JavascriptPromiseResolveOrRejectFunctionAlreadyResolvedWrapper* alreadyResolvedRecord = RecyclerNewStructZ(scriptContext->GetRecycler(), JavascriptPromiseResolveOrRejectFunctionAlreadyResolvedWrapper);
         alreadyResolvedRecord->alreadyResolved = false;
 
@@ -137,14 +135,31 @@ namespace Js
         return TRUE;
     }
 
-    JavascriptPromiseReactionList* JavascriptPromise::GetResolveReactions()
+    void JavascriptPromise::AddReactions(JavascriptPromiseReaction* resolveReaction, JavascriptPromiseReaction* rejectReaction, ScriptContext* scriptContext)
     {
-        return this->resolveReactions;
-    }
+        Assert(this->status == PromiseStatusCode_Unresolved);
+        Assert(resolveReaction && rejectReaction);
 
-    JavascriptPromiseReactionList* JavascriptPromise::GetRejectReactions()
-    {
-        return this->rejectReactions;
+        if (this->firstResolveReaction == nullptr)
+        {
+            Assert(this->firstRejectReaction == nullptr);
+            Assert(this->resolveReactions == nullptr && this->rejectReactions == nullptr);
+
+            this->firstResolveReaction = resolveReaction;
+            this->firstRejectReaction = rejectReaction;
+            return;
+        }
+
+        if (this->resolveReactions == nullptr)
+        {
+            Recycler* recycler = scriptContext->GetRecycler();
+
+            this->resolveReactions = RecyclerNew(recycler, JavascriptPromiseReactionList, recycler);
+            this->rejectReactions = RecyclerNew(recycler, JavascriptPromiseReactionList, recycler);
+        }
+
+        this->resolveReactions->Add(resolveReaction);
+        this->rejectReactions->Add(rejectReaction);
     }
 
     // Promise.all as described in ES 2015 Section 25.4.4.1
@@ -555,8 +570,20 @@ namespace Js
         promise = JavascriptPromise::FromVar(args[0]);
 
         JavascriptLibrary* library = scriptContext->GetLibrary();
-        Var constructor = JavascriptOperators::SpeciesConstructor(promise, scriptContext->GetLibrary()->GetPromiseConstructor(), scriptContext);
-        JavascriptPromiseCapability* promiseCapability = NewPromiseCapability(constructor, scriptContext);
+        Var constructor = JavascriptOperators::SpeciesConstructor(promise, library->GetPromiseConstructor(), scriptContext);
+        JavascriptPromiseCapability* promiseCapability;
+
+        if (constructor == library->GetPromiseConstructor())
+        {
+            // The derived promise is only ever settled by one of the reactions below, so it does not need resolving functions of
+            // its own, and constructing the built-in Promise has no side effects that would need to be observed.
+            promiseCapability = NewNativePromiseCapability(scriptContext);
+        }
+        else
+        {
+            promiseCapability = NewPromiseCapability(constructor, scriptContext);
+        }
+
         RecyclableObject* rejectionHandler;
         RecyclableObject* fulfillmentHandler;
 
@@ -584,8 +611,7 @@ namespace Js
         switch (promise->status)
         {
         case PromiseStatusCode_Unresolved:
-            promise->resolveReactions->Add(resolveReaction);
-            promise->rejectReactions->Add(rejectReaction);
+            promise->AddReactions(resolveReaction, rejectReaction, scriptContext);
             break;
         case PromiseStatusCode_HasResolution:
             EnqueuePromiseReactionTask(resolveReaction, promise->result, scriptContext);
@@ -631,9 +657,15 @@ namespace Js
 
         resolveOrRejectFunction->SetAlreadyResolved(true);
 
-        bool rejecting = resolveOrRejectFunction->IsRejectFunction();
+        return ResolveOrRejectPromise(resolveOrRejectFunction->GetPromise(), resolution, resolveOrRejectFunction->IsRejectFunction(), scriptContext);
+    }
 
-        JavascriptPromise* promise = resolveOrRejectFunction->GetPromise();
+    // Settles a promise that has been marked as already resolved, either by one of its resolving functions or by the reaction
+    // task of a native capability.
+    Var JavascriptPromise::ResolveOrRejectPromise(JavascriptPromise* promise, Var resolution, bool rejecting, ScriptContext* scriptContext)
+    {
+        JavascriptLibrary* library = scriptContext->GetLibrary();
+        Var undefinedVar = library->GetUndefined();
 
         // We only need to check SameValue and check for thenable resolution in the Resolve function case (not Reject)
         if (!rejecting)
@@ -670,27 +702,32 @@ namespace Js
             }
         }
 
+        JavascriptPromiseReaction* reaction;
         JavascriptPromiseReactionList* reactions;
         PromiseStatus newStatus;
 
         // Need to check rejecting state again as it might have changed due to failures
         if (rejecting)
         {
-            reactions = promise->GetRejectReactions();
+            reaction = promise->firstRejectReaction;
+            reactions = promise->rejectReactions;
             newStatus = PromiseStatusCode_HasRejection;
         }
         else
         {
-            reactions = promise->GetResolveReactions();
+            reaction = promise->firstResolveReaction;
+            reactions = promise->resolveReactions;
             newStatus = PromiseStatusCode_HasResolution;
         }
 
         promise->result = resolution;
+        promise->firstResolveReaction = nullptr;
+        promise->firstRejectReaction = nullptr;
         promise->resolveReactions = nullptr;
         promise->rejectReactions = nullptr;
         promise->status = newStatus;
 
-        return TriggerPromiseReactions(reactions, resolution, scriptContext);
+        return TriggerPromiseReactions(reaction, reactions, resolution, scriptContext);
     }
 
     // Promise Capabilities Executor Function as described in ES 2015 Section 25.4.1.6.2
@@ -754,6 +791,11 @@ namespace Js
         }
         catch (JavascriptExceptionObject* e)
         {
+            if (promiseCapability->IsNative())
+            {
+                return ResolveOrRejectNativeCapability(promiseCapability, e->GetThrownObject(scriptContext), true);
+            }
+
             RecyclableObject* reject = promiseCapability->GetReject();
 
             Assert(reject);
@@ -763,6 +805,11 @@ namespace Js
                 e->GetThrownObject(scriptContext));
         }
 
+        if (promiseCapability->IsNative())
+        {
+            return ResolveOrRejectNativeCapability(promiseCapability, handlerResult, false);
+        }
+
         RecyclableObject* resolve = promiseCapability->GetResolve();
 
         Assert(resolve);
@@ -772,6 +819,18 @@ namespace Js
             handlerResult);
     }
 
+    Var JavascriptPromise::ResolveOrRejectNativeCapability(JavascriptPromiseCapability* promiseCapability, Var resolution, bool rejecting)
+    {
+        Assert(promiseCapability->IsNative());
+
+        // The promise takes the place of the resolving functions it was created without, so settle it in its own script context
+        // just as calling one of them would.
+        JavascriptPromise* promise = JavascriptPromise::FromVar(promiseCapability->GetPromise());
+        ScriptContext* promiseScriptContext = promise->GetScriptContext();
+
+        return ResolveOrRejectPromise(promise, CrossSite::MarshalVar(promiseScriptContext, resolution), rejecting, promiseScriptContext);
+    }
+
     // Promise Resolve Thenable Job as described in ES 2015 Section 25.4.2.2
     Var JavascriptPromise::EntryResolveThenableTaskFunction(RecyclableObject* function, CallInfo callInfo, ...)
     {
@@ -787,6 +846,11 @@ namespace Js
         RecyclableObject* thenable = resolveThenableTaskFunction->GetThenable();
         RecyclableObject* thenFunction = resolveThenableTaskFunction->GetThenFunction();
 
+        if (JavascriptPromise::Is(thenable) && TryAdoptPromise(promise, JavascriptPromise::FromVar(thenable), thenFunction, scriptContext))
+        {
+            return library->GetUndefined();
+        }
+
         JavascriptPromiseResolveOrRejectFunctionAlreadyResolvedWrapper* alreadyResolvedRecord = RecyclerNewStructZ(scriptContext->GetRecycler(), JavascriptPromiseResolveOrRejectFunctionAlreadyResolvedWrapper);
         alreadyResolvedRecord->alreadyResolved = false;
 
@@ -808,6 +872,86 @@ namespace Js
         }
     }
 
+    // Calling the built-in then from the resolve thenable job allocates a derived promise and a pair of resolving functions
+    // whose only use is to settle the promise once the thenable settles. When the thenable is a native promise whose then
+    // and species constructor are the built-in ones, the promise is instead settled directly by a reaction registered on the
+    // thenable. That reaction runs in the same job the built-in then would have enqueued, so the number of ticks it takes to
+    // adopt the thenable's state does not change.
+    bool JavascriptPromise::TryAdoptPromise(JavascriptPromise* promise, JavascriptPromise* thenable, RecyclableObject* thenFunction, ScriptContext* scriptContext)
+    {
+        if (thenable->GetScriptContext() != scriptContext ||
+            !JavascriptFunction::Is(thenFunction) ||
+            JavascriptFunction::FromVar(thenFunction)->GetFunctionInfo() != &JavascriptPromise::EntryInfo::Then ||
+            !HasBuiltInSpeciesConstructor(thenable, scriptContext))
+        {
+            return false;
+        }
+
+        JavascriptLibrary* library = scriptContext->GetLibrary();
+        JavascriptPromiseCapability* promiseCapability = JavascriptPromiseCapability::New(promise, nullptr, nullptr, scriptContext);
+        JavascriptPromiseReaction* resolveReaction = JavascriptPromiseReaction::New(promiseCapability, library->GetIdentityFunction(), scriptContext);
+        JavascriptPromiseReaction* rejectReaction = JavascriptPromiseReaction::New(promiseCapability, library->GetThrowerFunction(), scriptContext);
+
+        switch (thenable->status)
+        {
+        case PromiseStatusCode_Unresolved:
+            thenable->AddReactions(resolveReaction, rejectReaction, scriptContext);
+            break;
+        case PromiseStatusCode_HasResolution:
+            EnqueuePromiseReactionTask(resolveReaction, thenable->result, scriptContext);
+            break;
+        case PromiseStatusCode_HasRejection:
+            EnqueuePromiseReactionTask(rejectReaction, thenable->result, scriptContext);
+            break;
+        default:
+            AssertMsg(false, "Promise status is in an invalid state");
+            break;
+        }
+
+        return true;
+    }
+
+    // Whether SpeciesConstructor(promise, %Promise%) would return %Promise% without running any script, that is, whether
+    // neither the promise nor Promise.prototype has had its constructor replaced and Promise[@@species] is the built-in
+    // getter. Looking at the property descriptors instead of getting the properties keeps this check unobservable.
+    bool JavascriptPromise::HasBuiltInSpeciesConstructor(JavascriptPromise* promise, ScriptContext* scriptContext)
+    {
+        JavascriptLibrary* library = scriptContext->GetLibrary();
+        DynamicObject* promisePrototype = library->GetPromisePrototype();
+        JavascriptFunction* promiseConstructor = library->GetPromiseConstructor();
+
+        if (promise->GetPrototype() != promisePrototype || promise->HasOwnProperty(PropertyIds::constructor))
+        {
+            return false;
+        }
+
+        PropertyDescriptor descriptor;
+
+        if (!JavascriptOperators::GetOwnPropertyDescriptor(promisePrototype, PropertyIds::constructor, scriptContext, &descriptor) ||
+            !descriptor.IsDataDescriptor() ||
+            descriptor.GetValue() != promiseConstructor)
+        {
+            return false;
+        }
+
+        if (!scriptContext->GetConfig()->IsES6SpeciesEnabled())
+        {
+            return true;
+        }
+
+        if (!JavascriptOperators::GetOwnPropertyDescriptor(promiseConstructor, PropertyIds::_symbolSpecies, scriptContext, &descriptor) ||
+            !descriptor.IsAccessorDescriptor())
+        {
+            return false;
+        }
+
+        Var getter = descriptor.GetGetter();
+
+        return getter != nullptr &&
+            JavascriptFunction::Is(getter) &&
+            JavascriptFunction::FromVar(getter)->GetFunctionInfo() == &JavascriptPromise::EntryInfo::GetterSymbolSpecies;
+    }
+
     // Promise Identity Function as described in ES 2015Section 25.4.5.3.1
     Var JavascriptPromise::EntryIdentityFunction(RecyclableObject* function, CallInfo callInfo, ...)
     {
@@ -1040,12 +1184,36 @@ namespace Js
             JavascriptError::ThrowTypeError(scriptContext, JSERR_NeedFunction);
         }
 
+        JavascriptLibrary* library = scriptContext->GetLibrary();
+
+        if (constructor == library->GetPromiseConstructor())
+        {
+            // Calling the built-in constructor with a capabilities executor would only hand back the resolving functions
+            // InitializePromise creates, so skip the executor and the constructor call.
+            JavascriptPromise* promise = library->CreatePromise();
+            JavascriptPromiseResolveOrRejectFunction* resolve;
+            JavascriptPromiseResolveOrRejectFunction* reject;
+
+            InitializePromise(promise, &resolve, &reject, scriptContext);
+
+            return JavascriptPromiseCapability::New(promise, resolve, reject, scriptContext);
+        }
+
         RecyclableObject* constructorFunc = RecyclableObject::FromVar(constructor);
-        Var promise = scriptContext->GetLibrary()->CreatePromise();
+        Var promise = library->CreatePromise();
 
         return CreatePromiseCapabilityRecord(promise, constructorFunc, scriptContext);
     }
 
+    JavascriptPromiseCapability* JavascriptPromise::NewNativePromiseCapability(ScriptContext* scriptContext)
+    {
+        JavascriptPromise* promise = scriptContext->GetLibrary()->CreatePromise();
+
+        promise->status = PromiseStatusCode_Unresolved;
+
+        return JavascriptPromiseCapability::New(promise, nullptr, nullptr, scriptContext);
+    }
+
     // CreatePromiseCapabilityRecord as described in ES6.0 (draft 29) Section 25.4.1.6.1
     JavascriptPromiseCapability* JavascriptPromise::CreatePromiseCapabilityRecord(Var promise, RecyclableObject* constructor, ScriptContext* scriptContext)
     {
@@ -1125,17 +1293,20 @@ namespace Js
     }
 
     // TriggerPromiseReactions as defined in ES 2015 Section 25.4.1.7
-    Var JavascriptPromise::TriggerPromiseReactions(JavascriptPromiseReactionList* reactions, Var resolution, ScriptContext* scriptContext)
+    Var JavascriptPromise::TriggerPromiseReactions(JavascriptPromiseReaction* reaction, JavascriptPromiseReactionList* reactions, Var resolution, ScriptContext* scriptContext)
     {
         JavascriptLibrary* library = scriptContext->GetLibrary();
 
+        if (reaction != nullptr)
+        {
+            EnqueuePromiseReactionTask(reaction, resolution, scriptContext);
+        }
+
         if (reactions != nullptr)
         {
             for (int i = 0; i < reactions->Count(); i++)
             {
-                JavascriptPromiseReaction* reaction = reactions->Item(i);
-
-                EnqueuePromiseReactionTask(reaction, resolution, scriptContext);
+                EnqueuePromiseReactionTask(reactions->Item(i), resolution, scriptContext);
             }
         }
 
@@ -1349,6 +1520,13 @@ namespace Js
         this->reject = reject;
     }
 
+    bool JavascriptPromiseCapability::IsNative()
+    {
+        Assert((this->resolve == nullptr) == (this->reject == nullptr));
+
+        return this->resolve == nullptr;
+    }
+
     JavascriptPromiseReaction* JavascriptPromiseReaction::New(JavascriptPromiseCapability* capabilities, RecyclableObject* handler, ScriptContext* scriptContext)
     {
         return RecyclerNew(scriptContext->GetRecycler(), JavascriptPromiseReaction, capabilities, handler);
@@ -233,6 +233,10 @@ namespace Js
         void SetResolve(RecyclableObject* resolve);
         void SetReject(RecyclableObject* reject);
 
+        // A native capability is one whose promise is a built-in promise without resolving functions. It is settled directly
+        // by the reaction task that owns it.
+        bool IsNative();
+
     public:
         // Finalizable support
         virtual void Finalize(bool isShutdown)
@@ -350,13 +354,13 @@ namespace Js
         virtual BOOL GetDiagValueString(StringBuilder<ArenaAllocator>* stringBuilder, ScriptContext* requestContext) override;
         virtual BOOL GetDiagTypeString(StringBuilder<ArenaAllocator>* stringBuilder, ScriptContext* requestContext) override;
 
-        JavascriptPromiseReactionList* GetResolveReactions();
-        JavascriptPromiseReactionList* GetRejectReactions();
+        void AddReactions(JavascriptPromiseReaction* resolveReaction, JavascriptPromiseReaction* rejectReaction, ScriptContext* scriptContext);
 
         static JavascriptPromiseCapability* NewPromiseCapability(Var constructor, ScriptContext* scriptContext);
+        static JavascriptPromiseCapability* NewNativePromiseCapability(ScriptContext* scriptContext);
         static JavascriptPromiseCapability* CreatePromiseCapabilityRecord(Var promise, RecyclableObject* constructor, ScriptContext* scriptContext);
         static bool UpdatePromiseFromPotentialThenable(Var resolution, JavascriptPromiseCapability* promiseCapability, ScriptContext* scriptContext);
-        static Var TriggerPromiseReactions(JavascriptPromiseReactionList* reactions, Var resolution, ScriptContext* scriptContext);
+        static Var TriggerPromiseReactions(JavascriptPromiseReaction* reaction, JavascriptPromiseReactionList* reactions, Var resolution, ScriptContext* scriptContext);
         static void EnqueuePromiseReactionTask(JavascriptPromiseReaction* reaction, Var resolution, ScriptContext* scriptContext);
 
         static void InitializePromise(JavascriptPromise* promise, JavascriptPromiseResolveOrRejectFunction** resolve, JavascriptPromiseResolveOrRejectFunction** reject, ScriptContext* scriptContext);
@@ -372,10 +376,19 @@ namespace Js
 
         PromiseStatus status;
         Var result;
+
+        // Most promises have at most one then() registered on them, so the first pair of reactions is stored inline and the
+        // lists are only allocated for the reactions that follow it.
+        JavascriptPromiseReaction* firstResolveReaction;
+        JavascriptPromiseReaction* firstRejectReaction;
         JavascriptPromiseReactionList* resolveReactions;
         JavascriptPromiseReactionList* rejectReactions;
 
     private :
+        static Var ResolveOrRejectPromise(JavascriptPromise* promise, Var resolution, bool rejecting, ScriptContext* scriptContext);
+        static Var ResolveOrRejectNativeCapability(JavascriptPromiseCapability* promiseCapability, Var resolution, bool rejecting);
+        static bool TryAdoptPromise(JavascriptPromise* promise, JavascriptPromise* thenable, RecyclableObject* thenFunction, ScriptContext* scriptContext);
+        static bool HasBuiltInSpeciesConstructor(JavascriptPromise* promise, ScriptContext* scriptContext);
         static void AsyncSpawnStep(JavascriptPromiseAsyncSpawnStepArgumentExecutorFunction* nextFunction, JavascriptGenerator* gen, JavascriptFunction* resolve, JavascriptFunction* reject);
 
     };
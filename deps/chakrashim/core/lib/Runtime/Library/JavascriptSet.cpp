@@ -31,9 +31,9 @@ namespace Js
         return static_cast<JavascriptSet *>(RecyclableObject::FromVar(aValue));
     }
 
-    JavascriptSet::SetDataList::Iterator JavascriptSet::GetIterator()
+    JavascriptSet::SetDataSet::Iterator JavascriptSet::GetIterator()
     {
-        return list.GetIterator();
+        return SetDataSet::Iterator(set);
     }
 
     Var JavascriptSet::NewInstance(RecyclableObject* function, CallInfo callInfo, ...)
@@ -290,35 +290,22 @@ namespace Js
 
     void JavascriptSet::Add(Var value)
     {
-        if (!set->ContainsKey(value))
-        {
-            SetDataNode* node = list.Append(value, GetScriptContext()->GetRecycler());
-            set->Add(value, node);
-        }
+        set->Add(value);
     }
 
     void JavascriptSet::Clear()
     {
-        // TODO: (Consider) Should we clear the set here and leave it as large as it has grown, or
-        // toss it away and create a new empty set, letting it grow as needed?
-        list.Clear();
         set->Clear();
     }
 
     bool JavascriptSet::Delete(Var value)
     {
-        if (set->ContainsKey(value))
-        {
-            SetDataNode* node = set->Item(value);
-            list.Remove(node);
-            return set->Remove(value);
-        }
-        return false;
+        return set->Remove(value);
     }
 
     bool JavascriptSet::Has(Var value)
     {
-        return set->ContainsKey(value);
+        return set->Find(value) != nullptr;
     }
 
     int JavascriptSet::Size()
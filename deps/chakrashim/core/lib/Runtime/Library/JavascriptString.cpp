@@ -2492,6 +2492,189 @@ case_2:
         return AllocateAndCopySz(alloc, GetString(), GetLength());
     }
 
+    template <typename Fn>
+    bool JavascriptString::VisitChars(const charcount_t start, const charcount_t length, ArenaAllocator *const alloc, Fn visit)
+    {
+        Assert(start <= GetLength());
+        Assert(length <= GetLength() - start);
+
+        struct CharRange
+        {
+            JavascriptString *string;
+            charcount_t start;
+            charcount_t length;
+        };
+
+        JsUtil::Stack<CharRange> ranges(alloc);
+        CharRange range = { this, start, length };
+        ranges.Push(range);
+        while (!ranges.Empty())
+        {
+            range = ranges.Pop();
+            JavascriptString *const s = range.string;
+            if (range.length == 0)
+            {
+                continue;
+            }
+
+            if (s->IsFinalized())
+            {
+                if (!visit(s->GetString() + range.start, range.length))
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            JavascriptString * const * items;
+            const int itemCount = s->GetRandomAccessItemsFromConcatString(items);
+            if (itemCount >= 0)
+            {
+                // Push the parts of the items that are in range, last first so that they are visited in order
+                const charcount_t rangeEnd = range.start + range.length;
+                charcount_t itemEnd = s->GetLength();
+                for (int i = itemCount - 1; i >= 0 && itemEnd > range.start; i--)
+                {
+                    JavascriptString *const item = items[i];
+                    if (!item)
+                    {
+                        continue;
+                    }
+
+                    const charcount_t itemStart = itemEnd - item->GetLength();
+                    if (itemStart < rangeEnd)
+                    {
+                        const charcount_t partStart = max(itemStart, range.start);
+                        CharRange part = { item, partStart - itemStart, min(itemEnd, rangeEnd) - partStart };
+                        ranges.Push(part);
+                    }
+                    itemEnd = itemStart;
+                }
+                continue;
+            }
+
+            const wchar_t *chars;
+            if (s->IsTree())
+            {
+                // A tree without random access items, such as a compound string, can only be copied whole
+                wchar_t *const copy = AnewArray(alloc, wchar_t, s->GetLength());
+                StringCopyInfoStack nestedStringTreeCopyInfos(GetScriptContext());
+                s->Copy(copy, nestedStringTreeCopyInfos, 0);
+                s->FinishCopy(copy, nestedStringTreeCopyInfos);
+                chars = copy;
+            }
+            else
+            {
+                chars = s->GetString();
+            }
+
+            if (!visit(chars + range.start, range.length))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void JavascriptString::CopyChars(__out_ecount(length) wchar_t *const buffer, const charcount_t start, const charcount_t length)
+    {
+        Assert(buffer);
+        Assert(start <= GetLength());
+        Assert(length <= GetLength() - start);
+
+        if (this->IsFinalized())
+        {
+            CopyHelper(buffer, GetString() + start, length);
+            return;
+        }
+
+        if (start == 0 && length == GetLength())
+        {
+            StringCopyInfoStack nestedStringTreeCopyInfos(GetScriptContext());
+            CopyVirtual(buffer, nestedStringTreeCopyInfos, 0);
+            FinishCopy(buffer, nestedStringTreeCopyInfos);
+            return;
+        }
+
+        ScriptContext *const scriptContext = GetScriptContext();
+        BEGIN_TEMP_ALLOCATOR(tempAllocator, scriptContext, L"CopyChars");
+        {
+            wchar_t *dest = buffer;
+            VisitChars(start, length, tempAllocator, [&](const wchar_t *chars, const charcount_t count) -> bool
+            {
+                CopyHelper(dest, chars, count);
+                dest += count;
+                return true;
+            });
+            Assert(dest == buffer + length);
+        }
+        END_TEMP_ALLOCATOR(tempAllocator, scriptContext);
+    }
+
+    size_t JavascriptString::CopyUtf8(__out_ecount_opt(bufferSize) utf8char_t *const buffer, const size_t bufferSize, __out charcount_t *const encodedLength)
+    {
+        if (this->IsFinalized())
+        {
+            return utf8::EncodeTrueUtf8Into(buffer, bufferSize, GetString(), GetLength(), encodedLength);
+        }
+
+        // Every character takes at least a byte, so a buffer of n bytes takes at most n characters. One more is looked at to
+        // see whether a high surrogate at the end of those has its low surrogate after it.
+        const charcount_t length = buffer == nullptr || bufferSize >= GetLength() ? GetLength() : static_cast<charcount_t>(bufferSize) + 1;
+
+        size_t byteLength = 0;
+        charcount_t charLength = 0;
+        auto encode = [&](const wchar_t *const chars, const charcount_t count) -> bool
+        {
+            charcount_t encodedCount;
+            byteLength += utf8::EncodeTrueUtf8Into(
+                buffer == nullptr ? nullptr : buffer + byteLength, buffer == nullptr ? 0 : bufferSize - byteLength, chars, count, &encodedCount);
+            charLength += encodedCount;
+            return encodedCount == count;
+        };
+
+        // The leaves are encoded one at a time, rather than gathered first, and the walk stops once the buffer is full. A high
+        // surrogate at the end of a leaf is held back until the start of the next leaf shows whether it is part of a pair.
+        ScriptContext *const scriptContext = GetScriptContext();
+        wchar_t highSurrogate = 0;
+        BEGIN_TEMP_ALLOCATOR(tempAllocator, scriptContext, L"CopyUtf8");
+        {
+            const bool isComplete = VisitChars(0, length, tempAllocator, [&](const wchar_t *chars, charcount_t count) -> bool
+            {
+                if (highSurrogate != 0)
+                {
+                    const wchar_t pair[] = { highSurrogate, chars[0] };
+                    const charcount_t pairCount = NumberUtilities::IsSurrogateUpperPart(chars[0]) ? 2 : 1;
+                    highSurrogate = 0;
+                    if (!encode(pair, pairCount))
+                    {
+                        return false;
+                    }
+                    chars += pairCount - 1;
+                    count -= pairCount - 1;
+                }
+
+                if (count != 0 && NumberUtilities::IsSurrogateLowerPart(chars[count - 1]))
+                {
+                    highSurrogate = chars[count - 1];
+                    count--;
+                }
+                return encode(chars, count);
+            });
+
+            // A high surrogate left at the end of a truncated range would not fit, as the buffer is full by then
+            if (isComplete && highSurrogate != 0 && length == GetLength())
+            {
+                encode(&highSurrogate, 1);
+            }
+        }
+        END_TEMP_ALLOCATOR(tempAllocator, scriptContext);
+
+        *encodedLength = charLength;
+        return byteLength;
+    }
+
     /*
     Table generated using the following:
 
@@ -2632,13 +2815,29 @@ case_2:
         BigInt bi;
         for ( ; pch < pchEnd ; pch++)
         {
-            wchar_t ch = *pch;
+            ulong multiplier;
+            ulong digits;
+            uint32 eightDigits;
 
-            if(ch >= _countof(stringToIntegerMap) || (ch = stringToIntegerMap[ch]) >= radix)
+            if (10 == radix && pchEnd - pch >= 8 && NumberUtilities::TryParseEightDecimalDigits(pch, &eightDigits))
             {
-                break;
+                // Long decimal strings take one big integer operation per eight digits
+                multiplier = 100000000;
+                digits = eightDigits;
+                pch += 7;
+            }
+            else
+            {
+                wchar_t ch = *pch;
+
+                if(ch >= _countof(stringToIntegerMap) || (ch = stringToIntegerMap[ch]) >= radix)
+                {
+                    break;
+                }
+                multiplier = radix;
+                digits = ch;
             }
-            if (!bi.FMulAdd(radix, ch))
+            if (!bi.FMulAdd(multiplier, digits))
             {
                 //Mimic IE8 which threw a OutOfMemory exception in this case.
                 JavascriptError::ThrowOutOfMemoryError(GetScriptContext());
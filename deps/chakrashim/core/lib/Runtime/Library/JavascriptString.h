@@ -104,8 +104,19 @@ namespace Js
         }
         virtual void CopyVirtual(_Out_writes_(m_charLength) wchar_t *const buffer, StringCopyInfoStack &nestedStringTreeCopyInfos, const byte recursionDepth);
 
+        // Copy out the characters without flattening a string tree in place, as GetString would. The whole of a tree is
+        // copied straight from its leaves; part of a tree is copied from the parts of its items that are in range.
+        void CopyChars(__out_ecount(length) wchar_t *const buffer, const charcount_t start, const charcount_t length);
+        // Encode the string as UTF-8 without flattening it, see utf8::EncodeTrueUtf8Into. Leaves are encoded in order until the
+        // buffer is full.
+        size_t CopyUtf8(__out_ecount_opt(bufferSize) utf8char_t *const buffer, const size_t bufferSize, __out charcount_t *const encodedLength);
+
     private:
         void FinishCopy(__inout_xcount(m_charLength) wchar_t *const buffer, StringCopyInfoStack &nestedStringTreeCopyInfos);
+        // Call visit with the characters in range, a leaf at a time, until it returns false. A tree that has no random access
+        // items is copied to alloc first. Returns false if visit stopped the walk.
+        template <typename Fn>
+        bool VisitChars(const charcount_t start, const charcount_t length, ArenaAllocator *const alloc, Fn visit);
 
     public:
         virtual int GetRandomAccessItemsFromConcatString(Js::JavascriptString * const *& items) const { return -1; }
@@ -0,0 +1,331 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// This is the hash table behind ES6 Map and Set objects. Entries are kept in
+// insertion order in one dense array, and an array of buckets holds the index
+// of the first entry of each hash chain, the chains running through the
+// entries themselves. An entry is its data, its hash code and the index of the
+// next entry in its chain, and a lookup touches one bucket and the entries of
+// one chain. Deleted entries are marked by a null key and stay where they are
+// until the table moves to new storage, which happens when the entry array is
+// full (compacting it, and growing it if it is mostly live) or when most
+// entries have been deleted (shrinking it).
+//
+// Iterators hold the storage they are iterating and the index of the next
+// entry, and stay valid whatever is done to the table. Storage which the table
+// has moved away from is left as it was, with a pointer to the new storage or
+// a flag saying the table was cleared. An iterator which finds its storage
+// obsolete follows the pointer and moves its index back by the number of
+// deleted entries before it, which are still marked in the old storage, or
+// starts again from the beginning of the table if it was cleared. Storage is
+// recycler allocated, so old storage lives as long as an iterator uses it and
+// the table does not need to know about its iterators.
+
+namespace Js
+{
+    inline Var GetMapOrSetDataKey(Var data)
+    {
+        return data;
+    }
+
+    inline Var GetMapOrSetDataKey(const JsUtil::KeyValuePair<Var, Var>& data)
+    {
+        return data.Key();
+    }
+
+    // Deleted data has a null key
+    inline void ClearMapOrSetData(Var& data)
+    {
+        data = nullptr;
+    }
+
+    inline void ClearMapOrSetData(JsUtil::KeyValuePair<Var, Var>& data)
+    {
+        data = JsUtil::KeyValuePair<Var, Var>(nullptr, nullptr);
+    }
+
+    template <typename TData>
+    class MapOrSetDataTable
+    {
+    private:
+        static const uint MinCapacity = 8;
+
+        struct Entry
+        {
+            TData data;
+            hash_t hash;
+            int next;
+        };
+
+        struct Storage
+        {
+            int* buckets;
+            Entry* entries;
+            uint capacity;
+            uint hashShift;
+            uint entryCount; // including deleted entries
+
+            // Set once the table has moved to other storage
+            Storage* next;
+            bool isCleared;
+
+            uint GetBucket(hash_t hash) const
+            {
+                // Fibonacci hashing spreads hash codes which differ only in their high or low bits, such as small
+                // integers and object addresses
+                return ((uint)hash * 2654435769u) >> hashShift;
+            }
+
+            bool IsObsolete() const
+            {
+                return next != nullptr || isCleared;
+            }
+
+            uint CountDeletedBefore(uint index) const
+            {
+                uint count = 0;
+                for (uint i = 0; i < index; i++)
+                {
+                    count += IsDeleted(entries[i]);
+                }
+                return count;
+            }
+        };
+
+        Recycler* recycler;
+        Storage* storage;
+        uint count;
+
+        static bool IsDeleted(const Entry& entry)
+        {
+            return GetMapOrSetDataKey(entry.data) == nullptr;
+        }
+
+        static hash_t GetHashCode(Var key)
+        {
+            return SameValueZeroComparer<Var>::GetHashCode(key);
+        }
+
+        static bool KeyEquals(Var entryKey, Var key)
+        {
+            return entryKey == key || (entryKey != nullptr && SameValueZeroComparer<Var>::Equals(entryKey, key));
+        }
+
+        Entry* FindEntry(Var key, hash_t hash)
+        {
+            if (storage == nullptr)
+            {
+                return nullptr;
+            }
+
+            for (int i = storage->buckets[storage->GetBucket(hash)]; i >= 0; )
+            {
+                Entry& entry = storage->entries[i];
+                if (entry.hash == hash && KeyEquals(GetMapOrSetDataKey(entry.data), key))
+                {
+                    return &entry;
+                }
+                i = entry.next;
+            }
+            return nullptr;
+        }
+
+        Storage* AllocateStorage(uint capacity)
+        {
+            Assert(capacity >= MinCapacity && Math::IsPow2((int32)capacity));
+
+            // Two entries per bucket when full
+            const uint bucketCount = capacity / 2;
+            uint hashShift = 32;
+            for (uint n = bucketCount; n > 1; n >>= 1)
+            {
+                hashShift--;
+            }
+
+            Storage* newStorage = RecyclerNewStructZ(recycler, Storage);
+            newStorage->buckets = RecyclerNewArrayLeaf(recycler, int, bucketCount);
+            memset(newStorage->buckets, -1, bucketCount * sizeof(int));
+            newStorage->entries = RecyclerNewArrayZ(recycler, Entry, capacity);
+            newStorage->capacity = capacity;
+            newStorage->hashShift = hashShift;
+            return newStorage;
+        }
+
+        void Rehash(uint capacity)
+        {
+            Assert(storage != nullptr);
+            Assert(count <= capacity);
+
+            Storage* newStorage = AllocateStorage(capacity);
+            uint newEntryCount = 0;
+            for (uint i = 0; i < storage->entryCount; i++)
+            {
+                const Entry& entry = storage->entries[i];
+                if (IsDeleted(entry))
+                {
+                    continue;
+                }
+
+                Entry& newEntry = newStorage->entries[newEntryCount];
+                newEntry.data = entry.data;
+                newEntry.hash = entry.hash;
+                int& bucket = newStorage->buckets[newStorage->GetBucket(entry.hash)];
+                newEntry.next = bucket;
+                bucket = newEntryCount++;
+            }
+            Assert(newEntryCount == count);
+            newStorage->entryCount = newEntryCount;
+
+            storage->next = newStorage;
+            storage = newStorage;
+        }
+
+    public:
+        MapOrSetDataTable(Recycler* recycler) : recycler(recycler), storage(nullptr), count(0) { }
+
+        class Iterator
+        {
+            MapOrSetDataTable<TData>* table;
+            Storage* storage;
+            uint index;
+        public:
+            Iterator() : table(nullptr), storage(nullptr), index(0) { }
+            Iterator(MapOrSetDataTable<TData>* table) : table(table), storage(table != nullptr ? table->storage : nullptr), index(0) { }
+
+            bool Next()
+            {
+                if (table == nullptr)
+                {
+                    return false;
+                }
+
+                // Catch up with the storage the table has moved to since the last call
+                while (storage == nullptr || storage->IsObsolete())
+                {
+                    if (storage == nullptr)
+                    {
+                        storage = table->storage;
+                        index = 0;
+                        if (storage == nullptr)
+                        {
+                            break;
+                        }
+                    }
+                    else if (storage->isCleared)
+                    {
+                        storage = nullptr;
+                    }
+                    else
+                    {
+                        index -= storage->CountDeletedBefore(index);
+                        storage = storage->next;
+                    }
+                }
+
+                if (storage != nullptr)
+                {
+                    while (index < storage->entryCount)
+                    {
+                        if (!IsDeleted(storage->entries[index++]))
+                        {
+                            return true;
+                        }
+                    }
+                }
+
+                // Done, even if entries are added later
+                table = nullptr;
+                storage = nullptr;
+                return false;
+            }
+
+            TData& Current()
+            {
+                Assert(storage != nullptr && index != 0 && !IsDeleted(storage->entries[index - 1]));
+                return storage->entries[index - 1].data;
+            }
+        };
+
+        uint Count() const
+        {
+            return count;
+        }
+
+        TData* Find(Var key)
+        {
+            Entry* entry = FindEntry(key, GetHashCode(key));
+            return entry != nullptr ? &entry->data : nullptr;
+        }
+
+        // Adds the data if its key is not in the table already. Returns the data in the table for the key if it was
+        // there, and null if the data was added.
+        TData* Add(const TData& data)
+        {
+            const Var key = GetMapOrSetDataKey(data);
+            Assert(key != nullptr);
+            const hash_t hash = GetHashCode(key);
+            Entry* existing = FindEntry(key, hash);
+            if (existing != nullptr)
+            {
+                return &existing->data;
+            }
+
+            if (storage == nullptr)
+            {
+                storage = AllocateStorage(MinCapacity);
+            }
+            else if (storage->entryCount == storage->capacity)
+            {
+                // Grow if most entries are live, otherwise compacting makes enough room
+                Rehash(count >= storage->capacity / 4 * 3 ? storage->capacity * 2 : storage->capacity);
+            }
+
+            const uint index = storage->entryCount++;
+            Entry& entry = storage->entries[index];
+            entry.data = data;
+            entry.hash = hash;
+            int& bucket = storage->buckets[storage->GetBucket(hash)];
+            entry.next = bucket;
+            bucket = index;
+            count++;
+            return nullptr;
+        }
+
+        bool Remove(Var key)
+        {
+            Entry* entry = FindEntry(key, GetHashCode(key));
+            if (entry == nullptr)
+            {
+                return false;
+            }
+
+            // The entry stays in its chain until the next rehash; clearing the data lets go of the key and value
+            ClearMapOrSetData(entry->data);
+            count--;
+
+            if (storage->capacity > MinCapacity && count < storage->capacity / 4)
+            {
+                Rehash(storage->capacity / 2);
+            }
+            return true;
+        }
+
+        void Clear()
+        {
+            if (storage != nullptr)
+            {
+                storage->isCleared = true;
+                storage = nullptr;
+            }
+            count = 0;
+        }
+
+        Iterator GetIterator()
+        {
+            return Iterator(this);
+        }
+    };
+}
@@ -43,7 +43,7 @@
 #include "Library\JavascriptGenerator.h"
 
 #include "Library\SameValueComparer.h"
-#include "Library\MapOrSetDataList.h"
+#include "Library\MapOrSetDataTable.h"
 #include "Library\JavascriptMap.h"
 #include "Library\JavascriptSet.h"
 #include "Library\JavascriptWeakMap.h"
@@ -33,6 +33,18 @@ namespace Js
 
         static hash_t GetHashCode(Var i)
         {
+            // Integer and string keys are the most common, so test for them before looking up the type id
+            if (TaggedInt::Is(i))
+            {
+                return TaggedInt::ToInt32(i);
+            }
+
+            if (!TaggedNumber::Is(i) && VirtualTableInfo<PropertyString>::HasVirtualTable(i))
+            {
+                // Property records hash the same characters the same way
+                return ((PropertyString*)i)->GetPropertyRecord()->GetHashCode();
+            }
+
             switch (JavascriptOperators::GetTypeId(i))
             {
             case TypeIds_Integer:
@@ -62,6 +74,13 @@ namespace Js
                         }
                     }
 
+                    // Numbers which are equal to tagged integers must hash like them
+                    int32 intValue;
+                    if (JavascriptNumber::TryGetInt32Value(d, &intValue))
+                    {
+                        return intValue;
+                    }
+
                     __int64 v = *(__int64*)&d;
                     return (uint)v ^ (uint)(v >> 32);
                 }
@@ -2304,6 +2304,185 @@ namespace Js
         }
     }
 
+    template<size_t size> struct TypedArrayUnsignedOfSize;
+    template<> struct TypedArrayUnsignedOfSize<1> { typedef uint8 Type; };
+    template<> struct TypedArrayUnsignedOfSize<2> { typedef uint16 Type; };
+    template<> struct TypedArrayUnsignedOfSize<4> { typedef uint32 Type; };
+    template<> struct TypedArrayUnsignedOfSize<8> { typedef uint64 Type; };
+
+    // Maps an element to an unsigned key whose order is the numeric order of the elements, with -0 before +0. NaN has no
+    // place in it and is sorted separately.
+    template<typename T> struct TypedArraySortKey
+    {
+        typedef typename TypedArrayUnsignedOfSize<sizeof(T)>::Type Type;
+
+        static Type Get(const T value)
+        {
+            const Type signBit = (Type)((Type)1 << (sizeof(T) * 8 - 1));
+            return ((T)-1 < 0) ? (Type)((Type)value ^ signBit) : (Type)value;
+        }
+    };
+
+    template<> struct TypedArraySortKey<float>
+    {
+        typedef uint32 Type;
+
+        static Type Get(const float value)
+        {
+            Type bits;
+            js_memcpy_s(&bits, sizeof(bits), &value, sizeof(value));
+            return (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+        }
+    };
+
+    template<> struct TypedArraySortKey<double>
+    {
+        typedef uint64 Type;
+
+        static Type Get(const double value)
+        {
+            Type bits;
+            js_memcpy_s(&bits, sizeof(bits), &value, sizeof(value));
+            return (bits & 0x8000000000000000ull) ? ~bits : (bits | 0x8000000000000000ull);
+        }
+    };
+
+    template<typename T> struct TypedArraySortKeyComparer
+    {
+        int Compare(const T& element1, const T& element2)
+        {
+            const typename TypedArraySortKey<T>::Type key1 = TypedArraySortKey<T>::Get(element1);
+            const typename TypedArraySortKey<T>::Type key2 = TypedArraySortKey<T>::Get(element2);
+            return key1 < key2 ? -1 : (key1 > key2 ? 1 : 0);
+        }
+    };
+
+    template<typename T> struct TypedArrayCompareFnComparer
+    {
+        void* context[2];
+
+        int Compare(const T& element1, const T& element2)
+        {
+            return TypedArrayCompareElementsHelper<T>(context, &element1, &element2);
+        }
+    };
+
+    // Least significant digit first radix sort on the bytes of the sort keys, skipping bytes which are the same in every key
+    template<typename T> static void TypedArrayRadixSort(__inout_ecount(length) T* elements, __inout_ecount(length) T* scratch, const uint32 length)
+    {
+        typedef TypedArraySortKey<T> SortKey;
+        const uint32 digitCount = sizeof(typename SortKey::Type);
+
+        uint32 counts[digitCount][256];
+        memset(counts, 0, sizeof(counts));
+        for (uint32 i = 0; i < length; i++)
+        {
+            const typename SortKey::Type key = SortKey::Get(elements[i]);
+            for (uint32 digit = 0; digit < digitCount; digit++)
+            {
+                counts[digit][(key >> (digit * 8)) & 0xFF]++;
+            }
+        }
+
+        T* source = elements;
+        T* destination = scratch;
+        for (uint32 digit = 0; digit < digitCount; digit++)
+        {
+            uint32* const digitCounts = counts[digit];
+            if (digitCounts[(SortKey::Get(source[0]) >> (digit * 8)) & 0xFF] == length)
+            {
+                continue;
+            }
+
+            uint32 offset = 0;
+            for (uint32 value = 0; value < 256; value++)
+            {
+                const uint32 count = digitCounts[value];
+                digitCounts[value] = offset;
+                offset += count;
+            }
+
+            for (uint32 i = 0; i < length; i++)
+            {
+                destination[digitCounts[(SortKey::Get(source[i]) >> (digit * 8)) & 0xFF]++] = source[i];
+            }
+
+            T* const sorted = destination;
+            destination = source;
+            source = sorted;
+        }
+
+        if (source != elements)
+        {
+            js_memcpy_s(elements, length * sizeof(T), source, length * sizeof(T));
+        }
+    }
+
+    template<typename T> void TypedArraySortElementsHelper(TypedArrayBase* typedArrayBase, RecyclableObject* compareFn)
+    {
+        // Arrays at least this long are sorted by radix rather than by comparison when there is no comparison function
+        const uint32 RadixSortMinLength = 256;
+
+        ScriptContext* scriptContext = typedArrayBase->GetScriptContext();
+        T* const elements = (T*)typedArrayBase->GetByteBuffer();
+        const uint32 length = typedArrayBase->GetLength();
+        const uint32 scratchLength = JsUtil::MergeSort<T, TypedArrayCompareFnComparer<T>>::GetScratchLength(length);
+
+        BEGIN_TEMP_ALLOCATOR(tempAlloc, scriptContext, L"Runtime")
+        {
+            if (compareFn != nullptr)
+            {
+                // The comparison function may detach the buffer, so sort a copy and only store it once the sort is done
+                T* const sortElements = AnewArray(tempAlloc, T, length);
+                js_memcpy_s(sortElements, length * sizeof(T), elements, length * sizeof(T));
+
+                TypedArrayCompareFnComparer<T> comparer;
+                comparer.context[0] = typedArrayBase;
+                comparer.context[1] = compareFn;
+                T* const scratch = scratchLength == 0 ? nullptr : AnewArray(tempAlloc, T, scratchLength);
+                JsUtil::MergeSort<T, TypedArrayCompareFnComparer<T>>::Sort(sortElements, length, scratch, comparer);
+
+                if (typedArrayBase->IsDetachedBuffer())
+                {
+                    JavascriptError::ThrowTypeError(scriptContext, JSERR_DetachedTypedArray, L"[TypedArray].prototype.sort");
+                }
+                js_memcpy_s(elements, length * sizeof(T), sortElements, length * sizeof(T));
+            }
+            else
+            {
+                // NaNs go last
+                uint32 numberCount = length;
+                for (uint32 i = 0; i < numberCount; )
+                {
+                    if (NumberUtilities::IsNan((double)elements[i]))
+                    {
+                        numberCount--;
+                        const T nan = elements[i];
+                        elements[i] = elements[numberCount];
+                        elements[numberCount] = nan;
+                    }
+                    else
+                    {
+                        i++;
+                    }
+                }
+
+                if (numberCount >= RadixSortMinLength)
+                {
+                    TypedArrayRadixSort(elements, AnewArray(tempAlloc, T, numberCount), numberCount);
+                }
+                else
+                {
+                    TypedArraySortKeyComparer<T> comparer;
+                    const uint32 numberScratchLength = JsUtil::MergeSort<T, TypedArraySortKeyComparer<T>>::GetScratchLength(numberCount);
+                    T* const scratch = numberScratchLength == 0 ? nullptr : AnewArray(tempAlloc, T, numberScratchLength);
+                    JsUtil::MergeSort<T, TypedArraySortKeyComparer<T>>::Sort(elements, numberCount, scratch, comparer);
+                }
+            }
+        }
+        END_TEMP_ALLOCATOR(tempAlloc, scriptContext);
+    }
+
     Var TypedArrayBase::EntrySort(RecyclableObject* function, CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -2347,19 +2526,7 @@ namespace Js
             compareFn = RecyclableObject::FromVar(args[1]);
         }
 
-        // Get the elements comparison function for the type of this TypedArray
-        void* elementCompare = typedArrayBase->GetCompareElementsFunction();
-
-        Assert(elementCompare);
-
-        // Cast compare to the correct function type
-        int(__cdecl*elementCompareFunc)(void*, const void*, const void*) = (int(__cdecl*)(void*, const void*, const void*))elementCompare;
-
-        void * contextToPass[] = { typedArrayBase, compareFn };
-
-        // We can always call qsort_s with the same arguments. If user compareFn is non-null, the callback will use it to do the comparison.
-        qsort_s(typedArrayBase->GetByteBuffer(), length, typedArrayBase->GetBytesPerElement(), elementCompareFunc, contextToPass);
-
+        typedArrayBase->SortElements(compareFn);
 
         return typedArrayBase;
     }
@@ -2484,6 +2651,35 @@ namespace Js
         return false;
     }
 
+    void TypedArrayBase::XorBuffer(byte *const buffer, const size_t byteCount, const uint32 pattern)
+    {
+        Assert(buffer || byteCount == 0);
+
+        // The pattern holds the value to xor with, replicated to fill 32 bits, so it lines up with the elements as long
+        // as the buffer starts on an element boundary
+        size_t i = 0;
+#if defined(_M_IX86) || defined(_M_X64)
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            const __m128i mask = _mm_set1_epi32(pattern);
+            for (; i + sizeof(__m128i) <= byteCount; i += sizeof(__m128i))
+            {
+                __m128i *const chunk = reinterpret_cast<__m128i *>(buffer + i);
+                _mm_storeu_si128(chunk, _mm_xor_si128(_mm_loadu_si128(chunk), mask));
+            }
+        }
+#endif
+        for (; i + sizeof(uint32) <= byteCount; i += sizeof(uint32))
+        {
+            uint32 *const chunk = reinterpret_cast<uint32 *>(buffer + i);
+            *chunk ^= pattern;
+        }
+        for (size_t shift = 0; i < byteCount; ++i, shift += 8)
+        {
+            buffer[i] ^= static_cast<byte>(pattern >> shift);
+        }
+    }
+
     BOOL TypedArrayBase::ValidateIndexAndDirectSetItem(__in Js::Var index, __in Js::Var value, __in bool * isNumericIndex)
     {
         bool skipSetItem = false;
@@ -10,7 +10,10 @@ namespace Js
 {
     typedef Var (*PFNCreateTypedArray)(Js::ArrayBuffer* arrayBuffer, uint32 offSet, uint32 mappedLength, Js::JavascriptLibrary* javascirptLibrary);
 
+    class TypedArrayBase;
+
     template<typename T> int __cdecl TypedArrayCompareElementsHelper(void* context, const void* elem1, const void* elem2);
+    template<typename T> void TypedArraySortElementsHelper(TypedArrayBase* typedArrayBase, RecyclableObject* compareFn);
 
     class TypedArrayBase : public ArrayBufferParent
     {
@@ -137,6 +140,8 @@ namespace Js
         // Returns false if this is not a TypedArray or it's not detached
         static BOOL IsDetachedTypedArray(Var aValue);
         static HRESULT GetBuffer(Var aValue, ArrayBuffer** outBuffer, uint32* outOffset, uint32* outLength);
+        // Xors byteCount bytes of buffer with a 32-bit pattern, using SSE2 where available
+        static void XorBuffer(byte *const buffer, const size_t byteCount, const uint32 pattern);
 
         virtual BOOL DirectSetItem(__in uint32 index, __in Js::Var value, __in bool skipSetItem) = 0;
         virtual Var  DirectGetItem(__in uint32 index) = 0;
@@ -170,7 +175,8 @@ namespace Js
         static Var CreateNewInstance(Arguments& args, ScriptContext* scriptContext, uint32 elementSize, PFNCreateTypedArray pfnCreateTypedArray );
         static int32 ToLengthChecked(Var lengthVar, uint32 elementSize, ScriptContext* scriptContext);
 
-        virtual void* GetCompareElementsFunction() = 0;
+        // Sorts the elements in place, in numeric order or with the given comparison function
+        virtual void SortElements(RecyclableObject* compareFn) = 0;
 
         virtual Var Subarray(uint32 begin, uint32 end) = 0;
         int32 BYTES_PER_ELEMENT;
@@ -360,6 +366,56 @@ namespace Js
             return TRUE;
         }
 
+        // Xors the elements in [start, start + length) with value, ignoring the indexes that are out of range the same way
+        // the element stores of the loop that this replaces would
+        __inline BOOL DirectXorItemAtRange(__in int32 start, __in uint32 length, __in int32 value)
+        {
+            CompileAssert(sizeof(TypeName) <= sizeof(uint32));
+            if (CrossSite::IsCrossSiteObjectTyped(this))
+            {
+                return false;
+            }
+
+            if (this->IsDetachedBuffer()) // 9.4.5.9 IntegerIndexedElementSet
+            {
+                JavascriptError::ThrowTypeError(GetScriptContext(), JSERR_DetachedTypedArray);
+            }
+            uint32 newStart = start, newLength = length;
+
+            if (start < 0)
+            {
+                if ((int64)(length) + start < 0)
+                {
+                    // nothing to do, all index are no-op
+                    return true;
+                }
+                newStart = 0;
+                // fixup the length with the change
+                newLength += start;
+            }
+            if (newStart >= GetLength())
+            {
+                // If we want to start past the length of the array, all index are no-op
+                return true;
+            }
+
+            if (UInt32Math::Add(newStart, newLength) > GetLength())
+            {
+                newLength = GetLength() - newStart;
+            }
+
+            // Replicate the element-sized value over 32 bits
+            uint32 pattern;
+            TypeName *const patternElements = reinterpret_cast<TypeName *>(&pattern);
+            for (uint32 i = 0; i < sizeof(pattern) / sizeof(TypeName); i++)
+            {
+                patternElements[i] = static_cast<TypeName>(value);
+            }
+
+            TypedArrayBase::XorBuffer(reinterpret_cast<byte *>((TypeName*)buffer + newStart), sizeof(TypeName) * newLength, pattern);
+            return TRUE;
+        }
+
         __inline BOOL BaseTypedDirectSetItem(__in uint32 index, __in Js::Var value, __in bool skipSetElement, TypeName (*convFunc)(Var value, ScriptContext* scriptContext))
         {
             // This call can potentially invoke user code, and may end up detaching the underlying array (this).
@@ -397,9 +453,9 @@ namespace Js
         }
 
     protected:
-        void* GetCompareElementsFunction()
+        void SortElements(RecyclableObject* compareFn)
         {
-            return &TypedArrayCompareElementsHelper<TypeName>;
+            TypedArraySortElementsHelper<TypeName>(this, compareFn);
         }
     };
 
@@ -442,9 +498,9 @@ namespace Js
         virtual Var  DirectGetItem(__in uint32 index) override;
 
     protected:
-        void* GetCompareElementsFunction()
+        void SortElements(RecyclableObject* compareFn)
         {
-            return &TypedArrayCompareElementsHelper<wchar_t>;
+            TypedArraySortElementsHelper<wchar_t>(this, compareFn);
         }
     };
 
@@ -75,6 +75,7 @@ LIBRARY_FUNCTION(Function,      Call,               15,   BIF_UseSrc0 | BIF_Igno
 LIBRARY_FUNCTION(GlobalObject,  ParseInt,           1,    BIF_IgnoreDst                                         , GlobalObject::EntryInfo::ParseInt)
 LIBRARY_FUNCTION(RegExp,        Exec,               2,    BIF_UseSrc0 | BIF_IgnoreDst                           , JavascriptRegExp::EntryInfo::Exec)
 LIBRARY_FUNCTION(Math,          Fround,             1,    BIF_TypeSpecUnaryToFloat                              , Math::EntryInfo::Fround)
+LIBRARY_FUNCTION(ArrayIterator, Next,               1,    BIF_UseSrc0 | BIF_IgnoreDst                           , JavascriptArrayIterator::EntryInfo::Next)
 
 // Note: 1st column is currently used only for debug tracing.
 
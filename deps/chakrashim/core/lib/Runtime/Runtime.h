@@ -29,6 +29,9 @@ namespace UnifiedRegex
     template <typename T> class StandardChars;      // Used by ThreadContext.h
     struct TrigramAlphabet;
     struct RegexStacks;
+#if ENABLE_REGEX_NATIVE_CODEGEN
+    class RegexCodeGenerator;
+#endif
 #if ENABLE_REGEX_CONFIG_OPTIONS
     class DebugWriter;
     struct RegexStats;
@@ -374,6 +377,7 @@ enum tagDEBUG_EVENT_INFO_TYPE
 #include "Language\JavascriptExceptionContext.h"
 #include "Language\JavascriptExceptionObject.h"
 #include "Base\PerfHint.h"
+#include "Base\PerfMap.h"
 
 #include "ByteCode\ByteBlock.h"
 
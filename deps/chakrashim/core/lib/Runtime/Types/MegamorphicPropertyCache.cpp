@@ -0,0 +1,153 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeTypePch.h"
+
+namespace Js
+{
+    MegamorphicPropertyCache::MegamorphicPropertyCache()
+    {
+        memset(elements, 0, sizeof(elements));
+        memset(&statistics, 0, sizeof(statistics));
+    }
+
+    size_t MegamorphicPropertyCache::ElementIndex(const Type *const type, const PropertyId id)
+    {
+        Assert(type);
+        Assert(id != Constants::NoProperty);
+        Assert((MegamorphicPropertyCache_NumElements & MegamorphicPropertyCache_NumElements - 1) == 0);
+
+        // Types are allocated with the same alignment that polymorphic inline caches rely on, so the low bits carry no
+        // information.
+        return ((reinterpret_cast<size_t>(type) >> PolymorphicInlineCacheShift) ^ id) & MegamorphicPropertyCache_NumElements - 1;
+    }
+
+    bool MegamorphicPropertyCache::TryGetProperty(
+        RecyclableObject *const object,
+        const PropertyId propertyId,
+        Var *const propertyValue,
+        ScriptContext *const requestContext,
+        PropertyValueInfo *const propertyValueInfo)
+    {
+        Assert(object);
+        Assert(propertyValue);
+        Assert(propertyValueInfo);
+
+        Type *const type = object->GetType();
+        const Element &element = elements[ElementIndex(type, propertyId)];
+        if(element.type != type || element.id != propertyId || object->GetScriptContext() != requestContext)
+        {
+            statistics.loadMisses++;
+            return false;
+        }
+        statistics.loadHits++;
+
+        DynamicObject *const dynamicObject = DynamicObject::FromVar(object);
+        Assert(
+            dynamicObject->GetDynamicType()->GetTypeHandler()->InlineOrAuxSlotIndexToPropertyIndex(element.index, element.isInlineSlot) ==
+            object->GetPropertyIndex(propertyId));
+
+        *propertyValue =
+            element.isInlineSlot
+                ? dynamicObject->GetInlineSlot(element.index)
+                : dynamicObject->GetAuxSlot(element.index);
+        Assert(*propertyValue == JavascriptOperators::GetProperty(object, propertyId, requestContext));
+
+        CacheOperators::Cache<false, true, false>(
+            false,
+            dynamicObject,
+            false,
+            type,
+            nullptr,
+            propertyId,
+            element.index,
+            element.isInlineSlot,
+            false,
+            0,
+            propertyValueInfo,
+            requestContext);
+        return true;
+    }
+
+    bool MegamorphicPropertyCache::TrySetProperty(
+        RecyclableObject *const object,
+        const PropertyId propertyId,
+        Var propertyValue,
+        ScriptContext *const requestContext,
+        PropertyValueInfo *const propertyValueInfo)
+    {
+        Assert(object);
+        Assert(propertyValueInfo);
+
+        Type *const type = object->GetType();
+        const Element &element = elements[ElementIndex(type, propertyId)];
+        if(element.type != type ||
+            element.id != propertyId ||
+            !element.isSetPropertyAllowed ||
+            object->GetScriptContext() != requestContext)
+        {
+            statistics.storeMisses++;
+            return false;
+        }
+        statistics.storeHits++;
+
+        DynamicObject *const dynamicObject = DynamicObject::FromVar(object);
+        Assert(!object->IsFixedProperty(propertyId));
+        Assert(
+            dynamicObject->GetDynamicType()->GetTypeHandler()->InlineOrAuxSlotIndexToPropertyIndex(element.index, element.isInlineSlot) ==
+            object->GetPropertyIndex(propertyId));
+        Assert(object->CanStorePropertyValueDirectly(propertyId, false));
+
+        const PropertyIndex propertyIndex = element.index;
+        const bool isInlineSlot = element.isInlineSlot;
+        if(isInlineSlot)
+        {
+            dynamicObject->SetInlineSlot(SetSlotArguments(propertyId, propertyIndex, propertyValue));
+        }
+        else
+        {
+            dynamicObject->SetAuxSlot(SetSlotArguments(propertyId, propertyIndex, propertyValue));
+        }
+
+        CacheOperators::Cache<false, false, false>(
+            false,
+            dynamicObject,
+            false,
+            type,
+            nullptr,
+            propertyId,
+            propertyIndex,
+            isInlineSlot,
+            false,
+            0,
+            propertyValueInfo,
+            requestContext);
+        return true;
+    }
+
+    void MegamorphicPropertyCache::Cache(
+        Type *const type,
+        const PropertyId id,
+        const PropertyIndex index,
+        const bool isInlineSlot,
+        const bool isSetPropertyAllowed)
+    {
+        Assert(type);
+        Assert(id != Constants::NoProperty);
+        Assert(index != Constants::NoSlot);
+
+        Element &element = elements[ElementIndex(type, id)];
+        element.type = type;
+        element.id = id;
+        element.index = index;
+        element.isInlineSlot = isInlineSlot;
+        element.isSetPropertyAllowed = isSetPropertyAllowed;
+        statistics.entriesCached++;
+    }
+
+    void MegamorphicPropertyCache::Clear()
+    {
+        memset(elements, 0, sizeof(elements));
+    }
+}
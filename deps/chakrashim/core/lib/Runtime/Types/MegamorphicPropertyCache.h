@@ -0,0 +1,54 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// Must be a power of 2
+#define MegamorphicPropertyCache_NumElements 1024
+
+namespace Js
+{
+    // Thread-wide (type, property) -> slot cache for property accesses whose inline and polymorphic inline caches have
+    // overflowed. Only own data properties are cached, under the same rules as the local entries of a TypePropertyCache.
+    // Types are not kept alive by the cache, so it is cleared before every sweep.
+    class MegamorphicPropertyCache
+    {
+    public:
+        struct Statistics
+        {
+            uint64 loadHits;
+            uint64 loadMisses;
+            uint64 storeHits;
+            uint64 storeMisses;
+            uint64 entriesCached;
+        };
+
+    private:
+        struct Element
+        {
+            Type *type;
+            PropertyId id;
+            PropertyIndex index;
+            bool isInlineSlot : 1;
+            bool isSetPropertyAllowed : 1;
+        };
+
+        Element elements[MegamorphicPropertyCache_NumElements];
+        Statistics statistics;
+
+    private:
+        static size_t ElementIndex(const Type *const type, const PropertyId id);
+
+    public:
+        MegamorphicPropertyCache();
+
+        bool TryGetProperty(RecyclableObject *const object, const PropertyId propertyId, Var *const propertyValue, ScriptContext *const requestContext, PropertyValueInfo *const propertyValueInfo);
+        bool TrySetProperty(RecyclableObject *const object, const PropertyId propertyId, Var propertyValue, ScriptContext *const requestContext, PropertyValueInfo *const propertyValueInfo);
+
+        void Cache(Type *const type, const PropertyId id, const PropertyIndex index, const bool isInlineSlot, const bool isSetPropertyAllowed);
+        void Clear();
+
+        const Statistics &GetStatistics() const { return statistics; }
+    };
+}
@@ -113,6 +113,7 @@ template<> struct IntMath<int64> { using Type = Int64Math; };
 #include "DataStructures\InternalStringNoCaseComparer.h"
 #include "DataStructures\SparseArray.h"
 #include "DataStructures\growingArray.h"
+#include "DataStructures\MergeSort.h"
 #include "DataStructures\EvalMapString.h"
 #include "DataStructures\RegexKey.h"
 #include "DataStructures\LineOffsetCache.h"
@@ -141,6 +141,20 @@
 // Other features
 // #define CHAKRA_CORE_DOWN_COMPAT 1
 
+#if ENABLE_NATIVE_CODEGEN
+#define ENABLE_PERF_MAP                             // perf-<pid>.map symbols for generated code
+#endif
+
+#if ENABLE_NATIVE_CODEGEN && defined(_M_X64)
+#define ENABLE_REGEX_NATIVE_CODEGEN 1               // Compile backtracking-free regex programs to machine code
+#else
+#define ENABLE_REGEX_NATIVE_CODEGEN 0
+#endif
+
+#if ENABLE_PROFILE_INFO
+#define DYNAMIC_PROFILE_STORAGE                     // Persist dynamic profile data across runs
+#endif
+
 #if defined(ENABLE_DEBUG_CONFIG_OPTIONS) || defined(CHAKRA_CORE_DOWN_COMPAT)
 #define DELAYLOAD_SET_CFG_TARGET 1
 #endif
@@ -215,7 +229,6 @@
 
 #define BAILOUT_INJECTION
 #if ENABLE_PROFILE_INFO
-#define DYNAMIC_PROFILE_STORAGE
 #define DYNAMIC_PROFILE_MUTATOR
 #endif
 #define RUNTIME_DATA_COLLECTION
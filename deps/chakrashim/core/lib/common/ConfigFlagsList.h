@@ -164,6 +164,7 @@ PHASE(All)
                 PHASE(MemOp)
                     PHASE(MemSet)
                     PHASE(MemCopy)
+                    PHASE(MemXor)
             PHASE(DeadStore)
                 PHASE(ReverseCopyProp)
                 PHASE(MarkTemp)
@@ -298,6 +299,7 @@ PHASE(All)
 #endif
         PHASE(JITLoopBody)
         PHASE(JITLoopBodyInTryCatch)
+        PHASE(JITLoopBodyFromSimpleJit)
         PHASE(ReJIT)
         PHASE(ExecutionMode)
         PHASE(SimpleJitDynamicProfile)
@@ -450,6 +452,9 @@ PHASE(All)
 #define DEFAULT_CONFIG_RegexProfile         (false)
 #define DEFAULT_CONFIG_RegexDebug           (false)
 #define DEFAULT_CONFIG_RegexOptimize        (true)
+#define DEFAULT_CONFIG_RegexLazyDfa         (true)
+#define DEFAULT_CONFIG_RegexJit             (true)
+#define DEFAULT_CONFIG_RegexJitThreshold    (16)
 #define DEFAULT_CONFIG_DynamicRegexMruListSize (16)
 #define DEFAULT_CONFIG_GoptCleanupThreshold  (25)
 #define DEFAULT_CONFIG_AsmGoptCleanupThreshold  (500)
@@ -561,6 +566,9 @@ PHASE(All)
 #define DEFAULT_CONFIG_MinProfileIterations_OldSimpleJit (25)
 #define DEFAULT_CONFIG_MinSimpleJitIterations (16)
 #define DEFAULT_CONFIG_NewSimpleJit (false)
+#define DEFAULT_CONFIG_AdaptiveTiering (false)
+#define DEFAULT_CONFIG_AdaptiveTieringProfileIterations (4)
+#define DEFAULT_CONFIG_MegamorphicPropertyCache (true)
 
 #define DEFAULT_CONFIG_MaxLinearIntCaseCount     (3)       // Maximum number of cases (in switch statement) for which instructions can be generated linearly.
 #define DEFAULT_CONFIG_MaxSingleCharStrJumpTableRatio  (2)       // Maximum single char string jump table size as multiples of the actual case arm
@@ -595,6 +603,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_DisableDebugObject (false)
 #define DEFAULT_CONFIG_DumpHeap (false)
 #define DEFAULT_CONFIG_PerfHintLevel (1)
+#define DEFAULT_CONFIG_PerfMap (false)
 
 #define DEFAULT_CONFIG_FailFastIfDisconnectedDelegate    (false)
 
@@ -826,9 +835,10 @@ FLAGR (Boolean, DumpObjectGraphOnCollect, "Dump object graph on recycler destruc
 FLAGNR(Boolean, DumpEvalStringOnRemoval, "Dumps an eval string when its being removed from the eval map", false)
 FLAGNR(Boolean, DumpObjectGraphOnEnum, "Dump object graph on recycler heap enumeration", false)
 #ifdef DYNAMIC_PROFILE_STORAGE
-FLAGNRA(String, DynamicProfileCache   , Dpc, "File to cache dynamic profile information", nullptr)
-FLAGNR(String,  DynamicProfileCacheDir, "Directory to cache dynamic profile information", nullptr)
-FLAGNRA(String, DynamicProfileInput   , Dpi, "Read only file containing dynamic profile information", nullptr)
+FLAGRA(String, DynamicProfileCache    , Dpc, "File to cache dynamic profile information", nullptr)
+FLAGR(String,  DynamicProfileCacheDir , "Directory to cache dynamic profile information", nullptr)
+FLAGRA(String, DynamicProfileInput    , Dpi, "Read only file containing dynamic profile information", nullptr)
+FLAGR(Boolean, DynamicProfileStorageReport, "Report dynamic profile storage problems and the profiles loaded from it on stderr", false)
 #endif
 #ifdef EDIT_AND_CONTINUE
 FLAGNR(Boolean, EditTest              , "Enable edit and continue test tools", false)
@@ -848,6 +858,10 @@ FLAGR(Boolean, SkipSplitOnNoResult, "If the result of Regex split isn't used, sk
 #ifdef TEST_ETW_EVENTS
 FLAGNR(String,  TestEtwDll            , "Path of the TestEtwEventSink DLL", nullptr)
 #endif
+#ifdef ENABLE_PERF_MAP
+FLAGR (Boolean, PerfMap               , "Write a perf-<pid>.map file describing the address range of all generated code", DEFAULT_CONFIG_PerfMap)
+FLAGR (String,  PerfMapFile           , "Path of the perf map file (default: perf-<pid>.map in the temp directory)", nullptr)
+#endif
 
 // ES6 (BLUE-shipped) features/flags
 FLAGNR(Boolean, __proto__             , "__proto__ support", DEFAULT_CONFIG___proto__)
@@ -1039,8 +1053,8 @@ FLAGNR(Boolean, ForceOldDateAPI       , "Force Chakra to use old dates API regar
 FLAGNR(Number,  JitLoopBodyHotLoopThreshold    , "Number of times loop has to be iterated in jitloopbody before it is determined as hot", DEFAULT_CONFIG_JitLoopBodyHotLoopThreshold)
 FLAGNR(Number,  LoopBodySizeThresholdToDisableOpts, "Minimum bytecode size of a loop body, above which we might consider switching off optimizations in jit loop body to avoid rejits", DEFAULT_CONFIG_LoopBodySizeThresholdToDisableOpts)
 
-FLAGNR(Number,  MaxJitThreadCount     , "Number of maximum allowed parallel jit threads (actual number is factor of number of processors and other heuristics)", DEFAULT_CONFIG_MaxJitThreadCount)
-FLAGNR(Boolean, ForceMaxJitThreadCount, "Force the number of parallel jit threads as specified by MaxJitThreadCount flag (creation guaranteed)", DEFAULT_CONFIG_ForceMaxJitThreadCount)
+FLAGR (Number,  MaxJitThreadCount     , "Number of maximum allowed parallel jit threads (actual number is factor of number of processors and other heuristics)", DEFAULT_CONFIG_MaxJitThreadCount)
+FLAGR (Boolean, ForceMaxJitThreadCount, "Force the number of parallel jit threads as specified by MaxJitThreadCount flag (creation guaranteed)", DEFAULT_CONFIG_ForceMaxJitThreadCount)
 
 FLAGNR(Number,  MinInterpretCount     , "Minimum number of times a function must be interpreted", 0)
 FLAGNR(Number,  MinSimpleJitRunCount  , "Minimum number of times a function must be run in simple jit", 0)
@@ -1069,6 +1083,8 @@ FLAGR (Number,  ProfilingInterpreter1Limit, "Limit after which to transition to
 
 FLAGNRA(String, ExecutionModeLimits,        Eml,  "Execution mode limits in th form: AutoProfilingInterpreter0.ProfilingInterpreter0.AutoProfilingInterpreter1.SimpleJit.ProfilingInterpreter1 - Example: -ExecutionModeLimits:12.4.0.132.12", L"")
 FLAGRA(Boolean, EnforceExecutionModeLimits, Eeml, "Enforces the execution mode limits such that they are never exceeded.", false)
+FLAGR (Boolean, AdaptiveTiering, "Shorten the execution mode limits of hot functions while the full JIT queue is idle, and skip simple JIT for functions with a stable profile", DEFAULT_CONFIG_AdaptiveTiering)
+FLAGR (Number,  AdaptiveTieringProfileIterations, "Number of profiled iterations after which adaptive tiering considers a function hot", DEFAULT_CONFIG_AdaptiveTieringProfileIterations)
 
 FLAGNRA(Number, SimpleJitAfter        , Sja, "Number of calls to a function after which to simple-JIT the function", 0)
 FLAGNRA(Number, FullJitAfter          , Fja, "Number of calls to a function after which to full-JIT the function. The function will be profiled for every iteration.", 0)
@@ -1087,6 +1103,7 @@ FLAGNR(Number,  SkipFuncCountForBailOnNoProfile,  "Initial Number of functions i
 FLAGNR(Number,  MaxJITFunctionBytecodeSize, "The biggest function we'll JIT (bytecode size)", DEFAULT_CONFIG_MaxJITFunctionBytecodeSize)
 FLAGNR(Number,  MaxLoopsPerFunction   , "Maximum number of loops in any function in the script", DEFAULT_CONFIG_MaxLoopsPerFunction)
 FLAGNR(Number,  FuncObjectInlineCacheThreshold  , "Maximum number of inline caches a function body may have to allow for inline caches to be allocated on the function object", DEFAULT_CONFIG_FuncObjectInlineCacheThreshold)
+FLAGR (Boolean, MegamorphicPropertyCache, "Look up properties accessed by sites that overflow their polymorphic inline cache in a thread-wide (type, property) cache", DEFAULT_CONFIG_MegamorphicPropertyCache)
 FLAGNR(Boolean, NoDeferParse          , "Disable deferred parsing", false)
 FLAGNR(Boolean, NoLogo                , "No logo, which we don't display anyways", false)
 #ifdef _ARM64_
@@ -1262,6 +1279,9 @@ FLAGR (Boolean, RegexTracing          , "Trace all Regex invocations to the outp
 FLAGR (Boolean, RegexProfile          , "Collect usage statistics on all Regex invocations.", DEFAULT_CONFIG_RegexProfile)
 FLAGR (Boolean, RegexDebug            , "Trace compilation of UnifiedRegex expressions.", DEFAULT_CONFIG_RegexDebug)
 FLAGR (Boolean, RegexOptimize         , "Optimize regular expressions in the unified Regex system (default: true)", DEFAULT_CONFIG_RegexOptimize)
+FLAGR (Boolean, RegexLazyDfa          , "Match backtracking-free regular expressions with a lazily built DFA (default: true)", DEFAULT_CONFIG_RegexLazyDfa)
+FLAGR (Boolean, RegexJit              , "Compile regular expressions which never backtrack to machine code once they are hot (default: true)", DEFAULT_CONFIG_RegexJit)
+FLAGR (Number,  RegexJitThreshold     , "Number of matches a regular expression runs in the interpreter before it is compiled to machine code", DEFAULT_CONFIG_RegexJitThreshold)
 FLAGR (Number,  DynamicRegexMruListSize, "Size of the MRU list for dynamic regexes", DEFAULT_CONFIG_DynamicRegexMruListSize)
 #endif
 
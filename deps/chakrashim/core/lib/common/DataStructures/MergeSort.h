@@ -0,0 +1,343 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace JsUtil
+{
+    // Stable, adaptive merge sort in the manner of TimSort. Ascending and strictly descending runs which are already in
+    // the input are kept as they are, shorter runs are extended with binary insertion, and runs are merged through a
+    // scratch buffer of at most half the length. The pending runs are kept on a stack whose lengths grow at least as fast
+    // as the Fibonacci numbers, so merges stay balanced.
+    //
+    // TComparer::Compare(a, b) returns a negative value if a sorts before b. It may throw: elements are only moved between
+    // the array and the scratch buffer, and a merge which is interrupted copies back the elements it took out, so the
+    // array always holds a permutation of its original contents. T must be copyable with memcpy.
+    template <class T, class TComparer>
+    class MergeSort
+    {
+    public:
+        // Arrays shorter than this are sorted with binary insertion alone and need no scratch buffer
+        static const uint32 MinMerge = 32;
+
+        static uint32 GetScratchLength(const uint32 length)
+        {
+            return length < MinMerge ? 0 : length / 2;
+        }
+
+        static void Sort(__inout_ecount(length) T* const elements, const uint32 length, __inout_ecount_opt(GetScratchLength(length)) T* const scratch, TComparer& comparer)
+        {
+            if (length < 2)
+            {
+                return;
+            }
+
+            if (length < MinMerge)
+            {
+                const uint32 runLength = CountRunAndMakeAscending(elements, length, comparer);
+                BinaryInsertionSort(elements, length, runLength, comparer);
+                return;
+            }
+
+            Assert(scratch != nullptr);
+
+            Run runs[MaxRuns];
+            uint32 runCount = 0;
+            const uint32 minRunLength = GetMinRunLength(length);
+            uint32 start = 0;
+            while (start < length)
+            {
+                const uint32 remaining = length - start;
+                uint32 runLength = CountRunAndMakeAscending(elements + start, remaining, comparer);
+                if (runLength < minRunLength)
+                {
+                    const uint32 extendedLength = min(minRunLength, remaining);
+                    BinaryInsertionSort(elements + start, extendedLength, runLength, comparer);
+                    runLength = extendedLength;
+                }
+
+                AnalysisAssert(runCount < MaxRuns);
+                runs[runCount].start = start;
+                runs[runCount].length = runLength;
+                runCount++;
+                start += runLength;
+
+                MergeCollapse(elements, scratch, runs, runCount, comparer);
+            }
+
+            while (runCount > 1)
+            {
+                uint32 i = runCount - 2;
+                if (i > 0 && runs[i - 1].length < runs[i + 1].length)
+                {
+                    i--;
+                }
+                MergeAt(elements, scratch, runs, runCount, i, comparer);
+            }
+        }
+
+    private:
+        // Enough for 2^32 elements given the invariant on run lengths
+        static const uint32 MaxRuns = 49;
+
+        struct Run
+        {
+            uint32 start;
+            uint32 length;
+        };
+
+        // The elements taken out of the array into the scratch buffer by a merge, and the hole they go back to. The
+        // destructor puts back what the merge has not placed yet, whether it finished or a comparison threw.
+        struct MergeLoState
+        {
+            T* destination;
+            T* taken;
+            uint32 takenCount;
+
+            ~MergeLoState()
+            {
+                if (takenCount != 0)
+                {
+                    js_memcpy_s(destination, takenCount * sizeof(T), taken, takenCount * sizeof(T));
+                }
+            }
+        };
+
+        struct MergeHiState
+        {
+            T* destinationEnd;
+            T* takenEnd;
+            uint32 takenCount;
+
+            ~MergeHiState()
+            {
+                if (takenCount != 0)
+                {
+                    js_memcpy_s(destinationEnd - takenCount, takenCount * sizeof(T), takenEnd - takenCount, takenCount * sizeof(T));
+                }
+            }
+        };
+
+        static uint32 GetMinRunLength(uint32 length)
+        {
+            // A length between MinMerge / 2 and MinMerge such that length / minRunLength is a power of two or just below one
+            uint32 roundUp = 0;
+            while (length >= MinMerge)
+            {
+                roundUp |= length & 1;
+                length >>= 1;
+            }
+            return length + roundUp;
+        }
+
+        static uint32 CountRunAndMakeAscending(T* const elements, const uint32 length, TComparer& comparer)
+        {
+            Assert(length != 0);
+            if (length == 1)
+            {
+                return 1;
+            }
+
+            uint32 end = 2;
+            if (comparer.Compare(elements[1], elements[0]) < 0)
+            {
+                // Only strictly descending runs are reversed, which keeps equal elements in order
+                while (end < length && comparer.Compare(elements[end], elements[end - 1]) < 0)
+                {
+                    end++;
+                }
+                Reverse(elements, end);
+            }
+            else
+            {
+                while (end < length && comparer.Compare(elements[end], elements[end - 1]) >= 0)
+                {
+                    end++;
+                }
+            }
+            return end;
+        }
+
+        static void Reverse(T* const elements, const uint32 length)
+        {
+            for (uint32 low = 0, high = length - 1; low < high; low++, high--)
+            {
+                const T element = elements[low];
+                elements[low] = elements[high];
+                elements[high] = element;
+            }
+        }
+
+        // Sorts elements given that the first sortedLength of them are sorted already
+        static void BinaryInsertionSort(T* const elements, const uint32 length, const uint32 sortedLength, TComparer& comparer)
+        {
+            for (uint32 i = sortedLength; i < length; i++)
+            {
+                // Insert after the last element that is not greater, so equal elements stay in order
+                const uint32 position = UpperBound(elements[i], elements, i, comparer);
+                if (position != i)
+                {
+                    const T element = elements[i];
+                    memmove(elements + position + 1, elements + position, (i - position) * sizeof(T));
+                    elements[position] = element;
+                }
+            }
+        }
+
+        // Index of the first element greater than key
+        static uint32 UpperBound(const T& key, const T* const elements, const uint32 length, TComparer& comparer)
+        {
+            uint32 low = 0;
+            uint32 high = length;
+            while (low < high)
+            {
+                const uint32 middle = low + (high - low) / 2;
+                if (comparer.Compare(key, elements[middle]) < 0)
+                {
+                    high = middle;
+                }
+                else
+                {
+                    low = middle + 1;
+                }
+            }
+            return low;
+        }
+
+        // Index of the first element not less than key
+        static uint32 LowerBound(const T& key, const T* const elements, const uint32 length, TComparer& comparer)
+        {
+            uint32 low = 0;
+            uint32 high = length;
+            while (low < high)
+            {
+                const uint32 middle = low + (high - low) / 2;
+                if (comparer.Compare(elements[middle], key) < 0)
+                {
+                    low = middle + 1;
+                }
+                else
+                {
+                    high = middle;
+                }
+            }
+            return low;
+        }
+
+        static void MergeCollapse(T* const elements, T* const scratch, Run* const runs, uint32& runCount, TComparer& comparer)
+        {
+            while (runCount > 1)
+            {
+                uint32 i = runCount - 2;
+                if ((i > 0 && runs[i - 1].length <= runs[i].length + runs[i + 1].length) ||
+                    (i > 1 && runs[i - 2].length <= runs[i - 1].length + runs[i].length))
+                {
+                    if (runs[i - 1].length < runs[i + 1].length)
+                    {
+                        i--;
+                    }
+                }
+                else if (runs[i].length > runs[i + 1].length)
+                {
+                    break;
+                }
+                MergeAt(elements, scratch, runs, runCount, i, comparer);
+            }
+        }
+
+        // Merges runs i and i + 1
+        static void MergeAt(T* const elements, T* const scratch, Run* const runs, uint32& runCount, const uint32 i, TComparer& comparer)
+        {
+            Assert(i + 1 < runCount);
+
+            T* left = elements + runs[i].start;
+            uint32 leftLength = runs[i].length;
+            T* const right = elements + runs[i + 1].start;
+            uint32 rightLength = runs[i + 1].length;
+            Assert(left + leftLength == right);
+
+            runs[i].length += rightLength;
+            if (i + 2 < runCount)
+            {
+                runs[i + 1] = runs[i + 2];
+            }
+            runCount--;
+
+            // Elements of the left run which are not greater than the first of the right run are in place already, as are
+            // elements of the right run which are not less than the last of the left run
+            const uint32 leftInPlace = UpperBound(right[0], left, leftLength, comparer);
+            left += leftInPlace;
+            leftLength -= leftInPlace;
+            if (leftLength == 0)
+            {
+                return;
+            }
+            rightLength = LowerBound(left[leftLength - 1], right, rightLength, comparer);
+            if (rightLength == 0)
+            {
+                return;
+            }
+
+            if (leftLength <= rightLength)
+            {
+                MergeLo(left, leftLength, right, rightLength, scratch, comparer);
+            }
+            else
+            {
+                MergeHi(left, leftLength, right, rightLength, scratch, comparer);
+            }
+        }
+
+        // Merges front to back, taking the left run out into the scratch buffer
+        static void MergeLo(T* const left, const uint32 leftLength, T* const right, const uint32 rightLength, T* const scratch, TComparer& comparer)
+        {
+            js_memcpy_s(scratch, leftLength * sizeof(T), left, leftLength * sizeof(T));
+
+            MergeLoState state;
+            state.destination = left;
+            state.taken = scratch;
+            state.takenCount = leftLength;
+
+            const T* next = right;
+            const T* const end = right + rightLength;
+            while (state.takenCount != 0 && next != end)
+            {
+                if (comparer.Compare(*next, *state.taken) < 0)
+                {
+                    *state.destination++ = *next++;
+                }
+                else
+                {
+                    *state.destination++ = *state.taken++;
+                    state.takenCount--;
+                }
+            }
+        }
+
+        // Merges back to front, taking the right run out into the scratch buffer
+        static void MergeHi(T* const left, const uint32 leftLength, T* const right, const uint32 rightLength, T* const scratch, TComparer& comparer)
+        {
+            js_memcpy_s(scratch, rightLength * sizeof(T), right, rightLength * sizeof(T));
+
+            MergeHiState state;
+            state.destinationEnd = right + rightLength;
+            state.takenEnd = scratch + rightLength;
+            state.takenCount = rightLength;
+
+            const T* next = left + leftLength;
+            while (state.takenCount != 0 && next != left)
+            {
+                if (comparer.Compare(state.takenEnd[-1], next[-1]) < 0)
+                {
+                    *--state.destinationEnd = *--next;
+                }
+                else
+                {
+                    *--state.destinationEnd = *--state.takenEnd;
+                    state.takenCount--;
+                }
+            }
+        }
+    };
+}
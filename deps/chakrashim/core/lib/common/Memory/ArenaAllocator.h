@@ -548,7 +548,7 @@ public:
 
 #define InlineCacheAuxSlotTypeTag 4
 #define MinPolymorphicInlineCacheSize 4
-#define MaxPolymorphicInlineCacheSize 32
+#define MaxPolymorphicInlineCacheSize 64
 
 #ifdef PERSISTENT_INLINE_CACHES
 
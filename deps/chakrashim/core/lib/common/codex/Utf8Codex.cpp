@@ -465,6 +465,68 @@ LSlowPath:
 
 
 
+    size_t EncodeTrueUtf8Into(__out_ecount_opt(cbBuffer) LPUTF8 buffer, size_t cbBuffer, __in_ecount(cch) const wchar_t *source, charcount_t cch, __out charcount_t *cchEncoded)
+    {
+        const wchar_t *const start = source;
+        const wchar_t *const end = source + cch;
+        const bool measureOnly = buffer == nullptr;
+        size_t cb = 0;
+
+        while (source < end)
+        {
+            // Runs of ASCII characters are the common case
+            wchar_t ch = *source;
+            if (ch < 0x80)
+            {
+                if (!measureOnly)
+                {
+                    if (cb == cbBuffer) break;
+                    buffer[cb] = static_cast<utf8char_t>(ch);
+                }
+                cb++;
+                source++;
+                continue;
+            }
+
+            size_t cbChar = EncodedSize(ch);
+            charcount_t cchChar = 1;
+            if (IsHighSurrogateChar(ch) && source + 1 < end && IsLowSurrogateChar(source[1]))
+            {
+                cbChar = 4;
+                cchChar = 2;
+            }
+            else if (InRange(ch, WCH_UTF16_HIGH_FIRST, WCH_UTF16_LOW_LAST))
+            {
+                ch = g_chUnknown;
+            }
+
+            if (!measureOnly)
+            {
+                if (cbBuffer - cb < cbChar) break;
+
+                LPUTF8 dest = buffer + cb;
+                if (cchChar == 2)
+                {
+                    // Four bytes : 11110uuu 10uuzzzz 10yyyyyy 10xxxxxx
+                    const uint32 codePoint = 0x10000 + ((static_cast<uint32>(ch) - WCH_UTF16_HIGH_FIRST) << 10) + (source[1] - WCH_UTF16_LOW_FIRST);
+                    dest[0] = static_cast<utf8char_t>(codePoint >> 18) | 0xF0;
+                    dest[1] = static_cast<utf8char_t>((codePoint >> 12) & 0x3F) | 0x80;
+                    dest[2] = static_cast<utf8char_t>((codePoint >> 6) & 0x3F) | 0x80;
+                    dest[3] = static_cast<utf8char_t>(codePoint & 0x3F) | 0x80;
+                }
+                else
+                {
+                    EncodeFull(ch, dest);
+                }
+            }
+            cb += cbChar;
+            source += cchChar;
+        }
+
+        *cchEncoded = static_cast<charcount_t>(source - start);
+        return cb;
+    }
+
     // Convert the character index into a byte index.
     size_t CharacterIndexToByteIndex(__in_ecount(cbLength) LPCUTF8 pch, size_t cbLength, charcount_t cchIndex, DecodeOptions options)
     {
@@ -193,6 +193,13 @@ namespace utf8
     __range(0, cch * 3)
     size_t EncodeIntoAndNullTerminate(__out_ecount(cch * 3 + 1) utf8char_t *buffer, __in_ecount(cch) const wchar_t *source, charcount_t cch);
 
+    // Encode a UTF16-LE sequence of cch words into valid UTF-8: a surrogate pair is encoded as the four byte sequence of
+    // its code point and an unpaired surrogate as U+FFFD. Only whole characters are written, as many as fit in the cbBuffer
+    // bytes of buffer, and cchEncoded receives the number of words they take up. If buffer is null nothing is written and
+    // the whole sequence is measured.
+    // Returns the number of bytes written or measured.
+    size_t EncodeTrueUtf8Into(__out_ecount_opt(cbBuffer) LPUTF8 buffer, size_t cbBuffer, __in_ecount(cch) const wchar_t *source, charcount_t cch, __out charcount_t *cchEncoded);
+
     // Returns true if the pch refers to a UTF-16LE encoding of the given UTF-8 encoding bch.
     bool CharsAreEqual(__in_ecount(cch) LPCOLESTR pch, LPCUTF8 bch, size_t cch, DecodeOptions options = doDefault);
 
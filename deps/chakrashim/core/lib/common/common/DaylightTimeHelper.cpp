@@ -91,6 +91,68 @@ namespace Js {
         lastUpdateTickCount = GetTickCount();
     }
 
+    // Empty until the first fast conversion
+    DaylightTimeHelper::OffsetInterval::OffsetInterval()
+    {
+        start = 1;
+        end = 0;
+    }
+
+    // Like the time zone information it was taken from, the interval is only used for a second after it was found
+    bool DaylightTimeHelper::OffsetInterval::IsValid(double time)
+    {
+        return GetTickCount() - lastUpdateTickCount < updatePeriod && time >= start && time < end;
+    }
+
+    // Called with a time which is not critical for the time zone information of its year. The interval around it stops
+    // where the critical periods begin; these include the daylight savings time switches, so the fast conversion uses
+    // the same biases for the whole interval.
+    void DaylightTimeHelper::OffsetInterval::Update(double time, TimeZoneInfo *timeZoneInfo)
+    {
+        start = 1;
+        end = 0;
+
+        // Near the limits of the years Windows has time zone information for, times are critical regardless of
+        // the periods below
+        if (timeZoneInfo->january1 <= criticalMin || timeZoneInfo->nextJanuary1 >= criticalMax)
+        {
+            return;
+        }
+
+        double lower = timeZoneInfo->january1;
+        double upper = min(timeZoneInfo->nextJanuary1, timeZoneInfo->january1 + TicksPerSafeEndOfYear);
+        if (timeZoneInfo->isJanuary1Critical)
+        {
+            lower = timeZoneInfo->january1 + TicksPerlargestTZOffset;
+        }
+
+        const double switchDates[] = { timeZoneInfo->daylightDate, timeZoneInfo->standardDate };
+        for (size_t i = 0; i < _countof(switchDates); i++)
+        {
+            if (time <= switchDates[i] - TicksPerlargestTZOffset)
+            {
+                upper = min(upper, switchDates[i] - TicksPerlargestTZOffset);
+            }
+            else
+            {
+                Assert(time >= switchDates[i] + TicksPerlargestTZOffset);
+                lower = max(lower, switchDates[i] + TicksPerlargestTZOffset);
+            }
+        }
+
+        if (time < lower || time >= upper)
+        {
+            return;
+        }
+
+        start = lower;
+        end = upper;
+        bias = timeZoneInfo->bias;
+        isDaylightSavings = IsDaylightSavingsUnsafe(time, timeZoneInfo);
+        daylightOrStandardBias = isDaylightSavings ? timeZoneInfo->daylightBias : timeZoneInfo->standardBias;
+        lastUpdateTickCount = timeZoneInfo->lastUpdateTickCount;
+    }
+
     DaylightTimeHelper::TimeZoneInfo* DaylightTimeHelper::GetTimeZoneInfo(double time)
     {
         if (cache1.IsValid(time)) return &cache1;
@@ -266,6 +328,20 @@ namespace Js {
         return localTime;
     }
 
+    // Same arithmetic as above, with the biases found for the interval the time is in
+    double DaylightTimeHelper::UtcToLocalFast(double utcTime, OffsetInterval *offsetInterval, int &bias, int &offset, bool &isDaylightSavings)
+    {
+        double localTime;
+        localTime = utcTime - TicksPerMinute * offsetInterval->bias;
+        localTime -= TicksPerMinute * offsetInterval->daylightOrStandardBias;
+        isDaylightSavings = offsetInterval->isDaylightSavings;
+
+        bias = offsetInterval->bias;
+        offset = ((int)(localTime - utcTime)) / ((int)(TicksPerMinute));
+
+        return localTime;
+    }
+
     double DaylightTimeHelper::UtcToLocalCritical(double utcTime, TimeZoneInfo *timeZoneInfo, int &bias, int &offset, bool &isDaylightSavings)
     {
         double localTime;
@@ -297,6 +373,11 @@ namespace Js {
 
     double DaylightTimeHelper::UtcToLocal(double utcTime, int &bias, int &offset, bool &isDaylightSavings)
     {
+        if (utcToLocalInterval.IsValid(utcTime))
+        {
+            return UtcToLocalFast(utcTime, &utcToLocalInterval, bias, offset, isDaylightSavings);
+        }
+
         TimeZoneInfo *timeZoneInfo = GetTimeZoneInfo(utcTime);
 
         if (IsCritical(utcTime, timeZoneInfo))
@@ -305,6 +386,7 @@ namespace Js {
         }
         else
         {
+            utcToLocalInterval.Update(utcTime, timeZoneInfo);
             return UtcToLocalFast(utcTime, timeZoneInfo, bias, offset, isDaylightSavings);
         }
     }
@@ -325,6 +407,14 @@ namespace Js {
         return utcTime;
     }
 
+    double DaylightTimeHelper::LocalToUtcFast(double localTime, OffsetInterval *offsetInterval)
+    {
+        double utcTime = localTime + TicksPerMinute * offsetInterval->bias;
+        utcTime += TicksPerMinute * offsetInterval->daylightOrStandardBias;
+
+        return utcTime;
+    }
+
     double DaylightTimeHelper::LocalToUtcCritical(double localTime, TimeZoneInfo *timeZoneInfo)
     {
         SYSTEMTIME localSystem, utcSystem;
@@ -344,6 +434,11 @@ namespace Js {
 
     double DaylightTimeHelper::LocalToUtc(double localTime)
     {
+        if (localToUtcInterval.IsValid(localTime))
+        {
+            return LocalToUtcFast(localTime, &localToUtcInterval);
+        }
+
         TimeZoneInfo *timeZoneInfo = GetTimeZoneInfo(localTime);
 
         if (IsCritical(localTime, timeZoneInfo))
@@ -352,6 +447,7 @@ namespace Js {
         }
         else
         {
+            localToUtcInterval.Update(localTime, timeZoneInfo);
             return LocalToUtcFast(localTime, timeZoneInfo);
         }
     }
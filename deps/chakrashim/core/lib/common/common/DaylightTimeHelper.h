@@ -42,6 +42,25 @@ namespace Js {
         TimeZoneInfo cache1, cache2;
         bool useFirstCache;
 
+        // Between the critical periods of a year the offset between UTC and local time only depends on which side of
+        // the daylight savings time switches a time is. The last offset found by the fast conversion in each direction
+        // is kept with the interval of times around it which convert with the same offset, so converting times close
+        // to each other takes a range check and the arithmetic of the fast conversion.
+        class OffsetInterval
+        {
+        public:
+            double start;
+            double end;
+            LONG bias;
+            LONG daylightOrStandardBias;
+            uint lastUpdateTickCount;
+            bool isDaylightSavings;
+            OffsetInterval();
+            bool IsValid(double time);
+            void Update(double time, TimeZoneInfo *timeZoneInfo);
+        };
+        OffsetInterval utcToLocalInterval, localToUtcInterval;
+
         static HINSTANCE TryLoadLibrary();
 
         static BOOL SysLocalToUtc(SYSTEMTIME *local, SYSTEMTIME *utc);
@@ -67,6 +86,8 @@ namespace Js {
         static inline double UtcToLocalFast(double utcTime, TimeZoneInfo *timeZoneInfo, int &bias, int &offset, bool &isDaylightSavings);
                inline double UtcToLocalCritical(double utcTime, TimeZoneInfo *timeZoneInfo, int &bias, int &offset, bool &isDaylightSavings);
         static inline double LocalToUtcFast(double localTime, TimeZoneInfo *timeZoneInfo);
+        static inline double UtcToLocalFast(double utcTime, OffsetInterval *offsetInterval, int &bias, int &offset, bool &isDaylightSavings);
+        static inline double LocalToUtcFast(double localTime, OffsetInterval *offsetInterval);
         static inline double LocalToUtcCritical(double localTime, TimeZoneInfo *timeZoneInfo);
     };
 } // namespace Js
@@ -107,6 +107,11 @@ namespace JsUtil
     {
     }
 
+    uint JobManager::GetJobPriority(JsUtil::Job *const job) const
+    {
+        return 0;
+    }
+
     void JobManager::OnDecommit(ParallelThreadData *threadData)
     {
     }
@@ -165,6 +165,11 @@ namespace JsUtil
         //     may need to use the job object, in which case it's necessary to ensure that the job won't be deleted during that
         //     time, and hence the existence of this function and why it's called inside the lock.
         //
+        // uint GetJobPriority(JsUtil::Job *const job) const;
+        //     Called by the BackgroundJobProcessor in response to PrioritizeJob (inside the lock), when the job to prioritize is
+        //     already queued. The job is moved to the front of the queue, but stays behind the job manager's jobs at the front
+        //     that have a higher priority, so that the background threads pick up the job manager's most important jobs first.
+        //
         // void BeforeWaitForJob(Js::FunctionBody *const functionBody) const;
         // void AfterWaitForJob(Js::FunctionBody *const functionBody) const;
         //     Called in response to PrioritizeJobAndWait (outside the lock), before and after waiting for the prioritized job
@@ -176,6 +181,7 @@ namespace JsUtil
         bool ShouldProcessInForeground(const bool willWaitForJob, const unsigned int numJobsInQueue) const;
         void Prioritize(JsUtil::Job *const job, const bool forceAddJobToProcessor = false, void* function = nullptr) const;
         void PrioritizedButNotYetProcessed(JsUtil::Job *const job) const;
+        uint GetJobPriority(JsUtil::Job *const job) const;
         void BeforeWaitForJob(bool) const;
         void AfterWaitForJob(bool) const;
     };
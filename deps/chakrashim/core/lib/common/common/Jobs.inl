@@ -342,7 +342,17 @@ namespace JsUtil
             bool forcedInThread = (threadService->HasCallback() && this->parallelThreadData[0]->isWaitingForJobs);
             if (!forcedInThread && !manager->ShouldProcessInForeground(false, numJobs))
             {
-                jobs.MoveToBeginning(job);
+                const uint priority = manager->GetJobPriority(job);
+                Job *nextJob = jobs.Head();
+                while(nextJob != job && nextJob->Manager() == manager && manager->GetJobPriority(nextJob) > priority)
+                {
+                    nextJob = nextJob->Next();
+                }
+                if(nextJob != job)
+                {
+                    jobs.Unlink(job);
+                    jobs.LinkBefore(job, nextJob);
+                }
                 manager->PrioritizedButNotYetProcessed(job);
                 return false;
             }
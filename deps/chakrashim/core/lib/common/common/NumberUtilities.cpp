@@ -281,6 +281,42 @@ namespace Js
         return true;
     }
 
+    bool NumberUtilities::TryParseEightDecimalDigits(__in_ecount(8) const wchar_t* str, uint32* value)
+    {
+#if defined(_M_IX86) || defined(_M_X64)
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str));
+            const __m128i digits = _mm_sub_epi16(chars, _mm_set1_epi16(L'0'));
+
+            // SSE2 only compares signed words, so flip the sign bit to get an unsigned digit > 9
+            const __m128i signBit = _mm_set1_epi16((short)0x8000);
+            const __m128i notDigits = _mm_cmpgt_epi16(_mm_xor_si128(digits, signBit), _mm_set1_epi16((short)(0x8000 | 9)));
+            if (_mm_movemask_epi8(notDigits) != 0)
+            {
+                return false;
+            }
+
+            // Combine neighboring digits into four two-digit numbers, and those into two four-digit numbers
+            const __m128i pairs = _mm_madd_epi16(digits, _mm_setr_epi16(10, 1, 10, 1, 10, 1, 10, 1));
+            const __m128i quads = _mm_madd_epi16(_mm_packs_epi32(pairs, pairs), _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+            *value = (uint32)_mm_cvtsi128_si32(quads) * 10000 + (uint32)_mm_cvtsi128_si32(_mm_srli_si128(quads, 4));
+            return true;
+        }
+#endif
+        uint32 val = 0;
+        for (int i = 0; i < 8; i++)
+        {
+            if (str[i] < L'0' || str[i] > L'9')
+            {
+                return false;
+            }
+            val = val * 10 + (uint32)(str[i] - L'0');
+        }
+        *value = val;
+        return true;
+    }
+
     double NumberUtilities::Modulus(double dblLeft, double dblRight)
     {
         double value = 0;
@@ -68,6 +68,9 @@ namespace Js
         // Try to parse an integer string to find out if the string contains an index property name.
         static BOOL TryConvertToUInt32(const wchar_t* str, int length, uint32* intVal);
 
+        // Parse the eight characters at str if they are all decimal digits
+        static bool TryParseEightDecimalDigits(__in_ecount(8) const wchar_t* str, uint32* value);
+
         static double Modulus(double dblLeft, double dblRight);
 
         enum FormatType
@@ -889,6 +889,287 @@ LFail:
 }
 
 
+/***************************************************************************
+Numbers with a 64 bit significand, used by the conversions below that get
+by without big number arithmetic.
+***************************************************************************/
+
+// f * 2^wExp2
+struct DIYFP
+{
+    uint64 f;
+    int wExp2;
+
+    void Normalize(void)
+    {
+        Assert(f != 0);
+        while (0 == (f & 0xFFC0000000000000ull))
+        {
+            f <<= 10;
+            wExp2 -= 10;
+        }
+        while (0 == (f & 0x8000000000000000ull))
+        {
+            f <<= 1;
+            wExp2--;
+        }
+    }
+
+    // The product rounded to 64 bits.
+    DIYFP Mul(const DIYFP &diy) const
+    {
+        const uint64 kluMask = 0xFFFFFFFF;
+        uint64 luA = f >> 32, luB = f & kluMask;
+        uint64 luC = diy.f >> 32, luD = diy.f & kluMask;
+        uint64 luAC = luA * luC, luBC = luB * luC, luAD = luA * luD, luBD = luB * luD;
+        uint64 luMid = (luBD >> 32) + (luAD & kluMask) + (luBC & kluMask) + 0x80000000;
+
+        DIYFP diyRes;
+        diyRes.f = luAC + (luAD >> 32) + (luBC >> 32) + (luMid >> 32);
+        diyRes.wExp2 = wExp2 + diy.wExp2 + 64;
+        return diyRes;
+    }
+};
+
+// Normalized approximations of 10^wExp10 for every eighth power of ten
+// that a double may need, rounded to 64 bits. The error is at most half a
+// unit in the last place.
+struct CACHEDPOWER
+{
+    uint64 f;
+    short wExp2;
+    short wExp10;
+};
+
+static const int kwCachedPowerMinExp10 = -348;
+static const int kwCachedPowerExp10Step = 8;
+static const CACHEDPOWER g_rgcpTens[] =
+{
+    { 0xFA8FD5A0081C0288ull, -1220, -348 },
+    { 0xBAAEE17FA23EBF76ull, -1193, -340 },
+    { 0x8B16FB203055AC76ull, -1166, -332 },
+    { 0xCF42894A5DCE35EAull, -1140, -324 },
+    { 0x9A6BB0AA55653B2Dull, -1113, -316 },
+    { 0xE61ACF033D1A45DFull, -1087, -308 },
+    { 0xAB70FE17C79AC6CAull, -1060, -300 },
+    { 0xFF77B1FCBEBCDC4Full, -1034, -292 },
+    { 0xBE5691EF416BD60Cull, -1007, -284 },
+    { 0x8DD01FAD907FFC3Cull,  -980, -276 },
+    { 0xD3515C2831559A83ull,  -954, -268 },
+    { 0x9D71AC8FADA6C9B5ull,  -927, -260 },
+    { 0xEA9C227723EE8BCBull,  -901, -252 },
+    { 0xAECC49914078536Dull,  -874, -244 },
+    { 0x823C12795DB6CE57ull,  -847, -236 },
+    { 0xC21094364DFB5637ull,  -821, -228 },
+    { 0x9096EA6F3848984Full,  -794, -220 },
+    { 0xD77485CB25823AC7ull,  -768, -212 },
+    { 0xA086CFCD97BF97F4ull,  -741, -204 },
+    { 0xEF340A98172AACE5ull,  -715, -196 },
+    { 0xB23867FB2A35B28Eull,  -688, -188 },
+    { 0x84C8D4DFD2C63F3Bull,  -661, -180 },
+    { 0xC5DD44271AD3CDBAull,  -635, -172 },
+    { 0x936B9FCEBB25C996ull,  -608, -164 },
+    { 0xDBAC6C247D62A584ull,  -582, -156 },
+    { 0xA3AB66580D5FDAF6ull,  -555, -148 },
+    { 0xF3E2F893DEC3F126ull,  -529, -140 },
+    { 0xB5B5ADA8AAFF80B8ull,  -502, -132 },
+    { 0x87625F056C7C4A8Bull,  -475, -124 },
+    { 0xC9BCFF6034C13053ull,  -449, -116 },
+    { 0x964E858C91BA2655ull,  -422, -108 },
+    { 0xDFF9772470297EBDull,  -396, -100 },
+    { 0xA6DFBD9FB8E5B88Full,  -369,  -92 },
+    { 0xF8A95FCF88747D94ull,  -343,  -84 },
+    { 0xB94470938FA89BCFull,  -316,  -76 },
+    { 0x8A08F0F8BF0F156Bull,  -289,  -68 },
+    { 0xCDB02555653131B6ull,  -263,  -60 },
+    { 0x993FE2C6D07B7FACull,  -236,  -52 },
+    { 0xE45C10C42A2B3B06ull,  -210,  -44 },
+    { 0xAA242499697392D3ull,  -183,  -36 },
+    { 0xFD87B5F28300CA0Eull,  -157,  -28 },
+    { 0xBCE5086492111AEBull,  -130,  -20 },
+    { 0x8CBCCC096F5088CCull,  -103,  -12 },
+    { 0xD1B71758E219652Cull,   -77,   -4 },
+    { 0x9C40000000000000ull,   -50,    4 },
+    { 0xE8D4A51000000000ull,   -24,   12 },
+    { 0xAD78EBC5AC620000ull,     3,   20 },
+    { 0x813F3978F8940984ull,    30,   28 },
+    { 0xC097CE7BC90715B3ull,    56,   36 },
+    { 0x8F7E32CE7BEA5C70ull,    83,   44 },
+    { 0xD5D238A4ABE98068ull,   109,   52 },
+    { 0x9F4F2726179A2245ull,   136,   60 },
+    { 0xED63A231D4C4FB27ull,   162,   68 },
+    { 0xB0DE65388CC8ADA8ull,   189,   76 },
+    { 0x83C7088E1AAB65DBull,   216,   84 },
+    { 0xC45D1DF942711D9Aull,   242,   92 },
+    { 0x924D692CA61BE758ull,   269,  100 },
+    { 0xDA01EE641A708DEAull,   295,  108 },
+    { 0xA26DA3999AEF774Aull,   322,  116 },
+    { 0xF209787BB47D6B85ull,   348,  124 },
+    { 0xB454E4A179DD1877ull,   375,  132 },
+    { 0x865B86925B9BC5C2ull,   402,  140 },
+    { 0xC83553C5C8965D3Dull,   428,  148 },
+    { 0x952AB45CFA97A0B3ull,   455,  156 },
+    { 0xDE469FBD99A05FE3ull,   481,  164 },
+    { 0xA59BC234DB398C25ull,   508,  172 },
+    { 0xF6C69A72A3989F5Cull,   534,  180 },
+    { 0xB7DCBF5354E9BECEull,   561,  188 },
+    { 0x88FCF317F22241E2ull,   588,  196 },
+    { 0xCC20CE9BD35C78A5ull,   614,  204 },
+    { 0x98165AF37B2153DFull,   641,  212 },
+    { 0xE2A0B5DC971F303Aull,   667,  220 },
+    { 0xA8D9D1535CE3B396ull,   694,  228 },
+    { 0xFB9B7CD9A4A7443Cull,   720,  236 },
+    { 0xBB764C4CA7A44410ull,   747,  244 },
+    { 0x8BAB8EEFB6409C1Aull,   774,  252 },
+    { 0xD01FEF10A657842Cull,   800,  260 },
+    { 0x9B10A4E5E9913129ull,   827,  268 },
+    { 0xE7109BFBA19C0C9Dull,   853,  276 },
+    { 0xAC2820D9623BF429ull,   880,  284 },
+    { 0x80444B5E7AA7CF85ull,   907,  292 },
+    { 0xBF21E44003ACDD2Dull,   933,  300 },
+    { 0x8E679C2F5E44FF8Full,   960,  308 },
+    { 0xD433179D9C8CB841ull,   986,  316 },
+    { 0x9E19DB92B4E31BA9ull,  1013,  324 },
+    { 0xEB96BF6EBADF77D9ull,  1039,  332 },
+    { 0xAF87023B9BF0EE6Bull,  1066,  340 },
+};
+
+// The powers of ten that cached powers are adjusted by, all exact.
+static const DIYFP g_rgdiyTensAdj[] =
+{
+    { 0xA000000000000000ull, -60 },
+    { 0xC800000000000000ull, -57 },
+    { 0xFA00000000000000ull, -54 },
+    { 0x9C40000000000000ull, -50 },
+    { 0xC350000000000000ull, -47 },
+    { 0xF424000000000000ull, -44 },
+    { 0x9896800000000000ull, -40 },
+};
+
+static const long kcchMaxUint64Dig = 19;   // Digits that always fit in 64 bits
+
+/***************************************************************************
+Decimal to double using 64 bit arithmetic, from Loitsch's double-conversion
+library. luMan is the cchDig digit mantissa and the result is
+luMan * 10^lwExp10. The product of luMan and a cached power of ten is
+accurate to a few units in the last of its 64 bits, which decides the 53
+bits of the double unless the bits below them are that close to halfway.
+In that case (rarely) this fails.
+***************************************************************************/
+_Success_(return)
+static BOOL FDblFromDecimalFast(uint64 luMan, long cchDig, long lwExp10, double *pdbl)
+{
+    // Errors are counted in eighths of a unit in the last place of the
+    // significand, starting from the exact mantissa.
+    const int kcbitErrorScale = 3;
+    const uint64 kluErrorHalf = 1 << (kcbitErrorScale - 1);
+    uint64 luError = 0;
+    int cbitShift;
+    DIYFP diy;
+
+    Assert(luMan != 0 && cchDig <= kcchMaxUint64Dig);
+    diy.f = luMan;
+    diy.wExp2 = 0;
+    diy.Normalize();
+
+    Assert(lwExp10 >= kwCachedPowerMinExp10);
+    const long icp = (lwExp10 - kwCachedPowerMinExp10) / kwCachedPowerExp10Step;
+    Assert(icp < (long)_countof(g_rgcpTens));
+    __analysis_assume(icp >= 0 && icp < _countof(g_rgcpTens));
+    const CACHEDPOWER *pcp = &g_rgcpTens[icp];
+    Assert(pcp->wExp10 <= lwExp10 && lwExp10 < pcp->wExp10 + kwCachedPowerExp10Step);
+
+    const long lwExp10Adj = lwExp10 - pcp->wExp10;
+    if (lwExp10Adj > 0)
+    {
+        diy = diy.Mul(g_rgdiyTensAdj[lwExp10Adj - 1]);
+
+        // The product is exact if it has no more than 19 digits.
+        if (cchDig + lwExp10Adj > kcchMaxUint64Dig)
+            luError += kluErrorHalf;
+    }
+
+    DIYFP diyScale;
+    diyScale.f = pcp->f;
+    diyScale.wExp2 = pcp->wExp2;
+    diy = diy.Mul(diyScale);
+
+    // Half a unit from the cached power, half from rounding the product and
+    // one more for the product of the two errors if there was one.
+    luError += kluErrorHalf + kluErrorHalf + (luError != 0);
+
+    cbitShift = diy.wExp2;
+    diy.Normalize();
+    luError <<= cbitShift - diy.wExp2;
+
+    // The number of bits the double keeps, fewer when it is denormal.
+    int cbitDbl;
+    const int wExp2Top = diy.wExp2 + 64;
+    if (wExp2Top >= -1074 + 53)
+        cbitDbl = 53;
+    else if (wExp2Top <= -1074)
+        cbitDbl = 0;
+    else
+        cbitDbl = wExp2Top + 1074;
+
+    int cbitExtra = 64 - cbitDbl;
+    if (cbitExtra + kcbitErrorScale >= 64)
+    {
+        // Tiny denormals. Drop bits so that halfway times the error scale
+        // fits in 64 bits, adding their worth to the error.
+        cbitShift = cbitExtra + kcbitErrorScale - 64 + 1;
+        diy.f >>= cbitShift;
+        diy.wExp2 += cbitShift;
+        luError = (luError >> cbitShift) + 1 + (kluErrorHalf << 1);
+        cbitExtra -= cbitShift;
+    }
+
+    const uint64 luExtra = (diy.f & ((1ull << cbitExtra) - 1)) << kcbitErrorScale;
+    const uint64 luHalf = (1ull << (cbitExtra - 1)) << kcbitErrorScale;
+    if (luHalf - luError < luExtra && luExtra < luHalf + luError)
+    {
+        // Too close to halfway to tell which way to round.
+        return FALSE;
+    }
+
+    uint64 luSig = diy.f >> cbitExtra;
+    int wExp2 = diy.wExp2 + cbitExtra;
+    if (luExtra >= luHalf + luError)
+        luSig++;
+
+    // Build the double, which may have rounded up to the next power of two,
+    // or overflowed, or be denormal or zero.
+    while (luSig > 0x001FFFFFFFFFFFFFull)
+    {
+        luSig >>= 1;
+        wExp2++;
+    }
+    if (wExp2 >= 0x7FF - 1075)
+    {
+        Js::NumberUtilities::LuHiDbl(*pdbl) = 0x7FF00000;
+        Js::NumberUtilities::LuLoDbl(*pdbl) = 0;
+        return TRUE;
+    }
+    if (wExp2 < -1074)
+    {
+        *pdbl = 0;
+        return TRUE;
+    }
+    while (wExp2 > -1074 && 0 == (luSig & 0x0010000000000000ull))
+    {
+        luSig <<= 1;
+        wExp2--;
+    }
+
+    uint64 luDbl = luSig & 0x000FFFFFFFFFFFFFull;
+    if (0 != (luSig & 0x0010000000000000ull))
+        luDbl |= (uint64)(wExp2 + 1075) << 52;
+    Js::NumberUtilities::LuHiDbl(*pdbl) = (ulong)(luDbl >> 32);
+    Js::NumberUtilities::LuLoDbl(*pdbl) = (ulong)luDbl;
+    return TRUE;
+}
+
+
 /***************************************************************************
 String to Double.
 ***************************************************************************/
@@ -1189,6 +1470,23 @@ LEnd:
         goto LDone;
     }
 
+    // With no more than 19 digits, try 64 bit arithmetic.
+    if (cchDig <= kcchMaxUint64Dig)
+    {
+        uint64 luMan = 0;
+        for (pch = pchMinDig; pch < pchLimDig; pch++)
+        {
+            if (*pch != '.')
+            {
+                Assert(Js::NumberUtilities::IsDigit(*pch));
+                luMan = luMan * 10 + (*pch - '0');
+            }
+        }
+
+        if (FDblFromDecimalFast(luMan, cchDig, lwExp - cchDig, &dbl))
+            goto LDone;
+    }
+
     // Convert to a big number.
     Assert(pchLimDig - pchMinDig >= 0 && pchLimDig - pchMinDig <= LONG_MAX);
     num.SetFromRgchExp(pchMinDig, (long)(pchLimDig - pchMinDig), lwExp);
@@ -1558,6 +1856,201 @@ LFail:
 }
 
 
+/***************************************************************************
+Shortest digits using 64 bit integer arithmetic: Grisu3, from Loitsch,
+"Printing Floating-Point Numbers Quickly and Accurately with Integers".
+The double and the bounds of the interval of values which round to it are
+scaled by a cached power of ten, so that the digits can be generated from
+64 bit fixed point numbers. This finds the shortest digit sequence in the
+interval and, of those, the closest to the double. When the imprecision of
+the scaling makes it uncertain whether the digits are the right ones (for
+about half a percent of doubles) it fails and the caller falls back to the
+slower conversions.
+***************************************************************************/
+
+// The scaled double has a binary exponent in this range, so that its
+// integral part fits in 32 bits and ten times its fractional part fits in
+// 64 bits.
+static const int kwGrisuMinExp2 = -60;
+static const int kwGrisuMaxExp2 = -32;
+
+static const uint32 g_rgluTens[] =
+{
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+// Get the cached power of ten that scales a normalized DIYFP with binary
+// exponent wExp2 into the range above.
+static const CACHEDPOWER *PcpGetScale(int wExp2)
+{
+    // ceil(log10(2^(kwGrisuMinExp2 - wExp2 - 1)))
+    int wExp10 = (int)ceil((kwGrisuMinExp2 - wExp2 - 1) * 0.30102999566398114);
+    int icp = (wExp10 - kwCachedPowerMinExp10 - 1) / kwCachedPowerExp10Step + 1;
+    Assert(icp >= 0 && icp < (int)_countof(g_rgcpTens));
+    __analysis_assume(icp >= 0 && icp < (int)_countof(g_rgcpTens));
+
+    const CACHEDPOWER *pcp = &g_rgcpTens[icp];
+    Assert(kwGrisuMinExp2 <= wExp2 + pcp->wExp2 + 64 && wExp2 + pcp->wExp2 + 64 <= kwGrisuMaxExp2);
+    return pcp;
+}
+
+// The last digit of prgb[0..ib) was generated from the upper bound of the
+// scaled interval, luRest being what is left of the bound. Decrement it
+// while that brings the digits closer to the scaled double, which is
+// luDistHi below the upper bound, and check that the result is safely
+// inside the interval and that no other digits would be closer. The
+// distances are only known within luUnit.
+static BOOL FGrisuRoundWeed(byte *prgb, int ib, uint64 luDistHi, uint64 luUnsafe, uint64 luRest, uint64 luTen, uint64 luUnit)
+{
+    uint64 luDistSmall = luDistHi - luUnit;
+    uint64 luDistBig = luDistHi + luUnit;
+
+    Assert(luRest <= luUnsafe);
+    while (luRest < luDistSmall &&
+        luUnsafe - luRest >= luTen &&
+        (luRest + luTen < luDistSmall || luDistSmall - luRest >= luRest + luTen - luDistSmall))
+    {
+        prgb[ib - 1]--;
+        luRest += luTen;
+    }
+
+    // If decrementing once more might be closer, whether it is depends on
+    // the error.
+    if (luRest < luDistBig &&
+        luUnsafe - luRest >= luTen &&
+        (luRest + luTen < luDistBig || luDistBig - luRest > luRest + luTen - luDistBig))
+    {
+        return FALSE;
+    }
+
+    // The digits must be inside the interval even at the worst of the
+    // error.
+    return 2 * luUnit <= luRest && luRest <= luUnsafe - 4 * luUnit;
+}
+
+_Success_(return)
+static BOOL FDblToRgbGrisu(double dbl, _Out_writes_to_(kcbMaxRgb, (*ppbLim - prgb)) byte *prgb, int *pwExp10, byte **ppbLim)
+{
+    int ib;
+    int wExp2;
+    int wKappa;
+    uint32 luDivisor;
+    uint32 luIntegral;
+    uint64 luFraction;
+    uint64 luUnit;
+    uint64 luRest;
+    DIYFP diyDbl, diyLo, diyHi, diyUnsafe;
+
+    // Caller should take care of 0, negative and non-finite values.
+    Assert(Js::NumberUtilities::IsFinite(dbl));
+    Assert(0 < dbl);
+
+    uint64 luDbl = Js::NumberUtilities::ToSpecial(dbl);
+    diyDbl.f = luDbl & 0x000FFFFFFFFFFFFFull;
+    wExp2 = (int)(luDbl >> 52);
+    if (wExp2 > 0)
+    {
+        diyDbl.f |= 0x0010000000000000ull;
+        diyDbl.wExp2 = wExp2 - 1075;
+    }
+    else
+    {
+        // Denormal
+        diyDbl.wExp2 = -1074;
+    }
+
+    // The bounds are halfway to the adjacent doubles. The double below a
+    // power of two is closer than the one above.
+    diyHi.f = (diyDbl.f << 1) + 1;
+    diyHi.wExp2 = diyDbl.wExp2 - 1;
+    if (diyDbl.f == 0x0010000000000000ull && wExp2 > 1)
+    {
+        diyLo.f = (diyDbl.f << 2) - 1;
+        diyLo.wExp2 = diyDbl.wExp2 - 2;
+    }
+    else
+    {
+        diyLo.f = (diyDbl.f << 1) - 1;
+        diyLo.wExp2 = diyDbl.wExp2 - 1;
+    }
+    diyHi.Normalize();
+    diyLo.f <<= diyLo.wExp2 - diyHi.wExp2;
+    diyLo.wExp2 = diyHi.wExp2;
+    diyDbl.Normalize();
+    Assert(diyDbl.wExp2 == diyHi.wExp2);
+
+    const CACHEDPOWER *pcp = PcpGetScale(diyDbl.wExp2);
+    DIYFP diyScale;
+    diyScale.f = pcp->f;
+    diyScale.wExp2 = pcp->wExp2;
+    diyDbl = diyDbl.Mul(diyScale);
+    diyLo = diyLo.Mul(diyScale);
+    diyHi = diyHi.Mul(diyScale);
+    Assert(diyLo.f + 1 <= diyHi.f - 1);
+
+    // Each scaled value is within one unit of the exact one, so the bounds
+    // are widened by a unit into an interval which certainly contains all
+    // the values that round to the double. Digits generated from its upper
+    // bound are cut off as soon as they are inside it.
+    const int cbitFraction = -diyDbl.wExp2;
+    const uint64 luOne = 1ull << cbitFraction;
+    luUnit = 1;
+    diyHi.f += luUnit;
+    diyUnsafe.f = diyHi.f - (diyLo.f - luUnit);
+    luIntegral = (uint32)(diyHi.f >> cbitFraction);
+    luFraction = diyHi.f & (luOne - 1);
+
+    for (wKappa = 0; wKappa < (int)_countof(g_rgluTens) && luIntegral >= g_rgluTens[wKappa]; wKappa++)
+        ;
+
+    ib = 0;
+    while (wKappa > 0)
+    {
+        luDivisor = g_rgluTens[wKappa - 1];
+        Assert(ib < kcbMaxRgb);
+        prgb[ib++] = (byte)(luIntegral / luDivisor);
+        luIntegral %= luDivisor;
+        wKappa--;
+
+        luRest = ((uint64)luIntegral << cbitFraction) + luFraction;
+        if (luRest < diyUnsafe.f)
+        {
+            if (!FGrisuRoundWeed(prgb, ib, diyHi.f - diyDbl.f, diyUnsafe.f, luRest, (uint64)luDivisor << cbitFraction, luUnit))
+                return FALSE;
+            goto LDone;
+        }
+    }
+
+    for (;;)
+    {
+        Assert(luFraction < luOne);
+        luFraction *= 10;
+        luUnit *= 10;
+        diyUnsafe.f *= 10;
+        Assert(ib < kcbMaxRgb);
+        if (!(ib < kcbMaxRgb))
+            return FALSE;
+        prgb[ib++] = (byte)(luFraction >> cbitFraction);
+        luFraction &= luOne - 1;
+        wKappa--;
+
+        if (luFraction < diyUnsafe.f)
+        {
+            if (!FGrisuRoundWeed(prgb, ib, (diyHi.f - diyDbl.f) * luUnit, diyUnsafe.f, luFraction, luOne, luUnit))
+                return FALSE;
+            goto LDone;
+        }
+    }
+
+LDone:
+    // The digits times 10^(wKappa - pcp->wExp10) approximate dbl.
+    Assert(ib > 0 && prgb[0] != 0);
+    *pwExp10 = ib + wKappa - pcp->wExp10;
+    *ppbLim = &prgb[ib];
+    return TRUE;
+}
+
+
 /***************************************************************************
 Get mantissa bytes (BCD).
 ***************************************************************************/
@@ -2294,7 +2787,8 @@ int Js::NumberUtilities::FDblToStr(double dbl, Js::NumberUtilities::FormatType f
             Js::NumberUtilities::LuHiDbl(dbl) &= 0x7FFFFFFF;
         }
 
-        if (!FDblToRgbFast(dbl, rgb, &wExp10, &pbLim) &&
+        if (!FDblToRgbGrisu(dbl, rgb, &wExp10, &pbLim) &&
+            !FDblToRgbFast(dbl, rgb, &wExp10, &pbLim) &&
             !FDblToRgbPrecise(dbl, rgb, &wExp10, &pbLim))
         {
             AssertMsg(FALSE, "Failure in FDblToRgbPrecise");
@@ -2431,7 +2925,8 @@ BOOL Js::NumberUtilities::FNonZeroFiniteDblToStr(double dbl, __out_ecount(cchDst
         AssertMsg(FALSE, "Failure in FDblToRgbPrecise");
 #endif //DBG
 
-    if (!FDblToRgbFast(dbl, rgb, &wExp10, &pbLim) &&
+    if (!FDblToRgbGrisu(dbl, rgb, &wExp10, &pbLim) &&
+        !FDblToRgbFast(dbl, rgb, &wExp10, &pbLim) &&
         !FDblToRgbPrecise(dbl, rgb, &wExp10, &pbLim))
     {
         AssertMsg(FALSE, "Failure in FDblToRgbPrecise");
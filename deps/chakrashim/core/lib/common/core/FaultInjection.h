@@ -174,6 +174,7 @@ namespace Js
     if((this->threadContextFlags & ThreadContextFlagCanDisableExecution) != 0){ \
         if( Js::FaultInjection::Global.ShouldInjectFault(Js::FaultInjection::Global.ScriptTermination)){ \
             this->stackLimitForCurrentThread = Js::Constants::StackLimitForScriptInterrupt; \
+            this->interruptProbeLimit = Js::Constants::StackLimitForScriptInterrupt; \
         }\
     }
 
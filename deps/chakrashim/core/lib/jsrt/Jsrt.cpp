@@ -12,6 +12,7 @@
 #include "common\ByteSwap.h"
 #include "Library\dataview.h"
 #include "Library\JavascriptSymbol.h"
+#include "Library\JSON.h"
 #include "Base\ThreadContextTLSEntry.h"
 
 // Parser Includes
@@ -22,6 +23,12 @@
 #include "TestHooksRt.h"
 #endif
 
+#ifdef DYNAMIC_PROFILE_STORAGE
+#include "Language\DynamicProfileStorage.h"
+#endif
+
+#include "Types\MegamorphicPropertyCache.h"
+
 JsErrorCode CheckContext(JsrtContext *currentContext, bool verifyRuntimeState, bool allowInObjectBeforeCollectCallback)
 {
     if (currentContext == nullptr)
@@ -116,7 +123,9 @@ STDAPI_(JsErrorCode) JsCreateRuntime(_In_ JsRuntimeAttributes attributes, _In_op
             JsRuntimeAttributeDisableEval |
             JsRuntimeAttributeDisableNativeCodeGeneration |
             JsRuntimeAttributeEnableExperimentalFeatures |
-            JsRuntimeAttributeDispatchSetExceptionsToDebugger
+            JsRuntimeAttributeDispatchSetExceptionsToDebugger |
+            JsRuntimeAttributeEnablePerfMap |
+            JsRuntimeAttributeEnableAdaptiveTiering
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
             | JsRuntimeAttributeSerializeLibraryByteCode
 #endif
@@ -168,6 +177,18 @@ STDAPI_(JsErrorCode) JsCreateRuntime(_In_ JsRuntimeAttributes attributes, _In_op
             threadContext->SetThreadContextFlag(ThreadContextFlagNoJIT);
         }
 
+        if ((attributes & JsRuntimeAttributeEnableAdaptiveTiering) || CONFIG_FLAG(AdaptiveTiering))
+        {
+            threadContext->SetThreadContextFlag(ThreadContextFlagAdaptiveTiering);
+        }
+
+#ifdef ENABLE_PERF_MAP
+        if ((attributes & JsRuntimeAttributeEnablePerfMap) || CONFIG_FLAG(PerfMap))
+        {
+            PerfMap::Enable();
+        }
+#endif
+
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
         if (Js::Configuration::Global.flags.PrimeRecycler)
         {
@@ -2246,6 +2267,283 @@ STDAPI_(JsErrorCode) JsIsRuntimeExecutionDisabled(_In_ JsRuntimeHandle runtimeHa
     return JsNoError;
 }
 
+STDAPI_(JsErrorCode) JsSetRuntimeSampleCallback(_In_ JsRuntimeHandle runtimeHandle, _In_opt_ void *callbackState, _In_opt_ JsSampleCallback sampleCallback)
+{
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        JsrtRuntime::FromHandle(runtimeHandle)->SetSampleCallback(sampleCallback, callbackState);
+        return JsNoError;
+    });
+}
+
+STDAPI_(JsErrorCode) JsRequestRuntimeSample(_In_ JsRuntimeHandle runtimeHandle)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+    // May be called from any thread, so only touch the request flag and the probe limit.
+    JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext()->RequestSample();
+    return JsNoError;
+}
+
+STDAPI_(JsErrorCode) JsEnableProfileCache(_In_opt_z_ const wchar_t *cacheDirectory, _In_ bool reportToStderr)
+{
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+#ifdef DYNAMIC_PROFILE_STORAGE
+        if (!DynamicProfileStorage::EnableCacheDir(cacheDirectory, reportToStderr))
+        {
+            return JsErrorFatal;
+        }
+        return JsNoError;
+#else
+        return JsErrorNotImplemented;
+#endif
+    });
+}
+
+STDAPI_(JsErrorCode) JsSaveRuntimeProfileCache(_In_ JsRuntimeHandle runtimeHandle)
+{
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+#ifdef DYNAMIC_PROFILE_STORAGE
+        for (Js::ScriptContext * scriptContext = threadContext->GetScriptContextList(); scriptContext != nullptr; scriptContext = scriptContext->next)
+        {
+            Js::DynamicProfileInfo::Save(scriptContext);
+        }
+#endif
+        return JsNoError;
+    });
+}
+
+STDAPI_(JsErrorCode) JsSetBackgroundJitThreadCount(_In_ unsigned int threadCount)
+{
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        if (threadCount == 0 || threadCount > INT_MAX)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        // Read by each BackgroundJobProcessor when it starts its threads
+        Js::Configuration::Global.flags.MaxJitThreadCount = static_cast<Js::Number>(threadCount);
+        Js::Configuration::Global.flags.ForceMaxJitThreadCount = true;
+        return JsNoError;
+    });
+}
+
+STDAPI_(JsErrorCode) JsGetRuntimePropertyCacheStatistics(_In_ JsRuntimeHandle runtimeHandle, _Out_ JsPropertyCacheStatistics *statistics)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+    PARAM_NOT_NULL(statistics);
+    memset(statistics, 0, sizeof(JsPropertyCacheStatistics));
+
+    ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+    Js::MegamorphicPropertyCache * megamorphicPropertyCache = threadContext->GetMegamorphicPropertyCache();
+    if (megamorphicPropertyCache != nullptr)
+    {
+        const Js::MegamorphicPropertyCache::Statistics &cacheStatistics = megamorphicPropertyCache->GetStatistics();
+        statistics->loadHits = cacheStatistics.loadHits;
+        statistics->loadMisses = cacheStatistics.loadMisses;
+        statistics->storeHits = cacheStatistics.storeHits;
+        statistics->storeMisses = cacheStatistics.storeMisses;
+        statistics->entriesCached = cacheStatistics.entriesCached;
+    }
+
+    return JsNoError;
+}
+
+static const unsigned int MaxFunctionTelemetryCount = 1000;
+
+static unsigned int GetFunctionTelemetryRank(const JsFunctionTelemetry &telemetry, JsFunctionTelemetryKind sortBy)
+{
+    switch (sortBy)
+    {
+    case JsFunctionTelemetryBailOuts:
+        return telemetry.bailOutCount;
+    case JsFunctionTelemetryRejits:
+        return telemetry.rejitCount;
+    case JsFunctionTelemetryInterpretedCalls:
+        return telemetry.interpretedCallCount;
+    case JsFunctionTelemetryPolymorphicSites:
+        return telemetry.polymorphicSiteCount;
+    default:
+        Assert(false);
+        return 0;
+    }
+}
+
+STDAPI_(JsErrorCode) JsGetRuntimeFunctionTelemetry(_In_ JsRuntimeHandle runtimeHandle, _In_ JsFunctionTelemetryKind sortBy, _In_ unsigned int maxCount, _In_ JsFunctionTelemetryCallback callback, _In_opt_ void *callbackState)
+{
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        PARAM_NOT_NULL(callback);
+
+        if (sortBy < JsFunctionTelemetryBailOuts || sortBy > JsFunctionTelemetryPolymorphicSites ||
+            maxCount == 0 || maxCount > MaxFunctionTelemetryCount)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        JsFunctionTelemetry * functions = HeapNewNoThrowArray(JsFunctionTelemetry, maxCount);
+        if (functions == nullptr)
+        {
+            return JsErrorOutOfMemory;
+        }
+
+        // Keep the highest ranked functions seen so far, highest first. The walk doesn't allocate on the recycler, so
+        // the strings stay alive until the callback returns.
+        unsigned int count = 0;
+        for (Js::ScriptContext * scriptContext = threadContext->GetScriptContextList(); scriptContext != nullptr; scriptContext = scriptContext->next)
+        {
+            if (scriptContext->IsClosed())
+            {
+                continue;
+            }
+
+            scriptContext->MapFunction([&](Js::FunctionBody * body)
+            {
+                JsFunctionTelemetry telemetry;
+                telemetry.bailOutCount = body->GetTotalBailOutCount();
+                telemetry.rejitCount = body->GetTotalRejitCount();
+                telemetry.interpretedCallCount = body->GetTotalInterpretedCount();
+                body->GetPolymorphicInlineCacheSiteCounts(&telemetry.polymorphicSiteCount, &telemetry.megamorphicSiteCount);
+
+                const unsigned int rank = GetFunctionTelemetryRank(telemetry, sortBy);
+                if (rank == 0 || (count == maxCount && rank <= GetFunctionTelemetryRank(functions[count - 1], sortBy)))
+                {
+                    return;
+                }
+
+                const wchar_t * sourceName = body->GetSourceName();
+                telemetry.functionName = body->GetExternalDisplayName();
+                telemetry.url = sourceName != nullptr ? sourceName : L"";
+                telemetry.sourceContext = body->GetSourceContextInfo()->dwHostSourceContext;
+                telemetry.line = body->GetLineNumber();
+                telemetry.column = body->GetColumnNumber();
+                telemetry.lastRejitReason = RejitReasonNames[body->GetLastRejitReason()];
+
+                unsigned int index = count < maxCount ? count++ : count - 1;
+                for (; index > 0 && GetFunctionTelemetryRank(functions[index - 1], sortBy) < rank; index--)
+                {
+                    functions[index] = functions[index - 1];
+                }
+                functions[index] = telemetry;
+            });
+        }
+
+        try
+        {
+            callback(functions, count, callbackState);
+        }
+        catch (...)
+        {
+            AssertMsg(false, "Unexpected non-engine exception.");
+        }
+
+        HeapDeleteArray(maxCount, functions);
+        return JsNoError;
+    });
+}
+
+STDAPI_(JsErrorCode) JsParseUtf8Json(_In_reads_(length) const char *content, _In_ size_t length, _Out_ JsValueRef *result)
+{
+    return ContextAPIWrapper<true>([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        PARAM_NOT_NULL(result);
+        *result = nullptr;
+
+        if (content == nullptr && length != 0)
+        {
+            return JsErrorNullArgument;
+        }
+
+        *result = JSON::ParseUtf8(reinterpret_cast<LPCUTF8>(content), length, scriptContext);
+        return JsNoError;
+    });
+}
+
+STDAPI_(JsErrorCode) JsCopyString(_In_ JsValueRef value, _In_ int start, _In_ int length, _Out_writes_to_(length, *written) wchar_t *buffer, _Out_opt_ size_t *written)
+{
+    VALIDATE_JSREF(value);
+    PARAM_NOT_NULL(buffer);
+    if (written != nullptr)
+    {
+        *written = 0;
+    }
+
+    if (!Js::JavascriptString::Is(value) || start < 0 || length < 0)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        Js::JavascriptString *jsString = Js::JavascriptString::FromVar(value);
+
+        const charcount_t stringLength = jsString->GetLength();
+        if (static_cast<charcount_t>(start) > stringLength)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        const charcount_t copyLength = min(static_cast<charcount_t>(length), stringLength - start);
+        jsString->CopyChars(buffer, start, copyLength);
+        if (written != nullptr)
+        {
+            *written = copyLength;
+        }
+        return JsNoError;
+    });
+}
+
+STDAPI_(JsErrorCode) JsCopyStringUtf8(_In_ JsValueRef value, _Out_writes_to_opt_(bufferSize, *writtenByteCount) char *buffer, _In_ size_t bufferSize, _Out_opt_ size_t *writtenByteCount, _Out_opt_ size_t *writtenCharCount)
+{
+    VALIDATE_JSREF(value);
+    if (writtenByteCount != nullptr)
+    {
+        *writtenByteCount = 0;
+    }
+    if (writtenCharCount != nullptr)
+    {
+        *writtenCharCount = 0;
+    }
+
+    if (!Js::JavascriptString::Is(value))
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        Js::JavascriptString *jsString = Js::JavascriptString::FromVar(value);
+
+        charcount_t encodedLength;
+        const size_t byteLength = jsString->CopyUtf8(reinterpret_cast<LPUTF8>(buffer), bufferSize, &encodedLength);
+        if (writtenByteCount != nullptr)
+        {
+            *writtenByteCount = byteLength;
+        }
+        if (writtenCharCount != nullptr)
+        {
+            *writtenCharCount = encodedLength;
+        }
+        return JsNoError;
+    });
+}
+
 STDAPI_(JsErrorCode) JsGetPropertyIdFromName(_In_z_ const wchar_t *name, _Out_ JsPropertyIdRef *propertyId)
 {
     return ContextAPINoScriptWrapper([&](Js::ScriptContext * scriptContext) -> JsErrorCode {
@@ -2419,10 +2717,13 @@ JsErrorCode RunScriptCore(const wchar_t *script, JsSourceContext sourceContext,
 
 
         SourceContextInfo * sourceContextInfo = scriptContext->GetSourceContextInfo(sourceContext, nullptr);
+        size_t scriptLength = wcslen(script);
 
         if (sourceContextInfo == nullptr)
         {
-            sourceContextInfo = scriptContext->CreateSourceContextInfo(sourceContext, sourceUrl, wcslen(sourceUrl), nullptr);
+            // The source hash keys persisted profile data, so that it is only reused for identical script text.
+            uint sourceHash = JsUtil::CharacterBuffer<WCHAR>::StaticGetHashCode(script, static_cast<charcount_t>(scriptLength));
+            sourceContextInfo = scriptContext->CreateSourceContextInfo(sourceContext, sourceUrl, wcslen(sourceUrl), nullptr, nullptr, 0, sourceHash);
         }
 
         SRCINFO si = {
@@ -2431,7 +2732,7 @@ JsErrorCode RunScriptCore(const wchar_t *script, JsSourceContext sourceContext,
             /* ulColumnHost        */ 0,
             /* lnMinHost           */ 0,
             /* ichMinHost          */ 0,
-            /* ichLimHost          */ static_cast<ULONG>(wcslen(script)), // OK to truncate since this is used to limit sourceText in debugDocument/compilation errors.
+            /* ichLimHost          */ static_cast<ULONG>(scriptLength), // OK to truncate since this is used to limit sourceText in debugDocument/compilation errors.
             /* ulCharOffset        */ 0,
             /* mod                 */ kmodGlobal,
             /* grfsi               */ 0
@@ -313,7 +313,20 @@
         ///     Calling <c>JsSetException</c> will also dispatch the exception to the script debugger
         ///     (if any) giving the debugger a chance to break on the exception.
         /// </summary>
-        JsRuntimeAttributeDispatchSetExceptionsToDebugger = 0x00000040
+        JsRuntimeAttributeDispatchSetExceptionsToDebugger = 0x00000040,
+        /// <summary>
+        ///     Runtime will describe the address range of all generated code in a
+        ///     <c>perf-&lt;pid&gt;.map</c> file in the temp directory so that sampling profilers
+        ///     which read perf maps can symbolize JIT-compiled frames. The file is written on
+        ///     Windows, the only platform the engine builds for.
+        /// </summary>
+        JsRuntimeAttributeEnablePerfMap = 0x00000080,
+        /// <summary>
+        ///     Runtime will adapt the execution mode limits to the load on the background JIT: hot
+        ///     functions are compiled sooner while the full JIT queue is idle, and functions with a
+        ///     stable profile skip the simple JIT. Intended for long-running server workloads.
+        /// </summary>
+        JsRuntimeAttributeEnableAdaptiveTiering = 0x00000100
     } JsRuntimeAttributes;
 
     /// <summary>
@@ -405,6 +418,64 @@
     /// <param name="callbackState">The state passed to <c>JsSetBeforeCollectCallback</c>.</param>
     typedef void (CALLBACK *JsBeforeCollectCallback)(_In_opt_ void *callbackState);
 
+    /// <summary>
+    ///     A script frame captured by a runtime sample.
+    /// </summary>
+    /// <remarks>
+    ///     The strings are owned by the runtime and are only valid for the duration of the
+    ///     <c>JsSampleCallback</c> they are passed to.
+    /// </remarks>
+    typedef struct JsSampleFrame
+    {
+        /// <summary>
+        ///     The display name of the function, or an empty string for anonymous functions.
+        /// </summary>
+        const wchar_t *functionName;
+        /// <summary>
+        ///     The url of the script that contains the function, or an empty string if none.
+        /// </summary>
+        const wchar_t *url;
+        /// <summary>
+        ///     The source context passed by the host when the script was run or parsed.
+        /// </summary>
+        JsSourceContext sourceContext;
+        /// <summary>
+        ///     The one-based line of the start of the function.
+        /// </summary>
+        unsigned int line;
+        /// <summary>
+        ///     The one-based column of the start of the function.
+        /// </summary>
+        unsigned int column;
+        /// <summary>
+        ///     The one-based line that was executing in this frame when the sample was taken, or zero
+        ///     if it is not known.
+        /// </summary>
+        unsigned int hitLine;
+        /// <summary>
+        ///     The reason the function's optimized code was last discarded and recompiled, or an empty
+        ///     string if that has not happened. Unlike the other strings this one is static.
+        /// </summary>
+        const char *bailoutReason;
+    } JsSampleFrame;
+
+    /// <summary>
+    ///     A callback called on the script thread when a sample requested with
+    ///     <c>JsRequestRuntimeSample</c> is taken.
+    /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///     Use <c>JsSetRuntimeSampleCallback</c> to register this callback.
+    ///     </para>
+    ///     <para>
+    ///     The callback is called while script is running and must not call back into the runtime.
+    ///     </para>
+    /// </remarks>
+    /// <param name="frames">The script frames on the stack, innermost first.</param>
+    /// <param name="frameCount">The number of frames in <paramref name="frames" />.</param>
+    /// <param name="callbackState">The state passed to <c>JsSetRuntimeSampleCallback</c>.</param>
+    typedef void (CALLBACK *JsSampleCallback)(_In_reads_(frameCount) const JsSampleFrame *frames, _In_ unsigned int frameCount, _In_opt_ void *callbackState);
+
     /// <summary>
     ///     A callback called before collecting an object.
     /// </summary>
@@ -2509,6 +2580,391 @@
             _In_ JsRuntimeHandle runtime,
             _Out_ bool *isDisabled);
 
+    /// <summary>
+    ///     Sets a callback that receives the script stack each time a sample is taken in the runtime.
+    /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///     Samples are only taken at safepoints: loop back edges, function entries in the interpreter
+    ///     and calls to host functions. Loop back edges in optimized code are only probed when the
+    ///     runtime was created with <c>JsRuntimeAttributeAllowScriptInterrupt</c>.
+    ///     </para>
+    ///     <para>
+    ///     Must be called on the thread the runtime is running on. It may be called while script
+    ///     is running, but not from within the sample callback.
+    ///     </para>
+    /// </remarks>
+    /// <param name="runtime">The runtime for which to register the callback.</param>
+    /// <param name="callbackState">
+    ///     User provided state that will be passed back to the callback.
+    /// </param>
+    /// <param name="sampleCallback">The callback function, or <c>NULL</c> to stop sampling.</param>
+    /// <returns>
+    ///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+    /// </returns>
+    STDAPI_(JsErrorCode)
+        JsSetRuntimeSampleCallback(
+            _In_ JsRuntimeHandle runtime,
+            _In_opt_ void *callbackState,
+            _In_opt_ JsSampleCallback sampleCallback);
+
+    /// <summary>
+    ///     Requests that a sample be taken at the next safepoint in the runtime.
+    /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///     This API does not need to be called from the runtime's thread; a profiler typically calls it
+    ///     from its own timer thread. The sample callback is called on the runtime's thread. Requests
+    ///     made while a previous request is still pending are coalesced.
+    ///     </para>
+    ///     <para>
+    ///     If no script is running, the request is serviced the next time script runs.
+    ///     </para>
+    /// </remarks>
+    /// <param name="runtime">The runtime to sample.</param>
+    /// <returns>
+    ///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+    /// </returns>
+    STDAPI_(JsErrorCode)
+        JsRequestRuntimeSample(
+            _In_ JsRuntimeHandle runtime);
+
+    /// <summary>
+    ///     Enables the persistent profile cache for all runtimes in the process.
+    /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///     The type profile collected for each script run with a non-empty source url is written to
+    ///     the cache when its context is released or when <c>JsSaveRuntimeProfileCache</c> is called.
+    ///     When the same script text is run again in a later process, its profile is loaded from the
+    ///     cache and functions that reached the optimizing JIT in the earlier run are compiled by it
+    ///     right away instead of warming up again.
+    ///     </para>
+    ///     <para>
+    ///     Must be called before any runtime is created. The cache directory can be shared by several
+    ///     processes at once.
+    ///     </para>
+    /// </remarks>
+    /// <param name="cacheDirectory">
+    ///     The directory to store the cache in, or <c>NULL</c> to use a directory under the temp path.
+    /// </param>
+    /// <param name="reportToStderr">
+    ///     Whether to print problems with the cache, the profiles loaded from it and the functions
+    ///     that go to the optimizing JIT because of them to stderr. Nothing is printed otherwise.
+    /// </param>
+    /// <returns>
+    ///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+    /// </returns>
+    STDAPI_(JsErrorCode)
+        JsEnableProfileCache(
+            _In_opt_z_ const wchar_t *cacheDirectory,
+            _In_ bool reportToStderr);
+
+    /// <summary>
+    ///     Writes the profiles collected so far by all contexts of a runtime to the profile cache.
+    /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///     Profiles are also written when a context is released, so this is only needed by hosts that
+    ///     may exit without disposing the runtime. Does nothing if <c>JsEnableProfileCache</c> was not
+    ///     called.
+    ///     </para>
+    ///     <para>
+    ///     Must be called on the thread the runtime is running on. It may be called while script is
+    ///     running.
+    ///     </para>
+    /// </remarks>
+    /// <param name="runtime">The runtime whose profiles to save.</param>
+    /// <returns>
+    ///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+    /// </returns>
+    STDAPI_(JsErrorCode)
+        JsSaveRuntimeProfileCache(
+            _In_ JsRuntimeHandle runtime);
+
+    /// <summary>
+    ///     Sets the number of background threads that runtimes use to compile functions with the JIT.
+    /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///     Each thread compiles a different function, so more threads shorten the time it takes to
+    ///     compile a large number of hot functions, for instance right after a server starts. By
+    ///     default, the number of threads is chosen based on the number of processors.
+    ///     </para>
+    ///     <para>
+    ///     Must be called before any runtime is created. Runtimes created with
+    ///     <c>JsRuntimeAttributeDisableBackgroundWork</c> do not use background threads.
+    ///     </para>
+    /// </remarks>
+    /// <param name="threadCount">The number of threads, at least 1.</param>
+    /// <returns>
+    ///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+    /// </returns>
+    STDAPI_(JsErrorCode)
+        JsSetBackgroundJitThreadCount(
+            _In_ unsigned int threadCount);
+
+    /// <summary>
+    ///     Counters of the megamorphic property cache of a runtime.
+    /// </summary>
+    /// <remarks>
+    ///     Property accesses whose inline caches have seen more object shapes than they can hold look
+    ///     the property up in the megamorphic property cache before falling back to a full lookup.
+    ///     Lookups are only counted once the first such access has been seen.
+    /// </remarks>
+    typedef struct JsPropertyCacheStatistics
+    {
+        /// <summary>
+        ///     The number of property reads served by the megamorphic property cache.
+        /// </summary>
+        unsigned __int64 loadHits;
+        /// <summary>
+        ///     The number of property reads that missed in the megamorphic property cache.
+        /// </summary>
+        unsigned __int64 loadMisses;
+        /// <summary>
+        ///     The number of property writes served by the megamorphic property cache.
+        /// </summary>
+        unsigned __int64 storeHits;
+        /// <summary>
+        ///     The number of property writes that missed in the megamorphic property cache.
+        /// </summary>
+        unsigned __int64 storeMisses;
+        /// <summary>
+        ///     The number of entries that have been added to the megamorphic property cache.
+        /// </summary>
+        unsigned __int64 entriesCached;
+    } JsPropertyCacheStatistics;
+
+    /// <summary>
+    ///     Gets the counters of the megamorphic property cache of a runtime.
+    /// </summary>
+    /// <remarks>
+    ///     The counters are cumulative over the lifetime of the runtime. The hit rate of the cache
+    ///     is <c>loadHits / (loadHits + loadMisses)</c> for reads, and likewise for writes.
+    /// </remarks>
+    /// <param name="runtime">The runtime whose counters to get.</param>
+    /// <param name="statistics">The counters of the runtime.</param>
+    /// <returns>
+    ///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+    /// </returns>
+    STDAPI_(JsErrorCode)
+        JsGetRuntimePropertyCacheStatistics(
+            _In_ JsRuntimeHandle runtime,
+            _Out_ JsPropertyCacheStatistics *statistics);
+
+    /// <summary>
+    ///     The counter that <c>JsGetRuntimeFunctionTelemetry</c> ranks functions by.
+    /// </summary>
+    typedef enum _JsFunctionTelemetryKind
+    {
+        /// <summary>
+        ///     Rank functions by the number of times their native code bailed out to the interpreter.
+        /// </summary>
+        JsFunctionTelemetryBailOuts = 0,
+        /// <summary>
+        ///     Rank functions by the number of times their native code was thrown away and recompiled.
+        /// </summary>
+        JsFunctionTelemetryRejits = 1,
+        /// <summary>
+        ///     Rank functions by the number of calls that ran in the interpreter.
+        /// </summary>
+        JsFunctionTelemetryInterpretedCalls = 2,
+        /// <summary>
+        ///     Rank functions by the number of property access sites that have seen several object shapes.
+        /// </summary>
+        JsFunctionTelemetryPolymorphicSites = 3
+    } JsFunctionTelemetryKind;
+
+    /// <summary>
+    ///     The execution counters of a function.
+    /// </summary>
+    /// <remarks>
+    ///     The strings are owned by the runtime and are only valid for the duration of the
+    ///     <c>JsFunctionTelemetryCallback</c> they are passed to.
+    /// </remarks>
+    typedef struct JsFunctionTelemetry
+    {
+        /// <summary>
+        ///     The display name of the function, or an empty string for anonymous functions.
+        /// </summary>
+        const wchar_t *functionName;
+        /// <summary>
+        ///     The url of the script that contains the function, or an empty string if none.
+        /// </summary>
+        const wchar_t *url;
+        /// <summary>
+        ///     The source context passed by the host when the script was run or parsed.
+        /// </summary>
+        JsSourceContext sourceContext;
+        /// <summary>
+        ///     The one-based line of the start of the function.
+        /// </summary>
+        unsigned int line;
+        /// <summary>
+        ///     The one-based column of the start of the function.
+        /// </summary>
+        unsigned int column;
+        /// <summary>
+        ///     The number of times native code of the function bailed out to the interpreter.
+        /// </summary>
+        unsigned int bailOutCount;
+        /// <summary>
+        ///     The number of times native code of the function or of one of its loops was recompiled
+        ///     after a bailout.
+        /// </summary>
+        unsigned int rejitCount;
+        /// <summary>
+        ///     The reason for the last recompilation, or <c>"None"</c> if there was none.
+        /// </summary>
+        const char *lastRejitReason;
+        /// <summary>
+        ///     The number of calls to the function that ran in the interpreter.
+        /// </summary>
+        unsigned int interpretedCallCount;
+        /// <summary>
+        ///     The number of property access sites of the function that have seen more than one object shape.
+        /// </summary>
+        unsigned int polymorphicSiteCount;
+        /// <summary>
+        ///     The number of polymorphic sites that have seen more object shapes than their inline caches
+        ///     can hold.
+        /// </summary>
+        unsigned int megamorphicSiteCount;
+    } JsFunctionTelemetry;
+
+    /// <summary>
+    ///     A callback called by <c>JsGetRuntimeFunctionTelemetry</c> with the highest ranked functions.
+    /// </summary>
+    /// <remarks>
+    ///     The callback must not call back into the runtime.
+    /// </remarks>
+    /// <param name="functions">The functions, highest ranked first.</param>
+    /// <param name="count">The number of functions in <paramref name="functions" />.</param>
+    /// <param name="callbackState">The state passed to <c>JsGetRuntimeFunctionTelemetry</c>.</param>
+    typedef void (CALLBACK *JsFunctionTelemetryCallback)(_In_reads_(count) const JsFunctionTelemetry *functions, _In_ unsigned int count, _In_opt_ void *callbackState);
+
+    /// <summary>
+    ///     Gets the functions of a runtime with the highest execution counters.
+    /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///     The counters are kept for every function at all times and are cumulative over the lifetime
+    ///     of the function. Functions whose ranking counter is zero are not reported.
+    ///     </para>
+    ///     <para>
+    ///     Must be called on the thread that uses the runtime. The functions are passed to <paramref name="callback" />
+    ///     before this call returns.
+    ///     </para>
+    /// </remarks>
+    /// <param name="runtime">The runtime whose functions to get.</param>
+    /// <param name="sortBy">The counter to rank the functions by.</param>
+    /// <param name="maxCount">The maximum number of functions to report, at most 1000.</param>
+    /// <param name="callback">The callback to pass the functions to.</param>
+    /// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+    /// <returns>
+    ///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+    /// </returns>
+    STDAPI_(JsErrorCode)
+        JsGetRuntimeFunctionTelemetry(
+            _In_ JsRuntimeHandle runtime,
+            _In_ JsFunctionTelemetryKind sortBy,
+            _In_ unsigned int maxCount,
+            _In_ JsFunctionTelemetryCallback callback,
+            _In_opt_ void *callbackState);
+
+    /// <summary>
+    ///     Parses UTF-8 encoded JSON text into a value, as <c>JSON.parse</c> does without a reviver.
+    /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///     The text is decoded once, straight into the engine string the parser reads, instead of being
+    ///     decoded by the host and then copied into a string value. Long string values that make up a
+    ///     large part of the text may share that string's buffer.
+    ///     Invalid UTF-8 sequences are decoded as the replacement character.
+    ///     </para>
+    ///     <para>
+    ///     Requires an active script context. If the text is not valid JSON, a <c>SyntaxError</c> is
+    ///     thrown and <c>JsErrorScriptException</c> is returned.
+    ///     </para>
+    /// </remarks>
+    /// <param name="content">The UTF-8 encoded JSON text. It does not need to be null terminated.</param>
+    /// <param name="length">The length of the text in bytes.</param>
+    /// <param name="result">The parsed value.</param>
+    /// <returns>
+    ///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+    /// </returns>
+    STDAPI_(JsErrorCode)
+        JsParseUtf8Json(
+            _In_reads_(length) const char *content,
+            _In_ size_t length,
+            _Out_ JsValueRef *result);
+
+    /// <summary>
+    ///     Copies characters of a string value into a buffer.
+    /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///     Unlike <c>JsStringToPointer</c>, copying does not flatten a string built by concatenation: the
+    ///     pieces of it that are in range are copied straight into the buffer and the string is left as it is.
+    ///     </para>
+    ///     <para>
+    ///     Requires an active script context.
+    ///     </para>
+    /// </remarks>
+    /// <param name="value">The string value to copy from.</param>
+    /// <param name="start">The index of the first character to copy.</param>
+    /// <param name="length">
+    ///     The number of characters to copy, which is also the size of the buffer. Fewer are copied if the
+    ///     string ends first.
+    /// </param>
+    /// <param name="buffer">The buffer to copy the characters into. It is not null terminated.</param>
+    /// <param name="written">The number of characters copied.</param>
+    /// <returns>
+    ///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+    /// </returns>
+    STDAPI_(JsErrorCode)
+        JsCopyString(
+            _In_ JsValueRef value,
+            _In_ int start,
+            _In_ int length,
+            _Out_writes_to_(length, *written) wchar_t *buffer,
+            _Out_opt_ size_t *written);
+
+    /// <summary>
+    ///     Encodes a string value as UTF-8 into a buffer.
+    /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///     Surrogate pairs are encoded as the code point they stand for, and unpaired surrogates as U+FFFD.
+    ///     Only whole characters are written: encoding stops at the first one which does not fit in the buffer.
+    ///     If <paramref name="buffer" /> is null, nothing is written and <paramref name="writtenByteCount" />
+    ///     receives the size of the whole encoding.
+    ///     </para>
+    ///     <para>
+    ///     The string is not flattened if it was built by concatenation, see <c>JsCopyString</c>. Its pieces
+    ///     are encoded in order until the buffer is full.
+    ///     </para>
+    ///     <para>
+    ///     Requires an active script context.
+    ///     </para>
+    /// </remarks>
+    /// <param name="value">The string value to encode.</param>
+    /// <param name="buffer">The buffer to write the encoding into, or null. It is not null terminated.</param>
+    /// <param name="bufferSize">The size of the buffer in bytes.</param>
+    /// <param name="writtenByteCount">The number of bytes written, or needed if the buffer is null.</param>
+    /// <param name="writtenCharCount">The number of UTF-16 characters of the string encoded.</param>
+    /// <returns>
+    ///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+    /// </returns>
+    STDAPI_(JsErrorCode)
+        JsCopyStringUtf8(
+            _In_ JsValueRef value,
+            _Out_writes_to_opt_(bufferSize, *writtenByteCount) char *buffer,
+            _In_ size_t bufferSize,
+            _Out_opt_ size_t *writtenByteCount,
+            _Out_opt_ size_t *writtenCharCount);
+
 
     /// <summary>
     ///     A promise continuation callback.
@@ -6,6 +6,7 @@
 #include "JsrtRuntime.h"
 #include "Base\ThreadContextTLSEntry.h"
 #include "Base\ThreadBoundThreadContextManager.h"
+#include "Language\JavascriptStackWalker.h"
 JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispatchExceptions)
 {
     Assert(threadContext != NULL);
@@ -14,6 +15,8 @@ JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispa
     this->collectCallback = NULL;
     this->beforeCollectCallback = NULL;
     this->callbackContext = NULL;
+    this->sampleCallback = NULL;
+    this->sampleCallbackState = NULL;
     this->allocationPolicyManager = threadContext->GetAllocationPolicyManager();
     this->useIdle = useIdle;
     this->dispatchExceptions = dispatchExceptions;
@@ -106,6 +109,63 @@ void JsrtRuntime::RecyclerCollectCallbackStatic(void * context, RecyclerCollectC
     }
 }
 
+void JsrtRuntime::SetSampleCallback(JsSampleCallback sampleCallback, void * sampleCallbackState)
+{
+    this->sampleCallback = sampleCallback;
+    this->sampleCallbackState = sampleCallbackState;
+    this->threadContext->SetSampleHandler(sampleCallback != NULL ? SampleHandlerStatic : nullptr, sampleCallback != NULL ? this : nullptr);
+}
+
+// Called on the script thread at a safepoint; must not allocate on the recycler or run script.
+void JsrtRuntime::SampleHandlerStatic(Js::ScriptContext * scriptContext, void * state)
+{
+    JsrtRuntime * _this = reinterpret_cast<JsrtRuntime *>(state);
+    Assert(_this->sampleCallback != NULL);
+
+    Js::JavascriptStackWalker walker(scriptContext, true);
+    ushort frameCount = walker.WalkUntil(MaxSampleFrames, [&](Js::JavascriptFunction * function, ushort frameIndex) -> bool
+    {
+        JsSampleFrame & frame = _this->sampleFrames[frameIndex];
+        Js::FunctionBody * body = function->IsScriptFunction() ? function->GetFunctionBody() : nullptr;
+        if (body == nullptr)
+        {
+            // Built-ins only show up when library stack frames are enabled; report them without a location.
+            frame.functionName = L"";
+            frame.url = L"";
+            frame.sourceContext = JS_SOURCE_CONTEXT_NONE;
+            frame.line = 0;
+            frame.column = 0;
+            frame.hitLine = 0;
+            frame.bailoutReason = "";
+            return false;
+        }
+
+        const wchar_t * sourceName = body->GetSourceName();
+        frame.functionName = body->GetExternalDisplayName();
+        frame.url = sourceName != nullptr ? sourceName : L"";
+        frame.sourceContext = body->GetSourceContextInfo()->dwHostSourceContext;
+        frame.line = body->GetLineNumber();
+        frame.column = body->GetColumnNumber();
+
+        ULONG hitLine;
+        LONG hitColumn;
+        frame.hitLine = body->GetLineCharOffset(walker.GetByteCodeOffset(), &hitLine, &hitColumn, false /* canAllocateLineCache */) ? hitLine + 1 : 0;
+
+        const RejitReason rejitReason = body->GetLastRejitReason();
+        frame.bailoutReason = rejitReason != RejitReason::None ? RejitReasonNames[rejitReason] : "";
+        return false;
+    });
+
+    try
+    {
+        _this->sampleCallback(_this->sampleFrames, frameCount, _this->sampleCallbackState);
+    }
+    catch (...)
+    {
+        AssertMsg(false, "Unexpected non-engine exception.");
+    }
+}
+
 unsigned int JsrtRuntime::Idle()
 {
     return this->threadService.Idle();
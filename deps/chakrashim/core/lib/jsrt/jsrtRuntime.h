@@ -34,6 +34,7 @@ public:
 
     void CloseContexts();
     void SetBeforeCollectCallback(JsBeforeCollectCallback beforeCollectCallback, void * callbackContext);
+    void SetSampleCallback(JsSampleCallback sampleCallback, void * sampleCallbackState);
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     void SetSerializeByteCodeForLibrary(bool set) { serializeByteCodeForLibrary = set; }
@@ -42,6 +43,9 @@ public:
 
 private:
     static void __cdecl RecyclerCollectCallbackStatic(void * context, RecyclerCollectCallBackFlags flags);
+    static void SampleHandlerStatic(Js::ScriptContext * scriptContext, void * state);
+
+    static const uint MaxSampleFrames = 64;
 
 private:
     ThreadContext * threadContext;
@@ -51,6 +55,9 @@ private:
     JsBeforeCollectCallback beforeCollectCallback;
     JsrtThreadService threadService;
     void * callbackContext;
+    JsSampleCallback sampleCallback;
+    void * sampleCallbackState;
+    JsSampleFrame sampleFrames[MaxSampleFrames];
     bool useIdle;
     bool dispatchExceptions;
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
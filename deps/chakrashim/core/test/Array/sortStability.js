@@ -0,0 +1,214 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Array.prototype.sort: stability, comparison functions that throw or change the array part way through, and the default
+// order of native int arrays, which are compared by their decimal strings without creating them.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var sizes = [0, 1, 2, 10, 31, 32, 33, 100, 511, 512, 513, 2000];
+
+function random(seed) {
+    return function () {
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+        return seed >> 8;
+    };
+}
+
+// Records with few distinct keys, in the given order of keys, remembering where each record started
+function records(size, keyOf) {
+    var result = [];
+    for (var i = 0; i < size; i++) {
+        result.push({ key: keyOf(i), position: i });
+    }
+    return result;
+}
+
+function checkStable(sorted, description) {
+    for (var i = 1; i < sorted.length; i++) {
+        var a = sorted[i - 1];
+        var b = sorted[i];
+        if (a.key > b.key || (a.key === b.key && a.position > b.position)) {
+            assert.fail(description + ": " + JSON.stringify(a) + " before " + JSON.stringify(b) + " at " + i);
+        }
+    }
+}
+
+function numbers(array) {
+    return Array.prototype.slice.call(array).sort(function (a, b) { return a - b; });
+}
+
+var tests = [
+    {
+        name: "Equal keys keep their order",
+        body: function () {
+            var next = random(1);
+            var orders = {
+                "random": function (i) { return next() % 5; },
+                "ascending runs": function (i) { return (i % 50) >> 3; },
+                "descending": function (i) { return 1000 - (i >> 2); },
+                "all equal": function (i) { return 0; },
+                "sawtooth": function (i) { return i % 7; },
+                "mostly sorted": function (i) { return i % 97 === 0 ? next() % 100 : i >> 1; }
+            };
+            Object.keys(orders).forEach(function (order) {
+                sizes.forEach(function (size) {
+                    var array = records(size, orders[order]);
+                    var result = array.sort(function (a, b) { return a.key - b.key; });
+                    assert.isTrue(result === array, "sorted in place");
+                    assert.areEqual(size, array.length, order + " " + size + ": length");
+                    checkStable(array, order + " " + size);
+                });
+            });
+        }
+    },
+    {
+        name: "The default order keeps equal strings in order",
+        body: function () {
+            var objects = [];
+            for (var i = 0; i < 600; i++) {
+                objects.push({ position: i, toString: (function (s) { return function () { return s; }; })(String.fromCharCode(0x61 + i % 3)) });
+            }
+            objects.sort();
+            for (var i = 1; i < objects.length; i++) {
+                var a = objects[i - 1];
+                var b = objects[i];
+                assert.isTrue(String(a) < String(b) || (String(a) === String(b) && a.position < b.position), "element " + i);
+            }
+        }
+    },
+    {
+        name: "A comparison function that throws part way through leaves a permutation",
+        body: function () {
+            [10, 100, 600, 3000].forEach(function (size) {
+                var next = random(size);
+                var original = [];
+                for (var i = 0; i < size; i++) {
+                    original.push(next() % (size >> 1));
+                }
+                var expected = numbers(original);
+                var comparisons = size * 12;
+                for (var throwAt = 1; throwAt < comparisons; throwAt = throwAt * 3 + 1) {
+                    var array = original.slice();
+                    var count = 0;
+                    var error = new Error("compare " + throwAt);
+                    try {
+                        array.sort(function (a, b) {
+                            if (++count === throwAt) {
+                                throw error;
+                            }
+                            return a - b;
+                        });
+                    } catch (e) {
+                        assert.isTrue(e === error, "the comparison function's exception");
+                    }
+                    assert.areEqual(size, array.length, size + " elements, throwing at " + throwAt + ": length");
+                    assert.areEqual(expected, numbers(array), size + " elements, throwing at " + throwAt + ": permutation");
+                }
+            });
+        }
+    },
+    {
+        name: "Objects that are only referenced from the array survive a throw and a collection",
+        body: function () {
+            var array = [];
+            for (var i = 0; i < 1000; i++) {
+                array.push({ value: (i * 7919) % 1000 });
+            }
+            var count = 0;
+            try {
+                array.sort(function (a, b) {
+                    if (++count === 5000) {
+                        if (typeof CollectGarbage === "function") {
+                            CollectGarbage();
+                        }
+                        throw new Error("stop");
+                    }
+                    return a.value - b.value;
+                });
+            } catch (e) {
+            }
+            var values = array.map(function (o) { return o.value; }).sort(function (a, b) { return a - b; });
+            for (var i = 0; i < 1000; i++) {
+                assert.areEqual(i, values[i], "value " + i);
+            }
+        }
+    },
+    {
+        name: "A comparison function that changes the array",
+        body: function () {
+            [20, 600].forEach(function (size) {
+                var make = function () {
+                    var array = [];
+                    for (var i = 0; i < size; i++) {
+                        array.push((i * 31) % size);
+                    }
+                    return array;
+                };
+                var allowed = function (v) { return v === "x" || (typeof v === "number" && v >= 0 && v < size) || v === undefined; };
+
+                var grown = make();
+                grown.sort(function (a, b) { grown.push(-1); return a - b; });
+                assert.isTrue(grown.length >= size, size + ": pushed elements are not sorted in");
+
+                var emptied = make();
+                var count = 0;
+                emptied.sort(function (a, b) { if (++count === 10) { emptied.length = 0; } return a - b; });
+                assert.isTrue(emptied.every(allowed), size + ": emptied");
+
+                var overwritten = make();
+                overwritten.sort(function (a, b) { overwritten[a % overwritten.length] = "x"; return a - b; });
+                assert.areEqual(size, overwritten.length, size + ": overwritten length");
+                assert.isTrue(overwritten.every(allowed), size + ": overwritten elements");
+            });
+        }
+    },
+    {
+        name: "Native int arrays in the default order",
+        body: function () {
+            var cases = [
+                [-1, -10, -2, 10, 1, 2, 0, -100, 100, -11, 11],
+                [2147483647, -2147483648, -2147483647, 2147483646, 0, -1, 1],
+                [9, 89, 899, 8999, 90, 900, 9000, 8, 80, 800, -9, -89, -90, -8],
+                [5, 5, 5, 50, 5, -5, -5, -50, 0, 0],
+                [10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, -1, -2, -3]
+            ];
+            var next = random(7);
+            var large = [];
+            for (var i = 0; i < 3000; i++) {
+                large.push((next() % 200001) - 100000);
+            }
+            cases.push(large);
+            cases.forEach(function (array, n) {
+                var expected = array.map(String).sort(function (a, b) { return a < b ? -1 : a > b ? 1 : 0; });
+                var sorted = array.slice().sort();
+                assert.areEqual(expected, sorted.map(String), "case " + n);
+                sorted.forEach(function (v) { assert.areEqual("number", typeof v, "case " + n + " keeps numbers"); });
+            });
+        }
+    },
+    {
+        name: "Int arrays that do not take the in-place path",
+        body: function () {
+            var holes = [3, , -1, , 20, -3];
+            holes.sort();
+            assert.areEqual(6, holes.length, "length with holes");
+            assert.areEqual([-1, -3, 20, 3], holes.slice(0, 4), "holes move to the end");
+            assert.isFalse(4 in holes || 5 in holes, "holes stay holes");
+
+            var withUndefined = [3, undefined, -1, 20];
+            withUndefined.sort();
+            assert.areEqual([-1, 20, 3, undefined], withUndefined, "undefined sorts last");
+
+            var proto = [5, -5, 50];
+            proto.__proto__ = Object.create(Array.prototype, { 3: { value: -50, writable: true, configurable: true } });
+            proto.length = 4;
+            proto.sort();
+            assert.areEqual(["-5", "-50", "5", "50"], proto.map(String), "element from the prototype");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
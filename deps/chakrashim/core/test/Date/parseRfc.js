@@ -0,0 +1,243 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Date.parse of strings in the formats of toUTCString and toString, which are parsed without going through the generic
+// parser, and of strings close to those formats that are left to it. Separating the fields with two spaces rather than
+// one keeps a string away from the direct parser without changing what it means to the generic one, so every string is
+// also parsed that way and the two must agree. Strings without a zone are in local time, which is checked against the
+// Date constructor, so the results do not depend on the time zone the test runs in.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var months = ["Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"];
+var days = ["Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"];
+
+function pad(n) {
+    return (n < 10 ? "0" : "") + n;
+}
+
+// The same string for the generic parser
+function generic(s) {
+    return s.replace(/ /g, "  ");
+}
+
+function parse(s, description) {
+    var direct = Date.parse(s);
+    var slow = Date.parse(generic(s));
+    if (!Object.is(direct, slow)) {
+        assert.fail(description + ": " + JSON.stringify(s) + " is " + direct + " but " + slow + " with two spaces");
+    }
+    return direct;
+}
+
+function rfc(year, month, day, hour, minute, second, zone) {
+    var s = pad(day) + " " + months[month] + " " + year + " " + pad(hour) + ":" + pad(minute);
+    if (second !== undefined) {
+        s += ":" + pad(second);
+    }
+    return zone === undefined ? s : s + " " + zone;
+}
+
+var tests = [
+    {
+        name: "Strings from toUTCString and toString",
+        body: function () {
+            var times = [0, 1, 86399999, 951782400000, 1000000000000, 1420070400000, 1435708799000, 1451606399000, -1, -86400000, -631152000000,
+                         253402300799000];
+            times.forEach(function (t) {
+                var date = new Date(t);
+                var seconds = Math.floor(t / 1000) * 1000;
+                assert.areEqual(seconds, parse(date.toUTCString(), "toUTCString"), "toUTCString of " + t);
+                assert.areEqual(seconds, parse(date.toString(), "toString"), "toString of " + t);
+                assert.areEqual(seconds, parse(date.toString().replace(/ \(.*\)$/, ""), "toString"), "toString without the zone name of " + t);
+            });
+        }
+    },
+    {
+        name: "Strings with a zone",
+        body: function () {
+            var cases = [
+                ["Tue, 25 Dec 2012 10:20:30 GMT", Date.UTC(2012, 11, 25, 10, 20, 30)],
+                ["Tue 25 Dec 2012 10:20:30 GMT", Date.UTC(2012, 11, 25, 10, 20, 30)],
+                ["25 Dec 2012 10:20:30 GMT", Date.UTC(2012, 11, 25, 10, 20, 30)],
+                ["25 Dec 2012 10:20 GMT", Date.UTC(2012, 11, 25, 10, 20)],
+                ["5 Dec 2012 10:20 GMT", Date.UTC(2012, 11, 5, 10, 20)],
+                ["Dec 25 2012 10:20:30 GMT", Date.UTC(2012, 11, 25, 10, 20, 30)],
+                ["Tue Dec 25 2012 10:20:30 GMT", Date.UTC(2012, 11, 25, 10, 20, 30)],
+                ["25 Dec 2012 10:20:30 UTC", Date.UTC(2012, 11, 25, 10, 20, 30)],
+                ["25 Dec 2012 10:20:30 UT", Date.UTC(2012, 11, 25, 10, 20, 30)],
+                ["25 Dec 2012 10:20:30 Z", Date.UTC(2012, 11, 25, 10, 20, 30)],
+                ["25 dec 2012 10:20:30 gmt", Date.UTC(2012, 11, 25, 10, 20, 30)],
+                ["25 DEC 2012 10:20:30 GMT", Date.UTC(2012, 11, 25, 10, 20, 30)],
+                ["25 Dec 2012 10:20:30 GMT+0130", Date.UTC(2012, 11, 25, 8, 50, 30)],
+                ["25 Dec 2012 10:20:30 GMT-0800", Date.UTC(2012, 11, 25, 18, 20, 30)],
+                ["25 Dec 2012 10:20:30 +0100", Date.UTC(2012, 11, 25, 9, 20, 30)],
+                ["25 Dec 2012 10:20:30 -1200", Date.UTC(2012, 11, 25, 22, 20, 30)],
+                ["25 Dec 2012 10:20:30 +0005", Date.UTC(2012, 11, 25, 5, 20, 30)],
+                ["25 Dec 2012 10:20:30 +0030", Date.UTC(2012, 11, 25, 9, 50, 30)],
+                ["25 Dec 2012 10:20:30 GMT+0000 (Coordinated Universal Time)", Date.UTC(2012, 11, 25, 10, 20, 30)],
+                ["Thu Jan 01 1970 00:00:00 GMT+0000", 0],
+                ["01 Jan 0100 00:00 GMT", Date.UTC(100, 0, 1)],
+                ["31 Dec 9999 23:59:59 GMT", 253402300799000]
+            ];
+            cases.forEach(function (c) {
+                assert.areEqual(c[1], parse(c[0], c[0]), c[0]);
+            });
+        }
+    },
+    {
+        name: "Strings without a zone are in local time",
+        body: function () {
+            var cases = [
+                ["25 Dec 2012 10:20:30", new Date(2012, 11, 25, 10, 20, 30)],
+                ["25 Dec 2012 10:20", new Date(2012, 11, 25, 10, 20)],
+                ["Tue, 25 Dec 2012 00:00", new Date(2012, 11, 25)],
+                ["Dec 25 2012 23:59:59", new Date(2012, 11, 25, 23, 59, 59)],
+                ["1 Jul 2015 12:00", new Date(2015, 6, 1, 12)],
+                ["1 Jan 1970 00:00", new Date(1970, 0, 1)],
+                ["Fri Jul 01 2016 12:00:00 (Some Time)", new Date(2016, 6, 1, 12)]
+            ];
+            cases.forEach(function (c) {
+                assert.areEqual(c[1].getTime(), parse(c[0], c[0]), c[0]);
+            });
+        }
+    },
+    {
+        name: "Days past the end of the month roll over",
+        body: function () {
+            var cases = [
+                ["31 Feb 2015 10:00 GMT", Date.UTC(2015, 2, 3, 10)],
+                ["29 Feb 2015 10:00 GMT", Date.UTC(2015, 2, 1, 10)],
+                ["29 Feb 2016 10:00 GMT", Date.UTC(2016, 1, 29, 10)],
+                ["29 Feb 1900 10:00 GMT", Date.UTC(1900, 2, 1, 10)],
+                ["29 Feb 2000 10:00 GMT", Date.UTC(2000, 1, 29, 10)],
+                ["31 Apr 2015 10:00 GMT", Date.UTC(2015, 4, 1, 10)],
+                ["32 Dec 2015 10:00 GMT", Date.UTC(2016, 0, 1, 10)],
+                ["69 Dec 2015 10:00 GMT", Date.UTC(2016, 1, 7, 10)],
+                ["00 Jan 2016 10:00 GMT", Date.UTC(2015, 11, 31, 10)],
+                ["31 Dec 2015 23:30 -0100", Date.UTC(2016, 0, 1, 0, 30)],
+                ["01 Jan 2016 00:30 +0100", Date.UTC(2015, 11, 31, 23, 30)],
+                ["28 Feb 2016 23:59:59 -2359", Date.UTC(2016, 1, 29, 23, 58, 59)],
+                ["01 Mar 2015 00:00 +0001", Date.UTC(2015, 1, 28, 23, 59)]
+            ];
+            cases.forEach(function (c) {
+                assert.areEqual(c[1], parse(c[0], c[0]), c[0]);
+            });
+            assert.areEqual(new Date(2015, 2, 3, 10).getTime(), parse("31 Feb 2015 10:00", "local"), "local time");
+        }
+    },
+    {
+        name: "Fields the direct parser does not accept",
+        body: function () {
+            // Each of these is left to the generic parser, which must read it as if it had never been tried directly
+            var strings = [
+                "25 Dec 2012 24:00 GMT",
+                "25 Dec 2012 24:00:00 GMT",
+                "25 Dec 2012 23:60 GMT",
+                "25 Dec 2012 23:59:60 GMT",
+                "25 Dec 2012 99:00 GMT",
+                "25 Dec 2012 24:00",
+                "25 Dec 99 10:00 GMT",
+                "25 Dec 0099 10:00 GMT",
+                "70 Dec 2012 10:00 GMT",
+                "Dec 70 2012 10:00 GMT",
+                "25 Dec 2012 10:00 PST",
+                "25 Dec 2012 10:00 EDT",
+                "25 Dec 2012 10:00 GMT+1",
+                "25 Dec 2012 10:00 GMT+01",
+                "25 Dec 2012 10:00 GMT+01:00",
+                "25 Dec 2012 10:00 +01",
+                "25 Dec 2012 10:00 GMTX",
+                "25 Dec 2012 10:00 A",
+                "25 Dec 2012 10:00 GMT (nested (comment))",
+                "25 Dec 2012 10:00 GMT (unclosed",
+                "25 Dec 2012 10:00 GMT extra",
+                "25 Dec 2012 10:00 pm",
+                "25 Dec 2012 10:00 GMT 2013",
+                "25 Dec 2012 10 GMT",
+                "25 Dec 2012 1:00 GMT",
+                "25 Dec 2012 10:0 GMT",
+                "25 December 2012 10:00 GMT",
+                "25 Dez 2012 10:00 GMT",
+                "Tuesday, 25 Dec 2012 10:00 GMT",
+                "Tue,25 Dec 2012 10:00 GMT",
+                "Xyz 25 Dec 2012 10:00 GMT",
+                "25-Dec-2012 10:00 GMT",
+                "25 Dec 2012, 10:00 GMT",
+                "25 Dec 20120 10:00 GMT",
+                " 25 Dec 2012 10:00 GMT",
+                "25 Dec 2012 10:00 GMT ",
+                "25 Dec 2012 10:00\tGMT",
+                "",
+                "Dec",
+                "25 Dec"
+            ];
+            strings.forEach(function (s) {
+                parse(s, s);
+            });
+            assert.isTrue(isNaN(Date.parse("25 Dec 2012 24:00 GMT")), "hour 24 is rejected by the generic parser as well");
+            assert.isTrue(isNaN(Date.parse("25 Dec 2012 23:60 GMT")), "minute 60");
+            assert.isTrue(isNaN(Date.parse("25 Dec 2012 23:59:60 GMT")), "second 60");
+            assert.areEqual(Date.UTC(1999, 11, 25, 10), Date.parse("25 Dec 99 10:00 GMT"), "a two digit year is in the 1900s");
+            assert.areEqual(Date.UTC(2012, 11, 25, 9), Date.parse("25 Dec 2012 10:00 +01"), "an offset in hours");
+            assert.areEqual(Date.UTC(2012, 11, 25, 18), Date.parse("25 Dec 2012 10:00 PST"), "a named zone");
+            assert.areEqual(Date.UTC(2012, 11, 25, 22), Date.parse("25 Dec 2012 10:00 pm GMT"), "pm");
+        }
+    },
+    {
+        name: "Local times either side of daylight saving time transitions",
+        body: function () {
+            // The days on which daylight saving time starts or ends in North America, Europe and Australia, on which local
+            // time skips or repeats an hour if the test runs in one of those time zones
+            var transitions = [
+                [2015, 2, 8], [2015, 10, 1], [2015, 2, 29], [2015, 9, 25], [2015, 3, 5], [2015, 9, 4],
+                [2016, 2, 13], [2016, 10, 6], [2016, 2, 27], [2016, 9, 30], [2006, 3, 2], [2006, 9, 29], [1990, 3, 1], [2030, 2, 10]
+            ];
+            transitions.forEach(function (t) {
+                for (var dayOffset = -1; dayOffset <= 1; dayOffset++) {
+                    for (var minutes = 0; minutes < 24 * 60; minutes += 15) {
+                        var hour = Math.floor(minutes / 60);
+                        var minute = minutes % 60;
+                        var expected = new Date(t[0], t[1], t[2] + dayOffset, hour, minute);
+                        var local = new Date(t[0], t[1], t[2] + dayOffset);
+                        var s = rfc(local.getFullYear(), local.getMonth(), local.getDate(), hour, minute, 0);
+                        assert.areEqual(expected.getTime(), parse(s, s), s);
+                        assert.areEqual(expected.getTime(), parse(days[local.getDay()] + " " + months[local.getMonth()] + " " + pad(local.getDate()) + " " +
+                            local.getFullYear() + " " + pad(hour) + ":" + pad(minute) + ":00", s), s + " in the toString order");
+
+                        var utc = Date.UTC(local.getFullYear(), local.getMonth(), local.getDate(), hour, minute);
+                        assert.areEqual(utc, parse(rfc(local.getFullYear(), local.getMonth(), local.getDate(), hour, minute, 0, "GMT"), s), s + " GMT");
+                    }
+                }
+            });
+        }
+    },
+    {
+        name: "Local times in other years and seasons after each other",
+        body: function () {
+            // Each conversion may reuse the offset found by the last one, so these jump between seasons, years and the
+            // ends of the range where the offset is known
+            var next = 12345;
+            for (var i = 0; i < 2000; i++) {
+                next = (next * 1103515245 + 12345) & 0x7fffffff;
+                var year = i % 3 === 0 ? 1970 + (next % 80) : 2015 + (next % 3);
+                var month = (next >> 8) % 12;
+                var day = 1 + (next >> 12) % 28;
+                var hour = (next >> 16) % 24;
+                var minute = (next >> 4) % 60;
+                var s = rfc(year, month, day, hour, minute, 30);
+                var expected = new Date(year, month, day, hour, minute, 30);
+                assert.areEqual(expected.getTime(), parse(s, s), s);
+                if (expected.getHours() === hour) {
+                    // Unless the time was skipped when daylight saving time started, it reads back the same
+                    var date = new Date(Date.parse(s));
+                    assert.areEqual([year, month, day, hour, minute], [date.getFullYear(), date.getMonth(), date.getDate(), date.getHours(), date.getMinutes()], s + " in local time");
+                }
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,190 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Computed property keys that are strings built at run time rather than property strings. Such a string is looked up by
+// identity in a small per-context cache once it has been used to get a property, so these check keys that collide in
+// the cache, keys that are array indices, and strings that are collected and replaced by new ones at the same address.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// A new string with the given contents, which is not a property string
+function build(s) {
+    return (s + "#").slice(0, -1);
+}
+
+function collect() {
+    if (typeof CollectGarbage === "function") {
+        CollectGarbage();
+    }
+}
+
+var tests = [
+    {
+        name: "More keys than the cache has entries",
+        body: function () {
+            var count = 1000;
+            var o = {};
+            var keys = [];
+            for (var i = 0; i < count; i++) {
+                keys.push(build("key" + i));
+                o[keys[i]] = i;
+            }
+            for (var round = 0; round < 3; round++) {
+                for (var i = 0; i < count; i++) {
+                    var k = round === 1 ? keys[count - 1 - i] : keys[(i * 7919) % count];
+                    assert.areEqual(keys.indexOf(k), o[k], "key " + k + " in round " + round);
+                }
+            }
+        }
+    },
+    {
+        name: "Equal strings with different identities",
+        body: function () {
+            var o = { alpha: 1, beta: 2 };
+            var keys = [build("alpha"), build("alpha"), "alpha", build("beta"), "al" + build("pha")];
+            for (var i = 0; i < 10; i++) {
+                assert.areEqual([1, 1, 1, 2, 1], keys.map(function (k) { return o[k]; }), "round " + i);
+            }
+            o[keys[0]] = 10;
+            assert.areEqual([10, 10, 10, 2, 10], keys.map(function (k) { return o[k]; }), "after a store through one of them");
+        }
+    },
+    {
+        name: "Keys that are or are not array indices",
+        body: function () {
+            var o = { "01": "leading zero", "-0": "minus zero", "4294967295": "max uint32", "1.5": "fraction" };
+            o[1] = "one";
+            o[4294967294] = "max index";
+            var a = ["zero", "one", "two"];
+            var cases = [["1", "one", "one"], ["01", "leading zero", undefined], ["-0", "minus zero", undefined], ["4294967295", "max uint32", undefined],
+                         ["4294967294", "max index", undefined], ["1.5", "fraction", undefined], ["2", undefined, "two"], ["length", undefined, 3]];
+            for (var round = 0; round < 3; round++) {
+                cases.forEach(function (c) {
+                    var k = build(c[0]);
+                    assert.areEqual(c[1], o[k], "object[" + c[0] + "] in round " + round);
+                    assert.areEqual(c[2], a[k], "array[" + c[0] + "] in round " + round);
+                });
+            }
+            var key = build("2");
+            assert.areEqual("two", a[key], "index key read");
+            a[key] = "TWO";
+            assert.areEqual("TWO", a[2], "index key stored");
+            assert.areEqual(3, a.length, "the array did not grow");
+        }
+    },
+    {
+        name: "Keys collected and replaced by new strings",
+        body: function () {
+            var o = {};
+            for (var i = 0; i < 64; i++) {
+                o["p" + i] = i;
+            }
+            for (var round = 0; round < 10; round++) {
+                // New strings on every round, which are likely to reuse the addresses of the previous round's strings, but for
+                // other properties
+                var keys = [];
+                for (var i = 0; i < 64; i++) {
+                    keys.push(build("p" + ((i + round * 13) % 64)));
+                }
+                keys.forEach(function (k) {
+                    assert.areEqual(+k.substring(1), o[k], k + " in round " + round);
+                });
+                keys = null;
+                collect();
+            }
+        }
+    },
+    {
+        name: "Stores through a cached key",
+        body: function () {
+            var key = build("value");
+            var plain = { value: 1 };
+            assert.areEqual(1, plain[key], "read to fill the cache");
+
+            var frozen = Object.freeze({ value: 2 });
+            frozen[key] = 20;
+            assert.areEqual(2, frozen[key], "frozen object");
+            assert.throws(function () { "use strict"; frozen[key] = 20; }, TypeError, "strict store to a frozen object");
+
+            var stored;
+            var withSetter = Object.create({ set value(v) { stored = v; }, get value() { return "getter"; } });
+            withSetter[key] = 30;
+            assert.areEqual(30, stored, "setter on the prototype");
+            assert.areEqual("getter", withSetter[key], "getter on the prototype");
+            assert.isFalse(withSetter.hasOwnProperty("value"), "no own property was added");
+
+            var empty = {};
+            empty[key] = 40;
+            assert.areEqual(40, empty.value, "new property");
+            assert.areEqual(["value"], Object.keys(empty), "new property keys");
+        }
+    },
+    {
+        name: "Properties that change after their key is cached",
+        body: function () {
+            var key = build("prop");
+            var o = { prop: 1 };
+            assert.areEqual(1, o[key], "data property");
+            delete o.prop;
+            assert.areEqual(undefined, o[key], "deleted");
+            Object.prototype.prop = "inherited";
+            try {
+                assert.areEqual("inherited", o[key], "inherited from Object.prototype");
+            } finally {
+                delete Object.prototype.prop;
+            }
+            Object.defineProperty(o, "prop", { get: function () { return "accessor"; }, configurable: true });
+            assert.areEqual("accessor", o[key], "accessor");
+            Object.setPrototypeOf(o, { prop: "new prototype" });
+            assert.areEqual("accessor", o[key], "own accessor after a prototype change");
+            delete o.prop;
+            assert.areEqual("new prototype", o[key], "new prototype");
+        }
+    },
+    {
+        name: "Cached keys used with other kinds of objects",
+        body: function () {
+            var lengthKey = build("length");
+            var fooKey = build("foo");
+            assert.areEqual(3, [1, 2, 3][lengthKey], "array length");
+            assert.areEqual(5, "hello"[lengthKey], "string length");
+            assert.areEqual(4, new Int8Array(4)[lengthKey], "typed array length");
+            assert.areEqual(2, (function () { return arguments; })(1, 2)[lengthKey], "arguments length");
+            var seen = [];
+            var proxy = new Proxy({}, { get: function (target, name) { seen.push(name); return "trapped"; } });
+            assert.areEqual("trapped", proxy[fooKey], "proxy");
+            assert.areEqual(["foo"], seen, "the trap saw the key");
+            assert.areEqual(undefined, (5)[fooKey], "number");
+            assert.throws(function () { return null[fooKey]; }, TypeError, "null");
+            assert.throws(function () { return undefined[fooKey]; }, TypeError, "undefined");
+            assert.areEqual(undefined, {}[fooKey], "missing property");
+        }
+    },
+    {
+        name: "Keys from string operations in a hot loop",
+        body: function () {
+            function sum(o, query) {
+                var total = 0;
+                var pairs = query.split("&");
+                for (var i = 0; i < pairs.length; i++) {
+                    var name = pairs[i].substring(0, pairs[i].indexOf("="));
+                    total += o[name];
+                }
+                return total;
+            }
+            var o = { a: 1, bb: 10, ccc: 100, dddd: 1000 };
+            for (var i = 0; i < 100; i++) {
+                assert.areEqual(1111, sum(o, "a=1&bb=2&ccc=3&dddd=4"), "run " + i);
+                if (i % 25 === 0) {
+                    collect();
+                }
+            }
+            o.bb = 20;
+            assert.areEqual(1121, sum(o, "a=1&bb=2&ccc=3&dddd=4"), "after a store");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,154 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// JSON.parse of arrays of objects that mostly share their member names. An object whose first member matches the
+// previous one's starts out with the type that one ended up with, so every way in which the members can go on to differ
+// is checked to still give objects with exactly the parsed properties, in the parsed order.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function keys(count, prefix) {
+    var result = [];
+    for (var i = 0; i < count; i++) {
+        result.push((prefix || "k") + i);
+    }
+    return result;
+}
+
+function record(names, seed) {
+    return "{" + names.map(function (name, i) { return '"' + name + '":' + (seed * 100 + i); }).join(",") + "}";
+}
+
+// Parses the records as one array and checks each object's own properties and values, in order
+function check(description, records) {
+    var text = "[" + records.map(function (names, seed) { return record(names, seed); }).join(",") + "]";
+    var parsed = JSON.parse(text);
+    assert.areEqual(records.length, parsed.length, description + ": record count");
+    records.forEach(function (names, seed) {
+        var o = parsed[seed];
+        assert.areEqual(names, Object.keys(o), description + ": keys of record " + seed);
+        names.forEach(function (name, i) {
+            assert.areEqual(seed * 100 + i, o[name], description + ": record " + seed + "." + name);
+        });
+    });
+    return parsed;
+}
+
+function times(count, names) {
+    var result = [];
+    for (var i = 0; i < count; i++) {
+        result.push(names);
+    }
+    return result;
+}
+
+var tests = [
+    {
+        name: "Identical records of several sizes",
+        body: function () {
+            [1, 2, 4, 16, 48].forEach(function (count) {
+                check(count + " keys", times(10, keys(count)));
+            });
+        }
+    },
+    {
+        name: "Key orders that diverge after the first key",
+        body: function () {
+            check("swapped", [["a", "b", "c"], ["a", "b", "c"], ["a", "c", "b"], ["a", "b", "c"], ["a", "c", "b"]]);
+            check("last differs", times(3, ["a", "b", "c", "d"]).concat([["a", "b", "c", "e"], ["a", "b", "c", "d"]]));
+            check("second differs", times(3, keys(20)).concat([["k0", "x"].concat(keys(20).slice(2))], times(2, keys(20))));
+            check("first differs", times(3, ["a", "b"]).concat([["b", "a"], ["a", "b"]]));
+        }
+    },
+    {
+        name: "Records that are shorter or longer than the previous ones",
+        body: function () {
+            check("shorter", times(3, keys(10)).concat([keys(3), keys(10), keys(1), keys(10)]));
+            check("longer", times(3, keys(3)).concat([keys(10), keys(3), keys(40), keys(3)]));
+            check("alternating", [keys(2), keys(30), keys(2), keys(30), keys(5), keys(30), keys(2)]);
+            check("empty", [keys(4), [], keys(4), [], keys(4)]);
+        }
+    },
+    {
+        name: "Shorter records do not get the missing properties",
+        body: function () {
+            var parsed = check("shorter", [keys(8), keys(8), keys(2)]);
+            assert.isFalse("k2" in parsed[2], "k2 is not a property");
+            assert.isFalse(parsed[2].hasOwnProperty("k7"), "k7 is not an own property");
+            assert.areEqual('{"k0":200,"k1":201}', JSON.stringify(parsed[2]), "stringified");
+            parsed[2].k7 = "added";
+            assert.areEqual(["k0", "k1", "k7"], Object.keys(parsed[2]), "added after the parse");
+            assert.areEqual(7, parsed[0].k7, "the first record is unchanged");
+        }
+    },
+    {
+        name: "Duplicate keys",
+        body: function () {
+            var text = '[{"a":1,"b":2,"c":3},{"a":1,"b":2,"c":3},{"a":4,"b":5,"a":6},{"a":7,"b":8,"c":9,"b":10},{"a":1,"a":2,"a":3},{"a":1,"b":2,"c":3}]';
+            var parsed = JSON.parse(text);
+            assert.areEqual(["a", "b"], Object.keys(parsed[2]), "keys with a repeated first key");
+            assert.areEqual(6, parsed[2].a, "the last value wins");
+            assert.areEqual(["a", "b", "c"], Object.keys(parsed[3]), "keys with a repeated key");
+            assert.areEqual(10, parsed[3].b, "the last value of b wins");
+            assert.areEqual(["a"], Object.keys(parsed[4]), "one key repeated");
+            assert.areEqual(3, parsed[4].a, "the last of three values wins");
+            assert.areEqual({ a: 1, b: 2, c: 3 }, parsed[5], "a record after the duplicates");
+        }
+    },
+    {
+        name: "Records with index and special keys",
+        body: function () {
+            var indexed = JSON.parse("[" + times(4, '{"a":1,"0":2,"1":3,"b":4}').join(",") + "]");
+            indexed.forEach(function (o, i) {
+                assert.areEqual(["0", "1", "a", "b"], Object.keys(o), "index keys come first in record " + i);
+                assert.areEqual([2, 3, 1, 4], [o[0], o[1], o.a, o.b], "values of record " + i);
+            });
+            var parsed = JSON.parse('[{"a":1,"__proto__":2,"b":3},{"a":1,"__proto__":2,"b":3},{"a":1,"b":3}]');
+            assert.areEqual(["a", "__proto__", "b"], Object.keys(parsed[1]), "__proto__ is an own property");
+            assert.isTrue(Object.getPrototypeOf(parsed[1]) === Object.prototype, "the prototype is unchanged");
+            assert.areEqual(["a", "b"], Object.keys(parsed[2]), "a record without __proto__");
+        }
+    },
+    {
+        name: "Records nested in each other and objects changed after the parse",
+        body: function () {
+            var inner = '{"x":1,"y":2}';
+            var text = "[" + times(6, '{"x":' + inner + ',"y":[' + inner + "," + inner + '],"z":3}').join(",") + "]";
+            var parsed = JSON.parse(text);
+            parsed.forEach(function (o, i) {
+                assert.areEqual({ x: { x: 1, y: 2 }, y: [{ x: 1, y: 2 }, { x: 1, y: 2 }], z: 3 }, o, "record " + i);
+            });
+            delete parsed[1].y;
+            parsed[2].w = 4;
+            Object.defineProperty(parsed[3], "x", { value: 0, writable: false });
+            parsed = JSON.parse(text);
+            parsed.forEach(function (o, i) {
+                assert.areEqual(["x", "y", "z"], Object.keys(o), "keys of record " + i + " after changing earlier objects");
+                o.x = i;
+                assert.areEqual(i, o.x, "x is writable in record " + i);
+            });
+        }
+    },
+    {
+        name: "Records revived with a reviver that changes them",
+        body: function () {
+            var text = "[" + times(5, record(keys(6), 1)).join(",") + "]";
+            var parsed = JSON.parse(text, function (key, value) {
+                if (key === "k2") {
+                    return undefined;
+                }
+                if (key === "k4") {
+                    this.extra = true;
+                }
+                return value;
+            });
+            parsed.forEach(function (o, i) {
+                assert.areEqual(["k0", "k1", "k3", "k4", "k5", "extra"], Object.keys(o), "record " + i);
+            });
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
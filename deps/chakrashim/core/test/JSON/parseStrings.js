@@ -0,0 +1,160 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// JSON.parse of string values and whitespace. The scanner takes plain string characters and whitespace eight at a time,
+// so every length and position is tried around that block size, and long escape-free values that may share the input's
+// buffer are checked to keep their contents after the input and the rest of the result are gone.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function repeat(s, count) {
+    return new Array(count + 1).join(s);
+}
+
+function collect() {
+    if (typeof CollectGarbage === "function") {
+        CollectGarbage();
+    }
+}
+
+var tests = [
+    {
+        name: "Plain strings of every length up to a few blocks",
+        body: function () {
+            for (var length = 0; length <= 40; length++) {
+                var s = "";
+                for (var i = 0; i < length; i++) {
+                    s += String.fromCharCode(0x61 + i % 26);
+                }
+                assert.areEqual(s, JSON.parse('"' + s + '"'), "length " + length);
+                assert.areEqual([s, 1], JSON.parse('["' + s + '",1]'), "length " + length + " in an array");
+            }
+        }
+    },
+    {
+        name: "A quote, an escape or a control character at every position",
+        body: function () {
+            for (var length = 1; length <= 34; length++) {
+                for (var at = 0; at < length; at++) {
+                    var before = repeat("x", at);
+                    var after = repeat("y", length - at - 1);
+                    assert.areEqual([before, after], JSON.parse('["' + before + '","' + after + '"]'), "quote at " + at + " of " + length);
+                    assert.areEqual(before + "\n" + after, JSON.parse('"' + before + '\\n' + after + '"'), "\\n at " + at + " of " + length);
+                    assert.areEqual(before + "\\" + after, JSON.parse('"' + before + '\\\\' + after + '"'), "\\\\ at " + at + " of " + length);
+                    assert.areEqual(before + "\u00e9" + after, JSON.parse('"' + before + '\\u00e9' + after + '"'), "\\u00e9 at " + at + " of " + length);
+                    assert.throws(function () { JSON.parse('"' + before + '\u0001' + after + '"'); }, SyntaxError, "control character at " + at + " of " + length);
+                    assert.throws(function () { JSON.parse('"' + before + after); }, SyntaxError, "unterminated at " + at + " of " + length);
+                }
+            }
+        }
+    },
+    {
+        name: "Every escape sequence",
+        body: function () {
+            var escaped = '"\\" \\\\ \\/ \\b \\f \\n \\r \\t \\u0000 \\u001f \\u0041 \\uFFFF \\ud83d\\ude00"';
+            assert.areEqual("\" \\ / \b \f \n \r \t \u0000 \u001f A \uffff \ud83d\ude00", JSON.parse(escaped), "escapes");
+            assert.areEqual("\ud800", JSON.parse('"\\ud800"'), "lone lead surrogate");
+            assert.areEqual("\udc00x", JSON.parse('"\\udc00x"'), "lone trail surrogate");
+            assert.throws(function () { JSON.parse('"\\x41"'); }, SyntaxError, "unknown escape");
+            assert.throws(function () { JSON.parse('"\\u12"'); }, SyntaxError, "short \\u escape");
+            assert.throws(function () { JSON.parse('"\\u12g4"'); }, SyntaxError, "bad hex digit");
+        }
+    },
+    {
+        name: "Characters that only differ from the special ones in their high bits",
+        body: function () {
+            var chars = [0x80, 0x2022, 0x7fff, 0x8000, 0x8001, 0x800a, 0x801f, 0x8020, 0x8022, 0x805c, 0xd83d, 0xfffe, 0xffff, 0x0122, 0x015c, 0x1f00];
+            chars.forEach(function (code) {
+                var ch = String.fromCharCode(code);
+                for (var at = 0; at < 18; at++) {
+                    var s = repeat("a", at) + ch + repeat("b", 17 - at);
+                    assert.areEqual(s, JSON.parse('"' + s + '"'), "U+" + code.toString(16) + " at " + at);
+                }
+            });
+        }
+    },
+    {
+        name: "Runs of whitespace of every length",
+        body: function () {
+            var space = " \t\r\n";
+            for (var length = 0; length <= 34; length++) {
+                var ws = "";
+                for (var i = 0; i < length; i++) {
+                    ws += space[i % space.length];
+                }
+                var text = ws + "{" + ws + '"a"' + ws + ":" + ws + "[" + ws + "1" + ws + "," + ws + '"s"' + ws + "]" + ws + "}" + ws;
+                assert.areEqual('{"a":[1,"s"]}', JSON.stringify(JSON.parse(text)), "whitespace run of " + length);
+                assert.throws(function () { JSON.parse(ws + "\u000b" + ws + "1"); }, SyntaxError, "vertical tab after " + length);
+                assert.throws(function () { JSON.parse(ws + "\u00a0" + ws + "1"); }, SyntaxError, "no-break space after " + length);
+            }
+        }
+    },
+    {
+        name: "Long strings that make up most of the input",
+        body: function () {
+            var long = repeat("0123456789abcdef", 4096);
+            var value = JSON.parse('"' + long + '"');
+            var inArray = JSON.parse('["' + long + '"]')[0];
+            var inObject = JSON.parse('{"key":"' + long + '","n":1}').key;
+            collect();
+            assert.areEqual(long.length, value.length, "length of the whole input");
+            assert.isTrue(long === value, "whole input");
+            assert.isTrue(long === inArray, "in an array");
+            assert.isTrue(long === inObject, "in an object");
+            assert.areEqual("f0", value.substring(15, 17), "substring of the value");
+            assert.areEqual(long + "!", value + "!", "concatenated with the value");
+        }
+    },
+    {
+        name: "Long strings that make up a small part of the input",
+        body: function () {
+            var values = [];
+            var parts = [];
+            for (var i = 0; i < 200; i++) {
+                values.push("value " + i + " " + repeat(String.fromCharCode(0x41 + i % 26), 32 + i % 17));
+                parts.push('"' + values[i] + '"');
+            }
+            var text = "[" + parts.join(",\n  ") + "]";
+            var kept = JSON.parse(text).filter(function (v, i) { return i % 50 === 7; });
+            text = null;
+            collect();
+            assert.areEqual(values.filter(function (v, i) { return i % 50 === 7; }), kept, "kept values");
+        }
+    },
+    {
+        name: "Long strings next to escaped ones",
+        body: function () {
+            var plain = repeat("p", 40);
+            var text = '{"a":"' + plain + '","b":"' + plain + '\\t' + plain + '","c":"\\u0041' + plain + '","' + plain + '":"' + plain + '"}';
+            var result = JSON.parse(text);
+            assert.areEqual(plain, result.a, "plain");
+            assert.areEqual(plain + "\t" + plain, result.b, "escape in the middle");
+            assert.areEqual("A" + plain, result.c, "escape at the start");
+            assert.areEqual(plain, result[plain], "long key");
+            assert.areEqual(["a", "b", "c", plain], Object.keys(result), "keys");
+        }
+    },
+    {
+        name: "Strings from a reviver and from parsing a substring",
+        body: function () {
+            var long = repeat("r", 64);
+            var seen = [];
+            var result = JSON.parse('{"a":"' + long + '","b":["' + long + 'x"]}', function (key, value) {
+                if (typeof value === "string") {
+                    seen.push(value);
+                    return value + "!";
+                }
+                return value;
+            });
+            assert.areEqual([long, long + "x"], seen, "values passed to the reviver");
+            assert.areEqual(long + "!", result.a, "revived value");
+            var outer = "xx" + '"' + long + '"' + "yy";
+            assert.areEqual(long, JSON.parse(outer.substring(2, outer.length - 2)), "input that is itself a substring");
+            assert.areEqual(long, JSON.parse(["", '"', long, '"'].join("")), "input that is a concatenation");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,208 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// JSON.stringify of objects that share their type. Without a replacer, the members of such objects are read from their
+// slots, in an order learned once per type, so the results are checked against text built by hand and against what a
+// replacer function that changes nothing gives, which enumerates every object. Also checked: toJSON methods that change
+// the object being stringified, and more distinct types than the serializer keeps member lists for.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function keys(count, prefix) {
+    var result = [];
+    for (var i = 0; i < count; i++) {
+        result.push((prefix || "k") + i);
+    }
+    return result;
+}
+
+// An object with the given members, added in order, and its JSON text
+function record(names, seed) {
+    var o = {};
+    var members = [];
+    names.forEach(function (name, i) {
+        o[name] = seed * 100 + i;
+        members.push('"' + name + '":' + (seed * 100 + i));
+    });
+    return { value: o, text: "{" + members.join(",") + "}" };
+}
+
+function unchanged(key, value) {
+    return value;
+}
+
+// Stringifies the value with and without a replacer function and checks both against the expected text
+function check(description, value, expected, space) {
+    assert.areEqual(expected, JSON.stringify(value, undefined, space), description);
+    assert.areEqual(expected, JSON.stringify(value, unchanged, space), description + ", with a replacer function");
+}
+
+function checkRecords(description, records) {
+    check(description, records.map(function (r) { return r.value; }),
+        "[" + records.map(function (r) { return r.text; }).join(",") + "]");
+}
+
+var tests = [
+    {
+        name: "Objects of the same type",
+        body: function () {
+            [1, 2, 5, 16, 40].forEach(function (count) {
+                var records = [];
+                for (var i = 0; i < 10; i++) {
+                    records.push(record(keys(count), i));
+                }
+                checkRecords(count + " members", records);
+            });
+            checkRecords("types that share a prefix", [
+                record(["a", "b", "c"], 1), record(["a", "b"], 2), record(["a", "b", "c", "d"], 3), record(["a", "b", "c"], 4)]);
+            check("empty objects", [{}, {}, { a: {} }], '[{},{},{"a":{}}]');
+        }
+    },
+    {
+        name: "Names and values that need escaping",
+        body: function () {
+            var quoted = [];
+            for (var i = 0; i < 3; i++) {
+                quoted.push({ "say \"hi\"": "\"hi\"", "tab\t": "\n", "\u00e9\u2028": "\ud83d\ude00" });
+            }
+            var text = '{"say \\"hi\\"":"\\"hi\\"","tab\\t":"\\n","\u00e9\u2028":"\ud83d\ude00"}';
+            check("escaped", quoted, "[" + [text, text, text].join(",") + "]");
+        }
+    },
+    {
+        name: "Indentation",
+        body: function () {
+            var value = [{ a: 1, b: { c: [], d: {} } }, { a: 2, b: { c: [3], d: { e: 4 } } }];
+            check("two spaces", value,
+                '[\n  {\n    "a": 1,\n    "b": {\n      "c": [],\n      "d": {}\n    }\n  },\n' +
+                '  {\n    "a": 2,\n    "b": {\n      "c": [\n        3\n      ],\n      "d": {\n        "e": 4\n      }\n    }\n  }\n]', 2);
+            check("a string", [{ a: 1, b: 2 }, { a: 3, b: 4 }],
+                '[\n--{\n----"a": 1,\n----"b": 2\n--},\n--{\n----"a": 3,\n----"b": 4\n--}\n]', "--");
+            // The separator after each name is learned with the name, so sessions with and without a gap must not share it
+            check("no indentation after indentation", [{ a: 1, b: 2 }, { a: 3, b: 4 }], '[{"a":1,"b":2},{"a":3,"b":4}]');
+        }
+    },
+    {
+        name: "Members that have no JSON text",
+        body: function () {
+            var records = [];
+            var expected = [];
+            for (var i = 0; i < 4; i++) {
+                records.push({ a: undefined, b: i, c: function () {}, d: Symbol("d"), e: i % 2 ? undefined : "e" });
+                expected.push(i % 2 ? '{"b":' + i + '}' : '{"b":' + i + ',"e":"e"}');
+            }
+            check("skipped", records, "[" + expected.join(",") + "]");
+            check("all skipped", [{ a: undefined }, { a: undefined }], "[{},{}]");
+        }
+    },
+    {
+        name: "Members that are not enumerable own data properties",
+        body: function () {
+            var sym = Symbol("s");
+            var records = [];
+            for (var i = 0; i < 4; i++) {
+                var o = Object.create({ inherited: 1 });
+                o.a = i;
+                o[sym] = "symbol";
+                o.b = i;
+                records.push(o);
+            }
+            check("symbol keys and inherited members", records, '[{"a":0,"b":0},{"a":1,"b":1},{"a":2,"b":2},{"a":3,"b":3}]');
+
+            var hidden = [{ a: 1, b: 2 }, { a: 3, b: 4 }, { a: 5, b: 6 }];
+            Object.defineProperty(hidden[1], "a", { enumerable: false });
+            Object.defineProperty(hidden[2], "b", { get: function () { return "got"; }, enumerable: true });
+            check("not enumerable and accessors", hidden, '[{"a":1,"b":2},{"b":4},{"a":5,"b":"got"}]');
+
+            var indexed = [{ a: 1, 0: "x", b: 2 }, { a: 3, 0: "y", b: 4 }, { a: 5, b: 6 }];
+            indexed[2][1] = "z";
+            check("index keys", indexed, '[{"0":"x","a":1,"b":2},{"0":"y","a":3,"b":4},{"1":"z","a":5,"b":6}]');
+
+            var deleted = [{ a: 1, b: 2, c: 3 }, { a: 1, b: 2, c: 3 }, { a: 1, b: 2, c: 3 }];
+            delete deleted[1].b;
+            check("deleted", deleted, '[{"a":1,"b":2,"c":3},{"a":1,"c":3},{"a":1,"b":2,"c":3}]');
+        }
+    },
+    {
+        name: "A toJSON method that changes the object holding it",
+        body: function () {
+            function holders(change) {
+                var result = [];
+                for (var i = 0; i < 3; i++) {
+                    result.push({ a: { toJSON: i == 1 ? function () { change(result[1]); return "a"; } : undefined }, b: 2, c: 1 });
+                }
+                return result;
+            }
+            function expected(changed) {
+                return '[{"a":{},"b":2,"c":1},' + changed + ',{"a":{},"b":2,"c":1}]';
+            }
+
+            // The members that follow are read after the change. A deleted member is skipped.
+            check("delete", holders(function (holder) { delete holder.b; holder.c = 3; }), expected('{"a":"a","c":3}'));
+            check("delete the rest", holders(function (holder) { delete holder.b; delete holder.c; }), expected('{"a":"a"}'));
+            check("accessor", holders(function (holder) {
+                    Object.defineProperty(holder, "c", { get: function () { return "got"; }, enumerable: true });
+                }), expected('{"a":"a","b":2,"c":"got"}'));
+            check("frozen", holders(function (holder) { holder.c = 3; Object.freeze(holder); }), expected('{"a":"a","b":2,"c":3}'));
+            check("values only", holders(function (holder) { holder.b = 3; holder.c = { d: 4 }; }),
+                expected('{"a":"a","b":3,"c":{"d":4}}'));
+        }
+    },
+    {
+        name: "A toJSON method that changes objects of the same type",
+        body: function () {
+            var records = [{ a: 1, b: 2 }, { a: 1, b: 2 }, { a: 1, b: 2 }, { a: 1, b: 2 }];
+            records[1].a = { toJSON: function () { delete records[2].a; records[3].b = 5; records[3].c = 6; return 0; } };
+            check("later objects", records, '[{"a":1,"b":2},{"a":0,"b":2},{"b":2},{"a":1,"b":5,"c":6}]');
+
+            var protoRecords = [{ a: 1 }, { a: { toJSON: function () { Object.prototype.toJSON = function () { return "p"; }; return 0; } } }, { a: 2 }];
+            try {
+                assert.areEqual('[{"a":1},{"a":0},"p"]', JSON.stringify(protoRecords), "a toJSON added to the prototype");
+            } finally {
+                delete Object.prototype.toJSON;
+            }
+        }
+    },
+    {
+        name: "More types than member lists are kept for",
+        body: function () {
+            // Each object has a type of its own, and each type is seen twice: once while there is room to keep its members,
+            // and once after. 300 is more than the serializer keeps.
+            var records = [];
+            for (var i = 0; i < 300; i++) {
+                records.push(record(keys(1 + i % 5, "t" + i + "_"), i));
+            }
+            checkRecords("distinct types", records.concat(records));
+            checkRecords("distinct types, reversed", records.slice().reverse().concat(records));
+
+            var nested = [];
+            var text = [];
+            for (var i = 0; i < 300; i++) {
+                var inner = record(["x", "y" + i], i);
+                nested.push({ id: i, inner: inner.value });
+                text.push('{"id":' + i + ',"inner":' + inner.text + '}');
+            }
+            check("shared outer type", nested, "[" + text.join(",") + "]");
+        }
+    },
+    {
+        name: "Exceptions and nested calls",
+        body: function () {
+            var records = [{ a: 1 }, { a: { toJSON: function () { throw new Error("from toJSON"); } } }];
+            assert.throws(function () { JSON.stringify(records); }, Error, "thrown from toJSON", "from toJSON");
+            check("after an exception", [{ a: 1 }, { a: 2 }], '[{"a":1},{"a":2}]');
+
+            var nestedCall = [{ a: 1, b: 2 }, { a: { toJSON: function () { return JSON.stringify([{ a: 3, b: 4 }, { b: 5 }]); } }, b: 2 }];
+            check("stringify from toJSON", nestedCall, '[{"a":1,"b":2},{"a":"[{\\"a\\":3,\\"b\\":4},{\\"b\\":5}]","b":2}]');
+
+            var cyclic = [{ a: 1 }, { a: 2 }];
+            cyclic[1].a = cyclic;
+            assert.throws(function () { JSON.stringify(cyclic); }, TypeError, "a cycle");
+            check("after a cycle", [{ a: 1 }, { a: 2 }], '[{"a":1},{"a":2}]');
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
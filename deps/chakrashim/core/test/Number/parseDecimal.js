@@ -0,0 +1,322 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Decimal strings to numbers. Mantissas of up to 19 digits are converted with 64 bit arithmetic, which gives up when the
+// result is too close to halfway between two doubles and leaves it to the big number conversion, and parseInt reads
+// long decimal strings eight digits at a time. These check that both give the same, correctly rounded, results as the
+// slower paths on either side of every boundary between them.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var doubles = new Float64Array(1);
+var words = new Uint32Array(doubles.buffer);
+
+function fromBits(hi, lo) {
+    words[0] = lo;
+    words[1] = hi;
+    return doubles[0];
+}
+
+function bitsOf(x) {
+    doubles[0] = x;
+    return words[1].toString(16) + " " + words[0].toString(16);
+}
+
+function random(seed) {
+    return function () {
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+        return seed >> 8;
+    };
+}
+
+function repeat(s, count) {
+    return new Array(count + 1).join(s);
+}
+
+// Exact decimal integers as arrays of digits, least significant first
+function bigFromString(s) {
+    return s.split("").reverse().map(Number);
+}
+
+function bigMul(digits, factor) {
+    var result = [];
+    var carry = 0;
+    for (var i = 0; i < digits.length; i++) {
+        var product = digits[i] * factor + carry;
+        result.push(product % 10);
+        carry = Math.floor(product / 10);
+    }
+    while (carry > 0) {
+        result.push(carry % 10);
+        carry = Math.floor(carry / 10);
+    }
+    return result;
+}
+
+function bigToString(digits) {
+    return digits.slice().reverse().join("");
+}
+
+// The exact decimal string of n * 2^exponent, n being a string of decimal digits
+function exactString(n, exponent) {
+    var digits = bigFromString(n);
+    if (exponent >= 0) {
+        for (var i = 0; i < exponent; i++) {
+            digits = bigMul(digits, 2);
+        }
+        return bigToString(digits);
+    }
+    // n / 2^k is n * 5^k / 10^k
+    for (var i = 0; i < -exponent; i++) {
+        digits = bigMul(digits, 5);
+    }
+    var s = bigToString(digits);
+    while (s.length <= -exponent) {
+        s = "0" + s;
+    }
+    return s.substring(0, s.length + exponent) + "." + s.substring(s.length + exponent);
+}
+
+// Checks every way of converting a decimal string to a number
+function checkParse(s, expected, description) {
+    var results = {
+        "Number": Number(s),
+        "parseFloat": parseFloat(s),
+        "unary plus": +s,
+        "literal": eval("(" + s + ")"),
+        "JSON.parse": JSON.parse(s.replace(/^(-?)0+(?=\d)/, "$1")),
+        "leading zeros": Number("0000000" + s),
+        "trailing characters": parseFloat(s + "x")
+    };
+    Object.keys(results).forEach(function (way) {
+        if (!Object.is(expected, results[way])) {
+            assert.fail(description + ": " + way + " of " + s + " is " + results[way] + " (" + bitsOf(results[way]) + ") rather than " +
+                expected + " (" + bitsOf(expected) + ")");
+        }
+    });
+    if (!Object.is(-expected, Number("-" + s))) {
+        assert.fail(description + ": -" + s + " is " + Number("-" + s));
+    }
+}
+
+var tests = [
+    {
+        name: "Strings that are correctly rounded",
+        body: function () {
+            var cases = [
+                // Just above 2^53, where doubles are two apart
+                ["9007199254740992", 0x43400000, 0x00000000],
+                ["9007199254740993", 0x43400000, 0x00000000],
+                ["9007199254740994", 0x43400000, 0x00000001],
+                ["9007199254740995", 0x43400000, 0x00000002],
+                ["9007199254740997", 0x43400000, 0x00000002],
+                ["9007199254740993.0000000001", 0x43400000, 0x00000001],
+                ["90071992547409930e-1", 0x43400000, 0x00000000],
+                ["9007199254740991.4999999999999999999999999999999995", 0x433fffff, 0xffffffff],
+                ["9214843084008499", 0x43405e6c, 0xec57761a],
+                // Exactly halfway, and either side of it
+                ["1.00000000000000011102230246251565404236316680908203125", 0x3ff00000, 0x00000000],
+                ["1.00000000000000011102230246251565404236316680908203126", 0x3ff00000, 0x00000001],
+                ["1.00000000000000011102230246251565404236316680908203124", 0x3ff00000, 0x00000000],
+                ["1.50000000000000011102230246251565404236316680908203125", 0x3ff80000, 0x00000000],
+                ["0.500000000000000166533453693773481063544750213623046875", 0x3fe00000, 0x00000002],
+                ["3.518437208883201171875e13", 0x42c00000, 0x00000002],
+                // Around 2^64 and the most digits that fit in 64 bits
+                ["18446744073709551615", 0x43f00000, 0x00000000],
+                ["18446744073709551616", 0x43f00000, 0x00000000],
+                ["18446744073709551617", 0x43f00000, 0x00000000],
+                ["1844674407370955161.5", 0x43b99999, 0x9999999a],
+                ["9999999999999999999", 0x43e158e4, 0x60913d00],
+                ["99999999999999999999", 0x4415af1d, 0x78b58c40],
+                ["10000000000000000000", 0x43e158e4, 0x60913d00],
+                ["30078505129381147446200", 0x44997a3c, 0x7271b021],
+                ["1777820000000000000001", 0x4458180d, 0x5bad2e3e],
+                // Eight and sixteen digits
+                ["12345678", 0x41678c29, 0xc0000000],
+                ["99999999", 0x4197d783, 0xfc000000],
+                ["1234567812345678", 0x43118b54, 0xdf9fbd38],
+                // The ends of the range
+                ["2.2250738585072011e-308", 0x000fffff, 0xffffffff],
+                ["2.2250738585072012e-308", 0x00100000, 0x00000000],
+                ["2.4703282292062327e-324", 0x00000000, 0x00000000],
+                ["2.4703282292062328e-324", 0x00000000, 0x00000001],
+                ["1.7976931348623158e308", 0x7fefffff, 0xffffffff],
+                ["1.7976931348623159e308", 0x7ff00000, 0x00000000],
+                // Hard cases for conversions that are not exact
+                ["7.038531e-26", 0x3ab5c87f, 0xb0000000],
+                ["62.5364939768271845828", 0x404f44ab, 0xd5aa7ca4],
+                ["8.10109172351e-10", 0x3e0bd5cb, 0xaef0fd0c]
+            ];
+            cases.forEach(function (c) {
+                checkParse(c[0], fromBits(c[1], c[2]), c[0]);
+            });
+        }
+    },
+    {
+        name: "Random mantissas of 8 to 25 digits",
+        body: function () {
+            var cases = [
+                ["66668643e30", 0x47c913f4, 0xf088e18f],
+                ["83355865e-17", 0x3e0ca40f, 0x3677d08f],
+                ["46673319e-32", 0x3ae20e4d, 0x3786c003],
+                ["131510800464099e-17", 0x3f558bf6, 0x77b8947a],
+                ["593532237315157e-9", 0x41221cf8, 0x79815f4c],
+                ["879088866359795e-27", 0x3d6eee20, 0xeabec388],
+                ["7193539942442468e35", 0x4a7ec33b, 0x4b7d4e6b],
+                ["5480477513508330e34", 0x4a42bfdd, 0x8e45b861],
+                ["7099559739820460e-8", 0x4190ed3a, 0x3597c2f2],
+                ["26888060738680642e-28", 0x3d87a6a7, 0x2c115df1],
+                ["17759773951882488e26", 0x48b46320, 0xe498441b],
+                ["55393974680952495e-21", 0x3f0d0ada, 0x7a29daab],
+                ["902804288288378488e-4", 0x42d48703, 0x38fe2976],
+                ["200284040642481192e24", 0x488264a7, 0xb901465a],
+                ["235060642484400008e0", 0x438a18d3, 0x457fa97c],
+                ["2939911773620884664e21", 0x4821477c, 0xd2e0457b],
+                ["5171986204085391046e-36", 0x3c57da00, 0xea4ab3df],
+                ["4623959394448208209e-12", 0x4151a395, 0xd93ea3b3],
+                ["34604262088600144420e20", 0x482456ab, 0xb0f24c64],
+                ["72420882241371517661e24", 0x4909face, 0xc2561451],
+                ["58215144028730715911e-40", 0x3bbb7dc7, 0x7130a11a],
+                ["820293722628733062826e-36", 0x3ccd8ddf, 0xca7a1212],
+                ["931047917531528413910e17", 0x47d182d5, 0x293612c3],
+                ["622424335395990422864e-36", 0x3cc66cd9, 0xe8e88940],
+                ["9717977559111517464803396e-1", 0x44e9b928, 0x618e8072],
+                ["3104061952493199599913648e6", 0x464396e1, 0xef02916e],
+                ["8777573166564253931793919e28", 0x4aed5352, 0xf7f3c3ef]
+            ];
+            cases.forEach(function (c) {
+                var expected = fromBits(c[1], c[2]);
+                checkParse(c[0], expected, c[0]);
+
+                // The same number with the decimal point moved into the mantissa, and with zeros after it
+                var match = /^(\d+)e(-?\d+)$/.exec(c[0]);
+                var mantissa = match[1];
+                var exponent = +match[2];
+                checkParse(mantissa.charAt(0) + "." + mantissa.substring(1) + "e" + (exponent + mantissa.length - 1), expected, c[0] + " with a point");
+                checkParse(mantissa + "000e" + (exponent - 3), expected, c[0] + " with zeros");
+            });
+        }
+    },
+    {
+        name: "Numbers exactly halfway between two doubles",
+        body: function () {
+            // (2^53 + 1) * 2^e is halfway between 2^(53 + e) and the next double up, and rounds to the even one below it;
+            // (2^53 + 3) * 2^e rounds to the even one above it. Anything more, however little, rounds up.
+            var exponents = [];
+            for (var e = -80; e <= 80; e++) {
+                exponents.push(e);
+            }
+            exponents.push(-200, -400, -700, -1000, -1074, 200, 500, 900, 970);
+            exponents.forEach(function (e) {
+                var scale = Math.pow(2, e);
+                var low = exactString("9007199254740993", e);
+                var high = exactString("9007199254740995", e);
+                var lowDown = 9007199254740992 * scale;
+                var highUp = 9007199254740996 * scale;
+                var lowUp = 9007199254740994 * scale;
+                checkParse(low, lowDown, "(2^53 + 1) * 2^" + e);
+                checkParse(high, highUp, "(2^53 + 3) * 2^" + e);
+                var above = low.indexOf(".") < 0 ? low + ".0000000000000000000001" : low + "0000000000000001";
+                checkParse(above, lowUp, "just above (2^53 + 1) * 2^" + e);
+                if (e >= 0) {
+                    checkParse(low.substring(0, low.length - 1) + (+low.charAt(low.length - 1) - 1) + ".9999999999999999999", lowDown, "just below (2^53 + 1) * 2^" + e);
+                }
+            });
+        }
+    },
+    {
+        name: "Mantissas of 8, 16, 19 and 20 digits",
+        body: function () {
+            var next = random(19);
+            [1, 7, 8, 9, 15, 16, 17, 18, 19, 20, 21, 24, 32].forEach(function (length) {
+                for (var i = 0; i < 200; i++) {
+                    var digits = String(1 + next() % 9);
+                    while (digits.length < length) {
+                        digits += next() % 10;
+                    }
+                    var exponent = next() % 60 - 30;
+                    var s = digits + "e" + exponent;
+                    var x = Number(s);
+                    checkParse(s, x, length + " digits");
+                    checkParse("0.0000000000" + digits + "e" + (exponent + length + 10), x, length + " digits after zeros");
+                    // Every double converts back from its shortest string and from 17 digits
+                    assert.areEqual(x, Number(String(x)), s + ": shortest string");
+                    assert.areEqual(x, Number(x.toPrecision(17)), s + ": 17 digits");
+                    if (length <= 15) {
+                        // Few enough digits for the mantissa to be exact, so the result is at most one power of ten away
+                        var mantissa = +digits;
+                        assert.areEqual(mantissa, Number(digits), s + ": the mantissa alone");
+                        if (exponent >= 0 && exponent <= 22) {
+                            assert.areEqual(mantissa * Math.pow(10, exponent), x, s + ": an exact product");
+                        } else if (exponent < 0 && exponent >= -22) {
+                            assert.areEqual(mantissa / Math.pow(10, -exponent), x, s + ": an exact quotient");
+                        }
+                    }
+                }
+            });
+        }
+    },
+    {
+        name: "Powers of two",
+        body: function () {
+            var digits = bigFromString("1");
+            for (var e = 0; e < 1024; e++) {
+                var s = bigToString(digits);
+                var x = Math.pow(2, e);
+                checkParse(s, x, "2^" + e);
+                assert.areEqual(x, parseInt(s), "parseInt of 2^" + e);
+                assert.areEqual(x, parseInt(s, 10), "parseInt of 2^" + e + " in base 10");
+                digits = bigMul(digits, 2);
+            }
+            assert.areEqual(Infinity, Number(bigToString(digits)), "2^1024");
+            assert.areEqual(Infinity, parseInt(bigToString(digits)), "parseInt of 2^1024");
+            assert.areEqual(Infinity, parseInt(repeat("9", 400)), "parseInt of 400 nines");
+            assert.areEqual(-Infinity, parseInt("-" + repeat("9", 400)), "parseInt of -400 nines");
+        }
+    },
+    {
+        name: "parseInt of decimal strings at every alignment",
+        body: function () {
+            var next = random(8);
+            // Characters just outside the digits, and characters whose low byte is a digit
+            var notDigits = ["x", "/", ":", ".", " ", "e", "\u0000", "\u0130", "\u0660", "\uff10", "\u1030", "\u3039", "\u8030", "\uffff"];
+            for (var length = 1; length <= 40; length++) {
+                var s = String(1 + next() % 9);
+                while (s.length < length) {
+                    s += next() % 10;
+                }
+                var value = parseInt(s);
+                if (length <= 15) {
+                    assert.areEqual(Number(s), value, s + ": exact");
+                }
+                assert.areEqual(value, parseInt(s, 10), s + " in base 10");
+                assert.areEqual(-value, parseInt("-" + s), "-" + s);
+                assert.areEqual(value, parseInt("  +" + s), "+" + s + " after spaces");
+                for (var zeros = 1; zeros <= 9; zeros++) {
+                    assert.areEqual(value, parseInt(repeat("0", zeros) + s), s + " after " + zeros + " zeros");
+                }
+                notDigits.forEach(function (c) {
+                    assert.areEqual(value, parseInt(s + c + "12345678"), s + " followed by " + escape(c));
+                    // A character that is not a digit at every position, so at every place in an eight digit block
+                    for (var i = 1; i < s.length; i++) {
+                        var prefix = s.substring(0, i);
+                        assert.areEqual(parseInt(prefix), parseInt(prefix + c + s.substring(i + 1) + "87654321"), s + " with " + escape(c) + " at " + i);
+                    }
+                });
+            }
+            assert.areEqual(0, parseInt("00000000"), "eight zeros");
+            assert.areEqual(0, parseInt(repeat("0", 40)), "forty zeros");
+            assert.areEqual(1, parseInt(repeat("0", 39) + "1"), "forty digits with one at the end");
+            assert.areEqual(12345678, parseInt("12345678"), "eight digits");
+            assert.areEqual(123456789, parseInt("123456789"), "nine digits");
+            assert.areEqual(1234567890123456, parseInt("1234567890123456"), "sixteen digits");
+            assert.areEqual(99999999999999999999, parseInt("99999999999999999999"), "twenty nines");
+            assert.isTrue(isNaN(parseInt("x12345678901234567")), "a character that is not a digit first");
+            assert.areEqual(1e21, parseInt("1000000000000000000000"), "10^21");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
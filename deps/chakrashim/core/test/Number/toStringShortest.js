@@ -0,0 +1,245 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Number to string conversion, which finds the shortest digits that convert back to the same double with Grisu3 and
+// falls back to the slower conversions for the few doubles where Grisu3 cannot tell which digits are right. toFixed,
+// toExponential and toPrecision round those digits, and toString with a radix other than 10 has its own conversion.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var doubles = new Float64Array(1);
+var words = new Uint32Array(doubles.buffer);
+
+function fromBits(hi, lo) {
+    words[0] = lo;
+    words[1] = hi;
+    return doubles[0];
+}
+
+function random(seed) {
+    return function () {
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+        return seed >> 8;
+    };
+}
+
+// 32 random bits
+function randomWord(next) {
+    return ((next() << 16) ^ next()) >>> 0;
+}
+
+// The significant digits of a number's string, without leading or trailing zeros
+function digitsOf(s) {
+    var match = /^-?(\d+)(?:\.(\d+))?(?:e[+-]\d+)?$/.exec(s);
+    return (match[1] + (match[2] || "")).replace(/^0+/, "").replace(/0+$/, "");
+}
+
+// Checks that the string converts back to the number and that it has no more digits than it needs
+function checkShortest(x, description) {
+    var s = String(x);
+    assert.areEqual(s, x.toString(), description + ": toString");
+    assert.areEqual(s, "" + x, description + ": concatenation");
+    assert.areEqual(s, x.toString(10), description + ": toString(10)");
+    if (Number(s) !== x) {
+        assert.fail(description + ": " + s + " does not convert back");
+    }
+    var digits = digitsOf(s);
+    if (digits.length > 1) {
+        var shorter = x.toPrecision(digits.length - 1);
+        if (Number(shorter) === x) {
+            assert.fail(description + ": " + shorter + " is shorter than " + s);
+        }
+    }
+}
+
+var tests = [
+    {
+        name: "Denormals, powers of ten and the largest and smallest numbers",
+        body: function () {
+            var cases = [
+                [Number.MIN_VALUE, "5e-324"],
+                [2 * Number.MIN_VALUE, "1e-323"],
+                [3 * Number.MIN_VALUE, "1.5e-323"],
+                [12345 * Number.MIN_VALUE, "6.099e-320"],
+                [fromBits(0x000fffff, 0xffffffff), "2.225073858507201e-308"],
+                [fromBits(0x00100000, 0), "2.2250738585072014e-308"],
+                [1e-300 * 1e-10, "1e-310"],
+                [Number.MAX_VALUE, "1.7976931348623157e+308"],
+                [-Number.MAX_VALUE, "-1.7976931348623157e+308"],
+                [fromBits(0x7fefffff, 0xfffffffe), "1.7976931348623155e+308"],
+                [1e308, "1e+308"],
+                [1e-308, "1e-308"],
+                [1e-7, "1e-7"],
+                [1.5e-7, "1.5e-7"],
+                [-1e-7, "-1e-7"],
+                [1e-6, "0.000001"],
+                [1e20, "100000000000000000000"],
+                [1e21, "1e+21"],
+                [1e22, "1e+22"],
+                [1e23, "1e+23"],
+                [999999999999999900000, "999999999999999900000"],
+                [123456789012345680000, "123456789012345680000"],
+                [Math.pow(2, 63), "9223372036854776000"],
+                [9007199254740993, "9007199254740992"],
+                [0.1 + 0.2, "0.30000000000000004"],
+                [1 / 3, "0.3333333333333333"],
+                [2 / 3, "0.6666666666666666"],
+                [-0, "0"],
+                [0, "0"]
+            ];
+            cases.forEach(function (c) {
+                assert.areEqual(c[1], String(c[0]), c[1]);
+                checkShortest(c[0], c[1]);
+            });
+
+            for (var e = -323; e <= 308; e++) {
+                var x = Number("1e" + e);
+                assert.areEqual(e >= -6 && e < 21 ? x.toFixed(Math.max(0, -e)) : "1e" + (e > 0 ? "+" : "") + e, String(x), "1e" + e);
+                checkShortest(x, "1e" + e);
+                checkShortest(-x, "-1e" + e);
+            }
+            for (var e = -1074; e <= 1023; e++) {
+                checkShortest(Math.pow(2, e), "2^" + e);
+            }
+        }
+    },
+    {
+        name: "Numbers that Grisu3 cannot convert",
+        body: function () {
+            // For each of these the interval of values that round to the double is so close to a boundary between digits
+            // that Grisu3 reports failure and the slower conversions are used
+            var cases = [
+                [0x3365de4f, 0x0a00ad80, "4.2527295970331707e-61"],
+                [0x50046a04, 0xd0ac5090, "2.9547443178665555e+77"],
+                [0x77bf2b09, 0x8f934bf4, "6.432009573618406e+268"],
+                [0x6030b284, 0xecb987c5, "2.2387473798562443e+155"],
+                [0x064fb7de, 0xadd11e9e, "2.7957808241737538e-278"],
+                [0x5c5ff233, 0x56df112b, "9.287863829146688e+136"],
+                [0x22bff5a5, 0xe09e27da, "2.6208542509989771e-141"],
+                [0x2022383c, 0x03f04a5d, "6.794423763117957e-154"],
+                [0x437eb64e, 0x0f2ae9ee, "138315130871914200"],
+                [0x7dcc0312, 0x93a82343, "9.159882040928485e+297"],
+                [0x40249de9, 0x79cc8127, "10.308421903814248"],
+                [0x74924f8d, 0xcb4d7612, "3.3561601319850486e+253"],
+                [0x79efa8db, 0x6cc4f63b, "2.244871033501918e+279"],
+                [0x4cc453d9, 0xfc2993ea, "6.53302106121913e+61"],
+                [0x7d5e6fc0, 0xa5983ffc, "7.775546887428274e+295"],
+                [0x606643c2, 0x94a2f549, "2.3881652626963677e+156"]
+            ];
+            cases.forEach(function (c) {
+                var x = fromBits(c[0], c[1]);
+                assert.areEqual(c[2], String(x), c[2]);
+                assert.areEqual("-" + c[2], String(-x), "-" + c[2]);
+                checkShortest(x, c[2]);
+            });
+        }
+    },
+    {
+        name: "toFixed, toExponential and toPrecision",
+        body: function () {
+            var cases = [
+                // value, toFixed(2), toPrecision(3), toExponential(4)
+                [Number.MIN_VALUE, "0.00", "4.94e-324", "4.9407e-324"],
+                [fromBits(0x00100000, 0), "0.00", "2.23e-308", "2.2251e-308"],
+                [Number.MAX_VALUE, "1.7976931348623157e+308", "1.80e+308", "1.7977e+308"],
+                [1e21, "1e+21", "1.00e+21", "1.0000e+21"],
+                [1e20, "100000000000000000000.00", "1.00e+20", "1.0000e+20"],
+                [1e-6, "0.00", "0.00000100", "1.0000e-6"],
+                [1e-7, "0.00", "1.00e-7", "1.0000e-7"],
+                [0.1 + 0.2, "0.30", "0.300", "3.0000e-1"],
+                [2 / 3, "0.67", "0.667", "6.6667e-1"],
+                [-2 / 3, "-0.67", "-0.667", "-6.6667e-1"],
+                [123.456, "123.46", "123", "1.2346e+2"],
+                [0.5, "0.50", "0.500", "5.0000e-1"],
+                [-0, "0.00", "0.00", "0.0000e+0"],
+                [0, "0.00", "0.00", "0.0000e+0"]
+            ];
+            cases.forEach(function (c) {
+                var description = String(c[0]);
+                assert.areEqual(c[1], c[0].toFixed(2), description + ".toFixed(2)");
+                assert.areEqual(c[2], c[0].toPrecision(3), description + ".toPrecision(3)");
+                assert.areEqual(c[3], c[0].toExponential(4), description + ".toExponential(4)");
+            });
+            assert.areEqual("0", (0.4).toFixed(), "toFixed()");
+            assert.areEqual("1", (0.5).toFixed(0), "toFixed(0) rounds half up");
+            assert.areEqual("3", (2.5).toFixed(0), "toFixed(0) of 2.5");
+            assert.areEqual("0.0", (0.04).toFixed(1), "toFixed(1) of a smaller number");
+            assert.areEqual("0.1", (0.05).toFixed(1), "toFixed(1) rounding up from below the first digit");
+            assert.areEqual("1.00000000000000000000", (1).toFixed(20), "toFixed(20)");
+            assert.areEqual("1.00000000000000000000", (1).toPrecision(21), "toPrecision(21)");
+            assert.areEqual("5e-7", (5e-7).toPrecision(1), "toPrecision(1) of a small number");
+            assert.areEqual("1e+21", (1e21).toPrecision(1), "toPrecision(1) of a large number");
+            assert.throws(function () { (1).toFixed(-1); }, RangeError, "toFixed(-1)");
+            assert.throws(function () { (1).toPrecision(0); }, RangeError, "toPrecision(0)");
+            assert.areEqual("NaN", NaN.toFixed(2), "NaN");
+            assert.areEqual("-Infinity", (-Infinity).toPrecision(3), "-Infinity");
+        }
+    },
+    {
+        name: "toString with a radix",
+        body: function () {
+            assert.areEqual("ff", (255).toString(16), "255 in hex");
+            assert.areEqual("-ff.8", (-255.5).toString(16), "-255.5 in hex");
+            assert.areEqual("0.1", (0.5).toString(2), "0.5 in binary");
+            assert.areEqual("11111111111111111111111111111111111111111111111111111", (9007199254740991).toString(2), "2^53 - 1 in binary");
+            assert.areEqual("zz", (1295).toString(36), "1295 in base 36");
+            assert.areEqual("0", (-0).toString(2), "-0 in binary");
+            assert.areEqual("Infinity", Infinity.toString(16), "Infinity in hex");
+            assert.areEqual("NaN", NaN.toString(8), "NaN in octal");
+            [Number.MIN_VALUE, Number.MAX_VALUE, 0.1, 1 / 3, 1e21, 123456.789].forEach(function (x) {
+                [2, 8, 16, 36].forEach(function (radix) {
+                    var s = x.toString(radix);
+                    assert.isTrue(/^[0-9a-z.]+$/.test(s), x + " in base " + radix + ": " + s);
+                    assert.areEqual(s, x.toString(radix), x + " in base " + radix + " again");
+                });
+            });
+        }
+    },
+    {
+        name: "Random bit patterns",
+        body: function () {
+            var next = random(73);
+            for (var i = 0; i < 20000; i++) {
+                var hi = randomWord(next);
+                var lo = randomWord(next);
+                if (i % 4 === 0) {
+                    // Denormals
+                    hi &= 0x800fffff;
+                }
+                var x = fromBits(hi, lo);
+                if (x !== x || x === Infinity || x === -Infinity) {
+                    assert.areEqual(String(x), x.toString(), "not finite");
+                    continue;
+                }
+                checkShortest(x, "bits " + hi.toString(16) + " " + lo.toString(16));
+            }
+        }
+    },
+    {
+        name: "Numbers converted again after other numbers",
+        body: function () {
+            var next = random(5);
+            var values = [-0, 0, NaN, fromBits(0x7ff80000, 1), fromBits(0xfff80000, 0), Infinity, -Infinity, 1, -1, 0.1];
+            for (var i = 0; i < 100; i++) {
+                values.push(fromBits(randomWord(next), randomWord(next)));
+            }
+            var strings = values.map(function (x) { return String(x); });
+            assert.areEqual(["0", "0", "NaN", "NaN", "NaN", "Infinity", "-Infinity", "1", "-1", "0.1"], strings.slice(0, 10), "special values");
+            for (var round = 0; round < 5; round++) {
+                for (var i = 0; i < values.length; i++) {
+                    var j = (i * 37 + round * 11) % values.length;
+                    assert.areEqual(strings[j], String(values[j]), "value " + j + " in round " + round);
+                    assert.areEqual(strings[j], "" + values[j], "concatenated value " + j + " in round " + round);
+                }
+            }
+            var o = {};
+            values.forEach(function (x, i) { o[x] = i; });
+            assert.areEqual(values.length - 1, o[values[values.length - 1]], "used as a property name");
+            assert.areEqual(1, o["0"], "-0 and 0 are the same property name");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
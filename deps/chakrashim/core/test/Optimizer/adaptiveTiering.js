@@ -0,0 +1,109 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Functions that adaptive tiering sends straight to full JIT, functions that keep their tiers with
+// a shorter full JIT threshold, and functions whose profile goes stale after they were jitted must
+// all compute the same results as in the interpreter.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var iterations = 2000;
+
+function makeAdders(count) {
+    var adders = [];
+    for (var i = 0; i < count; i++) {
+        adders.push(new Function("o", "return o.x * " + i + " + o.y;"));
+    }
+    return adders;
+}
+
+var tests = [
+    {
+        name: "Monomorphic functions skip simple JIT and stay correct",
+        body: function () {
+            var adders = makeAdders(20);
+            for (var i = 0; i < iterations; i++) {
+                var o = { x: i, y: 1 };
+                for (var j = 0; j < adders.length; j++) {
+                    assert.areEqual(i * j + 1, adders[j](o), "adder " + j + " at iteration " + i);
+                }
+            }
+        }
+    },
+    {
+        name: "Polymorphic functions keep their tiers and stay correct",
+        body: function () {
+            var adders = makeAdders(20);
+            var shapes = [
+                function (i) { return { x: i, y: 1 }; },
+                function (i) { return { y: 1, x: i }; },
+                function (i) { return { z: 0, x: i, y: 1 }; },
+                function (i) { var o = Object.create({ y: 1 }); o.x = i; return o; }
+            ];
+            for (var i = 0; i < iterations; i++) {
+                var o = shapes[i % shapes.length](i);
+                for (var j = 0; j < adders.length; j++) {
+                    assert.areEqual(i * j + 1, adders[j](o), "adder " + j + " at iteration " + i);
+                }
+            }
+        }
+    },
+    {
+        name: "Functions with implicit calls keep their tiers and stay correct",
+        body: function () {
+            var adders = makeAdders(10);
+            var calls = 0;
+            for (var i = 0; i < iterations; i++) {
+                var o = { x: { valueOf: function () { calls++; return 2; } }, y: 1 };
+                for (var j = 0; j < adders.length; j++) {
+                    assert.areEqual(2 * j + 1, adders[j](o), "adder " + j + " at iteration " + i);
+                }
+            }
+            assert.areEqual(iterations * adders.length, calls, "valueOf runs once per call");
+        }
+    },
+    {
+        name: "A stable profile that changes after full JIT bails out correctly",
+        body: function () {
+            var adders = makeAdders(10);
+            var i;
+            var j;
+            for (i = 0; i < iterations; i++) {
+                for (j = 0; j < adders.length; j++) {
+                    assert.areEqual(i * j + 1, adders[j]({ x: i, y: 1 }), "adder " + j + " at iteration " + i);
+                }
+            }
+            for (i = 0; i < iterations; i++) {
+                var o = { get x() { return i; }, y: "" };
+                for (j = 0; j < adders.length; j++) {
+                    assert.areEqual(String(i * j), adders[j](o), "adder " + j + " with a getter at iteration " + i);
+                }
+            }
+        }
+    },
+    {
+        name: "Hot loops in a function that adaptive tiering sent to full JIT",
+        body: function () {
+            function sum(a) {
+                var total = 0;
+                for (var i = 0; i < a.length; i++) {
+                    total += a[i];
+                }
+                return total;
+            }
+            var ints = [];
+            for (var i = 0; i < 100; i++) {
+                ints.push(i);
+            }
+            for (i = 0; i < iterations; i++) {
+                assert.areEqual(4950, sum(ints), "int array at iteration " + i);
+            }
+            assert.areEqual(1.5, sum([0.5, 1]), "float array after full JIT");
+            assert.areEqual("0ab", sum(["a", "b"]), "string array after full JIT");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
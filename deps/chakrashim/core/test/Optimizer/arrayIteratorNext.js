@@ -0,0 +1,255 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Array iterator next() calls that the full JIT inlines, with their result objects on the stack when they do not escape.
+// Each function runs several times so that the later runs execute jitted code.
+// Run with -mic:1 -off:simplejit
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var runs = 4;
+
+function repeat(f) {
+    for (var run = 0; run < runs; run++) {
+        f(run);
+    }
+}
+
+var tests = [
+    {
+        name: "for...of and destructuring over arrays",
+        body: function () {
+            function sum(a) {
+                var total = 0;
+                for (var v of a) {
+                    total += v;
+                }
+                return total;
+            }
+            function firstTwo(a) {
+                var [x, y] = a;
+                return x * 10 + y;
+            }
+            repeat(function (run) {
+                assert.areEqual(15, sum([1, 2, 3, 4, 5]), "sum in run " + run);
+                assert.areEqual(6, sum(new Int8Array([1, 2, 3])), "typed array sum in run " + run);
+                assert.areEqual(12, firstTwo([1, 2, 3]), "destructuring in run " + run);
+                assert.isTrue(isNaN(firstTwo([1])), "destructuring a short array in run " + run);
+            });
+        }
+    },
+    {
+        name: "A bailout while the result object is live boxes it",
+        body: function () {
+            function readAcrossBailout(a) {
+                var it = a[Symbol.iterator]();
+                var total = 0;
+                var seen = "";
+                var r;
+                while (!(r = it.next()).done) {
+                    // Int-specialized until a string element shows up, which bails out with r live
+                    total += r.value;
+                    seen += typeof r.value + ":" + r.value + ";";
+                }
+                return [total, seen, r.done, r.value];
+            }
+            repeat(function (run) {
+                assert.areEqual([6, "number:1;number:2;number:3;", true, undefined], readAcrossBailout([1, 2, 3]), "ints in run " + run);
+            });
+            assert.areEqual(["3x4", "number:1;number:2;string:x;number:4;", true, undefined], readAcrossBailout([1, 2, "x", 4]), "string element");
+            assert.areEqual([4.5, "number:1;number:2;number:1.5;", true, undefined], readAcrossBailout([1, 2, 1.5]), "double element");
+        }
+    },
+    {
+        name: "Holes, including holes filled from the prototype",
+        body: function () {
+            // Not collected into an array, which would see the elements put on Array.prototype below
+            function collect(a) {
+                var values = "";
+                for (var v of a) {
+                    values += v + ";";
+                }
+                return values;
+            }
+            repeat(function (run) {
+                assert.areEqual("1;undefined;3;", collect([1, , 3]), "hole in run " + run);
+            });
+            Array.prototype[1] = "proto";
+            try {
+                assert.areEqual("1;proto;3;", collect([1, , 3]), "hole filled from Array.prototype");
+            } finally {
+                delete Array.prototype[1];
+            }
+            var calls = 0;
+            Object.defineProperty(Array.prototype, 1, { get: function () { calls++; return "getter"; }, configurable: true });
+            try {
+                assert.areEqual("1;getter;3;", collect([1, , 3]), "hole filled by a getter");
+                assert.areEqual(1, calls, "the getter runs once");
+            } finally {
+                delete Array.prototype[1];
+            }
+            assert.areEqual("1;undefined;3;", collect([1, , 3]), "hole after the prototype is restored");
+        }
+    },
+    {
+        name: "Exhausted iterators stay exhausted",
+        body: function () {
+            function drain(a, extra) {
+                var it = a[Symbol.iterator]();
+                var count = 0;
+                while (!it.next().done) {
+                    count++;
+                }
+                a.push(extra);
+                var after = it.next();
+                var again = it.next();
+                return [count, after.done, after.value, again.done, again.value, after !== again];
+            }
+            repeat(function (run) {
+                assert.areEqual([3, true, undefined, true, undefined, true], drain([1, 2, 3], 4), "run " + run);
+                assert.areEqual([0, true, undefined, true, undefined, true], drain([], 4), "empty array in run " + run);
+            });
+        }
+    },
+    {
+        name: "entries() and keys()",
+        body: function () {
+            function entries(a) {
+                var pairs = [];
+                for (var entry of a.entries()) {
+                    pairs.push(entry);
+                }
+                return pairs;
+            }
+            function keys(a) {
+                var total = 0;
+                for (var k of a.keys()) {
+                    total += k;
+                }
+                return total;
+            }
+            function destructureEntries(a) {
+                var total = 0;
+                for (var [i, v] of a.entries()) {
+                    total += i * v;
+                }
+                return total;
+            }
+            repeat(function (run) {
+                var pairs = entries(["a", "b"]);
+                assert.areEqual([[0, "a"], [1, "b"]], pairs, "entries in run " + run);
+                assert.isTrue(pairs[0] !== pairs[1], "each entry is a new array in run " + run);
+                assert.areEqual(10, keys([9, 9, 9, 9, 9]), "keys in run " + run);
+                assert.areEqual(6, keys([, , , , ]), "keys of holes in run " + run);
+                assert.areEqual(1 * 2 + 2 * 3, destructureEntries([1, 2, 3]), "destructured entries in run " + run);
+            });
+        }
+    },
+    {
+        name: "Result objects that escape",
+        body: function () {
+            var leaked;
+            function keep(a) {
+                var results = [];
+                var it = a[Symbol.iterator]();
+                var r;
+                do {
+                    r = it.next();
+                    results.push(r);
+                } while (!r.done);
+                leaked = r;
+                return results;
+            }
+            function closeOver(a) {
+                var it = a[Symbol.iterator]();
+                var r = it.next();
+                return function () { return r.value; };
+            }
+            repeat(function (run) {
+                var results = keep([1, 2]);
+                assert.areEqual(3, results.length, "result count in run " + run);
+                assert.areEqual(1, results[0].value, "first result in run " + run);
+                assert.areEqual(2, results[1].value, "second result in run " + run);
+                assert.isFalse(results[1].done, "second result is not done in run " + run);
+                assert.isTrue(results[2].done, "last result is done in run " + run);
+                assert.isTrue(results[0] !== results[1], "each result is a new object in run " + run);
+                assert.isTrue(leaked === results[2], "the stored result is the last one in run " + run);
+                assert.areEqual(["value", "done"], Object.keys(results[0]), "result properties in run " + run);
+                assert.isTrue(Object.getPrototypeOf(results[0]) === Object.prototype, "result prototype in run " + run);
+                results[0].value = "changed";
+                assert.areEqual("changed", results[0].value, "results are ordinary objects in run " + run);
+                assert.areEqual(7, closeOver([7, 8])(), "result captured by a closure in run " + run);
+            });
+        }
+    },
+    {
+        name: "Arrays that change during iteration",
+        body: function () {
+            function grow(a) {
+                var values = [];
+                for (var v of a) {
+                    values.push(v);
+                    if (a.length < 6) {
+                        a.push(v * 10);
+                    }
+                }
+                return values;
+            }
+            function shrink(a) {
+                var values = [];
+                for (var v of a) {
+                    values.push(v);
+                    a.length = 2;
+                }
+                return values;
+            }
+            function convert(a) {
+                var values = [];
+                for (var v of a) {
+                    values.push(v);
+                    a[2] = "s";
+                }
+                return values;
+            }
+            repeat(function (run) {
+                assert.areEqual([1, 2, 3, 10, 20, 30], grow([1, 2, 3]), "grow in run " + run);
+                assert.areEqual([1, 2], shrink([1, 2, 3, 4]), "shrink in run " + run);
+                assert.areEqual([1, 2, "s", 4], convert([1, 2, 3, 4]), "convert in run " + run);
+            });
+        }
+    },
+    {
+        name: "An iterator whose next() has been replaced",
+        body: function () {
+            function sum(a) {
+                var total = 0;
+                for (var v of a) {
+                    total += v;
+                }
+                return total;
+            }
+            var iteratorPrototype = Object.getPrototypeOf([][Symbol.iterator]());
+            var next = iteratorPrototype.next;
+            repeat(function (run) {
+                assert.areEqual(6, sum([1, 2, 3]), "builtin next in run " + run);
+            });
+            iteratorPrototype.next = function () {
+                var r = next.call(this);
+                if (!r.done) {
+                    r.value *= 2;
+                }
+                return r;
+            };
+            try {
+                assert.areEqual(12, sum([1, 2, 3]), "replaced next");
+            } finally {
+                iteratorPrototype.next = next;
+            }
+            assert.areEqual(6, sum([1, 2, 3]), "restored next");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
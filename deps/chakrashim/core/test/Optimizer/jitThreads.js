@@ -0,0 +1,89 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Makes many distinct functions hot at once so that several background JIT threads compile code for
+// the same script context concurrently, then checks the results of the jitted code.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var functionCount = 200;
+var iterations = 300;
+
+function makeFunctions(body) {
+    var functions = [];
+    for (var i = 0; i < functionCount; i++) {
+        functions.push(new Function("a", "k", body.replace(/K/g, String(i))));
+    }
+    return functions;
+}
+
+var tests = [
+    {
+        name: "Many functions with loops jitted at the same time",
+        body: function () {
+            var functions = makeFunctions("var s = K; for (var i = 0; i < a.length; i++) { s += a[i] * K; } return s;");
+            var a = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10];
+            for (var n = 0; n < iterations; n++) {
+                for (var f = 0; f < functions.length; f++) {
+                    assert.areEqual(f + 55 * f, functions[f](a), "function " + f + " at iteration " + n);
+                }
+            }
+        }
+    },
+    {
+        name: "Many functions with float, string and object code jitted at the same time",
+        body: function () {
+            var functions = makeFunctions("return { d: a.d * K, s: a.s + K, o: a.o.x + K };");
+            for (var n = 0; n < iterations; n++) {
+                var input = { d: 0.5, s: "s", o: { x: n } };
+                for (var f = 0; f < functions.length; f++) {
+                    var result = functions[f](input);
+                    assert.areEqual(0.5 * f, result.d, "double in function " + f);
+                    assert.areEqual("s" + f, result.s, "string in function " + f);
+                    assert.areEqual(n + f, result.o, "property in function " + f);
+                }
+            }
+        }
+    },
+    {
+        name: "Inlining into many functions jitted at the same time",
+        body: function () {
+            function inner(x, k) { return x + k; }
+            var functions = [];
+            for (var i = 0; i < functionCount; i++) {
+                functions.push(new Function("inner", "return function (a) { return inner(a, " + i + ") + inner(a, 1); };")(inner));
+            }
+            for (var n = 0; n < iterations; n++) {
+                for (var f = 0; f < functions.length; f++) {
+                    assert.areEqual(2 * n + f + 1, functions[f](n), "function " + f + " at iteration " + n);
+                }
+            }
+        }
+    },
+    {
+        name: "Jitted code for many functions bails out after a shape change",
+        body: function () {
+            var functions = makeFunctions("return a.x + K;");
+            var n;
+            var f;
+            for (n = 0; n < iterations; n++) {
+                for (f = 0; f < functions.length; f++) {
+                    assert.areEqual(n + f, functions[f]({ x: n }), "function " + f + " at iteration " + n);
+                }
+            }
+            Object.defineProperty(Object.prototype, "x", { get: function () { return "p"; }, configurable: true });
+            try {
+                for (f = 0; f < functions.length; f++) {
+                    assert.areEqual("p" + f, functions[f]({}), "function " + f + " with a prototype getter");
+                    assert.areEqual(1 + f, functions[f]({ x: 1 }), "function " + f + " with an own property");
+                }
+            } finally {
+                delete Object.prototype.x;
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,162 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Load and store sites that see more types than the largest polymorphic inline cache holds, so that they are
+// served by the megamorphic property cache, and that must notice when a cached type changes underneath them.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var shapeCount = 100;
+var iterations = 20;
+
+function makeObjects() {
+    var objects = [];
+    for (var i = 0; i < shapeCount; i++) {
+        var o = {};
+        for (var j = 0; j < i % 10; j++) {
+            o["before" + j] = j;
+        }
+        o["shape" + i] = i;
+        o.x = i;
+        objects.push(o);
+    }
+    return objects;
+}
+
+function load(o) { return o.x; }
+function store(o, v) { o.x = v; }
+function loadAfterStore(o, v) { o.x = v; return o.x; }
+
+function collect() {
+    if (typeof CollectGarbage === "function") {
+        CollectGarbage();
+    }
+}
+
+var tests = [
+    {
+        name: "Loads and stores across more types than a polymorphic inline cache holds",
+        body: function () {
+            var objects = makeObjects();
+            for (var n = 0; n < iterations; n++) {
+                for (var i = 0; i < objects.length; i++) {
+                    assert.areEqual(i + n, load(objects[i]), "load from shape " + i);
+                    store(objects[i], i + n + 1);
+                    assert.areEqual(i + n + 1, objects[i].x, "store to shape " + i);
+                }
+            }
+        }
+    },
+    {
+        name: "A property that moves to the prototype as an accessor",
+        body: function () {
+            var objects = makeObjects();
+            var i;
+            for (var n = 0; n < iterations; n++) {
+                for (i = 0; i < objects.length; i++) {
+                    assert.areEqual(i, load(objects[i]), "load from shape " + i);
+                }
+            }
+            var proto = { get x() { return "getter"; }, set x(v) { this.stored = v; } };
+            for (i = 0; i < objects.length; i++) {
+                delete objects[i].x;
+                Object.setPrototypeOf(objects[i], proto);
+            }
+            for (i = 0; i < objects.length; i++) {
+                assert.areEqual("getter", load(objects[i]), "load through the accessor for shape " + i);
+                store(objects[i], i);
+                assert.areEqual(i, objects[i].stored, "store through the accessor for shape " + i);
+                assert.isFalse(objects[i].hasOwnProperty("x"), "store must not add an own property to shape " + i);
+            }
+        }
+    },
+    {
+        name: "A property that becomes read-only",
+        body: function () {
+            var objects = makeObjects();
+            var i;
+            for (var n = 0; n < iterations; n++) {
+                for (i = 0; i < objects.length; i++) {
+                    store(objects[i], n);
+                }
+            }
+            for (i = 0; i < objects.length; i += 2) {
+                Object.defineProperty(objects[i], "x", { writable: false });
+            }
+            for (i = 0; i < objects.length; i++) {
+                store(objects[i], -1);
+                assert.areEqual(i % 2 === 0 ? iterations - 1 : -1, objects[i].x, "store to shape " + i);
+            }
+            for (i = 0; i < objects.length; i++) {
+                Object.freeze(objects[i]);
+                store(objects[i], -2);
+                assert.areNotEqual(-2, objects[i].x, "store to frozen shape " + i);
+            }
+        }
+    },
+    {
+        name: "Objects that switch to dictionary mode and back to new types",
+        body: function () {
+            var objects = makeObjects();
+            var i;
+            for (var n = 0; n < iterations; n++) {
+                for (i = 0; i < objects.length; i++) {
+                    assert.areEqual(n + i, loadAfterStore(objects[i], n + i), "shape " + i);
+                }
+            }
+            for (i = 0; i < objects.length; i++) {
+                delete objects[i]["shape" + i];
+                objects[i]["other" + i] = i;
+            }
+            collect();
+            for (n = 0; n < iterations; n++) {
+                for (i = 0; i < objects.length; i++) {
+                    assert.areEqual(-n - i, loadAfterStore(objects[i], -n - i), "dictionary shape " + i);
+                    assert.areEqual(i, objects[i]["other" + i], "other property of shape " + i);
+                }
+            }
+        }
+    },
+    {
+        name: "A missing property that is added later",
+        body: function () {
+            function loadY(o) { return o.y; }
+            var objects = makeObjects();
+            var i;
+            for (var n = 0; n < iterations; n++) {
+                for (i = 0; i < objects.length; i++) {
+                    assert.areEqual(undefined, loadY(objects[i]), "missing property on shape " + i);
+                }
+            }
+            Object.prototype.y = "proto";
+            try {
+                for (i = 0; i < objects.length; i++) {
+                    assert.areEqual("proto", loadY(objects[i]), "prototype property on shape " + i);
+                    objects[i].y = i;
+                    assert.areEqual(i, loadY(objects[i]), "own property on shape " + i);
+                }
+            } finally {
+                delete Object.prototype.y;
+            }
+        }
+    },
+    {
+        name: "Cached types that die and are replaced by new ones",
+        body: function () {
+            for (var round = 0; round < 5; round++) {
+                var objects = makeObjects();
+                for (var n = 0; n < iterations; n++) {
+                    for (var i = 0; i < objects.length; i++) {
+                        assert.areEqual(i + round, loadAfterStore(objects[i], i + round), "round " + round + ", shape " + i);
+                    }
+                }
+                objects = null;
+                collect();
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
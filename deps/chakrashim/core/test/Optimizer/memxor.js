@@ -0,0 +1,158 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Typed array xor loops. Loops of the form dst[i] = src[i] ^ c over typed int arrays of one type become a memcopy and a
+// memxor, and every other form must stay a loop. Each loop runs once in the interpreter and then in jitted code, and
+// both runs are compared with the result computed element by element on a plain array.
+// Run with -mic:1 -off:simplejit -off:jitloopbody
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function fill(array, seed) {
+    for (var i = 0; i < array.length; i++) {
+        array[i] = (i * 37 + seed) * 2654435761;
+    }
+    return array;
+}
+
+// What dst holds after dst[i] = op(src[i], i) for i in [start, end), computed on plain arrays
+function expected(dst, src, start, end, op) {
+    var result = Array.prototype.slice.call(dst);
+    for (var i = start; i < end; i++) {
+        if (i >= 0 && i < result.length) {
+            result[i] = op(i < src.length ? src[i] : undefined, i);
+        }
+    }
+    return new dst.constructor(result);
+}
+
+// Runs the loop on fresh arrays twice, in the interpreter and then in jitted code
+function check(description, body, makeArrays, start, end, op) {
+    var loop = makeLoop(body);
+    for (var run = 0; run < 2; run++) {
+        var arrays = makeArrays();
+        var want = expected(arrays.dst, arrays.src, start, end, op);
+        loop(arrays.dst, arrays.src, start, end);
+        assert.areEqual(Array.prototype.slice.call(want), Array.prototype.slice.call(arrays.dst), description + (run === 0 ? " (interpreted)" : " (jitted)"));
+    }
+}
+
+// A fresh function per check, so that each one is profiled with the arrays it is checked with
+function makeLoop(body) {
+    return new Function("dst", "src", "start", "end", "for (var i = start; i < end; i++) { " + body + " }");
+}
+
+function pair(Type, length) {
+    return function () { return { dst: fill(new Type(length), 1), src: fill(new Type(length), 2) }; };
+}
+
+var intTypes = [Int8Array, Uint8Array, Int16Array, Uint16Array, Int32Array, Uint32Array];
+
+var tests = [
+    {
+        name: "Xor with a constant over every typed int array",
+        body: function () {
+            intTypes.forEach(function (Type) {
+                check(Type.name, "dst[i] = src[i] ^ 5;", pair(Type, 100), 0, 100, function (v) { return v ^ 5; });
+            });
+        }
+    },
+    {
+        name: "Uint8ClampedArray with constants inside and outside [0, 255]",
+        body: function () {
+            check("xor 200", "dst[i] = src[i] ^ 200;", pair(Uint8ClampedArray, 100), 0, 100, function (v) { return v ^ 200; });
+            check("xor 300 clamps", "dst[i] = src[i] ^ 300;", pair(Uint8ClampedArray, 100), 0, 100, function (v) { return v ^ 300; });
+            check("xor -1 clamps", "dst[i] = src[i] ^ -1;", pair(Uint8ClampedArray, 100), 0, 100, function (v) { return v ^ -1; });
+        }
+    },
+    {
+        name: "In-place xor",
+        body: function () {
+            function same(Type) {
+                return function () { var a = fill(new Type(100), 3); return { dst: a, src: a }; };
+            }
+            intTypes.concat([Uint8ClampedArray]).forEach(function (Type) {
+                check(Type.name + " ^= c", "dst[i] ^= 0x5a;", same(Type), 0, 100, function (v) { return v ^ 0x5a; });
+                check(Type.name + " = a[i] ^ c", "dst[i] = dst[i] ^ 0x5a;", same(Type), 0, 100, function (v) { return v ^ 0x5a; });
+            });
+        }
+    },
+    {
+        name: "Xor of two arrays stays a loop",
+        body: function () {
+            intTypes.concat([Uint8ClampedArray]).forEach(function (Type) {
+                var makeArrays = pair(Type, 100);
+                var xorArrays = makeLoop("dst[i] ^= src[i];");
+                for (var run = 0; run < 2; run++) {
+                    var arrays = makeArrays();
+                    var want = Array.prototype.map.call(arrays.dst, function (v, i) { return v ^ arrays.src[i]; });
+                    xorArrays(arrays.dst, arrays.src, 0, 100);
+                    assert.areEqual(Array.prototype.slice.call(new Type(want)), Array.prototype.slice.call(arrays.dst), Type.name + " run " + run);
+                }
+            });
+        }
+    },
+    {
+        name: "Partial ranges, including the vector loop's tails and ranges past the end",
+        body: function () {
+            var ranges = [[0, 0], [0, 1], [3, 18], [1, 16], [0, 17], [5, 38], [64, 100], [90, 130], [-5, 10], [120, 140]];
+            ranges.forEach(function (range) {
+                [Uint8Array, Int16Array, Int32Array].forEach(function (Type) {
+                    check(Type.name + " [" + range + ")", "dst[i] = src[i] ^ 0x33;", pair(Type, 100), range[0], range[1], function (v) { return v ^ 0x33; });
+                });
+            });
+            check("source shorter than destination", "dst[i] = src[i] ^ 0x33;", function () {
+                return { dst: fill(new Uint8Array(100), 1), src: fill(new Uint8Array(40), 2) };
+            }, 0, 100, function (v) { return v ^ 0x33; });
+        }
+    },
+    {
+        name: "Overlapping views of one buffer fall back to the loop",
+        body: function () {
+            function views(Type, dstOffset, srcOffset) {
+                return function () {
+                    var buffer = new ArrayBuffer(Type.BYTES_PER_ELEMENT * 80);
+                    fill(new Type(buffer), 4);
+                    return { dst: new Type(buffer, dstOffset * Type.BYTES_PER_ELEMENT, 64), src: new Type(buffer, srcOffset * Type.BYTES_PER_ELEMENT, 64) };
+                };
+            }
+            [Uint8Array, Int16Array, Uint32Array].forEach(function (Type) {
+                [[1, 0], [0, 1], [0, 0], [16, 0]].forEach(function (offsets) {
+                    var xorOverlap = makeLoop("dst[i] = src[i] ^ 1;");
+                    for (var run = 0; run < 2; run++) {
+                        var arrays = views(Type, offsets[0], offsets[1])();
+                        // Element by element, the way the loop runs, so that earlier stores feed later loads
+                        var memory = Array.prototype.slice.call(new Type(arrays.dst.buffer));
+                        for (var i = 0; i < 64; i++) {
+                            memory[offsets[0] + i] = memory[offsets[1] + i] ^ 1;
+                        }
+                        xorOverlap(arrays.dst, arrays.src, 0, 64);
+                        assert.areEqual(Array.prototype.slice.call(new Type(memory)), Array.prototype.slice.call(new Type(arrays.dst.buffer)), Type.name + " offsets " + offsets + " run " + run);
+                    }
+                });
+            });
+        }
+    },
+    {
+        name: "Mixed element types stay a loop",
+        body: function () {
+            var combinations = [
+                [Int8Array, Uint8Array], [Uint8Array, Int8Array], [Int16Array, Int32Array], [Uint32Array, Int32Array],
+                [Uint8ClampedArray, Uint8Array], [Uint8Array, Uint8ClampedArray], [Int32Array, Float64Array], [Float32Array, Int32Array]
+            ];
+            combinations.forEach(function (types) {
+                check(types[0].name + " from " + types[1].name, "dst[i] = src[i] ^ 0x7f;", function () {
+                    var src = new types[1](100);
+                    for (var i = 0; i < 100; i++) {
+                        src[i] = (i - 50) * 7.25;
+                    }
+                    return { dst: fill(new types[0](100), 1), src: src };
+                }, 0, 100, function (v) { return v ^ 0x7f; });
+            });
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
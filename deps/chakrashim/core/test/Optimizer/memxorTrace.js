@@ -0,0 +1,106 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Which typed array xor loops become a memxor. Each loop runs once in the interpreter and once in jitted code, and the
+// baseline has a MemXor test trace line for every loop that is folded.
+
+function checksum(a) {
+    var s = 0;
+    for (var i = 0; i < a.length; i++) {
+        s = (s * 31 + a[i]) | 0;
+    }
+    return s;
+}
+
+function fill(a, seed) {
+    for (var i = 0; i < a.length; i++) {
+        a[i] = (i * 37 + seed) & 0x7f;
+    }
+    return a;
+}
+
+// Copied and then xored
+function xorInt8(dst, src, n) {
+    for (var i = 0; i < n; i++) {
+        dst[i] = src[i] ^ 5;
+    }
+}
+
+// Only xored, as the source is the destination
+function xorInPlace(a, n) {
+    for (var i = 0; i < n; i++) {
+        a[i] ^= 0x5a;
+    }
+}
+
+// A constant that keeps the result in [0, 255]
+function xorClamped(dst, src, n) {
+    for (var i = 0; i < n; i++) {
+        dst[i] = src[i] ^ 200;
+    }
+}
+
+// A constant that can take the result out of [0, 255], which the store would clamp
+function xorClampedOutOfRange(dst, src, n) {
+    for (var i = 0; i < n; i++) {
+        dst[i] = src[i] ^ 300;
+    }
+}
+
+// Not a constant
+function xorVariable(dst, src, n, c) {
+    for (var i = 0; i < n; i++) {
+        dst[i] = src[i] ^ c;
+    }
+}
+
+// The loaded value is used again after the xor
+function xorSourceUsed(dst, src, n) {
+    var last = 0;
+    for (var i = 0; i < n; i++) {
+        var v = src[i];
+        dst[i] = v ^ 3;
+        last = v;
+    }
+    return last;
+}
+
+// Not a typed int array
+function xorFloat(dst, src, n) {
+    for (var i = 0; i < n; i++) {
+        dst[i] = src[i] ^ 9;
+    }
+}
+
+for (var run = 0; run < 2; run++) {
+    var dst = new Int8Array(64), src = fill(new Int8Array(64), 1);
+    xorInt8(dst, src, 64);
+    WScript.Echo("xorInt8: " + checksum(dst));
+
+    var a = fill(new Uint16Array(64), 2);
+    xorInPlace(a, 64);
+    WScript.Echo("xorInPlace: " + checksum(a));
+
+    dst = new Uint8ClampedArray(64);
+    src = fill(new Uint8ClampedArray(64), 3);
+    xorClamped(dst, src, 64);
+    WScript.Echo("xorClamped: " + checksum(dst));
+
+    dst = new Uint8ClampedArray(64);
+    xorClampedOutOfRange(dst, src, 64);
+    WScript.Echo("xorClampedOutOfRange: " + checksum(dst));
+
+    dst = new Int32Array(64);
+    src = fill(new Int32Array(64), 4);
+    xorVariable(dst, src, 64, 6);
+    WScript.Echo("xorVariable: " + checksum(dst));
+
+    dst = new Int32Array(64);
+    WScript.Echo("xorSourceUsed: " + xorSourceUsed(dst, src, 64) + " " + checksum(dst));
+
+    dst = new Float64Array(64);
+    xorFloat(dst, fill(new Float64Array(64), 5), 64);
+    WScript.Echo("xorFloat: " + checksum(dst));
+}
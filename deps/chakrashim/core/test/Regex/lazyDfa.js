@@ -0,0 +1,166 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Patterns that may be matched with a lazy DFA, compared with the backtracking matcher. Every pattern is also run with an
+// empty lookahead in front of it, which keeps it from getting a DFA but matches the same strings, and the two must agree
+// on every match, its groups and lastIndex. Run with and without -RegexLazyDfa-.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// The same pattern, but only ever matched by the backtracker
+function backtracking(re) {
+    return new RegExp("(?=)(?:" + re.source + ")", flagsOf(re));
+}
+
+function flagsOf(re) {
+    return (re.global ? "g" : "") + (re.ignoreCase ? "i" : "") + (re.multiline ? "m" : "") + (re.unicode ? "u" : "") + (re.sticky ? "y" : "");
+}
+
+function describe(re, input) {
+    return re + " on " + JSON.stringify(input.length > 40 ? input.substring(0, 40) + "..." : input);
+}
+
+function execResult(re, input) {
+    var m = re.exec(input);
+    return m === null ? [null, re.lastIndex] : [m.index, Array.prototype.slice.call(m), re.lastIndex];
+}
+
+// Compares exec, every match of a global exec loop, test, replace, match and split on the input
+function compare(re, input, lastIndex) {
+    var reference = backtracking(re);
+    var description = describe(re, input);
+    re.lastIndex = reference.lastIndex = lastIndex || 0;
+    assert.areEqual(execResult(reference, input), execResult(re, input), "exec " + description);
+
+    re.lastIndex = reference.lastIndex = lastIndex || 0;
+    assert.areEqual(reference.test(input), re.test(input), "test " + description);
+    assert.areEqual(reference.lastIndex, re.lastIndex, "lastIndex after test " + description);
+
+    var all = new RegExp(re.source, flagsOf(re).replace("g", "") + "g");
+    var allReference = backtracking(all);
+    for (var i = 0; i < 100; i++) {
+        var expected = execResult(allReference, input);
+        assert.areEqual(expected, execResult(all, input), "match " + i + " of " + description);
+        if (expected[0] === null) {
+            break;
+        }
+        if (expected[1][0] === "") {
+            allReference.lastIndex++;
+            all.lastIndex++;
+        }
+    }
+
+    assert.areEqual(input.replace(allReference, "<$&>"), input.replace(all, "<$&>"), "replace " + description);
+    assert.areEqual(input.match(allReference), input.match(all), "match " + description);
+    assert.areEqual(input.split(reference), input.split(re), "split " + description);
+}
+
+function compareAll(patterns, inputs) {
+    patterns.forEach(function (re) {
+        inputs.forEach(function (input) {
+            compare(re, input);
+        });
+    });
+}
+
+var tests = [
+    {
+        name: "Alternations and loops that the backtracker has to retry",
+        body: function () {
+            compareAll(
+                [/(a|ab)(c|bcd)(d*)/, /(a+)+b/, /(?:a|b)*abb/, /x(a|ab|abc)*y/, /(a|b|ab)*c/, /(\d+)-(\d+)?-?(\d*)/, /a{2,4}?b/, /(ab|a)(bc|c)?/],
+                ["abcd", "aaaab", "aaaa", "xabcabababcy", "xaby", "ababababc", "12-34-56", "12--", "aaaaab", "abc", "", "zzabbzz"]);
+            assert.areEqual(["abcd", "a", "bcd", ""], Array.prototype.slice.call(/(a|ab)(c|bcd)(d*)/.exec("abcd")), "leftmost-first, not longest");
+            assert.areEqual(["ab", "a", "b"], Array.prototype.slice.call(/(a|ab)(b)/.exec("ab")), "the first alternative that leads to a match");
+        }
+    },
+    {
+        name: "Case-insensitive patterns",
+        body: function () {
+            compareAll(
+                [/(a|ab)+c/i, /[a-z]+x/i, /(k|s)+t/i, /([^a-z]|q)+z/i, /(\u00c4|\u00f6)+$/i, /\w+(ss|\u00df)/i],
+                ["ABABc", "aBaBC", "HELLOx", "KsSkt", "\u212a\u017ft", "12Q3z", "\u00c4\u00e4\u00d6\u00f6", "strasse", "STRA\u00dfE", "\u00df\u1e9e"]);
+        }
+    },
+    {
+        name: "Anchors, with and without the multiline flag",
+        body: function () {
+            compareAll(
+                [/^(a|ab)+$/, /^(a|ab)+$/m, /(a|b)+$/, /(a|b)+$/m, /^(?:x|xy)*/, /^(?:x|xy)*/m, /^$/, /^$/m],
+                ["abab", "ab\nab", "ab\r\nab\n", "x\nxy\n\nxyx", "\n", "", "c\u2028ab\u2029b"]);
+        }
+    },
+    {
+        name: "Surrogates, with and without the unicode flag",
+        body: function () {
+            compareAll(
+                [/(\ud83d|\ude00)+/, /(.|\ud83d\ude00)+x/, /[\ud800-\udbff][\udc00-\udfff]/, /(\ud83d\ude00|a)+/u, /(.)+x/u, /[^a]+b/u],
+                ["\ud83d\ude00\ud83d\ude00x", "a\ud83dx", "\ude00\ud83d", "a\ud83d\ude00ab", "\ud83d"]);
+        }
+    },
+    {
+        name: "Sticky and global patterns starting at lastIndex",
+        body: function () {
+            var patterns = [/(a|ab)+c/y, /(a|ab)+c/g, /(a|ab)+c/gy, /(x|xy)*/y, /(x|xy)*/g];
+            var input = "zabacababcxxy";
+            patterns.forEach(function (re) {
+                for (var lastIndex = 0; lastIndex <= input.length + 1; lastIndex++) {
+                    compare(re, input, lastIndex);
+                }
+            });
+        }
+    },
+    {
+        name: "Empty matches",
+        body: function () {
+            compareAll(
+                [/(a|)*/, /(|a)+/, /(a*)*b?/, /(?:a|b)*?/, /(x|xy)?/, /(a{0,2}){2}/, /()|a/],
+                ["", "a", "aab", "baab", "xyxy", "bbb"]);
+            compareAll([/(a|)*?/g, /(a|b|)/], ["ab", ""]);
+        }
+    },
+    {
+        name: "Patterns with groups that are bound by the backtracker after the DFA finds the match",
+        body: function () {
+            compareAll(
+                [/((a|b)+)(c|d)/, /(a)|(b)|(ab)/, /(?:(a)|b)+/, /((x)|(xy))+z/, /(a(b(c)?)?)+d/],
+                ["abababd", "ab", "babab", "xxyxz", "ababcabd", "zzz"]);
+        }
+    },
+    {
+        name: "Inputs that fill the state cache",
+        body: function () {
+            // Each of the 2^13 combinations of the last 13 characters is a distinct state, so a few thousand random characters
+            // go through more states than the cache holds
+            var re = /(a|b)*a(a|b){12}c/;
+            var input = "";
+            var seed = 7;
+            for (var i = 0; i < 3000; i++) {
+                seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+                input += (seed >> 16) & 1 ? "a" : "b";
+            }
+            compare(re, input);
+            compare(re, input + "c");
+            compare(re, input.substring(0, 2000) + "c" + input.substring(2000));
+            compare(/(a|b)*?a(a|b){12}c/g, input.substring(0, 1000) + "c" + input.substring(1000, 2000) + "c");
+        }
+    },
+    {
+        name: "Patterns with more character classes than the DFA maps",
+        body: function () {
+            var chars = "";
+            for (var i = 0; i < 100; i++) {
+                chars += String.fromCharCode(0x100 + i * 3);
+            }
+            var alternatives = chars.split("").join("|");
+            var re = new RegExp("(" + alternatives + ")+z");
+            compare(re, chars + "z");
+            compare(re, chars + chars.substring(50) + "y");
+            compare(new RegExp("(" + alternatives + "|a)+z", "i"), "A" + chars + "Z");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
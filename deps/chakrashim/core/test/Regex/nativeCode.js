@@ -0,0 +1,163 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Regexes that are compiled to machine code once they are hot, compared with the interpreter. Each pattern is warmed up
+// past the threshold and then matched against every input, and each result is compared with that of a new regex with
+// the same source, which runs in the interpreter since it has not matched anything yet. Run with the default threshold,
+// with -RegexJitThreshold:1 and with -RegexJit-.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var warmUpCount = 40;
+
+function flagsOf(re) {
+    return (re.global ? "g" : "") + (re.ignoreCase ? "i" : "") + (re.multiline ? "m" : "") + (re.unicode ? "u" : "") + (re.sticky ? "y" : "");
+}
+
+function execResult(re, input) {
+    var m = re.exec(input);
+    return m === null ? [null, re.lastIndex] : [m.index, Array.prototype.slice.call(m), re.lastIndex];
+}
+
+function describe(re, input) {
+    return re + " on " + JSON.stringify(input.length > 40 ? input.substring(0, 40) + "..." : input);
+}
+
+function hot(re, warmUpInput) {
+    for (var i = 0; i < warmUpCount; i++) {
+        re.lastIndex = 0;
+        re.exec(warmUpInput);
+    }
+    return re;
+}
+
+// Compares exec from the given lastIndex, and a global exec loop, with a regex that runs in the interpreter
+function compare(re, input, lastIndex) {
+    var description = describe(re, input);
+    var reference = new RegExp(re.source, flagsOf(re));
+    re.lastIndex = reference.lastIndex = lastIndex || 0;
+    assert.areEqual(execResult(reference, input), execResult(re, input), "exec " + description + " from " + (lastIndex || 0));
+
+    var flags = flagsOf(re).replace("g", "") + "g";
+    var all = hot(new RegExp(re.source, flags), input);
+    var expected = input.match(new RegExp(re.source, flags));
+    all.lastIndex = 0;
+    assert.areEqual(expected, input.match(all), "match " + description);
+    assert.areEqual(input.replace(new RegExp(re.source, flags), "<$&>"), input.replace(all, "<$&>"), "replace " + description);
+}
+
+function compareAll(patterns, inputs) {
+    patterns.forEach(function (re) {
+        hot(re, inputs[0]);
+        inputs.forEach(function (input) {
+            compare(re, input);
+        });
+    });
+}
+
+var tests = [
+    {
+        name: "Character classes",
+        body: function () {
+            compareAll(
+                [/[a-z]+/, /[^a-z]+/, /\d+/, /\D+/, /\w+/, /\W+/, /\s+/, /\S+/, /a.c/, /[\u0100-\u017f\u2000-\u206f]+/, /[^\u0000-\u007f]/, /[a-z]+/i, /[\u00e0-\u00ff]+/i, /[.$^\\\]-]+/],
+                ["hello World 42", "\u00c0\u00e0\u0130\u0131\u017f K\u212a", "a\nc a\u2028c a\rc abc", "tab\there\u00a0\ufeffend", "\u2003\u2019\u0150x", "-]\\^$.", "", "Z"]);
+        }
+    },
+    {
+        name: "Bounded and unbounded loops",
+        body: function () {
+            compareAll(
+                [/a{3}/, /[0-9]{2,4}/, /\d{1,3}(?:\.\d{1,3}){3}/, /x*y/, /[a-z]*:/, /b+c/, /(?:ab){2}c/, /a{0}b/, /[ab]{5,}/, /z?q/],
+                ["aaaa 123456 10.0.0.255:80 xxxy x:y:", "ababc abababc aabb ababbaab bbbbbbc", "qzq y b c", "1.2.3 1234.5.6.7", "aa"]);
+        }
+    },
+    {
+        name: "Literals, anchors and word boundaries",
+        body: function () {
+            compareAll(
+                [/hello/, /hello/i, /^GET /, /\.js$/, /^\s*$/, /\bfoo\b/, /\Bar\B/, /^a|b$/, /x$|^y/, /^line/m, /end$/m, /^$/m],
+                ["hello HELLO hElLo", "GET /index.js", "  \t", "foo food barfoo foo", "bar bard ebarb", "line one\nline two end\n\nend", "", "y x"]);
+        }
+    },
+    {
+        name: "Inputs that end where a match would need more characters",
+        body: function () {
+            var patterns = [/abcd/, /abc$/, /\d{4}/, /[a-z]{3}x/, /ab\b/, /a\w*z/, /(?:xy){3}/];
+            var whole = "abcdxyxyxyz1234abz";
+            patterns.forEach(function (re) {
+                hot(re, whole);
+                for (var end = 0; end <= whole.length; end++) {
+                    for (var start = 0; start <= end; start += 3) {
+                        // Substrings of a longer string, so that the characters after the input are readable and match
+                        compare(re, whole.substring(start, end));
+                    }
+                }
+            });
+        }
+    },
+    {
+        name: "Global and sticky regexes starting at every lastIndex",
+        body: function () {
+            var input = "id=12; id=345;id=6 id=";
+            [/id=\d+/g, /id=\d+/y, /id=\d+/gy, /\d*/g, /[a-z]*/y].forEach(function (re) {
+                hot(re, input);
+                for (var lastIndex = 0; lastIndex <= input.length + 1; lastIndex++) {
+                    compare(re, input, lastIndex);
+                }
+            });
+        }
+    },
+    {
+        name: "Groups",
+        body: function () {
+            compareAll(
+                [/(\d+)-(\d+)/, /(a)?b/, /([a-z]+)@([a-z]+)\.com/, /x(y)?(z)?/, /(?:(a)|(b))c/],
+                ["10-20 3-4", "b ab", "me@example.com you@x.com", "x xy xz xyz", "ac bc c"]);
+            var re = hot(/(a)?b/, "ab");
+            var m = re.exec("ab b");
+            assert.areEqual("a", m[1], "group set by the first match");
+            m = re.exec("b");
+            assert.areEqual(undefined, m[1], "group not carried over from the previous match");
+        }
+    },
+    {
+        name: "Patterns that stay in the interpreter",
+        body: function () {
+            compareAll(
+                [/(a)\1/, /a(?=b)/, /a(?!b)/, /(a|ab)c/, /(?:a|b)+c/, /\u{1F600}/u, /[^a]/u],
+                ["aa ab ac abc", "babbc", "\ud83d\ude00 x"]);
+        }
+    },
+    {
+        name: "Hot regexes used by string methods",
+        body: function () {
+            var re = hot(/[aeiou]/g, "abc");
+            assert.areEqual("h*ll* w*rld", "hello world".replace(re, "*"), "replace");
+            assert.areEqual("hEllO wOrld", "hello world".replace(re, function (v) { return v === "e" || v === "o" ? v.toUpperCase() : v; }), "replace with a function");
+            assert.areEqual(["h", "ll", " w", "rld"], "hello world".split(/[aeiou]/), "split");
+            assert.areEqual(4, "hello world".search(hot(/o w/, "o w")), "search");
+            assert.areEqual(["e", "o", "o"], "hello world".match(re), "match");
+        }
+    },
+    {
+        name: "Many distinct hot regexes",
+        body: function () {
+            // Each of these compiles to a few hundred bytes at least, so together they need more code than the budget for regex
+            // code allows and the later ones stay in the interpreter
+            var body = new Array(21).join("[0-9a-f][g-z]");
+            for (var i = 0; i < 3000; i++) {
+                var source = "k" + i + "=" + body + "[0-9a-f]{1," + (1 + i % 7) + "}";
+                var match = "k" + i + "=" + new Array(21).join("0g");
+                var re = hot(new RegExp(source), match + "f");
+                var input = "k" + (i - 1) + "=00 " + match + "abcdef0123 " + match;
+                assert.areEqual(execResult(new RegExp(source), input), execResult(re, input), "regex " + i);
+                assert.areEqual(execResult(new RegExp(source), match.substring(1)), execResult(re, match.substring(1)), "regex " + i + " without a match");
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
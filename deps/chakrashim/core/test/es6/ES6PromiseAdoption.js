@@ -0,0 +1,155 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// ES6 Promise adoption tests -- verifies the order in which a promise resolved with another promise settles, and when the
+// other promise's then and constructor are looked up, relative to a chain of then calls on the other promise
+
+function echo(str) {
+    WScript.Echo(str);
+}
+
+// Chains three thens on p, the number of jobs it takes a promise resolved with p to settle
+function chain(p, name) {
+    p.then().then().then(
+        function (v) { echo(name + ' fulfilled: ' + v); },
+        function (e) { echo(name + ' rejected: ' + e); });
+}
+
+function adopt(p, name) {
+    new Promise(function (resolve) { resolve(p); }).then(
+        function (v) { echo(name + ' fulfilled: ' + v); },
+        function (e) { echo(name + ' rejected: ' + e); });
+}
+
+var tests = [
+    {
+        name: "Adopting a fulfilled promise",
+        body: function () {
+            var p = Promise.resolve(1);
+            adopt(p, 'new Promise(r => r(p)).then(A)');
+            chain(p, 'p.then().then().then(B)');
+            Promise.resolve().then(function () { echo('tick 1'); }).then(function () { echo('tick 2'); }).then(function () { echo('tick 3'); });
+        }
+    },
+    {
+        name: "Adopting a rejected promise",
+        body: function () {
+            var p = Promise.reject('error');
+            adopt(p, 'new Promise(r => r(p)).then(A)');
+            chain(p, 'p.then().then().then(B)');
+        }
+    },
+    {
+        name: "Adopting a pending promise that fulfills later",
+        body: function () {
+            var resolveP;
+            var p = new Promise(function (resolve) { resolveP = resolve; });
+            adopt(p, 'new Promise(r => r(p)).then(A)');
+            chain(p, 'p.then().then().then(B)');
+            Promise.resolve().then(function () { echo('resolving p'); resolveP(2); });
+        }
+    },
+    {
+        name: "Adopting a promise that adopts another promise",
+        body: function () {
+            var p = Promise.resolve(3);
+            var q = new Promise(function (resolve) { resolve(p); });
+            adopt(q, 'new Promise(r => r(q)).then(A)');
+            chain(p, 'p.then().then().then(B)');
+            chain(q, 'q.then().then().then(C)');
+        }
+    },
+    {
+        name: "The constructor getter runs in the job, not when the promise is resolved",
+        body: function () {
+            var p = Promise.resolve(4);
+            Object.defineProperty(p, 'constructor', { get: function () { echo('constructor getter'); return Promise; } });
+            adopt(p, 'new Promise(r => r(p)).then(A)');
+            echo('after resolve');
+            chain(Promise.resolve(4), 'p.then().then().then(B)');
+        }
+    },
+    {
+        name: "A Symbol.species getter runs in the job, not when the promise is resolved",
+        body: function () {
+            var p = Promise.resolve(5);
+            var species = Object.getOwnPropertyDescriptor(Promise, Symbol.species);
+            Object.defineProperty(Promise, Symbol.species, { get: function () { echo('species getter'); return Promise; }, configurable: true });
+            new Promise(function (resolve) { resolve(p); });
+            echo('after resolve');
+            return function () { Object.defineProperty(Promise, Symbol.species, species); };
+        }
+    },
+    {
+        name: "A then replaced on Promise.prototype is called in the job",
+        body: function () {
+            var then = Promise.prototype.then;
+            Promise.prototype.then = function (onFulfilled, onRejected) {
+                echo('replaced then');
+                return then.call(this, onFulfilled, onRejected);
+            };
+            var p = Promise.resolve(6);
+            new Promise(function (resolve) { resolve(p); });
+            echo('after resolve');
+            Promise.prototype.then = then;
+        }
+    },
+    {
+        name: "An own then is looked up when the promise is resolved and called in the job",
+        body: function () {
+            var p = Promise.resolve(7);
+            Object.defineProperty(p, 'then', { get: function () {
+                echo('then getter');
+                return function (onFulfilled) { echo('own then'); onFulfilled(70); };
+            } });
+            adopt(p, 'new Promise(r => r(p)).then(A)');
+            echo('after resolve');
+        }
+    },
+    {
+        name: "A species constructor other than Promise is constructed in the job",
+        body: function () {
+            function Derived(executor) {
+                echo('Derived constructed');
+                return new Promise(executor);
+            }
+            var p = Promise.resolve(8);
+            p.constructor = { [Symbol.species]: Derived };
+            adopt(p, 'new Promise(r => r(p)).then(A)');
+            echo('after resolve');
+            chain(Promise.resolve(8), 'p.then().then().then(B)');
+        }
+    },
+    {
+        name: "Adopting a subclass instance",
+        body: function () {
+            class SubPromise extends Promise {}
+            var p = SubPromise.resolve(9);
+            adopt(p, 'new Promise(r => r(p)).then(A)');
+            chain(Promise.resolve(9), 'p.then().then().then(B)');
+        }
+    },
+];
+
+var index = 0;
+
+// Runs each test in a task of its own, once the jobs of the previous one have all run. A test can return a function that
+// undoes its changes to the built-ins once its jobs have run.
+function runNext() {
+    if (index === tests.length) {
+        return;
+    }
+    var test = tests[index++];
+    echo('Executing test #' + index + ' - ' + test.name);
+    var cleanup = test.body();
+    WScript.SetTimeout(function () {
+        if (cleanup) {
+            cleanup();
+        }
+        runNext();
+    }, 0);
+}
+
+runNext();
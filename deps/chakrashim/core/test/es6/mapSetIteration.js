@@ -0,0 +1,350 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Map and Set iteration while the collection changes. The entries are kept in insertion order in one array, deleted
+// entries stay in place until the table compacts, grows or shrinks into new storage, and iterators that are part way
+// through find their place again in the new storage. Every case is checked for Map and Set, through forEach and through
+// iterators.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// Operations that are the same on a Map and a Set, with a Map's values derived from its keys
+var kinds = [
+    {
+        name: "Map",
+        create: function (keys) {
+            var map = new Map();
+            (keys || []).forEach(function (k) { map.set(k, "v" + k); });
+            return map;
+        },
+        add: function (collection, key) { collection.set(key, "v" + key); },
+        checkEntry: function (collection, key, value) {
+            assert.areEqual("v" + key, value, "the value of " + key);
+        }
+    },
+    {
+        name: "Set",
+        create: function (keys) {
+            return new Set(keys || []);
+        },
+        add: function (collection, key) { collection.add(key); },
+        checkEntry: function (collection, key, value) {
+            assert.isTrue(key === value || (key !== key && value !== value), "a Set passes its key as the value");
+        }
+    }
+];
+
+function range(start, end) {
+    var result = [];
+    for (var i = start; i < end; i++) {
+        result.push(i);
+    }
+    return result;
+}
+
+// The keys that forEach visits, calling visit with each key before it goes on
+function forEachKeys(kind, collection, visit) {
+    var seen = [];
+    collection.forEach(function (value, key, c) {
+        assert.isTrue(c === collection, "the collection is passed to the callback");
+        kind.checkEntry(collection, key, value);
+        seen.push(key);
+        if (visit) {
+            visit(key, seen.length);
+        }
+    });
+    return seen;
+}
+
+// The keys that an entries iterator returns, calling visit with each key before it goes on
+function iteratorKeys(kind, collection, visit) {
+    var seen = [];
+    var iterator = collection.entries();
+    for (var result = iterator.next(); !result.done; result = iterator.next()) {
+        kind.checkEntry(collection, result.value[0], result.value[1]);
+        seen.push(result.value[0]);
+        if (visit) {
+            visit(result.value[0], seen.length);
+        }
+    }
+    assert.isTrue(iterator.next().done, "a finished iterator stays finished");
+    return seen;
+}
+
+var walks = [
+    { name: "forEach", keys: forEachKeys },
+    { name: "iterator", keys: iteratorKeys }
+];
+
+// Runs the body for each kind of collection and each way of walking it
+function eachWay(body) {
+    kinds.forEach(function (kind) {
+        walks.forEach(function (walk) {
+            body(kind, function (collection, visit) { return walk.keys(kind, collection, visit); }, kind.name + " " + walk.name);
+        });
+    });
+}
+
+function keysOf(collection) {
+    var keys = [];
+    collection.forEach(function (value, key) { keys.push(key); });
+    return keys;
+}
+
+var tests = [
+    {
+        name: "A key deleted and added again while it is being visited is visited again at the end",
+        body: function () {
+            eachWay(function (kind, walk, description) {
+                var collection = kind.create([1, 2, 3, 4]);
+                var seen = walk(collection, function (key, n) {
+                    if (key === 2 && n === 2) {
+                        collection.delete(2);
+                        kind.add(collection, 2);
+                    }
+                });
+                assert.areEqual([1, 2, 3, 4, 2], seen, description + ": the current key");
+                assert.areEqual([1, 3, 4, 2], keysOf(collection), description + ": the order afterwards");
+
+                collection = kind.create([1, 2, 3, 4]);
+                seen = walk(collection, function (key) {
+                    if (key === 1) {
+                        collection.delete(3);
+                        kind.add(collection, 3);
+                    }
+                });
+                assert.areEqual([1, 2, 4, 3], seen, description + ": a later key moves to the end");
+
+                collection = kind.create([1, 2, 3, 4]);
+                seen = walk(collection, function (key) {
+                    if (key === 3) {
+                        collection.delete(1);
+                        kind.add(collection, 1);
+                    }
+                });
+                assert.areEqual([1, 2, 3, 4, 1], seen, description + ": an earlier key is visited again");
+            });
+        }
+    },
+    {
+        name: "Keys deleted before they are visited are skipped",
+        body: function () {
+            eachWay(function (kind, walk, description) {
+                var collection = kind.create(range(0, 10));
+                var seen = walk(collection, function (key) {
+                    if (key % 3 === 0) {
+                        collection.delete(key + 1);
+                        collection.delete(key + 2);
+                    }
+                });
+                assert.areEqual([0, 3, 6, 9], seen, description);
+
+                collection = kind.create(range(0, 10));
+                seen = walk(collection, function (key) {
+                    collection.delete(key);
+                });
+                assert.areEqual(range(0, 10), seen, description + ": deleting each key as it is visited");
+                assert.areEqual(0, collection.size, description + ": all deleted");
+            });
+        }
+    },
+    {
+        name: "clear() while iterating",
+        body: function () {
+            eachWay(function (kind, walk, description) {
+                var collection = kind.create(range(0, 20));
+                var seen = walk(collection, function (key) {
+                    if (key === 5) {
+                        collection.clear();
+                    }
+                });
+                assert.areEqual(range(0, 6), seen, description + ": nothing after the clear");
+
+                collection = kind.create(range(0, 20));
+                seen = walk(collection, function (key) {
+                    if (key === 5) {
+                        collection.clear();
+                        kind.add(collection, 100);
+                        kind.add(collection, 3);
+                    }
+                });
+                assert.areEqual([0, 1, 2, 3, 4, 5, 100, 3], seen, description + ": keys added after the clear");
+
+                collection = kind.create(range(0, 4));
+                var cleared = 0;
+                seen = walk(collection, function (key) {
+                    if (cleared < 3) {
+                        cleared++;
+                        collection.clear();
+                        kind.add(collection, key + 10);
+                    }
+                });
+                assert.areEqual([0, 10, 20, 30], seen, description + ": cleared on every visit");
+            });
+        }
+    },
+    {
+        name: "Iterators that are not running when the collection is cleared",
+        body: function () {
+            kinds.forEach(function (kind) {
+                var collection = kind.create(range(0, 10));
+                var before = collection.keys();
+                var partWay = collection.keys();
+                partWay.next();
+                partWay.next();
+                collection.clear();
+                kind.add(collection, "a");
+                kind.add(collection, "b");
+                assert.areEqual({ value: "a", done: false }, before.next(), kind.name + ": an iterator that had not started");
+                assert.areEqual({ value: "a", done: false }, partWay.next(), kind.name + ": an iterator part way through");
+                collection.clear();
+                assert.isTrue(before.next().done, kind.name + ": cleared again");
+                kind.add(collection, "c");
+                assert.isTrue(before.next().done, kind.name + ": a finished iterator does not see new keys");
+                assert.areEqual({ value: "c", done: false }, partWay.next(), kind.name + ": an unfinished iterator sees keys added after a clear");
+                assert.isTrue(partWay.next().done, kind.name + ": and then finishes");
+            });
+        }
+    },
+    {
+        name: "Insertion order after deletes",
+        body: function () {
+            kinds.forEach(function (kind) {
+                var collection = kind.create(range(0, 100));
+                var expected = range(0, 100);
+                for (var i = 0; i < 100; i += 2) {
+                    collection.delete(i);
+                }
+                expected = expected.filter(function (k) { return k % 2; });
+                assert.areEqual(expected, keysOf(collection), kind.name + ": even keys deleted");
+
+                kind.add(collection, 0);
+                kind.add(collection, 51);
+                expected.push(0);
+                assert.areEqual(expected, keysOf(collection), kind.name + ": a deleted key is added at the end, an existing key stays");
+
+                // Enough churn to compact the table several times
+                for (var round = 0; round < 20; round++) {
+                    var key = expected.shift();
+                    collection.delete(key);
+                    kind.add(collection, key);
+                    expected.push(key);
+                    for (var i = 0; i < 30; i++) {
+                        kind.add(collection, "t" + i);
+                    }
+                    for (var i = 0; i < 30; i++) {
+                        collection.delete("t" + i);
+                    }
+                }
+                assert.areEqual(expected, keysOf(collection), kind.name + ": after compaction");
+                assert.areEqual(expected.length, collection.size, kind.name + ": size");
+
+                for (var i = 0; i < expected.length; i++) {
+                    assert.isTrue(collection.has(expected[i]), kind.name + ": has " + expected[i]);
+                }
+                assert.isFalse(collection.has("t0"), kind.name + ": a deleted temporary key");
+            });
+        }
+    },
+    {
+        name: "Iterators part way through while the table grows, compacts and shrinks",
+        body: function () {
+            eachWay(function (kind, walk, description) {
+                var collection = kind.create([0, 1, 2]);
+                var seen = walk(collection, function (key) {
+                    if (key === 1) {
+                        for (var i = 3; i < 1000; i++) {
+                            kind.add(collection, i);
+                        }
+                    }
+                });
+                assert.areEqual(range(0, 1000), seen, description + ": grown");
+
+                collection = kind.create(range(0, 1000));
+                seen = walk(collection, function (key) {
+                    if (key === 400) {
+                        for (var i = 0; i < 1000; i++) {
+                            if (i % 10 !== 0) {
+                                collection.delete(i);
+                            }
+                        }
+                    }
+                });
+                var expected = range(0, 401).concat(range(410, 1000).filter(function (k) { return k % 10 === 0; }));
+                assert.areEqual(expected, seen, description + ": shrunk");
+
+                collection = kind.create(range(0, 16));
+                var added = 16;
+                seen = walk(collection, function (key) {
+                    if (key < 200) {
+                        // Replaces every visited key with a new one at the end, so the deleted entries fill the table
+                        collection.delete(key);
+                        kind.add(collection, added++);
+                    }
+                });
+                assert.areEqual(range(0, added), seen, description + ": compacted");
+                assert.areEqual(16, collection.size, description + ": the size after compaction");
+            });
+        }
+    },
+    {
+        name: "Several iterators over one collection",
+        body: function () {
+            kinds.forEach(function (kind) {
+                var collection = kind.create(range(0, 50));
+                var iterators = [];
+                for (var i = 0; i < 5; i++) {
+                    var iterator = collection.keys();
+                    for (var j = 0; j < i * 10; j++) {
+                        iterator.next();
+                    }
+                    iterators.push(iterator);
+                }
+                for (var i = 0; i < 50; i += 3) {
+                    collection.delete(i);
+                }
+                for (var i = 0; i < 200; i++) {
+                    kind.add(collection, "x" + i);
+                }
+                iterators.forEach(function (iterator, n) {
+                    var remaining = [];
+                    for (var result = iterator.next(); !result.done; result = iterator.next()) {
+                        remaining.push(result.value);
+                    }
+                    var expected = keysOf(collection).filter(function (k) { return typeof k === "string" || k >= n * 10; });
+                    assert.areEqual(expected, remaining, kind.name + ": iterator " + n);
+                });
+            });
+        }
+    },
+    {
+        name: "Keys that are equal under SameValueZero",
+        body: function () {
+            kinds.forEach(function (kind) {
+                var collection = kind.create();
+                kind.add(collection, 0);
+                kind.add(collection, -0);
+                kind.add(collection, NaN);
+                kind.add(collection, 0 / 0);
+                kind.add(collection, 5);
+                kind.add(collection, 10 / 2);
+                kind.add(collection, 2147483648);
+                kind.add(collection, Math.pow(2, 31));
+                kind.add(collection, "5");
+                assert.areEqual(5, collection.size, kind.name + ": size");
+                var keys = keysOf(collection);
+                assert.isTrue(Object.is(0, keys[0]), kind.name + ": -0 is stored as +0");
+                assert.isTrue(keys[1] !== keys[1], kind.name + ": NaN");
+                assert.areEqual([5, 2147483648, "5"], keys.slice(2), kind.name + ": numbers and strings");
+                assert.isTrue(collection.has(-0) && collection.has(NaN) && collection.has(2.5 * 2), kind.name + ": found by equal keys");
+                collection.delete(-0);
+                collection.delete(0 / 0);
+                assert.areEqual([5, 2147483648, "5"], keysOf(collection), kind.name + ": deleted by equal keys");
+            });
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
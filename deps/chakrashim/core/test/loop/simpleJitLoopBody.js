@@ -0,0 +1,163 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Long loops in functions that are already running in simple JIT code. Each function is called a few times with short
+// loops so that it gets simple jitted, then once with a long loop, which schedules its full JIT loop body from the
+// simple JIT frame and moves into it once it is ready.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var longCount = 20000;
+
+function warmUp(f) {
+    var args = Array.prototype.slice.call(arguments, 1);
+    for (var i = 0; i < 5; i++) {
+        f.apply(null, [2].concat(args));
+    }
+}
+
+var tests = [
+    {
+        name: "Live-in values of every type reach the loop body",
+        body: function () {
+            function mix(n, start, scale, prefix, o) {
+                var i = start;
+                var d = 0.5;
+                var s = prefix;
+                for (var k = 0; k < n; k++) {
+                    i += k & 3;
+                    d *= scale;
+                    o.count++;
+                }
+                s += i;
+                return [i, d, s, o.count];
+            }
+            warmUp(mix, 0, 1, "p", { count: 0 });
+            var o = { count: 0 };
+            var result = mix(longCount, 10, 1, "p", o);
+            assert.areEqual(10 + 1.5 * longCount, result[0], "int live-in");
+            assert.areEqual(0.5, result[1], "double live-in");
+            assert.areEqual("p" + result[0], result[2], "string live-in");
+            assert.areEqual(longCount, result[3], "object live-in");
+        }
+    },
+    {
+        name: "Live-in types that differ from the profile collected in simple JIT code",
+        body: function () {
+            function accumulate(n, total, step) {
+                for (var k = 0; k < n; k++) {
+                    total += step;
+                }
+                return total;
+            }
+            warmUp(accumulate, 0, 1);
+            assert.areEqual(longCount * 0.5, accumulate(longCount, 0, 0.5), "double after int warm-up");
+            assert.areEqual("x" + Array(longCount + 1).join("y"), accumulate(longCount, "x", "y"), "string after int warm-up");
+            assert.areEqual(longCount, accumulate(longCount, 0, 1), "int again");
+        }
+    },
+    {
+        name: "Nested loops and early exits",
+        body: function () {
+            function search(n, target) {
+                var visited = 0;
+                for (var i = 0; i < n; i++) {
+                    for (var j = 0; j < 10; j++) {
+                        visited++;
+                        if (j > i) {
+                            break;
+                        }
+                        if ((i * 10 + j) % 7 === 0) {
+                            continue;
+                        }
+                        if (i * 10 + j === target) {
+                            return [i, j, visited];
+                        }
+                    }
+                }
+                return [-1, -1, visited];
+            }
+            warmUp(search, 0);
+            assert.areEqual([1500, 3, 14968], search(longCount, 15003), "found");
+            assert.areEqual([-1, -1, 199964], search(longCount, -1), "not found");
+        }
+    },
+    {
+        name: "Closures that capture loop variables",
+        body: function () {
+            function capture(n) {
+                var functions = [];
+                for (let k = 0; k < n; k++) {
+                    if (k % 1000 === 0) {
+                        functions.push(function () { return k; });
+                    }
+                }
+                return functions.map(function (f) { return f(); });
+            }
+            warmUp(capture);
+            var captured = capture(longCount);
+            assert.areEqual(longCount / 1000, captured.length, "closure count");
+            for (var i = 0; i < captured.length; i++) {
+                assert.areEqual(i * 1000, captured[i], "closure " + i);
+            }
+        }
+    },
+    {
+        name: "Exceptions thrown out of the loop",
+        body: function () {
+            function throwAt(n, at) {
+                var sum = 0;
+                for (var k = 0; k < n; k++) {
+                    if (k === at) {
+                        throw new Error(String(sum));
+                    }
+                    sum += k;
+                }
+                return sum;
+            }
+            warmUp(throwAt, -1);
+            assert.throws(function () { throwAt(longCount, longCount - 1); }, Error, "throws from the loop", String((longCount - 1) * (longCount - 2) / 2));
+            assert.areEqual(longCount * (longCount - 1) / 2, throwAt(longCount, -1), "completes after an exception");
+        }
+    },
+    {
+        name: "Recursive calls that reach the same hot loop",
+        body: function () {
+            function recurse(n, depth) {
+                var sum = 0;
+                for (var k = 0; k < n; k++) {
+                    sum += k;
+                    if (depth > 0 && k === n >> 1) {
+                        sum += recurse(n, depth - 1);
+                    }
+                }
+                return sum;
+            }
+            warmUp(recurse, 0);
+            var single = longCount * (longCount - 1) / 2;
+            assert.areEqual(single * 4, recurse(longCount, 3), "four nested activations");
+        }
+    },
+    {
+        name: "Loops in a function with try run in the interpreter's loop bodies",
+        body: function () {
+            function guarded(n) {
+                var sum = 0;
+                try {
+                    for (var k = 0; k < n; k++) {
+                        sum += k;
+                    }
+                } catch (e) {
+                    return -1;
+                }
+                return sum;
+            }
+            warmUp(guarded);
+            assert.areEqual(longCount * (longCount - 1) / 2, guarded(longCount), "loop in try");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
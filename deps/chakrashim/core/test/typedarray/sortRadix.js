@@ -0,0 +1,199 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// %TypedArray%.prototype.sort without a comparison function, which sorts by merge sort below 256 elements and by radix at
+// or above that, on the bits of each element. Every kind of typed array is sorted at lengths either side of the switch and
+// compared with a numeric sort that puts -0 before +0 and NaN last.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var lengths = [0, 1, 2, 17, 255, 256, 257, 1000, 5000];
+
+function random(seed) {
+    return function () {
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+        return seed >> 8;
+    };
+}
+
+function compareNumbers(a, b) {
+    if (a !== a) {
+        return b !== b ? 0 : 1;
+    }
+    if (b !== b) {
+        return -1;
+    }
+    if (a === 0 && b === 0) {
+        return (1 / a) - (1 / b) < 0 ? -1 : (1 / a) === (1 / b) ? 0 : 1;
+    }
+    return a < b ? -1 : a > b ? 1 : 0;
+}
+
+function check(array, description) {
+    var expected = Array.prototype.slice.call(array).sort(compareNumbers);
+    var result = array.sort();
+    assert.isTrue(result === array, description + ": sorted in place");
+    assert.areEqual(expected.length, array.length, description + ": length");
+    for (var i = 0; i < expected.length; i++) {
+        if (!Object.is(expected[i], array[i])) {
+            assert.fail(description + ": element " + i + " is " + array[i] + " rather than " + expected[i]);
+        }
+    }
+}
+
+function fill(Type, length, valueOf) {
+    var array = new Type(length);
+    for (var i = 0; i < length; i++) {
+        array[i] = valueOf(i);
+    }
+    return array;
+}
+
+var integerTypes = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array, Int32Array, Uint32Array];
+var floatTypes = [Float32Array, Float64Array];
+
+var tests = [
+    {
+        name: "Integer arrays",
+        body: function () {
+            integerTypes.forEach(function (Type) {
+                var next = random(Type.BYTES_PER_ELEMENT);
+                lengths.forEach(function (length) {
+                    var name = Type.name + " of " + length;
+                    check(fill(Type, length, function () { return next() * 1021 - 0x40000000; }), name + ", random");
+                    check(fill(Type, length, function (i) { return length - i; }), name + ", descending");
+                    check(fill(Type, length, function (i) { return i; }), name + ", ascending");
+                    check(fill(Type, length, function (i) { return i % 3 - 1; }), name + ", -1, 0 and 1");
+                    check(fill(Type, length, function () { return 7; }), name + ", all equal");
+                });
+            });
+        }
+    },
+    {
+        name: "The most negative and largest integers",
+        body: function () {
+            var extremes = [
+                [Int8Array, [-128, 127, -1, 0]],
+                [Int16Array, [-32768, 32767, -1, 0, 255, 256, -256, -257]],
+                [Int32Array, [-2147483648, 2147483647, -1, 0, 65535, 65536, -65536, -16777216]],
+                [Uint16Array, [65535, 0, 255, 256]],
+                [Uint32Array, [4294967295, 2147483648, 2147483647, 0, 16777216, 16777215]]
+            ];
+            extremes.forEach(function (extreme) {
+                var Type = extreme[0];
+                var values = extreme[1];
+                [8, 300].forEach(function (length) {
+                    check(fill(Type, length, function (i) { return values[(i * 7) % values.length]; }), Type.name + " of " + length);
+                });
+            });
+        }
+    },
+    {
+        name: "Float arrays with zeros, infinities and NaN",
+        body: function () {
+            var specials = [0, -0, NaN, Infinity, -Infinity, 1, -1, 0.5, -0.5];
+            floatTypes.forEach(function (Type) {
+                var next = random(Type.BYTES_PER_ELEMENT);
+                lengths.forEach(function (length) {
+                    var name = Type.name + " of " + length;
+                    check(fill(Type, length, function () { return specials[next() % specials.length]; }), name + ", only special values");
+                    check(fill(Type, length, function (i) { return i % 5 === 0 ? specials[next() % specials.length] : (next() - 0x400000) / 1024; }), name + ", mixed");
+                    check(fill(Type, length, function (i) { return i % 2 ? -0 : 0; }), name + ", alternating zeros");
+                    check(fill(Type, length, function () { return NaN; }), name + ", all NaN");
+                    check(fill(Type, length, function (i) { return i % 2 ? NaN : length - i; }), name + ", every other NaN");
+                });
+            });
+        }
+    },
+    {
+        name: "Float arrays with denormals and extremes",
+        body: function () {
+            var values = {
+                Float32Array: [1.401298464324817e-45, -1.401298464324817e-45, 1.1754942106924411e-38, 1.1754943508222875e-38,
+                               3.4028234663852886e+38, -3.4028234663852886e+38, 2.802596928649634e-45, -0, 0],
+                Float64Array: [Number.MIN_VALUE, -Number.MIN_VALUE, 2.2250738585072009e-308, 2.2250738585072014e-308,
+                               Number.MAX_VALUE, -Number.MAX_VALUE, 2 * Number.MIN_VALUE, -0, 0, 1 + Number.EPSILON, 1]
+            };
+            floatTypes.forEach(function (Type) {
+                var list = values[Type.name];
+                [list.length, 256, 1024].forEach(function (length) {
+                    check(fill(Type, length, function (i) { return list[(i * 5) % list.length]; }), Type.name + " of " + length);
+                });
+            });
+        }
+    },
+    {
+        name: "NaNs with other bit patterns",
+        body: function () {
+            [10, 400].forEach(function (length) {
+                var doubles = new Float64Array(length);
+                var words = new Uint32Array(doubles.buffer);
+                for (var i = 0; i < length; i++) {
+                    if (i % 4 === 0) {
+                        // Quiet and signalling NaNs, with either sign
+                        words[2 * i] = i + 1;
+                        words[2 * i + 1] = (i % 8 ? 0x7ff80000 : 0xfff00000) | (i & 0xff);
+                    } else {
+                        doubles[i] = length / 2 - i;
+                    }
+                }
+                check(doubles, "Float64Array of " + length);
+
+                var floats = new Float32Array(length);
+                var floatWords = new Uint32Array(floats.buffer);
+                for (var i = 0; i < length; i++) {
+                    if (i % 3 === 0) {
+                        floatWords[i] = ((i % 2 ? 0x7fc00000 : 0xff800001) | i) >>> 0;
+                    } else {
+                        floats[i] = i - length / 2;
+                    }
+                }
+                check(floats, "Float32Array of " + length);
+            });
+        }
+    },
+    {
+        name: "Views on part of a buffer",
+        body: function () {
+            var buffer = new ArrayBuffer(8 * 1200);
+            var whole = new Int32Array(buffer);
+            for (var i = 0; i < whole.length; i++) {
+                whole[i] = 1000000 - i;
+            }
+            var part = new Int32Array(buffer, 400 * 4, 500);
+            check(part, "500 elements from 400");
+            assert.areEqual(1000000 - 399, whole[399], "the element before the view");
+            assert.areEqual(1000000 - 900, whole[900], "the element after the view");
+            for (var i = 0; i < 500; i++) {
+                assert.areEqual(1000000 - 899 + i, whole[400 + i], "sorted element " + i);
+            }
+        }
+    },
+    {
+        name: "A comparison function sorts stably and leaves the array unchanged when it throws",
+        body: function () {
+            [100, 600].forEach(function (length) {
+                var array = fill(Float64Array, length, function (i) { return (i * 37) % 50 + (i % 10) / 10; });
+                var sorted = Array.prototype.slice.call(array).sort(function (a, b) { return Math.floor(a) - Math.floor(b); });
+                array.sort(function (a, b) { return Math.floor(a) - Math.floor(b); });
+                assert.areEqual(sorted, Array.prototype.slice.call(array), length + ": stable by the integer part");
+
+                var before = Array.prototype.slice.call(array.reverse());
+                var count = 0;
+                assert.throws(function () {
+                    array.sort(function (a, b) {
+                        if (++count === length) {
+                            throw new RangeError("stop");
+                        }
+                        return a - b;
+                    });
+                }, RangeError, length + ": the comparison function's exception");
+                assert.areEqual(before, Array.prototype.slice.call(array), length + ": unchanged after the throw");
+            });
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
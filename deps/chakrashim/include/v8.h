@@ -288,6 +288,7 @@ class Local {
   friend struct FunctionTemplateData;
   friend class HandleScope;
   friend class Integer;
+  friend class JSON;
   friend class Number;
   friend class NumberObject;
   friend class Object;
@@ -2034,6 +2035,14 @@ class V8_EXPORT ResourceConstraints {
   void set_stack_limit(uint32_t *value) {}
 };
 
+class V8_EXPORT JSON {
+ public:
+  // ChakraCore extension: parses UTF-8 encoded JSON text, such as the
+  // contents of a Buffer, without creating a string from it first.
+  static MaybeLocal<Value> ParseUtf8(Isolate* isolate,
+                                     const char* data, size_t length);
+};
+
 class V8_EXPORT Exception {
  public:
   static Local<Value> RangeError(Handle<String> message);
@@ -2194,6 +2203,7 @@ class V8_EXPORT Isolate {
   Local<Context> GetCurrentContext();
   void SetPromiseRejectCallback(PromiseRejectCallback callback);
   void RunMicrotasks();
+  void EnqueueMicrotask(Handle<Function> microtask);
   void SetAutorunMicrotasks(bool autorun);
   void SetFatalErrorHandler(FatalErrorCallback that);
   void SetJitCodeEventHandler(
@@ -381,9 +381,6 @@
     };
   }
 
-  // Simulate v8 micro tasks queue
-  var microTasks = [];
-
   function patchUtils(utils) {
     var isUintRegex = /^(0|[1-9]\\d*)$/;
 
@@ -515,12 +512,6 @@
       return Symbol_for(key);
     };
     utils.ensureDebug = ensureDebug;
-    utils.enqueueMicrotask = function(task) {
-      microTasks.push(task);
-    };
-    utils.dequeueMicrotask = function(task) {
-      return microTasks.shift();
-    };
   }
 
   patchErrorTypes();
@@ -78,8 +78,8 @@ ContextShim::ContextShim(IsolateShim * isolateShim,
       getSymbolKeyForFunction(JS_INVALID_REFERENCE),
       getSymbolForFunction(JS_INVALID_REFERENCE),
       ensureDebugFunction(JS_INVALID_REFERENCE),
-      enqueueMicrotaskFunction(JS_INVALID_REFERENCE),
-      dequeueMicrotaskFunction(JS_INVALID_REFERENCE) {
+      microtaskQueueHead(0),
+      microtaskQueueCount(0) {
   memset(globalConstructor, 0, sizeof(globalConstructor));
   memset(globalPrototypeFunction, 0, sizeof(globalPrototypeFunction));
 }
@@ -88,6 +88,9 @@ ContextShim::~ContextShim() {
   if (globalObjectTemplateInstance != JS_INVALID_REFERENCE) {
     JsRelease(globalObjectTemplateInstance, nullptr);
   }
+
+  // Release the tasks that never ran
+  ClearMicrotasks();
 }
 
 bool ContextShim::CheckConfigGlobalObjectTemplate() {
@@ -460,23 +463,77 @@ void ContextShim::SetAlignedPointerInEmbedderData(int index, void * value) {
   }
 }
 
-void ContextShim::RunMicrotasks() {
-  JsValueRef dequeueMicrotaskFunction = GetdequeueMicrotaskFunction();
+bool ContextShim::EnqueueMicrotask(JsValueRef task) {
+  const size_t initialMicrotaskQueueSize = 16;
 
-  for (;;) {
-    JsValueRef task;
-    if (jsrt::CallFunction(dequeueMicrotaskFunction, &task) != JsNoError ||
-      reinterpret_cast<v8::Value*>(task)->IsUndefined()) {
-      break;
+  size_t capacity = microtaskQueue.size();
+  if (microtaskQueueCount == capacity) {
+    // Grow, moving the queued tasks to the front of the new buffer
+    try {
+      std::vector<JsValueRef> newQueue(
+        capacity == 0 ? initialMicrotaskQueueSize : capacity * 2);
+      for (size_t i = 0; i < microtaskQueueCount; i++) {
+        newQueue[i] = microtaskQueue[(microtaskQueueHead + i) & (capacity - 1)];
+      }
+      microtaskQueue.swap(newQueue);
+    } catch(const std::exception&) {
+      return false;
     }
+    microtaskQueueHead = 0;
+    capacity = microtaskQueue.size();
+  }
+
+  if (JsAddRef(task, nullptr) != JsNoError) {
+    return false;
+  }
+
+  microtaskQueue[(microtaskQueueHead + microtaskQueueCount) & (capacity - 1)] =
+    task;
+  microtaskQueueCount++;
+  return true;
+}
+
+bool ContextShim::DequeueMicrotask(JsValueRef * task) {
+  if (microtaskQueueCount == 0) {
+    return false;
+  }
+
+  *task = microtaskQueue[microtaskQueueHead];
+  microtaskQueueHead = (microtaskQueueHead + 1) & (microtaskQueue.size() - 1);
+  microtaskQueueCount--;
+  return true;
+}
 
+void ContextShim::RunMicrotasks() {
+  // Tasks queued by a running task are appended and run in the same loop
+  JsValueRef task;
+  while (DequeueMicrotask(&task)) {
     JsValueRef notUsed;
-    if (jsrt::CallFunction(task, &notUsed) != JsNoError) {
-      JsGetAndClearException(&notUsed); // swallow any exception from task
+    JsErrorCode errorCode = jsrt::CallFunction(task, &notUsed);
+    JsRelease(task, nullptr);
+
+    if (errorCode == JsErrorInDisabledState) {
+      // Execution was terminated. Drop the remaining tasks, as v8 does.
+      ClearMicrotasks();
+      return;
+    }
+
+    // Drop an exception from a task and go on with the next task, as the
+    // bundled v8 does
+    if (errorCode != JsNoError) {
+      JsValueRef exception;
+      JsGetAndClearException(&exception);
     }
   }
 }
 
+void ContextShim::ClearMicrotasks() {
+  JsValueRef task;
+  while (DequeueMicrotask(&task)) {
+    JsRelease(task, nullptr);
+  }
+}
+
 JsValueRef ContextShim::GetUndefined() {
   return undefinedRef;
 }
@@ -581,8 +638,6 @@ CHAKRASHIM_FUNCTION_GETTER(getStackTrace)
 CHAKRASHIM_FUNCTION_GETTER(getSymbolKeyFor)
 CHAKRASHIM_FUNCTION_GETTER(getSymbolFor)
 CHAKRASHIM_FUNCTION_GETTER(ensureDebug)
-CHAKRASHIM_FUNCTION_GETTER(enqueueMicrotask);
-CHAKRASHIM_FUNCTION_GETTER(dequeueMicrotask);
 
 #define DEF_IS_TYPE(F) CHAKRASHIM_FUNCTION_GETTER(F)
 #include "jsrtcachedpropertyidref.inc"
@@ -80,6 +80,7 @@ class ContextShim {
 
   void * GetAlignedPointerFromEmbedderData(int index);
   void SetAlignedPointerInEmbedderData(int index, void * value);
+  bool EnqueueMicrotask(JsValueRef task);
   void RunMicrotasks();
 
   static ContextShim * GetCurrent();
@@ -102,6 +103,8 @@ class ContextShim {
   bool ExposeGc();
   bool CheckConfigGlobalObjectTemplate();
   bool ExecuteChakraShimJS();
+  bool DequeueMicrotask(JsValueRef * task);
+  void ClearMicrotasks();
 
   IsolateShim * isolateShim;
   JsContextRef context;
@@ -128,6 +131,12 @@ class ContextShim {
   JsValueRef promiseContinuationFunction;
   std::vector<void*> embedderData;
 
+  // Pending promise jobs, kept as a ring buffer whose size is a power of 2.
+  // Queued tasks are pinned with JsAddRef until they have run.
+  std::vector<JsValueRef> microtaskQueue;
+  size_t microtaskQueueHead;
+  size_t microtaskQueueCount;
+
 #define DECLARE_CHAKRASHIM_FUNCTION_GETTER(F) \
 public: \
 JsValueRef Get##F##Function(); \
@@ -147,8 +156,6 @@ JsValueRef F##Function; \
   DECLARE_CHAKRASHIM_FUNCTION_GETTER(getSymbolKeyFor);
   DECLARE_CHAKRASHIM_FUNCTION_GETTER(getSymbolFor);
   DECLARE_CHAKRASHIM_FUNCTION_GETTER(ensureDebug);
-  DECLARE_CHAKRASHIM_FUNCTION_GETTER(enqueueMicrotask);
-  DECLARE_CHAKRASHIM_FUNCTION_GETTER(dequeueMicrotask);
 
 #define DEF_IS_TYPE(F) DECLARE_CHAKRASHIM_FUNCTION_GETTER(F)
 #include "jsrtcachedpropertyidref.inc"
@@ -24,6 +24,11 @@
 #include <vector>
 #include <algorithm>
 
+namespace v8 {
+extern bool g_perfBasicProf;
+extern bool g_adaptiveTiering;
+}
+
 namespace jsrt {
 
 /* static */ __declspec(thread) IsolateShim * IsolateShim::s_currentIsolate;
@@ -36,7 +41,8 @@ IsolateShim::IsolateShim(JsRuntimeHandle runtime)
       cachedPropertyIdRefs(),
       embeddedData(),
       isDisposing(false),
-      tryCatchStackTop(nullptr) {
+      tryCatchStackTop(nullptr),
+      cpuProfiler(nullptr) {
   // CHAKRA-TODO: multithread locking for s_isolateList?
   this->prevnext = &s_isolateList;
   this->next = s_isolateList;
@@ -57,12 +63,20 @@ IsolateShim::~IsolateShim() {
     return nullptr;
   }
 
+  JsRuntimeAttributes attributes = static_cast<JsRuntimeAttributes>(
+    JsRuntimeAttributeAllowScriptInterrupt |
+    JsRuntimeAttributeEnableExperimentalFeatures);
+  if (v8::g_perfBasicProf) {
+    attributes = static_cast<JsRuntimeAttributes>(
+      attributes | JsRuntimeAttributeEnablePerfMap);
+  }
+  if (v8::g_adaptiveTiering) {
+    attributes = static_cast<JsRuntimeAttributes>(
+      attributes | JsRuntimeAttributeEnableAdaptiveTiering);
+  }
+
   JsRuntimeHandle runtime;
-  JsErrorCode error =
-    JsCreateRuntime(static_cast<JsRuntimeAttributes>(
-                      JsRuntimeAttributeAllowScriptInterrupt |
-                      JsRuntimeAttributeEnableExperimentalFeatures),
-                    nullptr, &runtime);
+  JsErrorCode error = JsCreateRuntime(attributes, nullptr, &runtime);
   if (error != JsNoError) {
     return nullptr;
   }
@@ -108,6 +122,13 @@ JsRuntimeHandle IsolateShim::GetRuntimeHandle() {
 
 bool IsolateShim::Dispose() {
   isDisposing = true;
+
+  // Stops the sampler thread, which must not outlive the runtime
+  if (cpuProfiler != nullptr) {
+    DeleteCpuProfiler(cpuProfiler);
+    cpuProfiler = nullptr;
+  }
+
   {
     // Disposing the runtime may cause finalize call back to run
     // Set the current IsolateShim scope
@@ -133,6 +154,15 @@ bool IsolateShim::Dispose() {
   return true;
 }
 
+CpuProfiler * IsolateShim::GetCpuProfiler() {
+  return cpuProfiler;
+}
+
+void IsolateShim::SetCpuProfiler(CpuProfiler * cpuProfiler) {
+  CHAKRA_ASSERT(this->cpuProfiler == nullptr);
+  this->cpuProfiler = cpuProfiler;
+}
+
 bool IsolateShim::IsDisposing() {
   return isDisposing;
 }
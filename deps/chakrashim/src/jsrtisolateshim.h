@@ -42,6 +42,9 @@ enum CachedSymbolPropertyIdRef {
   SymbolCount
 };
 
+class CpuProfiler;
+void DeleteCpuProfiler(CpuProfiler * cpuProfiler);
+
 class IsolateShim {
  public:
 
@@ -97,6 +100,11 @@ class IsolateShim {
 
   void SetData(unsigned int slot, void* data);
   void* GetData(unsigned int slot);
+
+  // Created on first use by v8::CpuProfiler and deleted when the isolate is
+  // disposed
+  CpuProfiler * GetCpuProfiler();
+  void SetCpuProfiler(CpuProfiler * cpuProfiler);
  private:
   // Construction/Destruction should go thru New/Dispose
   explicit IsolateShim(JsRuntimeHandle runtime);
@@ -119,6 +127,8 @@ class IsolateShim {
 
   std::vector<void *> messageListeners;
 
+  CpuProfiler * cpuProfiler;
+
   // Node only has 4 slots (internals::Internals::kNumIsolateDataSlots = 4)
   void * embeddedData[4];
 
@@ -25,11 +25,7 @@ namespace jsrt {
 
 static void CALLBACK PromiseContinuationCallback(JsValueRef task,
                                                  void *callbackState) {
-  JsValueRef enqueueMicrotaskFunction =
-    ContextShim::GetCurrent()->GetenqueueMicrotaskFunction();
-
-  JsValueRef result;
-  jsrt::CallFunction(enqueueMicrotaskFunction, task, &result);
+  ContextShim::GetCurrent()->EnqueueMicrotask(task);
 }
 
 JsErrorCode InitializePromise() {
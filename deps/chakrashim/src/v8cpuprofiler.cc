@@ -0,0 +1,441 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "v8.h"
+#include "v8-profiler.h"
+#include "jsrtutils.h"
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace jsrt {
+
+// The sampler thread only requests samples; the engine calls OnSample on the
+// script thread at the next safepoint, so the profile trees below are only
+// ever touched from the script thread.
+class ProfileNode {
+ public:
+  ProfileNode(const wchar_t* functionName, const wchar_t* url,
+              JsSourceContext sourceContext, unsigned int line,
+              unsigned int column, unsigned int id)
+    : functionName(functionName), url(url), sourceContext(sourceContext),
+      line(line), column(column), id(id), hitCount(0), bailoutReason("") {
+  }
+
+  ~ProfileNode() {
+    for (auto i = children.begin(); i != children.end(); i++) {
+      delete *i;
+    }
+  }
+
+  ProfileNode* FindOrAddChild(const JsSampleFrame& frame, unsigned int* nextId) {
+    for (auto i = children.begin(); i != children.end(); i++) {
+      ProfileNode* child = *i;
+      if (child->sourceContext == frame.sourceContext &&
+          child->line == frame.line && child->column == frame.column &&
+          child->functionName == frame.functionName) {
+        return child;
+      }
+    }
+
+    ProfileNode* child = new ProfileNode(frame.functionName, frame.url,
+                                         frame.sourceContext, frame.line,
+                                         frame.column, (*nextId)++);
+    children.push_back(child);
+    return child;
+  }
+
+  // The latest reason seen for the function is the one reported
+  void SetBailoutReason(const char* reason) {
+    bailoutReason = reason != nullptr ? reason : "";
+  }
+
+  void AddHit(unsigned int hitLine) {
+    hitCount++;
+    if (hitLine != 0) {
+      lineTicks[hitLine]++;
+    }
+  }
+
+  std::wstring functionName;
+  std::wstring url;
+  JsSourceContext sourceContext;
+  unsigned int line;
+  unsigned int column;
+  unsigned int id;
+  unsigned int hitCount;
+  const char* bailoutReason;  // static, from the engine
+  std::map<unsigned int, unsigned int> lineTicks;
+  std::vector<ProfileNode*> children;
+};
+
+class Profile {
+ public:
+  Profile(const std::wstring& title, bool recordSamples, int64_t startTime)
+    : title(title), recordSamples(recordSamples), startTime(startTime),
+      endTime(startTime), nextNodeId(1),
+      root(L"(root)", L"", JS_SOURCE_CONTEXT_NONE, 0, 0, nextNodeId++) {
+  }
+
+  void AddSample(const JsSampleFrame* frames, unsigned int frameCount,
+                 bool isIdle, int64_t timestamp) {
+    ProfileNode* node = &root;
+    unsigned int hitLine = 0;
+    if (frameCount == 0) {
+      JsSampleFrame frame = {
+        isIdle ? L"(idle)" : L"(program)", L"", JS_SOURCE_CONTEXT_NONE
+      };
+      node = node->FindOrAddChild(frame, &nextNodeId);
+    } else {
+      // Frames are innermost first; the tree is top down.
+      for (unsigned int i = frameCount; i > 0; i--) {
+        node = node->FindOrAddChild(frames[i - 1], &nextNodeId);
+        node->SetBailoutReason(frames[i - 1].bailoutReason);
+      }
+      hitLine = frames[0].hitLine;
+    }
+
+    node->AddHit(hitLine);
+    if (recordSamples) {
+      samples.push_back(node);
+      timestamps.push_back(timestamp);
+    }
+  }
+
+  std::wstring title;
+  bool recordSamples;
+  int64_t startTime;
+  int64_t endTime;
+  unsigned int nextNodeId;
+  ProfileNode root;
+  std::vector<ProfileNode*> samples;
+  std::vector<int64_t> timestamps;
+};
+
+class CpuProfiler {
+ public:
+  static CpuProfiler* Get() {
+    IsolateShim* isolateShim = IsolateShim::GetCurrent();
+    CpuProfiler* profiler = isolateShim->GetCpuProfiler();
+    if (profiler == nullptr) {
+      profiler = new CpuProfiler(isolateShim->GetRuntimeHandle());
+      isolateShim->SetCpuProfiler(profiler);
+    }
+    return profiler;
+  }
+
+  ~CpuProfiler() {
+    if (!activeProfiles.empty()) {
+      StopSampling();
+    }
+    for (auto i = activeProfiles.begin(); i != activeProfiles.end(); i++) {
+      delete *i;
+    }
+  }
+
+  void SetSamplingInterval(int us) {
+    CHAKRA_ASSERT(activeProfiles.empty());
+    samplingInterval = us;
+  }
+
+  void StartProfiling(const std::wstring& title, bool recordSamples) {
+    for (auto i = activeProfiles.begin(); i != activeProfiles.end(); i++) {
+      if ((*i)->title == title) {
+        return;
+      }
+    }
+
+    if (activeProfiles.empty() && !StartSampling()) {
+      return;
+    }
+
+    activeProfiles.push_back(new Profile(title, recordSamples, Now()));
+  }
+
+  Profile* StopProfiling(const std::wstring& title) {
+    if (activeProfiles.empty()) {
+      return nullptr;
+    }
+
+    auto found = activeProfiles.end() - 1;
+    if (!title.empty()) {
+      found = std::find_if(activeProfiles.begin(), activeProfiles.end(),
+                           [&](Profile* profile) {
+        return profile->title == title;
+      });
+      if (found == activeProfiles.end()) {
+        return nullptr;
+      }
+    }
+
+    Profile* profile = *found;
+    activeProfiles.erase(found);
+    profile->endTime = Now();
+
+    if (activeProfiles.empty()) {
+      StopSampling();
+    }
+    return profile;
+  }
+
+  void SetIdle(bool isIdle) {
+    this->isIdle = isIdle;
+  }
+
+  static int64_t Now() {
+    static LARGE_INTEGER frequency = {};
+    if (frequency.QuadPart == 0) {
+      QueryPerformanceFrequency(&frequency);
+    }
+
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return static_cast<int64_t>(counter.QuadPart * 1000000 /
+                                frequency.QuadPart);
+  }
+
+ private:
+  explicit CpuProfiler(JsRuntimeHandle runtime)
+    : samplingInterval(1000), isIdle(false), runtime(runtime),
+      samplerThread(nullptr), stopEvent(nullptr) {
+  }
+
+  bool StartSampling() {
+    if (JsSetRuntimeSampleCallback(runtime, this, OnSample) != JsNoError) {
+      return false;
+    }
+
+    stopEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    samplerThread = CreateThread(nullptr, 0, SamplerThreadProc, this, 0,
+                                 nullptr);
+    if (stopEvent == nullptr || samplerThread == nullptr) {
+      StopSampling();
+      return false;
+    }
+    return true;
+  }
+
+  void StopSampling() {
+    if (samplerThread != nullptr) {
+      SetEvent(stopEvent);
+      WaitForSingleObject(samplerThread, INFINITE);
+      CloseHandle(samplerThread);
+      samplerThread = nullptr;
+    }
+    if (stopEvent != nullptr) {
+      CloseHandle(stopEvent);
+      stopEvent = nullptr;
+    }
+
+    JsSetRuntimeSampleCallback(runtime, nullptr, nullptr);
+  }
+
+  static DWORD WINAPI SamplerThreadProc(LPVOID param) {
+    CpuProfiler* profiler = static_cast<CpuProfiler*>(param);
+
+    // Windows waits have millisecond granularity.
+    DWORD interval = static_cast<DWORD>(
+      (std::max)(profiler->samplingInterval / 1000, 1));
+    while (WaitForSingleObject(profiler->stopEvent, interval) ==
+           WAIT_TIMEOUT) {
+      JsRequestRuntimeSample(profiler->runtime);
+    }
+    return 0;
+  }
+
+  static void CALLBACK OnSample(const JsSampleFrame* frames,
+                                unsigned int frameCount,
+                                void* callbackState) {
+    CpuProfiler* profiler = static_cast<CpuProfiler*>(callbackState);
+    int64_t timestamp = Now();
+    for (auto i = profiler->activeProfiles.begin();
+         i != profiler->activeProfiles.end(); i++) {
+      (*i)->AddSample(frames, frameCount, profiler->isIdle, timestamp);
+    }
+  }
+
+  int samplingInterval;
+  bool isIdle;
+  JsRuntimeHandle runtime;
+  HANDLE samplerThread;
+  HANDLE stopEvent;
+  std::vector<Profile*> activeProfiles;
+};
+
+void DeleteCpuProfiler(CpuProfiler* cpuProfiler) {
+  delete cpuProfiler;
+}
+
+static std::wstring ToWString(v8::Handle<v8::String> str) {
+  const wchar_t* chars;
+  size_t length;
+  if (str.IsEmpty() ||
+      JsStringToPointer(*str, &chars, &length) != JsNoError) {
+    return std::wstring();
+  }
+  return std::wstring(chars, length);
+}
+
+static v8::Handle<v8::String> ToString(const std::wstring& str) {
+  JsValueRef strRef;
+  if (JsPointerToString(str.c_str(), str.length(), &strRef) != JsNoError) {
+    return v8::Handle<v8::String>();
+  }
+  return v8::Local<v8::String>::New(strRef);
+}
+
+}  // namespace jsrt
+
+namespace v8 {
+
+using jsrt::ProfileNode;
+using jsrt::Profile;
+
+static const ProfileNode* ToProfileNode(const CpuProfileNode* node) {
+  return reinterpret_cast<const ProfileNode*>(node);
+}
+
+static const CpuProfileNode* ToCpuProfileNode(const ProfileNode* node) {
+  return reinterpret_cast<const CpuProfileNode*>(node);
+}
+
+static const Profile* ToProfile(const CpuProfile* profile) {
+  return reinterpret_cast<const Profile*>(profile);
+}
+
+Handle<String> CpuProfileNode::GetFunctionName() const {
+  return jsrt::ToString(ToProfileNode(this)->functionName);
+}
+
+int CpuProfileNode::GetScriptId() const {
+  JsSourceContext sourceContext = ToProfileNode(this)->sourceContext;
+  return sourceContext == JS_SOURCE_CONTEXT_NONE ?
+    0 : static_cast<int>(sourceContext);
+}
+
+Handle<String> CpuProfileNode::GetScriptResourceName() const {
+  return jsrt::ToString(ToProfileNode(this)->url);
+}
+
+int CpuProfileNode::GetLineNumber() const {
+  return static_cast<int>(ToProfileNode(this)->line);
+}
+
+int CpuProfileNode::GetColumnNumber() const {
+  return static_cast<int>(ToProfileNode(this)->column);
+}
+
+unsigned int CpuProfileNode::GetHitLineCount() const {
+  return static_cast<unsigned int>(ToProfileNode(this)->lineTicks.size());
+}
+
+bool CpuProfileNode::GetLineTicks(LineTick* entries,
+                                  unsigned int length) const {
+  const ProfileNode* node = ToProfileNode(this);
+  if (entries == nullptr || length < node->lineTicks.size()) {
+    return false;
+  }
+
+  for (auto i = node->lineTicks.begin(); i != node->lineTicks.end(); i++) {
+    entries->line = static_cast<int>(i->first);
+    entries->hit_count = i->second;
+    entries++;
+  }
+  return true;
+}
+
+const char* CpuProfileNode::GetBailoutReason() const {
+  return ToProfileNode(this)->bailoutReason;
+}
+
+unsigned CpuProfileNode::GetHitCount() const {
+  return ToProfileNode(this)->hitCount;
+}
+
+unsigned CpuProfileNode::GetCallUid() const {
+  const ProfileNode* node = ToProfileNode(this);
+  return static_cast<unsigned>(node->sourceContext) * 31 * 31 +
+    node->line * 31 + node->column;
+}
+
+unsigned CpuProfileNode::GetNodeId() const {
+  return ToProfileNode(this)->id;
+}
+
+int CpuProfileNode::GetChildrenCount() const {
+  return static_cast<int>(ToProfileNode(this)->children.size());
+}
+
+const CpuProfileNode* CpuProfileNode::GetChild(int index) const {
+  return ToCpuProfileNode(ToProfileNode(this)->children[index]);
+}
+
+Handle<String> CpuProfile::GetTitle() const {
+  return jsrt::ToString(ToProfile(this)->title);
+}
+
+const CpuProfileNode* CpuProfile::GetTopDownRoot() const {
+  return ToCpuProfileNode(&ToProfile(this)->root);
+}
+
+int CpuProfile::GetSamplesCount() const {
+  return static_cast<int>(ToProfile(this)->samples.size());
+}
+
+const CpuProfileNode* CpuProfile::GetSample(int index) const {
+  return ToCpuProfileNode(ToProfile(this)->samples[index]);
+}
+
+int64_t CpuProfile::GetSampleTimestamp(int index) const {
+  return ToProfile(this)->timestamps[index];
+}
+
+int64_t CpuProfile::GetStartTime() const {
+  return ToProfile(this)->startTime;
+}
+
+int64_t CpuProfile::GetEndTime() const {
+  return ToProfile(this)->endTime;
+}
+
+void CpuProfile::Delete() {
+  delete reinterpret_cast<Profile*>(this);
+}
+
+void CpuProfiler::SetSamplingInterval(int us) {
+  jsrt::CpuProfiler::Get()->SetSamplingInterval(us);
+}
+
+void CpuProfiler::StartProfiling(Handle<String> title, bool record_samples) {
+  jsrt::CpuProfiler::Get()->StartProfiling(jsrt::ToWString(title),
+                                           record_samples);
+}
+
+CpuProfile* CpuProfiler::StopProfiling(Handle<String> title) {
+  return reinterpret_cast<CpuProfile*>(
+    jsrt::CpuProfiler::Get()->StopProfiling(jsrt::ToWString(title)));
+}
+
+void CpuProfiler::SetIdle(bool is_idle) {
+  jsrt::CpuProfiler::Get()->SetIdle(is_idle);
+}
+
+}  // namespace v8
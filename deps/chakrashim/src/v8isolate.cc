@@ -25,7 +25,7 @@
 namespace v8 {
 
 HeapProfiler dummyHeapProfiler;
-CpuProfiler dummyCpuProfiler;
+CpuProfiler cpuProfiler;
 
 Isolate* Isolate::New(const CreateParams& params) {
   Isolate* iso = jsrt::IsolateShim::New();
@@ -107,6 +107,10 @@ void Isolate::RunMicrotasks() {
   jsrt::ContextShim::GetCurrent()->RunMicrotasks();
 }
 
+void Isolate::EnqueueMicrotask(Handle<Function> microtask) {
+  jsrt::ContextShim::GetCurrent()->EnqueueMicrotask(*microtask);
+}
+
 void Isolate::SetAutorunMicrotasks(bool autorun) {
 }
 
@@ -120,7 +124,7 @@ HeapProfiler* Isolate::GetHeapProfiler() {
 }
 
 CpuProfiler* Isolate::GetCpuProfiler() {
-  return &dummyCpuProfiler;
+  return &cpuProfiler;
 }
 
 void Isolate::AddGCPrologueCallback(
@@ -70,6 +70,8 @@ int String::Length() const {
 }
 
 int String::Utf8Length() const {
+  // Flattens a string built by concatenation, and keeps it flat: the length is
+  // asked for ahead of a write, which then reads the flat string
   const wchar_t* str;
   size_t stringLength;
   if (JsStringToPointer((JsValueRef)this, &str, &stringLength) != JsNoError) {
@@ -136,12 +138,57 @@ static int WriteRaw(
 }
 
 int String::Write(uint16_t *buffer, int start, int length, int options) const {
-  return WriteRaw(
-    (JsValueRef)this,
-    reinterpret_cast<wchar_t*>(buffer),
-    start,
-    length,
-    options);
+  if (length == 0) {
+    // bail out if we are required to write no chars
+    return 0;
+  }
+
+  // Copied straight out of the string, which does not flatten a string built
+  // by concatenation the way JsStringToPointer does
+  int stringLength;
+  if (JsGetStringLength((JsValueRef)this, &stringLength) != JsNoError) {
+    // error
+    return 0;
+  }
+
+  if (stringLength == 0) {
+    if (!(options & String::NO_NULL_TERMINATION)) {
+      // include the null terminate
+      buffer[0] = L'\0';
+    }
+    return 0;
+  }
+
+  if (start < 0 || start > stringLength) {
+    // illegal bail out
+    return 0;
+  }
+
+  // in case length was not provided we want to copy the whole string
+  int count = length >= 0 ? length : stringLength;
+  count = min(count, stringLength - start);
+
+  if (length < 0) {
+    // If length was not provided, assume enough space to hold content and null
+    // terminator.
+    length = count + 1;
+  }
+
+  size_t written = 0;
+  if (count > 0 &&
+      JsCopyString((JsValueRef)this, start, count,
+                   reinterpret_cast<wchar_t*>(buffer), &written) != JsNoError) {
+    // error
+    return 0;
+  }
+  count = static_cast<int>(written);
+
+  if (count < length && !(options & String::NO_NULL_TERMINATION)) {
+    // include the null terminate
+    buffer[count++] = L'\0';
+  }
+
+  return count;
 }
 
 int String::WriteOneByte(
@@ -157,9 +204,8 @@ int String::WriteUtf8(
     return 0;
   }
 
-  const wchar_t* str;
-  size_t stringLength;
-  if (JsStringToPointer((JsValueRef)this, &str, &stringLength) != JsNoError) {
+  int stringLength;
+  if (JsGetStringLength((JsValueRef)this, &stringLength) != JsNoError) {
     // error
     return 0;
   }
@@ -171,32 +217,27 @@ int String::WriteUtf8(
       buffer[0] = '\0';
     }
 
-    return 0;
-  }
+    if (nchars_ref != nullptr) {
+      *nchars_ref = 0;
+    }
 
-  int originalLength = length;
-  if (length < 0) {
-    // in case length was not provided we want to copy the whole string
-    length = static_cast<int>(stringLength);
+    return 0;
   }
-  unsigned int count = length < static_cast<int>(stringLength) ?
-    length : static_cast<unsigned int>(stringLength);
 
-  size_t charsCount = 0;
+  // Encoded straight out of the string, which does not flatten a string built
+  // by concatenation the way JsStringToPointer does. In case length was not
+  // provided the buffer is assumed to be big enough.
+  size_t bufferSize = length < 0 ? static_cast<size_t>(-1) : length;
   size_t size = 0;
-  // we pass -1 as the buffer size to imply that the buffer is big enough
-  JsErrorCode convertResult = jsrt::StringConvert::ToUTF8Char(
-    str, count, buffer, originalLength, &size, &charsCount);
-
-  if (convertResult != JsNoError) {
+  size_t charsCount = 0;
+  if (JsCopyStringUtf8((JsValueRef)this, buffer, bufferSize,
+                       &size, &charsCount) != JsNoError) {
+    // error
     return 0;
   }
 
-  if (!(options & String::NO_NULL_TERMINATION)) {
+  if (!(options & String::NO_NULL_TERMINATION) && size < bufferSize) {
     buffer[size++] = '\0';
-    count++;
-    // CHAKRA-TODO: @saary - should we increase this?
-    // charsCount++;
   }
 
   if (nchars_ref != nullptr) {
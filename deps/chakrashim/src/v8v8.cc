@@ -29,6 +29,12 @@ namespace v8 {
 bool g_disposed = false;
 bool g_exposeGC = false;
 bool g_useStrict = false;
+bool g_perfBasicProf = false;
+bool g_adaptiveTiering = false;
+unsigned int g_jitThreadCount = 0;
+bool g_jitProfileCache = false;
+bool g_traceJitProfileCache = false;
+const char* g_jitProfileCacheDir = nullptr;
 ArrayBuffer::Allocator* g_arrayBufferAllocator = nullptr;
 
 const char *V8::GetVersion() {
@@ -97,6 +103,44 @@ void V8::SetFlagsFromCommandLine(int *argc, char **argv, bool remove_flags) {
       if (remove_flags) {
         argv[i] = nullptr;
       }
+    } else if (equals("--perf-basic-prof", arg) ||
+               equals("--perf_basic_prof", arg)) {
+      g_perfBasicProf = true;
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
+    } else if (equals("--adaptive-tiering", arg) ||
+               equals("--adaptive_tiering", arg)) {
+      g_adaptiveTiering = true;
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
+    } else if (startsWith(arg, "--jit-threads=") ||
+               startsWith(arg, "--jit_threads=")) {
+      int threadCount = atoi(strchr(arg, '=') + 1);
+      g_jitThreadCount = threadCount > 0 ? threadCount : 0;
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
+    } else if (equals("--jit-profile-cache", arg) ||
+               equals("--jit_profile_cache", arg)) {
+      g_jitProfileCache = true;
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
+    } else if (startsWith(arg, "--jit-profile-cache=") ||
+               startsWith(arg, "--jit_profile_cache=")) {
+      g_jitProfileCache = true;
+      g_jitProfileCacheDir = strchr(arg, '=') + 1;
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
+    } else if (equals("--trace-jit-profile-cache", arg) ||
+               equals("--trace_jit_profile_cache", arg)) {
+      g_traceJitProfileCache = true;
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
     } else if (remove_flags &&
                (startsWith(
                  arg, "--debug")  // Ignore some flags to reduce unit test noise
@@ -110,6 +154,19 @@ void V8::SetFlagsFromCommandLine(int *argc, char **argv, bool remove_flags) {
           "     type: bool  default: false\n"
           " --expose_gc (expose gc extension)\n"
           "     type: bool  default: false\n"
+          " --perf_basic_prof (write perf-<pid>.map for jitted code)\n"
+          "     type: bool  default: false\n"
+          " --adaptive_tiering (tier up hot functions sooner while the JIT\n"
+          "     is idle; tuned for long-running servers)\n"
+          "     type: bool  default: false\n"
+          " --jit_threads=n (number of background JIT threads)\n"
+          "     type: int  default: based on the number of processors\n"
+          " --jit_profile_cache[=dir] (keep JIT profiles across runs in dir,\n"
+          "     or in the temp directory if dir is omitted)\n"
+          "     type: string  default: off\n"
+          " --trace_jit_profile_cache (print the profiles the JIT profile\n"
+          "     cache loads and uses, and its problems, to stderr)\n"
+          "     type: bool  default: false\n"
           " --harmony (Ignored in node running with chakracore)\n"
           " --debug (Ignored in node running with chakracore)\n"
           " --stack-size (Ignored in node running with chakracore)\n";
@@ -124,6 +181,40 @@ void V8::SetFlagsFromCommandLine(int *argc, char **argv, bool remove_flags) {
   }
 }
 
+// process.exit() ends the process without disposing the isolate, which is
+// where the profile cache is normally written.
+static void SaveJitProfileCache() {
+  if (g_disposed) {
+    return;
+  }
+
+  jsrt::IsolateShim* isolateShim = jsrt::IsolateShim::GetCurrent();
+  if (isolateShim != nullptr) {
+    JsSaveRuntimeProfileCache(isolateShim->GetRuntimeHandle());
+  }
+}
+
+static void EnableJitProfileCache() {
+  wchar_t dir[_MAX_PATH];
+  const wchar_t* cacheDir = nullptr;
+  if (g_jitProfileCacheDir != nullptr && g_jitProfileCacheDir[0] != '\0') {
+    size_t length = 0;
+    if (jsrt::StringConvert::ToWChar(g_jitProfileCacheDir,
+                                     strlen(g_jitProfileCacheDir),
+                                     dir, _countof(dir) - 1,
+                                     &length) != JsNoError) {
+      return;
+    }
+    dir[length] = L'\0';
+    cacheDir = dir;
+  }
+
+  // A cache that cannot be set up only costs the warm-up it would have saved.
+  if (JsEnableProfileCache(cacheDir, g_traceJitProfileCache) == JsNoError) {
+    atexit(SaveJitProfileCache);
+  }
+}
+
 bool V8::Initialize() {
   if (g_disposed) {
     return false; // Can no longer Initialize if Disposed
@@ -133,6 +224,13 @@ bool V8::Initialize() {
     return false;
   }
 #endif
+  if (g_jitThreadCount != 0 &&
+      JsSetBackgroundJitThreadCount(g_jitThreadCount) != JsNoError) {
+    return false;
+  }
+  if (g_jitProfileCache) {
+    EnableJitProfileCache();
+  }
   return true;
 }
 
@@ -305,6 +305,19 @@ Buffer.compare = function compare(a, b) {
 };
 
 
+Buffer.parseJSON = function parseJSON(buffer, reviver) {
+  if (!(buffer instanceof Buffer))
+    throw new TypeError('Argument must be a Buffer');
+
+  // The native parser has no reviver support; a reviver has to see every
+  // value anyway, so decoding the text first costs comparatively little.
+  if (binding.parseJSON === undefined || typeof reviver === 'function')
+    return JSON.parse(buffer.toString('utf8'), reviver);
+
+  return binding.parseJSON(buffer);
+};
+
+
 Buffer.isEncoding = function(encoding) {
   var loweredCase = false;
   for (;;) {
@@ -73,3 +73,29 @@ exports.getHeapSpaceStatistics = function() {
 
   return heapSpaceStatistics;
 };
+
+if (v8binding.getFunctionTelemetry) {
+  const functionTelemetrySortKeys = {
+    bailouts: v8binding.JsFunctionTelemetryBailOuts,
+    rejits: v8binding.JsFunctionTelemetryRejits,
+    interpretedCalls: v8binding.JsFunctionTelemetryInterpretedCalls,
+    polymorphicSites: v8binding.JsFunctionTelemetryPolymorphicSites
+  };
+
+  exports.getFunctionTelemetry = function(options) {
+    options = options || {};
+    const sortBy = options.sortBy === undefined ? 'bailouts' : options.sortBy;
+    const count = options.count === undefined ? 20 : options.count;
+
+    if (!functionTelemetrySortKeys.hasOwnProperty(sortBy))
+      throw new TypeError('sortBy must be one of: ' +
+                          Object.keys(functionTelemetrySortKeys).join(', '));
+    if (!Number.isInteger(count) || count < 1 || count > 1000)
+      throw new RangeError('count must be an integer between 1 and 1000');
+
+    return v8binding.getFunctionTelemetry(functionTelemetrySortKeys[sortBy],
+                                          count);
+  };
+
+  exports.getPropertyCacheStatistics = v8binding.getPropertyCacheStatistics;
+}
@@ -1165,6 +1165,23 @@ void Swap32(const FunctionCallbackInfo<Value>& args) {
   args.GetReturnValue().Set(args.This());
 }
 
+#if defined(NODE_ENGINE_CHAKRACORE)
+// Parses the contents of a Buffer as UTF-8 encoded JSON text. The engine
+// decodes it once, straight into the string its parser reads.
+void ParseJSON(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  THROW_AND_RETURN_UNLESS_BUFFER(env, args[0]);
+  SPREAD_ARG(args[0], ts_obj);
+
+  Local<Value> result;
+  if (v8::JSON::ParseUtf8(env->isolate(), ts_obj_data, ts_obj_length)
+          .ToLocal(&result)) {
+    args.GetReturnValue().Set(result);
+  }
+}
+#endif  // NODE_ENGINE_CHAKRACORE
+
 // pass Buffer object to load prototype methods
 void SetupBufferJS(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
@@ -1221,6 +1238,10 @@ void Initialize(Local<Object> target,
   env->SetMethod(target, "indexOfNumber", IndexOfNumber);
   env->SetMethod(target, "indexOfString", IndexOfString);
 
+#if defined(NODE_ENGINE_CHAKRACORE)
+  env->SetMethod(target, "parseJSON", ParseJSON);
+#endif
+
   env->SetMethod(target, "readDoubleBE", ReadDoubleBE);
   env->SetMethod(target, "readDoubleLE", ReadDoubleLE);
   env->SetMethod(target, "readFloatBE", ReadFloatBE);
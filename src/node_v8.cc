@@ -5,6 +5,11 @@
 #include "util-inl.h"
 #include "v8.h"
 
+#if defined(NODE_ENGINE_CHAKRACORE)
+#include <string>
+#include <vector>
+#endif
+
 namespace node {
 
 using v8::Array;
@@ -17,6 +22,7 @@ using v8::HeapStatistics;
 using v8::Isolate;
 using v8::Local;
 using v8::NewStringType;
+using v8::Number;
 using v8::Object;
 using v8::String;
 using v8::Uint32;
@@ -93,6 +99,141 @@ void SetFlagsFromString(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+#if defined(NODE_ENGINE_CHAKRACORE)
+struct FunctionTelemetry {
+  std::wstring name;
+  std::wstring url;
+  unsigned int line;
+  unsigned int column;
+  unsigned int bailouts;
+  unsigned int rejits;
+  std::string last_rejit_reason;
+  unsigned int interpreted_calls;
+  unsigned int polymorphic_sites;
+  unsigned int megamorphic_sites;
+};
+
+
+// The strings passed in are only valid during the callback, and nothing may
+// be allocated on the JS heap until it returns, so copy everything out first.
+static void CALLBACK CopyFunctionTelemetry(const JsFunctionTelemetry* functions,
+                                           unsigned int count,
+                                           void* state) {
+  std::vector<FunctionTelemetry>* result =
+      static_cast<std::vector<FunctionTelemetry>*>(state);
+  for (unsigned int i = 0; i < count; i++) {
+    const JsFunctionTelemetry& f = functions[i];
+    FunctionTelemetry entry;
+    entry.name = f.functionName;
+    entry.url = f.url;
+    entry.line = f.line;
+    entry.column = f.column;
+    entry.bailouts = f.bailOutCount;
+    entry.rejits = f.rejitCount;
+    entry.last_rejit_reason = f.lastRejitReason;
+    entry.interpreted_calls = f.interpretedCallCount;
+    entry.polymorphic_sites = f.polymorphicSiteCount;
+    entry.megamorphic_sites = f.megamorphicSiteCount;
+    result->push_back(entry);
+  }
+}
+
+
+static JsRuntimeHandle GetCurrentRuntime() {
+  JsContextRef context;
+  JsRuntimeHandle runtime;
+  if (JsGetCurrentContext(&context) != JsNoError ||
+      JsGetRuntime(context, &runtime) != JsNoError) {
+    return JS_INVALID_RUNTIME_HANDLE;
+  }
+  return runtime;
+}
+
+
+static Local<String> WideString(Isolate* isolate, const std::wstring& str) {
+  return String::NewFromTwoByte(isolate,
+                                reinterpret_cast<const uint16_t*>(str.c_str()),
+                                NewStringType::kNormal,
+                                static_cast<int>(str.length()))
+      .ToLocalChecked();
+}
+
+
+void GetFunctionTelemetry(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
+
+  CHECK(args[0]->IsUint32());
+  CHECK(args[1]->IsUint32());
+
+  std::vector<FunctionTelemetry> functions;
+  JsErrorCode error = JsGetRuntimeFunctionTelemetry(
+      GetCurrentRuntime(),
+      static_cast<JsFunctionTelemetryKind>(args[0]->Uint32Value()),
+      args[1]->Uint32Value(),
+      CopyFunctionTelemetry,
+      &functions);
+  if (error == JsErrorInvalidArgument)
+    return env->ThrowRangeError("invalid sortBy or count");
+  if (error != JsNoError)
+    return env->ThrowError("failed to get function telemetry");
+
+  Local<Array> result = Array::New(isolate, static_cast<int>(functions.size()));
+  for (size_t i = 0; i < functions.size(); i++) {
+    const FunctionTelemetry& f = functions[i];
+    Local<Object> entry = Object::New(isolate);
+    entry->Set(FIXED_ONE_BYTE_STRING(isolate, "name"),
+               WideString(isolate, f.name));
+    entry->Set(FIXED_ONE_BYTE_STRING(isolate, "url"),
+               WideString(isolate, f.url));
+    entry->Set(FIXED_ONE_BYTE_STRING(isolate, "line"),
+               Uint32::NewFromUnsigned(isolate, f.line));
+    entry->Set(FIXED_ONE_BYTE_STRING(isolate, "column"),
+               Uint32::NewFromUnsigned(isolate, f.column));
+    entry->Set(FIXED_ONE_BYTE_STRING(isolate, "bailouts"),
+               Uint32::NewFromUnsigned(isolate, f.bailouts));
+    entry->Set(FIXED_ONE_BYTE_STRING(isolate, "rejits"),
+               Uint32::NewFromUnsigned(isolate, f.rejits));
+    entry->Set(FIXED_ONE_BYTE_STRING(isolate, "lastRejitReason"),
+               OneByteString(isolate, f.last_rejit_reason.c_str()));
+    entry->Set(FIXED_ONE_BYTE_STRING(isolate, "interpretedCalls"),
+               Uint32::NewFromUnsigned(isolate, f.interpreted_calls));
+    entry->Set(FIXED_ONE_BYTE_STRING(isolate, "polymorphicSites"),
+               Uint32::NewFromUnsigned(isolate, f.polymorphic_sites));
+    entry->Set(FIXED_ONE_BYTE_STRING(isolate, "megamorphicSites"),
+               Uint32::NewFromUnsigned(isolate, f.megamorphic_sites));
+    result->Set(i, entry);
+  }
+  args.GetReturnValue().Set(result);
+}
+
+
+void GetPropertyCacheStatistics(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
+
+  JsPropertyCacheStatistics s;
+  if (JsGetRuntimePropertyCacheStatistics(GetCurrentRuntime(), &s) !=
+      JsNoError) {
+    return env->ThrowError("failed to get property cache statistics");
+  }
+
+  Local<Object> result = Object::New(isolate);
+  result->Set(FIXED_ONE_BYTE_STRING(isolate, "loadHits"),
+              Number::New(isolate, static_cast<double>(s.loadHits)));
+  result->Set(FIXED_ONE_BYTE_STRING(isolate, "loadMisses"),
+              Number::New(isolate, static_cast<double>(s.loadMisses)));
+  result->Set(FIXED_ONE_BYTE_STRING(isolate, "storeHits"),
+              Number::New(isolate, static_cast<double>(s.storeHits)));
+  result->Set(FIXED_ONE_BYTE_STRING(isolate, "storeMisses"),
+              Number::New(isolate, static_cast<double>(s.storeMisses)));
+  result->Set(FIXED_ONE_BYTE_STRING(isolate, "entriesCached"),
+              Number::New(isolate, static_cast<double>(s.entriesCached)));
+  args.GetReturnValue().Set(result);
+}
+#endif  // NODE_ENGINE_CHAKRACORE
+
+
 void InitializeV8Bindings(Local<Object> target,
                           Local<Value> unused,
                           Local<Context> context) {
@@ -169,6 +310,23 @@ void InitializeV8Bindings(Local<Object> target,
 #undef V
 
   env->SetMethod(target, "setFlagsFromString", SetFlagsFromString);
+
+#if defined(NODE_ENGINE_CHAKRACORE)
+  env->SetMethod(target, "getFunctionTelemetry", GetFunctionTelemetry);
+  env->SetMethod(target,
+                 "getPropertyCacheStatistics",
+                 GetPropertyCacheStatistics);
+
+#define V(name)                                                               \
+  target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), #name),                   \
+              Uint32::NewFromUnsigned(env->isolate(), name));
+
+  V(JsFunctionTelemetryBailOuts)
+  V(JsFunctionTelemetryRejits)
+  V(JsFunctionTelemetryInterpretedCalls)
+  V(JsFunctionTelemetryPolymorphicSites)
+#undef V
+#endif
 }
 
 }  // namespace node
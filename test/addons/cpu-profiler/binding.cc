@@ -0,0 +1,104 @@
+#include "node.h"
+#include "v8.h"
+#include "v8-profiler.h"
+
+namespace {
+
+inline v8::Local<v8::String> Str(v8::Isolate* isolate, const char* s) {
+  return v8::String::NewFromUtf8(isolate, s);
+}
+
+v8::Local<v8::Object> NodeToObject(v8::Isolate* isolate,
+                                   const v8::CpuProfileNode* node) {
+  v8::Local<v8::Object> result = v8::Object::New(isolate);
+  result->Set(Str(isolate, "functionName"), node->GetFunctionName());
+  result->Set(Str(isolate, "url"), node->GetScriptResourceName());
+  result->Set(Str(isolate, "lineNumber"),
+              v8::Integer::New(isolate, node->GetLineNumber()));
+  result->Set(Str(isolate, "hitCount"),
+              v8::Integer::NewFromUnsigned(isolate, node->GetHitCount()));
+  result->Set(Str(isolate, "id"),
+              v8::Integer::NewFromUnsigned(isolate, node->GetNodeId()));
+  result->Set(Str(isolate, "bailoutReason"),
+              Str(isolate, node->GetBailoutReason()));
+
+  const unsigned int lineCount = node->GetHitLineCount();
+  v8::Local<v8::Array> lineTicks = v8::Array::New(isolate, lineCount);
+  if (lineCount != 0) {
+    v8::CpuProfileNode::LineTick* entries =
+        new v8::CpuProfileNode::LineTick[lineCount];
+    if (node->GetLineTicks(entries, lineCount)) {
+      for (unsigned int i = 0; i < lineCount; i++) {
+        v8::Local<v8::Object> entry = v8::Object::New(isolate);
+        entry->Set(Str(isolate, "line"),
+                   v8::Integer::New(isolate, entries[i].line));
+        entry->Set(Str(isolate, "hitCount"),
+                   v8::Integer::NewFromUnsigned(isolate, entries[i].hit_count));
+        lineTicks->Set(i, entry);
+      }
+    }
+    delete[] entries;
+  }
+  result->Set(Str(isolate, "lineTicks"), lineTicks);
+
+  const int childCount = node->GetChildrenCount();
+  v8::Local<v8::Array> children = v8::Array::New(isolate, childCount);
+  for (int i = 0; i < childCount; i++) {
+    children->Set(i, NodeToObject(isolate, node->GetChild(i)));
+  }
+  result->Set(Str(isolate, "children"), children);
+  return result;
+}
+
+// profile(title, fn) runs fn while recording a profile with samples and
+// returns the profile as a plain object.
+inline void Profile(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  v8::Isolate* const isolate = args.GetIsolate();
+  v8::Local<v8::String> title = args[0].As<v8::String>();
+  v8::Local<v8::Function> fn = args[1].As<v8::Function>();
+
+  v8::CpuProfiler* const profiler = isolate->GetCpuProfiler();
+  profiler->SetSamplingInterval(1000);
+  profiler->StartProfiling(title, true);
+  fn->Call(isolate->GetCurrentContext()->Global(), 0, nullptr);
+  v8::CpuProfile* const profile = profiler->StopProfiling(title);
+  if (profile == nullptr) {
+    return;
+  }
+
+  v8::Local<v8::Object> result = v8::Object::New(isolate);
+  result->Set(Str(isolate, "title"), profile->GetTitle());
+  result->Set(Str(isolate, "startTime"),
+              v8::Number::New(isolate,
+                              static_cast<double>(profile->GetStartTime())));
+  result->Set(Str(isolate, "endTime"),
+              v8::Number::New(isolate,
+                              static_cast<double>(profile->GetEndTime())));
+  result->Set(Str(isolate, "head"),
+              NodeToObject(isolate, profile->GetTopDownRoot()));
+
+  const int sampleCount = profile->GetSamplesCount();
+  v8::Local<v8::Array> samples = v8::Array::New(isolate, sampleCount);
+  v8::Local<v8::Array> timestamps = v8::Array::New(isolate, sampleCount);
+  for (int i = 0; i < sampleCount; i++) {
+    samples->Set(i, v8::Integer::NewFromUnsigned(
+        isolate, profile->GetSample(i)->GetNodeId()));
+    timestamps->Set(i, v8::Number::New(
+        isolate, static_cast<double>(profile->GetSampleTimestamp(i))));
+  }
+  result->Set(Str(isolate, "samples"), samples);
+  result->Set(Str(isolate, "timestamps"), timestamps);
+
+  profile->Delete();
+  args.GetReturnValue().Set(result);
+}
+
+inline void Initialize(v8::Local<v8::Object> binding) {
+  v8::Isolate* const isolate = binding->GetIsolate();
+  binding->Set(Str(isolate, "profile"),
+               v8::FunctionTemplate::New(isolate, Profile)->GetFunction());
+}
+
+NODE_MODULE(binding, Initialize)
+
+}  // anonymous namespace
@@ -0,0 +1,64 @@
+'use strict';
+
+require('../../common');
+const assert = require('assert');
+const binding = require('./build/Release/binding');
+
+function hot() {
+  let sum = 0;
+  const end = Date.now() + 200;
+  while (Date.now() < end) {
+    for (let i = 0; i < 1000; i++)
+      sum += i % 7;
+  }
+  return sum;
+}
+
+function run() {
+  return hot();
+}
+
+const profile = binding.profile('test', run);
+assert.strictEqual(profile.title, 'test');
+assert(profile.endTime >= profile.startTime);
+
+const nodes = new Map();
+(function walk(node) {
+  assert.strictEqual(typeof node.bailoutReason, 'string');
+  assert(!nodes.has(node.id), 'node ids are unique');
+  nodes.set(node.id, node);
+  node.children.forEach(walk);
+})(profile.head);
+
+// The loop in hot() runs for 200ms, which is many sampling intervals.
+const hotNode = Array.from(nodes.values()).find((node) => {
+  return node.functionName === 'hot';
+});
+assert(hotNode, 'hot() is in the profile');
+assert(hotNode.hitCount > 0);
+assert(/test\.js$/.test(hotNode.url));
+
+// Line ticks fall inside hot(), and add up to at most its hits.
+let lineHits = 0;
+hotNode.lineTicks.forEach((tick) => {
+  assert(tick.line >= hotNode.lineNumber);
+  assert(tick.line < hotNode.lineNumber + 9);
+  lineHits += tick.hitCount;
+});
+assert(lineHits <= hotNode.hitCount);
+
+// Every sample names a node of the tree, and there is one sample per hit.
+let totalHits = 0;
+nodes.forEach((node) => { totalHits += node.hitCount; });
+assert.strictEqual(profile.samples.length, totalHits);
+assert.strictEqual(profile.timestamps.length, profile.samples.length);
+profile.samples.forEach((id, i) => {
+  assert(nodes.has(id));
+  if (i > 0)
+    assert(profile.timestamps[i] >= profile.timestamps[i - 1]);
+});
+
+// A profile that is stopped before any sample is taken still has a root.
+const empty = binding.profile('empty', function() {});
+assert.strictEqual(empty.head.functionName, '(root)');
+assert.strictEqual(empty.samples.length, empty.timestamps.length);
@@ -0,0 +1,46 @@
+#include "node.h"
+#include "v8.h"
+
+namespace {
+
+inline void Enqueue(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  args.GetIsolate()->EnqueueMicrotask(args[0].As<v8::Function>());
+}
+
+inline void Run(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  args.GetIsolate()->RunMicrotasks();
+}
+
+// Queues tasks in a context of their own that nothing ever drains, so that
+// they are still queued when the context goes away.
+inline void EnqueueInNewContext(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  v8::Isolate* const isolate = args.GetIsolate();
+  const int count =
+      args[0]->Int32Value(isolate->GetCurrentContext()).FromJust();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+  v8::Local<v8::String> source =
+      v8::String::NewFromUtf8(isolate, "(function() { return [1, 2, 3]; })");
+  v8::Local<v8::Function> task = v8::Script::Compile(context, source)
+      .ToLocalChecked()->Run(context).ToLocalChecked().As<v8::Function>();
+  for (int i = 0; i < count; i++) {
+    isolate->EnqueueMicrotask(task);
+  }
+}
+
+inline void Initialize(v8::Local<v8::Object> binding) {
+  v8::Isolate* const isolate = binding->GetIsolate();
+  binding->Set(v8::String::NewFromUtf8(isolate, "enqueue"),
+               v8::FunctionTemplate::New(isolate, Enqueue)->GetFunction());
+  binding->Set(v8::String::NewFromUtf8(isolate, "run"),
+               v8::FunctionTemplate::New(isolate, Run)->GetFunction());
+  binding->Set(v8::String::NewFromUtf8(isolate, "enqueueInNewContext"),
+               v8::FunctionTemplate::New(isolate,
+                                         EnqueueInNewContext)->GetFunction());
+}
+
+NODE_MODULE(binding, Initialize)
+
+}  // anonymous namespace
@@ -0,0 +1,26 @@
+'use strict';
+
+const common = require('../../common');
+const assert = require('assert');
+const binding = require('./build/Release/binding');
+
+// Tasks run in order, including the ones queued while the queue runs, and an
+// exception from one task does not keep the others from running. The
+// exception is dropped, not reported as uncaught.
+const order = [];
+process.on('uncaughtException', common.fail);
+
+binding.enqueue(function() { order.push('first'); });
+binding.enqueue(function() {
+  binding.enqueue(function() { order.push('queued while running'); });
+  throw new Error('from a microtask');
+});
+binding.enqueue(function() { order.push('last'); });
+binding.run();
+process.removeListener('uncaughtException', common.fail);
+
+assert.deepStrictEqual(order, ['first', 'last', 'queued while running']);
+
+// Tasks still queued in a context that nothing drains are released when the
+// context goes away, at the latest when the isolate is disposed on exit.
+binding.enqueueInNewContext(100);
@@ -0,0 +1,72 @@
+#include "node.h"
+#include "node_buffer.h"
+#include "v8.h"
+
+#include <vector>
+
+namespace {
+
+// The sentinel shows which units or bytes of the buffer were not written.
+const uint16_t kUnwritten16 = 0xFFFF;
+const char kUnwritten8 = '\xFF';
+
+inline int Options(const v8::FunctionCallbackInfo<v8::Value>& args,
+                   int index) {
+  return args[index]->IsTrue() ? v8::String::NO_NULL_TERMINATION
+                               : v8::String::NO_OPTIONS;
+}
+
+// write(string, start, length, noNullTermination) returns the result of
+// String::Write followed by the length + 1 units of the buffer.
+inline void Write(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  v8::Isolate* const isolate = args.GetIsolate();
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  const int start = args[1]->Int32Value(context).FromJust();
+  const int length = args[2]->Int32Value(context).FromJust();
+  std::vector<uint16_t> buffer(length + 1, kUnwritten16);
+
+  const int result = args[0].As<v8::String>()->Write(
+      buffer.data(), start, length, Options(args, 3));
+
+  v8::Local<v8::Array> array = v8::Array::New(isolate);
+  array->Set(0, v8::Integer::New(isolate, result));
+  for (size_t i = 0; i < buffer.size(); i++) {
+    array->Set(static_cast<uint32_t>(i + 1),
+               v8::Integer::New(isolate, buffer[i]));
+  }
+  args.GetReturnValue().Set(array);
+}
+
+// writeUtf8(string, capacity, noNullTermination) returns the result of
+// String::WriteUtf8, the characters it reports and the capacity + 1 bytes
+// of the buffer.
+inline void WriteUtf8(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  v8::Isolate* const isolate = args.GetIsolate();
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  const int capacity = args[1]->Int32Value(context).FromJust();
+  std::vector<char> buffer(capacity + 1, kUnwritten8);
+
+  int chars = -1;
+  const int result = args[0].As<v8::String>()->WriteUtf8(
+      buffer.data(), capacity, &chars,
+      Options(args, 2) | v8::String::REPLACE_INVALID_UTF8);
+
+  v8::Local<v8::Array> array = v8::Array::New(isolate);
+  array->Set(0, v8::Integer::New(isolate, result));
+  array->Set(1, v8::Integer::New(isolate, chars));
+  array->Set(2, node::Buffer::Copy(isolate, buffer.data(), buffer.size())
+      .ToLocalChecked());
+  args.GetReturnValue().Set(array);
+}
+
+inline void Initialize(v8::Local<v8::Object> binding) {
+  v8::Isolate* const isolate = binding->GetIsolate();
+  binding->Set(v8::String::NewFromUtf8(isolate, "write"),
+               v8::FunctionTemplate::New(isolate, Write)->GetFunction());
+  binding->Set(v8::String::NewFromUtf8(isolate, "writeUtf8"),
+               v8::FunctionTemplate::New(isolate, WriteUtf8)->GetFunction());
+}
+
+NODE_MODULE(binding, Initialize)
+
+}  // anonymous namespace
@@ -0,0 +1,166 @@
+'use strict';
+
+const common = require('../../common');
+const assert = require('assert');
+const binding = require('./build/Release/binding');
+
+// String::Write and String::WriteUtf8 of strings built by concatenation give
+// the same results as they do for flat strings with the same contents, for
+// any part of the string and any buffer size. Each string is built afresh
+// for every check, since reading its characters from script could flatten it.
+
+const kUnwritten16 = 0xFFFF;
+const kUnwritten8 = 0xFF;
+
+function join(parts) {
+  let result = '';
+  for (const part of parts)
+    result = result + part;
+  return result;
+}
+
+function append(parts) {
+  let result = parts[0];
+  for (let i = 1; i < parts.length; i++)
+    result += parts[i];
+  return result;
+}
+
+// Concatenates the halves of the parts, which nests deeper than the copy of
+// a string tree recurses
+function balanced(parts) {
+  if (parts.length === 1)
+    return parts[0];
+  const half = parts.length >> 1;
+  return balanced(parts.slice(0, half)) + balanced(parts.slice(half));
+}
+
+const parts = {
+  ascii: ['<p>', 'hello', ' ', 'world', '</p>', '\n'],
+  twoAndThreeBytes: ['caf', 'é', ' ', '€', '5', 'é€'],
+  surrogatePairs: ['a', '😀', 'b', '🎉😀', 'c'],
+  splitPairs: ['a\ud83d', '\ude00b', '\ud83c', '\udf89', 'c'],
+  loneSurrogates: ['\udc00', 'a\ud800', 'b', '\ud800', '𐀀', '\ud800'],
+  longParts: [],
+};
+for (let i = 0; i < 40; i++)
+  parts.longParts.push(i % 3 ? 'part' + i + 'é' : '😀' + i);
+
+// The contents of a built string, as a flat string
+function flat(build, partList) {
+  return JSON.parse(JSON.stringify(build(partList)));
+}
+
+// UTF-8 of the whole characters that fit in capacity bytes. Unpaired
+// surrogates are encoded as U+FFFD.
+function encode(string, capacity) {
+  const bytes = [];
+  let units = 0;
+  while (units < string.length) {
+    let codePoint = string.codePointAt(units);
+    const size = codePoint > 0xFFFF ? 2 : 1;
+    if (codePoint >= 0xD800 && codePoint <= 0xDFFF)
+      codePoint = 0xFFFD;
+
+    let encoded;
+    if (codePoint < 0x80) {
+      encoded = [codePoint];
+    } else if (codePoint < 0x800) {
+      encoded = [0xC0 | codePoint >> 6, 0x80 | codePoint & 0x3F];
+    } else if (codePoint < 0x10000) {
+      encoded = [0xE0 | codePoint >> 12, 0x80 | codePoint >> 6 & 0x3F,
+                 0x80 | codePoint & 0x3F];
+    } else {
+      encoded = [0xF0 | codePoint >> 18, 0x80 | codePoint >> 12 & 0x3F,
+                 0x80 | codePoint >> 6 & 0x3F, 0x80 | codePoint & 0x3F];
+    }
+    if (bytes.length + encoded.length > capacity)
+      break;
+    bytes.push.apply(bytes, encoded);
+    units += size;
+  }
+  return { bytes: bytes, units: units };
+}
+
+function checkWriteUtf8(description, build, partList) {
+  const string = flat(build, partList);
+  const fullSize = encode(string, Infinity).bytes.length;
+  for (let capacity = 1; capacity <= fullSize + 2; capacity++) {
+    const expected = encode(string, capacity);
+    const what = `${description}, ${capacity} bytes`;
+
+    let [result, chars, buffer] =
+        binding.writeUtf8(build(partList), capacity, true);
+    assert.strictEqual(result, expected.bytes.length, what);
+    assert.strictEqual(chars, expected.units, what);
+    assert.deepStrictEqual(Array.from(buffer.slice(0, result)),
+                           expected.bytes, what);
+    for (let i = result; i < buffer.length; i++)
+      assert.strictEqual(buffer[i], kUnwritten8, `${what}, byte ${i}`);
+
+    // The terminator is written when there is room after the whole string
+    if (capacity > fullSize) {
+      [result, chars, buffer] = binding.writeUtf8(build(partList), capacity);
+      assert.strictEqual(result, fullSize + 1, `${what}, terminated`);
+      assert.strictEqual(buffer[fullSize], 0, `${what}, terminated`);
+      assert.deepStrictEqual(Array.from(buffer.slice(0, fullSize)),
+                             expected.bytes, `${what}, terminated`);
+    }
+  }
+}
+
+function checkWrite(description, build, partList) {
+  const string = flat(build, partList);
+  const step = string.length > 50 ? 7 : 1;
+  for (let start = 0; start <= string.length; start += step) {
+    for (let length = 1; length <= string.length - start + 2;
+         length += step) {
+      const expected = string.slice(start, start + length);
+      const what = `${description}, ${length} units from ${start}`;
+
+      let written = binding.write(build(partList), start, length, true);
+      const result = written.shift();
+      assert.strictEqual(result, expected.length, what);
+      assert.strictEqual(String.fromCharCode.apply(null,
+                                                   written.slice(0, result)),
+                         expected, what);
+      for (let i = result; i < written.length; i++)
+        assert.strictEqual(written[i], kUnwritten16, `${what}, unit ${i}`);
+
+      if (expected.length < length) {
+        written = binding.write(build(partList), start, length);
+        assert.strictEqual(written[1 + expected.length], 0,
+                           `${what}, terminated`);
+      }
+    }
+  }
+}
+
+const builds = { join: join, append: append, balanced: balanced };
+for (const name of Object.keys(parts)) {
+  for (const buildName of Object.keys(builds)) {
+    const build = builds[buildName];
+    checkWriteUtf8(`${name} by ${buildName}`, build, parts[name]);
+    checkWrite(`${name} by ${buildName}`, build, parts[name]);
+  }
+  // The flat string itself
+  const flatString = () => flat(join, parts[name]);
+  checkWriteUtf8(`${name} flat`, flatString, []);
+  checkWrite(`${name} flat`, flatString, []);
+}
+
+// A string that is empty writes only the terminator, and counts nothing.
+// V8 counts the terminator that String::WriteUtf8 writes.
+let [result, chars, buffer] = binding.writeUtf8('', 4);
+assert.strictEqual(result, common.isChakraEngine ? 0 : 1);
+assert.strictEqual(chars, 0);
+assert.strictEqual(buffer[0], 0);
+assert.strictEqual(buffer[1], kUnwritten8);
+[result, chars, buffer] = binding.writeUtf8(join(['', '']), 4, true);
+assert.strictEqual(result, 0);
+assert.strictEqual(buffer[0], kUnwritten8);
+
+const written = binding.write('', 0, 4);
+assert.strictEqual(written[0], 0);
+assert.strictEqual(written[1], 0);
+assert.strictEqual(written[2], kUnwritten16);
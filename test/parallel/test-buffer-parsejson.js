@@ -0,0 +1,52 @@
+'use strict';
+require('../common');
+const assert = require('assert');
+
+const values = [
+  {},
+  [],
+  { a: [1, 2.5, -3e-7, true, false, null], b: { c: 'd' } },
+  'a "quoted" string with \\ and \n escapes',
+  'non-ASCII: été 中文 😀',
+  42,
+  null
+];
+
+for (const value of values) {
+  const json = JSON.stringify(value);
+  assert.deepStrictEqual(Buffer.parseJSON(Buffer.from(json)), value);
+}
+
+// Objects with the same keys, as a parser caching their shapes would see them.
+const rows = [];
+for (let i = 0; i < 100; i++)
+  rows.push({ id: i, name: 'row' + i, tags: ['x', 'y'], nested: { id: i } });
+assert.deepStrictEqual(Buffer.parseJSON(Buffer.from(JSON.stringify(rows))),
+                       rows);
+
+// Slices parse only their own bytes.
+const padded = Buffer.from('xx[1,2]yy');
+assert.deepStrictEqual(Buffer.parseJSON(padded.slice(2, 7)), [1, 2]);
+
+// Whitespace around the value is allowed.
+assert.deepStrictEqual(Buffer.parseJSON(Buffer.from(' \t\n{"a":1}\r\n')),
+                       { a: 1 });
+
+// Invalid UTF-8 decodes the same way as buf.toString() does.
+const invalid = Buffer.from([0x22, 0xff, 0x61, 0x22]);
+assert.strictEqual(Buffer.parseJSON(invalid),
+                   JSON.parse(invalid.toString('utf8')));
+
+// The reviver is applied exactly as with JSON.parse().
+assert.deepStrictEqual(
+  Buffer.parseJSON(Buffer.from('{"a":1,"b":[2,3]}'), function(key, value) {
+    return typeof value === 'number' ? value * 10 : value;
+  }),
+  { a: 10, b: [20, 30] });
+
+for (const text of ['', '{', '[1,]', '{"a" 1}', 'undefined', '\ufeff{}']) {
+  assert.throws(() => Buffer.parseJSON(Buffer.from(text)), SyntaxError);
+}
+
+assert.throws(() => Buffer.parseJSON('{}'), TypeError);
+assert.throws(() => Buffer.parseJSON(new Uint8Array(2)), TypeError);
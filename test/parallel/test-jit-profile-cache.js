@@ -0,0 +1,83 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const cp = require('child_process');
+const fs = require('fs');
+const path = require('path');
+
+if (!common.isChakraEngine) {
+  console.log('1..0 # Skipped: --jit-profile-cache is ChakraCore only');
+  return;
+}
+
+common.refreshTmpDir();
+const cacheDir = path.join(common.tmpDir, 'profiles');
+fs.mkdirSync(cacheDir);
+const script = path.join(common.tmpDir, 'hot.js');
+
+// Enough hot functions for the profiles to be worth saving, with shapes that
+// a stale profile would get wrong.
+function writeScript(property) {
+  const lines = [];
+  for (let f = 0; f < 8; f++) {
+    lines.push(`function f${f}(o) { return o.${property} + ${f}; }`);
+  }
+  lines.push('let sum = 0;');
+  lines.push('for (let i = 0; i < 20000; i++) {');
+  lines.push(`  const o = { ${property}: i };`);
+  for (let f = 0; f < 8; f++) {
+    lines.push(`  sum += f${f}(o);`);
+  }
+  lines.push('}');
+  lines.push('console.log(sum);');
+  fs.writeFileSync(script, lines.join('\n'));
+}
+
+// Runs the script and returns its output. With the cache, the engine reports
+// on stderr which profiles it loaded and which functions it compiled with the
+// optimizing JIT right away because of them.
+function run(flag) {
+  const args = flag ? [flag, '--trace-jit-profile-cache', script] : [script];
+  const child = cp.spawnSync(process.execPath, args);
+  assert.strictEqual(child.status, 0, child.stderr.toString());
+  return { output: child.stdout.toString(), report: child.stderr.toString() };
+}
+
+function loadedProfile(report) {
+  return /Loaded profile for '.*hot\.js#/.test(report);
+}
+
+writeScript('x');
+const expected = run().output;
+
+// The first run writes the catalog and the profiles, the second one loads
+// them, goes to full JIT right away for the hot functions, and must compute
+// the same.
+const flag = `--jit-profile-cache=${cacheDir}`;
+let result = run(flag);
+assert.strictEqual(result.output, expected);
+assert(!loadedProfile(result.report), result.report);
+const files = fs.readdirSync(cacheDir);
+assert(files.indexOf('jsdpcache_master.dpc') !== -1, files.join());
+assert(files.some((file) => /\.dpd$/.test(file)), files.join());
+
+result = run(flag);
+assert.strictEqual(result.output, expected);
+assert(loadedProfile(result.report), result.report);
+for (let f = 0; f < 8; f++) {
+  assert(result.report.indexOf(`first call of 'f${f}'`) !== -1,
+         `f${f} did not use its profile: ${result.report}`);
+}
+
+// An edited script hashes differently, so it does not pick up the profiles of
+// the old text.
+writeScript('y');
+result = run(flag);
+assert.strictEqual(result.output, run().output);
+assert(!loadedProfile(result.report), result.report);
+
+// A cache that cannot be set up is ignored.
+const notADirectory = path.join(common.tmpDir, 'file');
+fs.writeFileSync(notADirectory, '');
+assert.strictEqual(run(`--jit-profile-cache=${notADirectory}`).output,
+                   run().output);
@@ -0,0 +1,56 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const cp = require('child_process');
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+
+if (!common.isChakraEngine) {
+  console.log('1..0 # Skipped: the JS: and RegExp: perf map entries are ' +
+              'ChakraCore only');
+  return;
+}
+
+// A hot function, a hot loop and a hot regex without backtracking, which are
+// compiled to machine code and written to perf-<pid>.map in the temp directory
+// when the map is enabled.
+const script = `
+  function hotFunction(i) { return i * 2 + 1; }
+  let sum = 0;
+  for (let i = 0; i < 100000; i++) {
+    sum += hotFunction(i);
+  }
+  const re = /abc/;
+  for (let i = 0; i < 1000; i++) {
+    re.test('xxabcxx');
+  }
+  console.log(sum);
+`;
+
+function run(flags) {
+  const child = cp.spawnSync(process.execPath, flags.concat(['-e', script]));
+  assert.strictEqual(child.status, 0, child.stderr.toString());
+  assert.strictEqual(child.stdout.toString().trim(), '10000000000');
+  return path.join(os.tmpdir(), `perf-${child.pid}.map`);
+}
+
+const mapFile = run(['--perf-basic-prof']);
+const lines = fs.readFileSync(mapFile, 'utf8').split('\n');
+fs.unlinkSync(mapFile);
+
+// Every line is '<start> <size> <name>', and the file ends with a newline
+// once the engine has closed it.
+assert.strictEqual(lines.pop(), '');
+lines.forEach(function(line) {
+  assert(/^[0-9a-f]+ [0-9a-f]+ \S/.test(line), line);
+});
+assert(lines.some((line) => / JS:[*~]hotFunction /.test(line)),
+       'no JIT entry for hotFunction');
+if (process.arch === 'x64') {
+  assert(lines.some((line) => / RegExp:\/abc\/$/.test(line)),
+         'no entry for the compiled regex');
+}
+
+// Without the flag there is no map.
+assert(!common.fileExists(run([])), 'a map was written without the flag');
@@ -0,0 +1,63 @@
+'use strict';
+var common = require('../common');
+var assert = require('assert');
+var v8 = require('v8');
+
+if (!common.isChakraEngine) {
+  assert.strictEqual(v8.getFunctionTelemetry, undefined);
+  return;
+}
+
+function shapes(o) {
+  return o.x;
+}
+
+for (var i = 0; i < 1000; i++) {
+  var o = {};
+  o['p' + (i % 40)] = i;
+  o.x = i;
+  shapes(o);
+}
+
+var keys = [
+  'bailouts',
+  'column',
+  'interpretedCalls',
+  'lastRejitReason',
+  'line',
+  'megamorphicSites',
+  'name',
+  'polymorphicSites',
+  'rejits',
+  'url'];
+
+['bailouts', 'rejits', 'interpretedCalls', 'polymorphicSites'].forEach(
+  function(sortBy) {
+    var functions = v8.getFunctionTelemetry({ sortBy: sortBy, count: 5 });
+    assert(Array.isArray(functions));
+    assert(functions.length <= 5);
+    functions.forEach(function(f, index) {
+      assert.deepEqual(Object.keys(f).sort(), keys);
+      assert(f[sortBy] > 0);
+      if (index > 0)
+        assert(f[sortBy] <= functions[index - 1][sortBy]);
+    });
+  });
+
+var polymorphic = v8.getFunctionTelemetry({ sortBy: 'polymorphicSites' });
+assert(polymorphic.some(function(f) {
+  return f.name === 'shapes' && f.url === __filename;
+}));
+
+assert.throws(function() {
+  v8.getFunctionTelemetry({ sortBy: 'calls' });
+}, TypeError);
+assert.throws(function() {
+  v8.getFunctionTelemetry({ count: 0 });
+}, RangeError);
+
+var s = v8.getPropertyCacheStatistics();
+['loadHits', 'loadMisses', 'storeHits', 'storeMisses', 'entriesCached']
+  .forEach(function(key) {
+    assert.strictEqual(typeof s[key], 'number');
+  });